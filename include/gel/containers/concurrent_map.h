@@ -0,0 +1,921 @@
+// concurrent_map.h
+#ifndef GEL_CONCURRENT_MAP_H
+#define GEL_CONCURRENT_MAP_H
+
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include "gel/gellib.h"
+#include "gel/containers/hash.h"
+#include "gel/containers/imap.h"
+#include "gel/memory/heap_memory.h"
+#include "gel/memory/imemory.h"
+
+namespace gel
+{
+
+namespace cntr
+{
+
+namespace detail
+{
+
+/**
+ * Gets the reader stripe of the calling thread. Threads are given stripes
+ * in turn, so that up to a stripe count of threads never share one.
+ *
+ * @param stripes The number of stripes.
+ * @return        The stripe.
+ */
+inline
+unsigned readerStripe(unsigned stripes)
+{
+    static std::atomic<unsigned> next(0);
+    static thread_local unsigned stripe =
+        next.fetch_add(1, std::memory_order_relaxed);
+    return stripe % stripes;
+}
+
+} // End nspc detail
+
+/**
+ * @brief Defines a hash map that many threads may read while others write.
+ *
+ * Readers never lock and never write to memory that other readers share:
+ * a lookup announces itself in a counter of its own stripe and walks the
+ * chain of its bucket, whose nodes are never changed once they are linked.
+ * Writers serialize on a lock, link new nodes with a single release store
+ * and unlink erased ones without touching the erased node, so a reader that
+ * is on it carries on down the chain.
+ *
+ * Growing is incremental. Once the map is three quarters full a table twice
+ * the size is created, and every following write copies the chains of the
+ * next few buckets into it and marks those buckets as moved, which sends
+ * readers on to the new table. The new table replaces the old one when
+ * every bucket has moved, so no single write pays for the whole resize.
+ *
+ * Unlinked nodes and replaced tables are reclaimed by epochs. A reader
+ * counts itself in the parity of the epoch it starts in, and the epoch only
+ * advances once nobody is counted in the parity of the epoch before the
+ * current one, at which point everything unlinked in that epoch is no
+ * longer reachable and is freed. Reclamation happens during writes and
+ * reclaim(), so it never waits on readers.
+ *
+ * Values are read by copying them out, and a key's value is changed by
+ * erasing and inserting it again.
+ *
+ * @tparam K The type of the keys, which must be equality comparable.
+ * @tparam V The type of the values.
+ * @tparam H The hasher, whose results must agree for keys that compare
+ *           equal.
+ */
+template<typename K, typename V, typename H = Hash<K> >
+class ConcurrentMap: public IMap<K, V>
+{
+  public:
+    /**
+     * The smallest number of buckets.
+     */
+    static const Size MIN_CAPACITY = 16;
+
+    /**
+     * The number of buckets that every write moves while the map grows.
+     */
+    static const Size MIGRATE_STEP = 16;
+
+    /**
+     * The number of reader stripes.
+     */
+    static const unsigned STRIPES = 32;
+
+  private:
+    /**
+     * Defines a key and its value.
+     */
+    struct Node
+    {
+        /**
+         * The hash of the key.
+         */
+        uint64 hash;
+
+        /**
+         * The next node of the bucket.
+         */
+        std::atomic<Node*> next;
+
+        /**
+         * The next node that is waiting to be freed.
+         */
+        Node* retired;
+
+        /**
+         * The key.
+         */
+        K key;
+
+        /**
+         * The value.
+         */
+        V value;
+
+        /**
+         * Constructs a new node.
+         *
+         * @param hash  The hash of the key.
+         * @param key   The key.
+         * @param value The value.
+         */
+        Node(uint64 hash, const K& key, const V& value);
+    };
+
+    /**
+     * Defines an array of buckets.
+     */
+    struct Table
+    {
+        /**
+         * The number of buckets, less one.
+         */
+        Size mask;
+
+        /**
+         * The table that the buckets are moving to, or null.
+         */
+        std::atomic<Table*> next;
+
+        /**
+         * The next table that is waiting to be freed.
+         */
+        Table* retired;
+
+        /**
+         * The first node of every bucket.
+         */
+        std::atomic<Node*>* buckets;
+    };
+
+    /**
+     * Defines the number of readers of a stripe, padded to a cache line so
+     * that stripes do not share one.
+     */
+    struct Counter
+    {
+        /**
+         * The number of readers.
+         */
+        std::atomic<Size> readers;
+
+        /**
+         * The padding.
+         */
+        char padding[64 - sizeof(std::atomic<Size>)];
+    };
+
+    /**
+     * Defines the scope of a read.
+     */
+    class ReadGuard
+    {
+      private:
+        /**
+         * The counter of the reader.
+         */
+        std::atomic<Size>* _counter;
+
+      public:
+        /**
+         * Enters a read, which holds back reclamation.
+         *
+         * @param map The map that is read.
+         */
+        explicit ReadGuard(const ConcurrentMap<K, V, H>& map);
+
+        /**
+         * Leaves the read.
+         */
+        ~ReadGuard();
+    };
+
+    /**
+     * The memory that nodes and tables are allocated from.
+     */
+    mem::IMemory* _memory;
+
+    /**
+     * The hasher.
+     */
+    H _hash;
+
+    /**
+     * The table that readers start from.
+     */
+    std::atomic<Table*> _table;
+
+    /**
+     * The number of keys.
+     */
+    std::atomic<Size> _size;
+
+    /**
+     * The epoch.
+     */
+    std::atomic<uint64> _epoch;
+
+    /**
+     * The number of readers, by epoch parity and stripe.
+     */
+    mutable Counter _readers[2][STRIPES];
+
+    /**
+     * Guards every write.
+     */
+    std::mutex _writer;
+
+    /**
+     * The next bucket of the current table to move while the map grows.
+     */
+    Size _migrated;
+
+    /**
+     * The nodes that were unlinked, by epoch modulo three.
+     */
+    Node* _retiredNodes[3];
+
+    /**
+     * The tables that were replaced, by epoch modulo three.
+     */
+    Table* _retiredTables[3];
+
+    // HELPER FUNCTIONS
+    /**
+     * Finds the node of a key, which must be called during a read.
+     *
+     * @param key  The key.
+     * @param hash The hash of the key.
+     * @return     The node, or null if the key is absent.
+     */
+    const Node* locate(const K& key, uint64 hash) const;
+
+    /**
+     * Gets the bucket that holds a hash, which must be called while writing.
+     *
+     * @param hash The hash.
+     * @return     The bucket.
+     */
+    std::atomic<Node*>& bucketOf(uint64 hash);
+
+    /**
+     * Moves buckets of the current table to the table it is growing into,
+     * and replaces it once they have all moved.
+     *
+     * @param count The largest number of buckets to move.
+     */
+    void migrate(Size count);
+
+    /**
+     * Advances the epoch if no reader is left in the previous one and frees
+     * what was retired in it.
+     */
+    void advance();
+
+    /**
+     * Retires a node, which is freed once no reader can reach it.
+     *
+     * @param node The node.
+     */
+    void retire(Node* node);
+
+    /**
+     * Retires a table, which is freed once no reader can reach it.
+     *
+     * @param table The table.
+     */
+    void retire(Table* table);
+
+    /**
+     * Retires every node of a chain.
+     *
+     * @param node The first node.
+     */
+    void retireChain(Node* node);
+
+    /**
+     * Allocates a table with every bucket empty.
+     *
+     * @param capacity The number of buckets, which must be a power of two.
+     * @return         The table, or null if the memory is exhausted.
+     */
+    Table* createTable(Size capacity);
+
+    /**
+     * Allocates a node.
+     *
+     * @param hash  The hash of the key.
+     * @param key   The key.
+     * @param value The value.
+     * @return      The node, or null if the memory is exhausted.
+     */
+    Node* createNode(uint64 hash, const K& key, const V& value);
+
+    /**
+     * Frees a node.
+     *
+     * @param node The node.
+     */
+    void destroyNode(Node* node);
+
+    /**
+     * Frees a list of retired nodes and a list of retired tables.
+     *
+     * @param nodes  The first node.
+     * @param tables The first table.
+     */
+    void destroyRetired(Node* nodes, Table* tables);
+
+    /**
+     * Gets the marker of a bucket that has moved to the next table.
+     *
+     * @return The marker.
+     */
+    static Node* moved();
+
+    // DISABLED
+    ConcurrentMap(const ConcurrentMap<K, V, H>&);
+
+    ConcurrentMap<K, V, H>& operator=(const ConcurrentMap<K, V, H>&);
+
+  public:
+    // CONSTRUCTORS
+    /**
+     * Constructs a new empty map.
+     *
+     * @param capacity The initial number of buckets, which is rounded up to
+     *                 a power of two.
+     * @param memory   The memory that nodes and tables are allocated from,
+     *                 which is only used while writing.
+     * @param hash     The hasher.
+     */
+    explicit ConcurrentMap(Size capacity = MIN_CAPACITY,
+                           mem::IMemory& memory = mem::HeapMemory::instance(),
+                           const H& hash = H());
+
+    /**
+     * Destructor. No thread may be using the map.
+     */
+    virtual ~ConcurrentMap();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Inserts a key and its value, unless the key is already present.
+     *
+     * @param key   The key.
+     * @param value The value.
+     * @return      If the key was inserted, which fails if it is already
+     *              present or the memory is exhausted.
+     */
+    virtual bool insert(const K& key, const V& value);
+
+    /**
+     * Erases a key and its value.
+     *
+     * @param key The key.
+     * @return    If the key was present.
+     */
+    virtual bool erase(const K& key);
+
+    /**
+     * Erases every key.
+     */
+    virtual void clear();
+
+    /**
+     * Frees the memory of erased keys and replaced tables that no reader
+     * can still see. Writes do this on their own, so this is only needed to
+     * release memory while nothing is written.
+     */
+    void reclaim();
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the value of a key. This never locks.
+     *
+     * @param key   The key.
+     * @param value The value, which is only written if the key is present.
+     * @return      If the key is present.
+     */
+    virtual bool get(const K& key, V& value) const;
+
+    /**
+     * Checks if a key is present. This never locks.
+     *
+     * @param key The key.
+     * @return    If the key is present.
+     */
+    virtual bool contains(const K& key) const;
+
+    /**
+     * Gets the number of keys.
+     *
+     * @return The number of keys.
+     */
+    virtual Size size() const;
+
+    /**
+     * Gets the number of buckets of the table that keys are moving to, or
+     * of the current table if the map is not growing.
+     *
+     * @return The number of buckets.
+     */
+    Size capacity() const;
+};
+
+template<typename K, typename V, typename H>
+const Size ConcurrentMap<K, V, H>::MIN_CAPACITY;
+
+template<typename K, typename V, typename H>
+const Size ConcurrentMap<K, V, H>::MIGRATE_STEP;
+
+template<typename K, typename V, typename H>
+const unsigned ConcurrentMap<K, V, H>::STRIPES;
+
+template<typename K, typename V, typename H>
+inline
+ConcurrentMap<K, V, H>::Node::Node(uint64 hash, const K& key, const V& value)
+    : hash(hash), next(0), retired(0), key(key), value(value)
+{
+}
+
+template<typename K, typename V, typename H>
+inline
+ConcurrentMap<K, V, H>::ReadGuard::ReadGuard(
+    const ConcurrentMap<K, V, H>& map)
+{
+    // the epoch is checked again once the reader is counted, so a reader
+    // is never counted in an epoch that has already been passed
+    const unsigned stripe = detail::readerStripe(STRIPES);
+    for (;;)
+    {
+        const uint64 epoch = map._epoch.load();
+        _counter = &map._readers[epoch & 1][stripe].readers;
+        _counter->fetch_add(1);
+        if (map._epoch.load() == epoch)
+        {
+            return;
+        }
+        _counter->fetch_sub(1);
+    }
+}
+
+template<typename K, typename V, typename H>
+inline
+ConcurrentMap<K, V, H>::ReadGuard::~ReadGuard()
+{
+    _counter->fetch_sub(1, std::memory_order_release);
+}
+
+// CONSTRUCTORS
+template<typename K, typename V, typename H>
+inline
+ConcurrentMap<K, V, H>::ConcurrentMap(Size capacity, mem::IMemory& memory,
+                                      const H& hash)
+    : _memory(&memory), _hash(hash), _table(0), _size(0), _epoch(0),
+      _migrated(0)
+{
+    for (unsigned parity = 0; parity < 2; ++parity)
+    {
+        for (unsigned stripe = 0; stripe < STRIPES; ++stripe)
+        {
+            _readers[parity][stripe].readers.store(0);
+        }
+    }
+    for (unsigned i = 0; i < 3; ++i)
+    {
+        _retiredNodes[i] = 0;
+        _retiredTables[i] = 0;
+    }
+
+    Size buckets = MIN_CAPACITY;
+    while (buckets < capacity)
+    {
+        buckets *= 2;
+    }
+    _table.store(createTable(buckets));
+}
+
+template<typename K, typename V, typename H>
+inline
+ConcurrentMap<K, V, H>::~ConcurrentMap()
+{
+    Table* table = _table.load();
+    while (table)
+    {
+        for (Size i = 0; i <= table->mask; ++i)
+        {
+            Node* node = table->buckets[i].load();
+            while (node && node != moved())
+            {
+                Node* next = node->next.load();
+                destroyNode(node);
+                node = next;
+            }
+        }
+        Table* next = table->next.load();
+        _memory->release(table);
+        table = next;
+    }
+    for (unsigned i = 0; i < 3; ++i)
+    {
+        destroyRetired(_retiredNodes[i], _retiredTables[i]);
+    }
+}
+
+// MEMBER FUNCTIONS
+template<typename K, typename V, typename H>
+inline
+bool ConcurrentMap<K, V, H>::insert(const K& key, const V& value)
+{
+    std::lock_guard<std::mutex> lock(_writer);
+    Table* table = _table.load(std::memory_order_relaxed);
+    if (!table)
+    {
+        return false;
+    }
+    migrate(MIGRATE_STEP);
+    advance();
+
+    const uint64 hash = _hash(key);
+    std::atomic<Node*>& bucket = bucketOf(hash);
+    Node* first = bucket.load(std::memory_order_relaxed);
+    for (Node* node = first; node;
+         node = node->next.load(std::memory_order_relaxed))
+    {
+        if (node->hash == hash && node->key == key)
+        {
+            return false;
+        }
+    }
+
+    Node* node = createNode(hash, key, value);
+    if (!node)
+    {
+        return false;
+    }
+    node->next.store(first, std::memory_order_relaxed);
+    bucket.store(node, std::memory_order_release);
+    const Size size = _size.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    // start growing once the current table is three quarters full
+    table = _table.load(std::memory_order_relaxed);
+    const Size capacity = table->mask + 1;
+    if (!table->next.load(std::memory_order_relaxed) &&
+        size > capacity - capacity / 4)
+    {
+        Table* next = createTable(2 * capacity);
+        if (next)
+        {
+            table->next.store(next, std::memory_order_release);
+            _migrated = 0;
+        }
+    }
+    return true;
+}
+
+template<typename K, typename V, typename H>
+inline
+bool ConcurrentMap<K, V, H>::erase(const K& key)
+{
+    std::lock_guard<std::mutex> lock(_writer);
+    if (!_table.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+    migrate(MIGRATE_STEP);
+    advance();
+
+    // the erased node keeps its link, so a reader on it carries on
+    const uint64 hash = _hash(key);
+    std::atomic<Node*>* link = &bucketOf(hash);
+    for (Node* node = link->load(std::memory_order_relaxed); node;
+         link = &node->next, node = link->load(std::memory_order_relaxed))
+    {
+        if (node->hash == hash && node->key == key)
+        {
+            link->store(node->next.load(std::memory_order_relaxed),
+                        std::memory_order_release);
+            retire(node);
+            _size.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename K, typename V, typename H>
+inline
+void ConcurrentMap<K, V, H>::clear()
+{
+    std::lock_guard<std::mutex> lock(_writer);
+    for (Table* table = _table.load(std::memory_order_relaxed); table;
+         table = table->next.load(std::memory_order_relaxed))
+    {
+        for (Size i = 0; i <= table->mask; ++i)
+        {
+            Node* node = table->buckets[i].load(std::memory_order_relaxed);
+            if (node && node != moved())
+            {
+                table->buckets[i].store(0, std::memory_order_release);
+                retireChain(node);
+            }
+        }
+    }
+    _size.store(0, std::memory_order_relaxed);
+    advance();
+}
+
+template<typename K, typename V, typename H>
+inline
+void ConcurrentMap<K, V, H>::reclaim()
+{
+    // two advances free everything that was retired before the call, if no
+    // reader holds either back
+    std::lock_guard<std::mutex> lock(_writer);
+    advance();
+    advance();
+}
+
+// ACCESSOR FUNCTIONS
+template<typename K, typename V, typename H>
+inline
+bool ConcurrentMap<K, V, H>::get(const K& key, V& value) const
+{
+    ReadGuard guard(*this);
+    const Node* node = locate(key, _hash(key));
+    if (!node)
+    {
+        return false;
+    }
+    value = node->value;
+    return true;
+}
+
+template<typename K, typename V, typename H>
+inline
+bool ConcurrentMap<K, V, H>::contains(const K& key) const
+{
+    ReadGuard guard(*this);
+    return locate(key, _hash(key)) != 0;
+}
+
+template<typename K, typename V, typename H>
+inline
+Size ConcurrentMap<K, V, H>::size() const
+{
+    return _size.load(std::memory_order_relaxed);
+}
+
+template<typename K, typename V, typename H>
+inline
+Size ConcurrentMap<K, V, H>::capacity() const
+{
+    ReadGuard guard(*this);
+    const Table* table = _table.load(std::memory_order_acquire);
+    if (!table)
+    {
+        return 0;
+    }
+    const Table* next = table->next.load(std::memory_order_acquire);
+    return (next ? next->mask : table->mask) + 1;
+}
+
+// HELPER FUNCTIONS
+template<typename K, typename V, typename H>
+inline
+const typename ConcurrentMap<K, V, H>::Node*
+ConcurrentMap<K, V, H>::locate(const K& key, uint64 hash) const
+{
+    const Table* table = _table.load(std::memory_order_acquire);
+    if (!table)
+    {
+        return 0;
+    }
+
+    // a moved bucket sends the reader on to the table it moved to
+    const Node* node =
+        table->buckets[hash & table->mask].load(std::memory_order_acquire);
+    while (node == moved())
+    {
+        table = table->next.load(std::memory_order_acquire);
+        node =
+            table->buckets[hash & table->mask].load(std::memory_order_acquire);
+    }
+
+    for (; node; node = node->next.load(std::memory_order_acquire))
+    {
+        if (node->hash == hash && node->key == key)
+        {
+            return node;
+        }
+    }
+    return 0;
+}
+
+template<typename K, typename V, typename H>
+inline
+std::atomic<typename ConcurrentMap<K, V, H>::Node*>&
+ConcurrentMap<K, V, H>::bucketOf(uint64 hash)
+{
+    Table* table = _table.load(std::memory_order_relaxed);
+    std::atomic<Node*>* bucket = &table->buckets[hash & table->mask];
+    while (bucket->load(std::memory_order_relaxed) == moved())
+    {
+        table = table->next.load(std::memory_order_relaxed);
+        bucket = &table->buckets[hash & table->mask];
+    }
+    return *bucket;
+}
+
+template<typename K, typename V, typename H>
+inline
+void ConcurrentMap<K, V, H>::migrate(Size count)
+{
+    Table* table = _table.load(std::memory_order_relaxed);
+    Table* next = table->next.load(std::memory_order_relaxed);
+    if (!next)
+    {
+        return;
+    }
+
+    for (; count && _migrated <= table->mask; --count, ++_migrated)
+    {
+        // copy the chain privately first, so running out of memory leaves
+        // the bucket as it was
+        std::atomic<Node*>& bucket = table->buckets[_migrated];
+        Node* chain = bucket.load(std::memory_order_relaxed);
+        Node* copies = 0;
+        for (Node* node = chain; node;
+             node = node->next.load(std::memory_order_relaxed))
+        {
+            Node* copy = createNode(node->hash, node->key, node->value);
+            if (!copy)
+            {
+                while (copies)
+                {
+                    Node* following = copies->retired;
+                    destroyNode(copies);
+                    copies = following;
+                }
+                return;
+            }
+            copy->retired = copies;
+            copies = copy;
+        }
+
+        // the new buckets are unreachable until the old one is marked, so
+        // the copies can be linked in any order
+        while (copies)
+        {
+            Node* copy = copies;
+            copies = copy->retired;
+            copy->retired = 0;
+            std::atomic<Node*>& target = next->buckets[copy->hash & next->mask];
+            copy->next.store(target.load(std::memory_order_relaxed),
+                             std::memory_order_relaxed);
+            target.store(copy, std::memory_order_relaxed);
+        }
+        bucket.store(moved(), std::memory_order_release);
+        retireChain(chain);
+    }
+
+    if (_migrated > table->mask)
+    {
+        _table.store(next, std::memory_order_release);
+        retire(table);
+        _migrated = 0;
+    }
+}
+
+template<typename K, typename V, typename H>
+inline
+void ConcurrentMap<K, V, H>::advance()
+{
+    // nobody left in the previous epoch means nobody can still reach what
+    // was retired in it, which shares its slot with the next epoch
+    const uint64 epoch = _epoch.load();
+    const unsigned parity = (epoch + 1) & 1;
+    for (unsigned stripe = 0; stripe < STRIPES; ++stripe)
+    {
+        if (_readers[parity][stripe].readers.load())
+        {
+            return;
+        }
+    }
+
+    const unsigned slot = (epoch + 2) % 3;
+    destroyRetired(_retiredNodes[slot], _retiredTables[slot]);
+    _retiredNodes[slot] = 0;
+    _retiredTables[slot] = 0;
+    _epoch.store(epoch + 1);
+}
+
+template<typename K, typename V, typename H>
+inline
+void ConcurrentMap<K, V, H>::retire(Node* node)
+{
+    // the retired link is separate, so the chain stays walkable
+    const unsigned slot = _epoch.load() % 3;
+    node->retired = _retiredNodes[slot];
+    _retiredNodes[slot] = node;
+}
+
+template<typename K, typename V, typename H>
+inline
+void ConcurrentMap<K, V, H>::retire(Table* table)
+{
+    const unsigned slot = _epoch.load() % 3;
+    table->retired = _retiredTables[slot];
+    _retiredTables[slot] = table;
+}
+
+template<typename K, typename V, typename H>
+inline
+void ConcurrentMap<K, V, H>::retireChain(Node* node)
+{
+    for (; node; node = node->next.load(std::memory_order_relaxed))
+    {
+        retire(node);
+    }
+}
+
+template<typename K, typename V, typename H>
+inline
+typename ConcurrentMap<K, V, H>::Table*
+ConcurrentMap<K, V, H>::createTable(Size capacity)
+{
+    void* block = _memory->allocate(
+        sizeof(Table) + capacity * sizeof(std::atomic<Node*>));
+    if (!block)
+    {
+        return 0;
+    }
+
+    Table* table = static_cast<Table*>(block);
+    table->mask = capacity - 1;
+    new (&table->next) std::atomic<Table*>(0);
+    table->retired = 0;
+    table->buckets = reinterpret_cast<std::atomic<Node*>*>(table + 1);
+    for (Size i = 0; i < capacity; ++i)
+    {
+        new (table->buckets + i) std::atomic<Node*>(0);
+    }
+    return table;
+}
+
+template<typename K, typename V, typename H>
+inline
+typename ConcurrentMap<K, V, H>::Node*
+ConcurrentMap<K, V, H>::createNode(uint64 hash, const K& key, const V& value)
+{
+    void* block = _memory->allocate(sizeof(Node));
+    return block ? new (block) Node(hash, key, value) : 0;
+}
+
+template<typename K, typename V, typename H>
+inline
+void ConcurrentMap<K, V, H>::destroyNode(Node* node)
+{
+    node->~Node();
+    _memory->release(node);
+}
+
+template<typename K, typename V, typename H>
+inline
+void ConcurrentMap<K, V, H>::destroyRetired(Node* nodes, Table* tables)
+{
+    while (nodes)
+    {
+        Node* next = nodes->retired;
+        destroyNode(nodes);
+        nodes = next;
+    }
+    while (tables)
+    {
+        Table* next = tables->retired;
+        _memory->release(tables);
+        tables = next;
+    }
+}
+
+template<typename K, typename V, typename H>
+inline
+typename ConcurrentMap<K, V, H>::Node* ConcurrentMap<K, V, H>::moved()
+{
+    return reinterpret_cast<Node*>(uintptr_t(1));
+}
+
+} // End nspc cntr
+
+} // End nspc gel
+
+#endif //GEL_CONCURRENT_MAP_H
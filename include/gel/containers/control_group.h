@@ -0,0 +1,141 @@
+// control_group.h
+#ifndef GEL_CONTROL_GROUP_H
+#define GEL_CONTROL_GROUP_H
+
+#include "gel/gellib.h"
+
+#if GEL_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace gel
+{
+
+namespace cntr
+{
+
+namespace detail
+{
+
+/**
+ * @brief Defines the operations on a group of control bytes of a hashed
+ * container.
+ *
+ * A control byte is EMPTY or holds the low seven bits of the hash of the
+ * key in its slot, so a group is probed for a key by comparing all of its
+ * bytes at once with those bits.
+ */
+struct ControlGroup
+{
+    /**
+     * The number of control bytes of a group.
+     */
+    static const Size WIDTH = 16;
+
+    /**
+     * The control byte of an empty slot.
+     */
+    static const uint8 EMPTY = 0x80;
+
+    /**
+     * Gets the bytes of a group that hold a hash.
+     *
+     * @param control The first byte of the group, which need not be aligned.
+     * @param hash    The low seven bits of the hash.
+     * @return        A mask with a bit set for every matching byte.
+     */
+    static uint32 match(const uint8* control, uint8 hash);
+
+    /**
+     * Gets the bytes of a group that are empty.
+     *
+     * @param control The first byte of the group, which need not be aligned.
+     * @return        A mask with a bit set for every empty byte.
+     */
+    static uint32 matchEmpty(const uint8* control);
+
+    /**
+     * Gets the index of the lowest set bit.
+     *
+     * @param bits The bits, which must not be zero.
+     * @return     The index.
+     */
+    static unsigned lowestBit(uint32 bits);
+};
+
+inline
+uint32 ControlGroup::match(const uint8* control, uint8 hash)
+{
+#if GEL_SSE2
+    const __m128i group =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+    return _mm_movemask_epi8(
+        _mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(hash))));
+#else
+    uint32 bits = 0;
+    for (unsigned i = 0; i < WIDTH; ++i)
+    {
+        bits |= uint32(control[i] == hash) << i;
+    }
+    return bits;
+#endif
+}
+
+inline
+uint32 ControlGroup::matchEmpty(const uint8* control)
+{
+#if GEL_SSE2
+    // only EMPTY has the high bit set
+    return _mm_movemask_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(control)));
+#else
+    uint32 bits = 0;
+    for (unsigned i = 0; i < WIDTH; ++i)
+    {
+        bits |= uint32(control[i] >> 7) << i;
+    }
+    return bits;
+#endif
+}
+
+inline
+unsigned ControlGroup::lowestBit(uint32 bits)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, bits);
+    return index;
+#else
+    return __builtin_ctz(bits);
+#endif
+}
+
+/**
+ * Hints the processor to load the cache line that holds an address, so a
+ * later access does not stall on memory.
+ *
+ * @param address The address, which need not be valid.
+ */
+inline
+void prefetch(const void* address)
+{
+#if GEL_SSE2
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#elif defined( __GNUC__ )
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+}
+
+} // End nspc detail
+
+} // End nspc cntr
+
+} // End nspc gel
+
+#endif //GEL_CONTROL_GROUP_H
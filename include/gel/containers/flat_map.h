@@ -0,0 +1,831 @@
+// flat_map.h
+#ifndef GEL_FLAT_MAP_H
+#define GEL_FLAT_MAP_H
+
+#include <assert.h>
+#include <algorithm>
+#include <functional>
+#include <new>
+#include <utility>
+#include "gel/gellib.h"
+#include "gel/containers/control_group.h"
+#include "gel/containers/imap.h"
+#include "gel/memory/heap_allocator.h"
+#include "gel/memory/iallocator.h"
+
+namespace gel
+{
+
+namespace cntr
+{
+
+/**
+ * @brief Defines a sorted map that is built once and then read many times.
+ *
+ * The keys and values are stored in two separate arrays, so a search only
+ * walks memory that holds keys. While the map is being built the keys are
+ * kept sorted: insert() and erase() shift the entries, and build() sorts a
+ * whole batch at once, which is the fast way to fill the map.
+ *
+ * freeze() shrinks the arrays to fit and stops changes. A frozen map may
+ * keep the sorted layout, which is searched with a branch-free binary
+ * search, or use the Eytzinger layout, which stores the keys in the
+ * breadth first order of a complete binary search tree. The descendants of
+ * a node four levels down are then adjacent, so they are prefetched while
+ * the node is compared, and the search does not branch on the comparison.
+ * thaw() restores the sorted layout so the map can change again.
+ *
+ * Growing, erasing and changing the layout move the entries, so pointers
+ * into the map are only valid until the next change. The map is not thread
+ * safe, but a frozen map may be read by any number of threads.
+ *
+ * @tparam K The type of the keys, which must be move constructible.
+ * @tparam V The type of the values, which must be move constructible.
+ * @tparam C The strict weak ordering of the keys.
+ */
+template<typename K, typename V, typename C = std::less<K> >
+class FlatMap: public IMap<K, V>
+{
+  public:
+    /**
+     * Defines the order of the entries of a frozen map.
+     */
+    enum Layout
+    {
+        SORTED,
+        EYTZINGER
+    };
+
+    /**
+     * The smallest number of entries of a map that has any.
+     */
+    static const Size MIN_CAPACITY = 16;
+
+  private:
+    /**
+     * The position that is returned when a key is absent.
+     */
+    static const Size NPOS = ~Size(0);
+
+    /**
+     * The number of levels below a node of the Eytzinger layout whose
+     * first descendant is prefetched.
+     */
+    static const unsigned PREFETCH_LEVELS = 4;
+
+    /**
+     * Orders the positions of the keys given to build(), and equal keys by
+     * position so the first of them is kept.
+     */
+    struct BuildOrder
+    {
+        /**
+         * The ordering.
+         */
+        const C* compare;
+
+        /**
+         * The keys.
+         */
+        const K* keys;
+
+        /**
+         * Compares two positions.
+         *
+         * @param left  The first position.
+         * @param right The second position.
+         * @return      If the first position goes before the second.
+         */
+        bool operator()(uint32 left, uint32 right) const;
+    };
+
+    /**
+     * The allocator of the keys.
+     */
+    mem::IAllocator<K>* _keyAllocator;
+
+    /**
+     * The allocator of the values.
+     */
+    mem::IAllocator<V>* _valueAllocator;
+
+    /**
+     * The allocator of the order that build() sorts.
+     */
+    mem::IAllocator<uint32>* _indices;
+
+    /**
+     * The ordering.
+     */
+    C _compare;
+
+    /**
+     * The keys, from position one in the Eytzinger layout.
+     */
+    K* _keys;
+
+    /**
+     * The values, in the same positions as their keys.
+     */
+    V* _values;
+
+    /**
+     * The number of entries.
+     */
+    Size _size;
+
+    /**
+     * The number of entries the arrays can hold.
+     */
+    Size _capacity;
+
+    /**
+     * The layout.
+     */
+    Layout _layout;
+
+    /**
+     * If the map may not change.
+     */
+    bool _frozen;
+
+    // HELPER FUNCTIONS
+    /**
+     * Finds the position of a key.
+     *
+     * @param key The key.
+     * @return    The position, or NPOS if the key is absent.
+     */
+    template<typename Q>
+    Size locate(const Q& key) const;
+
+    /**
+     * Finds the first position of the sorted layout whose key does not go
+     * before a key.
+     *
+     * @param key The key.
+     * @return    The position, which is the size if every key goes before.
+     */
+    template<typename Q>
+    Size lowerBound(const Q& key) const;
+
+    /**
+     * Moves the entries into new arrays with a layout.
+     *
+     * @param capacity The number of entries of the new arrays.
+     * @param layout   The layout.
+     * @return         If the allocators provided the arrays.
+     */
+    bool relayout(Size capacity, Layout layout);
+
+    /**
+     * Moves the entries of a subtree between the sorted and the Eytzinger
+     * layout, in key order.
+     *
+     * @param sorted  The sorted position of the first entry of the subtree.
+     * @param node    The Eytzinger position of the root of the subtree.
+     * @param keys    The keys to move to.
+     * @param values  The values to move to.
+     * @param forward If the entries move to the Eytzinger layout.
+     * @return        The sorted position that follows the subtree.
+     */
+    Size arrange(Size sorted, Size node, K* keys, V* values, bool forward);
+
+    /**
+     * Moves an entry to another position of new arrays.
+     *
+     * @param from   The position of the entry.
+     * @param to     The position in the new arrays.
+     * @param keys   The keys to move to.
+     * @param values The values to move to.
+     */
+    void transfer(Size from, Size to, K* keys, V* values);
+
+    /**
+     * Visits the entries of a subtree of the Eytzinger layout in key order.
+     *
+     * @param node     The Eytzinger position of the root of the subtree.
+     * @param function The function.
+     */
+    template<typename F>
+    void visit(Size node, F& function) const;
+
+    /**
+     * Gets the position of the first entry.
+     *
+     * @return The position.
+     */
+    Size first() const;
+
+    // DISABLED
+    FlatMap(const FlatMap<K, V, C>&);
+
+    FlatMap<K, V, C>& operator=(const FlatMap<K, V, C>&);
+
+  public:
+    // CONSTRUCTORS
+    /**
+     * Constructs a new empty map.
+     *
+     * @param keys    The allocator of the keys.
+     * @param values  The allocator of the values.
+     * @param indices The allocator of the order that build() sorts.
+     * @param compare The ordering.
+     */
+    explicit FlatMap(
+        mem::IAllocator<K>& keys = mem::HeapAllocator<K>::instance(),
+        mem::IAllocator<V>& values = mem::HeapAllocator<V>::instance(),
+        mem::IAllocator<uint32>& indices =
+            mem::HeapAllocator<uint32>::instance(),
+        const C& compare = C());
+
+    /**
+     * Destructor.
+     */
+    virtual ~FlatMap();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Inserts a key and its value in order, unless the key is already
+     * present. A frozen map always returns false without changing, which
+     * looks like a present key to a caller, so callers that may see a
+     * frozen map check isFrozen() first.
+     *
+     * @param key   The key.
+     * @param value The value.
+     * @return      If the key was inserted, which fails if it is already
+     *              present, the map is frozen or the allocators are
+     *              exhausted.
+     */
+    virtual bool insert(const K& key, const V& value);
+
+    /**
+     * Erases a key and its value. A frozen map always returns false
+     * without changing, which looks like an absent key to a caller, so
+     * callers that may see a frozen map check isFrozen() first.
+     *
+     * @param key The key.
+     * @return    If the key was erased, which fails if it is absent or the
+     *            map is frozen.
+     */
+    virtual bool erase(const K& key);
+
+    /**
+     * Erases every key and thaws the map.
+     */
+    virtual void clear();
+
+    /**
+     * Replaces the contents with many keys and their values, which is
+     * faster than inserting them one at a time. Of keys that are equal,
+     * the first one is kept.
+     *
+     * @param keys   The keys.
+     * @param values The value of every key.
+     * @param count  The number of keys.
+     * @return       If the allocators provided the memory.
+     */
+    bool build(const K* keys, const V* values, Size count);
+
+    /**
+     * Stops changes, shrinks the arrays to fit and orders the entries for
+     * searching.
+     *
+     * @param layout The layout.
+     * @return       If the allocators provided the arrays.
+     */
+    bool freeze(Layout layout = EYTZINGER);
+
+    /**
+     * Restores the sorted layout and allows changes again.
+     *
+     * @return If the allocators provided the arrays.
+     */
+    bool thaw();
+
+    /**
+     * Finds the value of a key.
+     *
+     * @param key The key, or anything the ordering compares with keys.
+     * @return    The value, or null if the key is absent.
+     */
+    template<typename Q>
+    V* find(const Q& key);
+
+    /**
+     * Calls a function with every key and its value, in key order.
+     *
+     * @param function The function, which is called as function(key, value).
+     */
+    template<typename F>
+    void forEach(F function) const;
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the value of a key.
+     *
+     * @param key   The key.
+     * @param value The value, which is only written if the key is present.
+     * @return      If the key is present.
+     */
+    virtual bool get(const K& key, V& value) const;
+
+    /**
+     * Checks if a key is present.
+     *
+     * @param key The key.
+     * @return    If the key is present.
+     */
+    virtual bool contains(const K& key) const;
+
+    /**
+     * Gets the number of keys.
+     *
+     * @return The number of keys.
+     */
+    virtual Size size() const;
+
+    /**
+     * Finds the value of a key.
+     *
+     * @param key The key, or anything the ordering compares with keys.
+     * @return    The value, or null if the key is absent.
+     */
+    template<typename Q>
+    const V* find(const Q& key) const;
+
+    /**
+     * Gets the number of entries the arrays can hold.
+     *
+     * @return The capacity.
+     */
+    Size capacity() const;
+
+    /**
+     * Gets the layout, which is always SORTED unless the map is frozen.
+     *
+     * @return The layout.
+     */
+    Layout layout() const;
+
+    /**
+     * Checks if the map may not change.
+     *
+     * @return If the map is frozen.
+     */
+    bool isFrozen() const;
+};
+
+template<typename K, typename V, typename C>
+const Size FlatMap<K, V, C>::MIN_CAPACITY;
+
+template<typename K, typename V, typename C>
+const Size FlatMap<K, V, C>::NPOS;
+
+template<typename K, typename V, typename C>
+const unsigned FlatMap<K, V, C>::PREFETCH_LEVELS;
+
+template<typename K, typename V, typename C>
+inline
+bool FlatMap<K, V, C>::BuildOrder::operator()(uint32 left,
+                                              uint32 right) const
+{
+    if ((*compare)(keys[left], keys[right]))
+    {
+        return true;
+    }
+    return !(*compare)(keys[right], keys[left]) && left < right;
+}
+
+// CONSTRUCTORS
+template<typename K, typename V, typename C>
+inline
+FlatMap<K, V, C>::FlatMap(mem::IAllocator<K>& keys,
+                          mem::IAllocator<V>& values,
+                          mem::IAllocator<uint32>& indices,
+                          const C& compare)
+    : _keyAllocator(&keys), _valueAllocator(&values), _indices(&indices),
+      _compare(compare), _keys(0), _values(0), _size(0), _capacity(0),
+      _layout(SORTED), _frozen(false)
+{
+}
+
+template<typename K, typename V, typename C>
+inline
+FlatMap<K, V, C>::~FlatMap()
+{
+    clear();
+    if (_keys)
+    {
+        _keyAllocator->free(_keys);
+        _valueAllocator->free(_values);
+    }
+}
+
+// MEMBER FUNCTIONS
+template<typename K, typename V, typename C>
+inline
+bool FlatMap<K, V, C>::insert(const K& key, const V& value)
+{
+    if (_frozen)
+    {
+        return false;
+    }
+    const Size position = lowerBound(key);
+    if (position < _size && !_compare(key, _keys[position]))
+    {
+        return false;
+    }
+
+    // the key or value may be an entry, which growing and shifting move
+    K insertedKey(key);
+    V insertedValue(value);
+    if (_size == _capacity &&
+        !relayout(_capacity ? 2 * _capacity : MIN_CAPACITY, SORTED))
+    {
+        return false;
+    }
+
+    if (position == _size)
+    {
+        new (_keys + _size) K(std::move(insertedKey));
+        new (_values + _size) V(std::move(insertedValue));
+    }
+    else
+    {
+        new (_keys + _size) K(std::move(_keys[_size - 1]));
+        new (_values + _size) V(std::move(_values[_size - 1]));
+        for (Size i = _size - 1; i > position; --i)
+        {
+            _keys[i] = std::move(_keys[i - 1]);
+            _values[i] = std::move(_values[i - 1]);
+        }
+        _keys[position] = std::move(insertedKey);
+        _values[position] = std::move(insertedValue);
+    }
+    ++_size;
+    return true;
+}
+
+template<typename K, typename V, typename C>
+inline
+bool FlatMap<K, V, C>::erase(const K& key)
+{
+    if (_frozen)
+    {
+        return false;
+    }
+    const Size position = locate(key);
+    if (position == NPOS)
+    {
+        return false;
+    }
+
+    for (Size i = position + 1; i < _size; ++i)
+    {
+        _keys[i - 1] = std::move(_keys[i]);
+        _values[i - 1] = std::move(_values[i]);
+    }
+    --_size;
+    _keys[_size].~K();
+    _values[_size].~V();
+    return true;
+}
+
+template<typename K, typename V, typename C>
+inline
+void FlatMap<K, V, C>::clear()
+{
+    const Size start = first();
+    for (Size i = start; i < start + _size; ++i)
+    {
+        _keys[i].~K();
+        _values[i].~V();
+    }
+    _size = 0;
+    _frozen = false;
+
+    // the arrays of the Eytzinger layout are offset, so they are dropped
+    if (_layout == EYTZINGER)
+    {
+        relayout(0, SORTED);
+    }
+}
+
+template<typename K, typename V, typename C>
+inline
+bool FlatMap<K, V, C>::build(const K* keys, const V* values, Size count)
+{
+    clear();
+    if (!count)
+    {
+        return true;
+    }
+    assert(count <= ~uint32(0));
+
+    uint32* order = _indices->allocate(count);
+    if (!order)
+    {
+        return false;
+    }
+    if (_capacity < count && !relayout(count, SORTED))
+    {
+        _indices->free(order);
+        return false;
+    }
+
+    for (Size i = 0; i < count; ++i)
+    {
+        order[i] = static_cast<uint32>(i);
+    }
+    BuildOrder compare = { &_compare, keys };
+    std::sort(order, order + count, compare);
+
+    // equal keys are adjacent after sorting, with the first one leading
+    for (Size i = 0; i < count; ++i)
+    {
+        const K& key = keys[order[i]];
+        if (_size && !_compare(_keys[_size - 1], key))
+        {
+            continue;
+        }
+        new (_keys + _size) K(key);
+        new (_values + _size) V(values[order[i]]);
+        ++_size;
+    }
+    _indices->free(order);
+    return true;
+}
+
+template<typename K, typename V, typename C>
+inline
+bool FlatMap<K, V, C>::freeze(Layout layout)
+{
+    if (_capacity != _size || _layout != layout)
+    {
+        if (!relayout(_size, layout))
+        {
+            return false;
+        }
+    }
+    _frozen = true;
+    return true;
+}
+
+template<typename K, typename V, typename C>
+inline
+bool FlatMap<K, V, C>::thaw()
+{
+    if (_layout != SORTED && !relayout(_size, SORTED))
+    {
+        return false;
+    }
+    _frozen = false;
+    return true;
+}
+
+template<typename K, typename V, typename C>
+template<typename Q>
+inline
+V* FlatMap<K, V, C>::find(const Q& key)
+{
+    const Size position = locate(key);
+    return position != NPOS ? _values + position : 0;
+}
+
+template<typename K, typename V, typename C>
+template<typename F>
+inline
+void FlatMap<K, V, C>::forEach(F function) const
+{
+    if (_layout == EYTZINGER)
+    {
+        visit(1, function);
+        return;
+    }
+    for (Size i = 0; i < _size; ++i)
+    {
+        function(_keys[i], _values[i]);
+    }
+}
+
+// ACCESSOR FUNCTIONS
+template<typename K, typename V, typename C>
+inline
+bool FlatMap<K, V, C>::get(const K& key, V& value) const
+{
+    const Size position = locate(key);
+    if (position == NPOS)
+    {
+        return false;
+    }
+    value = _values[position];
+    return true;
+}
+
+template<typename K, typename V, typename C>
+inline
+bool FlatMap<K, V, C>::contains(const K& key) const
+{
+    return locate(key) != NPOS;
+}
+
+template<typename K, typename V, typename C>
+inline
+Size FlatMap<K, V, C>::size() const
+{
+    return _size;
+}
+
+template<typename K, typename V, typename C>
+template<typename Q>
+inline
+const V* FlatMap<K, V, C>::find(const Q& key) const
+{
+    const Size position = locate(key);
+    return position != NPOS ? _values + position : 0;
+}
+
+template<typename K, typename V, typename C>
+inline
+Size FlatMap<K, V, C>::capacity() const
+{
+    return _capacity;
+}
+
+template<typename K, typename V, typename C>
+inline
+typename FlatMap<K, V, C>::Layout FlatMap<K, V, C>::layout() const
+{
+    return _layout;
+}
+
+template<typename K, typename V, typename C>
+inline
+bool FlatMap<K, V, C>::isFrozen() const
+{
+    return _frozen;
+}
+
+// HELPER FUNCTIONS
+template<typename K, typename V, typename C>
+template<typename Q>
+inline
+Size FlatMap<K, V, C>::locate(const Q& key) const
+{
+    if (_layout == SORTED)
+    {
+        const Size position = lowerBound(key);
+        return position < _size && !_compare(key, _keys[position])
+                   ? position
+                   : NPOS;
+    }
+
+    // descend by adding the comparison to the child index; the first
+    // descendant a few levels down shares a cache line with its siblings
+    Size node = 1;
+    while (node <= _size)
+    {
+        const Size ahead = node << PREFETCH_LEVELS;
+        detail::prefetch(_keys + (ahead <= _size ? ahead : 0));
+        node = 2 * node + _compare(_keys[node], key);
+    }
+
+    // the last left turn was at the lower bound, which is undone by
+    // dropping the trailing right turns and that turn
+    while (node & 1)
+    {
+        node >>= 1;
+    }
+    node >>= 1;
+    return node && !_compare(key, _keys[node]) ? node : NPOS;
+}
+
+template<typename K, typename V, typename C>
+template<typename Q>
+inline
+Size FlatMap<K, V, C>::lowerBound(const Q& key) const
+{
+    if (!_size)
+    {
+        return 0;
+    }
+
+    // halve the range without branching on the comparison, prefetching
+    // the middles of both halves
+    const K* base = _keys;
+    Size length = _size;
+    while (length > 1)
+    {
+        const Size half = length / 2;
+        detail::prefetch(base + half / 2);
+        detail::prefetch(base + half + half / 2);
+        base = _compare(base[half], key) ? base + half : base;
+        length -= half;
+    }
+    return Size(base - _keys) + _compare(*base, key);
+}
+
+template<typename K, typename V, typename C>
+inline
+bool FlatMap<K, V, C>::relayout(Size capacity, Layout layout)
+{
+    assert(capacity >= _size);
+    const Size start = layout == EYTZINGER ? 1 : 0;
+    K* keys = 0;
+    V* values = 0;
+    if (capacity)
+    {
+        keys = _keyAllocator->allocate(start + capacity);
+        values = keys ? _valueAllocator->allocate(start + capacity) : 0;
+        if (!values)
+        {
+            if (keys)
+            {
+                _keyAllocator->free(keys);
+            }
+            return false;
+        }
+    }
+
+    if (_layout == layout)
+    {
+        for (Size i = start; i < start + _size; ++i)
+        {
+            transfer(i, i, keys, values);
+        }
+    }
+    else
+    {
+        arrange(0, 1, keys, values, layout == EYTZINGER);
+    }
+
+    if (_keys)
+    {
+        _keyAllocator->free(_keys);
+        _valueAllocator->free(_values);
+    }
+    _keys = keys;
+    _values = values;
+    _capacity = capacity;
+    _layout = layout;
+    return true;
+}
+
+template<typename K, typename V, typename C>
+inline
+Size FlatMap<K, V, C>::arrange(Size sorted, Size node, K* keys, V* values,
+                               bool forward)
+{
+    if (node > _size)
+    {
+        return sorted;
+    }
+    sorted = arrange(sorted, 2 * node, keys, values, forward);
+    if (forward)
+    {
+        transfer(sorted, node, keys, values);
+    }
+    else
+    {
+        transfer(node, sorted, keys, values);
+    }
+    return arrange(sorted + 1, 2 * node + 1, keys, values, forward);
+}
+
+template<typename K, typename V, typename C>
+inline
+void FlatMap<K, V, C>::transfer(Size from, Size to, K* keys, V* values)
+{
+    new (keys + to) K(std::move(_keys[from]));
+    new (values + to) V(std::move(_values[from]));
+    _keys[from].~K();
+    _values[from].~V();
+}
+
+template<typename K, typename V, typename C>
+template<typename F>
+inline
+void FlatMap<K, V, C>::visit(Size node, F& function) const
+{
+    if (node > _size)
+    {
+        return;
+    }
+    visit(2 * node, function);
+    function(_keys[node], _values[node]);
+    visit(2 * node + 1, function);
+}
+
+template<typename K, typename V, typename C>
+inline
+Size FlatMap<K, V, C>::first() const
+{
+    return _layout == EYTZINGER ? 1 : 0;
+}
+
+} // End nspc cntr
+
+} // End nspc gel
+
+#endif //GEL_FLAT_MAP_H
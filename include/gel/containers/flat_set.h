@@ -0,0 +1,399 @@
+// flat_set.h
+#ifndef GEL_FLAT_SET_H
+#define GEL_FLAT_SET_H
+
+#include <string.h>
+#include "gel/gellib.h"
+#include "gel/containers/control_group.h"
+#include "gel/containers/hash.h"
+#include "gel/containers/iset.h"
+#include "gel/containers/open_table.h"
+#include "gel/memory/heap_allocator.h"
+#include "gel/memory/iallocator.h"
+
+namespace gel
+{
+
+namespace cntr
+{
+
+/**
+ * @brief Defines an open addressing hash set with flat storage.
+ *
+ * This is the set counterpart of HashMap: the keys are stored inline in the
+ * same detail::OpenTable, whose control bytes are probed 16 at a time and
+ * whose erase() leaves no tombstones, and the set grows by doubling once it
+ * is seven eighths full.
+ *
+ * containsAll() and insertAll() work on many keys at once. They hash a
+ * batch of keys and prefetch their home slots before probing any of them,
+ * so the cache misses of the batch overlap instead of being paid one after
+ * another, which is what dominates membership tests of large sets.
+ *
+ * Inserting and erasing move the slots. The set is not thread safe.
+ *
+ * @tparam T The type of the keys, which must be equality comparable.
+ * @tparam H The hasher, whose results must agree for keys that compare
+ *           equal.
+ */
+template<typename T, typename H = Hash<T> >
+class FlatSet: public ISet<T>
+{
+  public:
+    /**
+     * The smallest number of slots of a set that has any.
+     */
+    static const Size MIN_CAPACITY = detail::ControlGroup::WIDTH;
+
+    /**
+     * The number of keys that containsAll() and insertAll() have in flight.
+     */
+    static const Size BATCH = 16;
+
+  private:
+    /**
+     * Gets the key of a slot, which is the key itself.
+     */
+    struct SlotKey
+    {
+        /**
+         * Gets the key of a slot.
+         *
+         * @param key The slot.
+         * @return    The key.
+         */
+        const T& operator()(const T& key) const;
+    };
+
+    /**
+     * The table type.
+     */
+    typedef detail::OpenTable<T, H, SlotKey> Table;
+
+    /**
+     * The slots.
+     */
+    Table _table;
+
+    // HELPER FUNCTIONS
+    /**
+     * Inserts a key, unless it is already present.
+     *
+     * @param key  The key.
+     * @param hash The hash of the key.
+     * @return     If the key was inserted.
+     */
+    bool insert(const T& key, uint64 hash);
+
+    /**
+     * Hashes a batch of keys and prefetches their home slots, so that the
+     * cache misses of the batch overlap.
+     *
+     * @param keys   The keys.
+     * @param count  The number of keys, which must not exceed BATCH.
+     * @param hashes The hashes of the keys.
+     */
+    void prefetchAll(const T* keys, Size count, uint64* hashes) const;
+
+    // DISABLED
+    FlatSet(const FlatSet<T, H>&);
+
+    FlatSet<T, H>& operator=(const FlatSet<T, H>&);
+
+  public:
+    // CONSTRUCTORS
+    /**
+     * Constructs a new empty set.
+     *
+     * @param allocator The allocator of the slots.
+     * @param hash      The hasher.
+     */
+    explicit FlatSet(
+        mem::IAllocator<uint8>& allocator =
+            mem::HeapAllocator<uint8>::instance(),
+        const H& hash = H());
+
+    /**
+     * Destructor.
+     */
+    virtual ~FlatSet();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Inserts a key, unless it is already present.
+     *
+     * @param key The key.
+     * @return    If the key was inserted, which fails if it is already
+     *            present or the set cannot grow.
+     */
+    virtual bool insert(const T& key);
+
+    /**
+     * Inserts many keys.
+     *
+     * @param keys  The keys.
+     * @param count The number of keys.
+     * @return      The number of keys that were inserted.
+     */
+    Size insertAll(const T* keys, Size count);
+
+    /**
+     * Erases a key, shifting the keys after it back.
+     *
+     * @param key The key.
+     * @return    If the key was present.
+     */
+    virtual bool erase(const T& key);
+
+    /**
+     * Erases every key.
+     */
+    virtual void clear();
+
+    /**
+     * Makes room for a number of keys, so that inserting them does not
+     * rehash.
+     *
+     * @param count The number of keys.
+     * @return      If the set has room for them.
+     */
+    bool reserve(Size count);
+
+    /**
+     * Calls a function with every key, in no particular order. The function
+     * must not change the set.
+     *
+     * @param function The function, which is called with a const T&.
+     */
+    template<typename F>
+    void forEach(F function) const;
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Checks if a key is present.
+     *
+     * @param key The key.
+     * @return    If the key is present.
+     */
+    virtual bool contains(const T& key) const;
+
+    /**
+     * Finds a key.
+     *
+     * @param key The key, or any value that hashes and compares equal to it.
+     * @return    The key in the set, or null if it is absent.
+     */
+    template<typename Q>
+    const T* find(const Q& key) const;
+
+    /**
+     * Checks which of many keys are present.
+     *
+     * @param keys   The keys.
+     * @param count  The number of keys.
+     * @param result The results, one for every key, which is set to one if
+     *               the key is present and zero otherwise.
+     * @return       The number of keys that are present.
+     */
+    Size containsAll(const T* keys, Size count, uint8* result) const;
+
+    /**
+     * Gets the number of keys.
+     *
+     * @return The number of keys.
+     */
+    virtual Size size() const;
+
+    /**
+     * Gets the number of slots.
+     *
+     * @return The number of slots.
+     */
+    Size capacity() const;
+};
+
+template<typename T, typename H>
+const Size FlatSet<T, H>::MIN_CAPACITY;
+
+template<typename T, typename H>
+const Size FlatSet<T, H>::BATCH;
+
+template<typename T, typename H>
+inline
+const T& FlatSet<T, H>::SlotKey::operator()(const T& key) const
+{
+    return key;
+}
+
+// CONSTRUCTORS
+template<typename T, typename H>
+inline
+FlatSet<T, H>::FlatSet(mem::IAllocator<uint8>& allocator, const H& hash)
+    : _table(allocator, hash)
+{
+}
+
+template<typename T, typename H>
+inline
+FlatSet<T, H>::~FlatSet()
+{
+}
+
+// MEMBER FUNCTIONS
+template<typename T, typename H>
+inline
+bool FlatSet<T, H>::insert(const T& key)
+{
+    return insert(key, _table.hash(key));
+}
+
+template<typename T, typename H>
+inline
+Size FlatSet<T, H>::insertAll(const T* keys, Size count)
+{
+    // an empty set cannot hold any of the keys yet, so it can be sized for
+    // all of them up front without overshooting on duplicates
+    if (!_table.size())
+    {
+        reserve(count);
+    }
+
+    uint64 hashes[BATCH];
+    Size inserted = 0;
+    for (Size start = 0; start < count; start += BATCH)
+    {
+        const Size end = count - start < BATCH ? count : start + BATCH;
+        prefetchAll(keys + start, end - start, hashes);
+        for (Size i = start; i < end; ++i)
+        {
+            inserted += insert(keys[i], hashes[i - start]);
+        }
+    }
+    return inserted;
+}
+
+template<typename T, typename H>
+inline
+bool FlatSet<T, H>::erase(const T& key)
+{
+    const Size index = _table.locate(key, _table.hash(key));
+    if (index == Table::NPOS)
+    {
+        return false;
+    }
+    _table.erase(index);
+    return true;
+}
+
+template<typename T, typename H>
+inline
+void FlatSet<T, H>::clear()
+{
+    _table.clear();
+}
+
+template<typename T, typename H>
+inline
+bool FlatSet<T, H>::reserve(Size count)
+{
+    return _table.reserve(count);
+}
+
+template<typename T, typename H>
+template<typename F>
+inline
+void FlatSet<T, H>::forEach(F function) const
+{
+    for (Size i = 0; _table.size() && i < _table.capacity(); ++i)
+    {
+        if (_table.isUsed(i))
+        {
+            function(_table.at(i));
+        }
+    }
+}
+
+// ACCESSOR FUNCTIONS
+template<typename T, typename H>
+inline
+bool FlatSet<T, H>::contains(const T& key) const
+{
+    return _table.locate(key, _table.hash(key)) != Table::NPOS;
+}
+
+template<typename T, typename H>
+template<typename Q>
+inline
+const T* FlatSet<T, H>::find(const Q& key) const
+{
+    const Size index = _table.locate(key, _table.hash(key));
+    return index != Table::NPOS ? &_table.at(index) : 0;
+}
+
+template<typename T, typename H>
+inline
+Size FlatSet<T, H>::containsAll(const T* keys, Size count,
+                                uint8* result) const
+{
+    if (!_table.size())
+    {
+        memset(result, 0, count);
+        return 0;
+    }
+
+    uint64 hashes[BATCH];
+    Size found = 0;
+    for (Size start = 0; start < count; start += BATCH)
+    {
+        const Size end = count - start < BATCH ? count : start + BATCH;
+        prefetchAll(keys + start, end - start, hashes);
+        for (Size i = start; i < end; ++i)
+        {
+            result[i] =
+                _table.locate(keys[i], hashes[i - start]) != Table::NPOS;
+            found += result[i];
+        }
+    }
+    return found;
+}
+
+template<typename T, typename H>
+inline
+Size FlatSet<T, H>::size() const
+{
+    return _table.size();
+}
+
+template<typename T, typename H>
+inline
+Size FlatSet<T, H>::capacity() const
+{
+    return _table.capacity();
+}
+
+// HELPER FUNCTIONS
+template<typename T, typename H>
+inline
+bool FlatSet<T, H>::insert(const T& key, uint64 hash)
+{
+    return _table.locate(key, hash) == Table::NPOS &&
+           _table.insert(key, hash);
+}
+
+template<typename T, typename H>
+inline
+void FlatSet<T, H>::prefetchAll(const T* keys, Size count,
+                                uint64* hashes) const
+{
+    for (Size i = 0; i < count; ++i)
+    {
+        hashes[i] = _table.hash(keys[i]);
+        _table.prefetch(hashes[i]);
+    }
+}
+
+} // End nspc cntr
+
+} // End nspc gel
+
+#endif //GEL_FLAT_SET_H
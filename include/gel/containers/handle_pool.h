@@ -0,0 +1,606 @@
+// handle_pool.h
+#ifndef GEL_HANDLE_POOL_H
+#define GEL_HANDLE_POOL_H
+
+#include <assert.h>
+#include <new>
+#include <utility>
+#include "gel/gellib.h"
+#include "gel/memory/heap_allocator.h"
+#include "gel/memory/iallocator.h"
+
+namespace gel
+{
+
+namespace cntr
+{
+
+/**
+ * @brief Defines a pool of objects that are referenced by generational
+ * handles.
+ *
+ * The objects are stored densely in one array, so they can be iterated as
+ * contiguous memory with data() and size(). A handle is an ID that packs
+ * the index of a slot with the generation of the slot, and the slot holds
+ * the position of its object in the dense array. Erasing an object moves
+ * the last object into its place and bumps the generation of its slot, so
+ * insert(), erase() and get() are O(1) and handles to erased objects are
+ * detected as stale instead of referencing whatever reuses the slot.
+ * Freed slots are reused in the order they were freed, which spreads the
+ * wrap around of the generations as far apart as possible.
+ *
+ * Erasing reorders the objects and growing moves them, so pointers into the
+ * pool are only valid until the next insert() or erase(). The pool is not
+ * thread safe.
+ *
+ * @tparam T The type that is stored, which must be copy or move
+ *           constructible and assignable.
+ */
+template<typename T>
+class HandlePool
+{
+  public:
+    /**
+     * The number of bits of a handle that hold the slot index.
+     */
+    static const unsigned INDEX_BITS = 20;
+
+    /**
+     * The number of bits of a handle that hold the generation.
+     */
+    static const unsigned GENERATION_BITS = 32 - INDEX_BITS;
+
+    /**
+     * The largest number of objects.
+     */
+    static const Size MAX_SIZE = Size(1) << INDEX_BITS;
+
+    /**
+     * The handle that never references an object.
+     */
+    static const ID NONE = 0;
+
+  private:
+    /**
+     * The mask of the slot index of a handle.
+     */
+    static const uint32 INDEX_MASK = (uint32(1) << INDEX_BITS) - 1;
+
+    /**
+     * The mask of a generation, once shifted down.
+     */
+    static const uint32 GENERATION_MASK = (uint32(1) << GENERATION_BITS) - 1;
+
+    /**
+     * The end of the list of free slots.
+     */
+    static const uint32 END = ~uint32(0);
+
+    /**
+     * The allocator of the objects.
+     */
+    mem::IAllocator<T>* _allocator;
+
+    /**
+     * The allocator of the slots and owners.
+     */
+    mem::IAllocator<uint32>* _indices;
+
+    /**
+     * The objects.
+     */
+    T* _objects;
+
+    /**
+     * The slot of every object.
+     */
+    uint32* _owners;
+
+    /**
+     * The position of the object of every slot, or the next free slot.
+     */
+    uint32* _slots;
+
+    /**
+     * The generation of every slot.
+     */
+    uint32* _generations;
+
+    /**
+     * The oldest free slot.
+     */
+    uint32 _freeHead;
+
+    /**
+     * The newest free slot.
+     */
+    uint32 _freeTail;
+
+    /**
+     * The number of slots that have been used.
+     */
+    Size _slotCount;
+
+    /**
+     * The number of objects.
+     */
+    Size _size;
+
+    /**
+     * The number of objects and slots there is room for.
+     */
+    Size _capacity;
+
+    // HELPER FUNCTIONS
+    /**
+     * Gets the slot of a handle, if the handle references an object.
+     *
+     * @param handle The handle.
+     * @param slot   The slot.
+     * @return       If the handle references an object.
+     */
+    bool resolve(ID handle, uint32& slot) const;
+
+    /**
+     * Moves the objects and slots into larger arrays.
+     *
+     * @param capacity The new capacity.
+     * @return         If the allocators provided the arrays.
+     */
+    bool grow(Size capacity);
+
+    // DISABLED
+    HandlePool(const HandlePool<T>&);
+
+    HandlePool<T>& operator=(const HandlePool<T>&);
+
+  public:
+    // CONSTRUCTORS
+    /**
+     * Constructs a new empty pool.
+     *
+     * @param allocator The allocator of the objects.
+     * @param indices   The allocator of the slots.
+     */
+    explicit HandlePool(
+        mem::IAllocator<T>& allocator = mem::HeapAllocator<T>::instance(),
+        mem::IAllocator<uint32>& indices =
+            mem::HeapAllocator<uint32>::instance());
+
+    /**
+     * Destructor. This destroys every object.
+     */
+    ~HandlePool();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Inserts a copy of an object.
+     *
+     * @param value The object.
+     * @return      The handle of the inserted object, or NONE if the pool
+     *              is full or could not grow.
+     */
+    ID insert(const T& value);
+
+    /**
+     * Erases an object, moving the last object into its place.
+     *
+     * @param handle The handle of the object.
+     * @return       If the handle referenced an object.
+     */
+    bool erase(ID handle);
+
+    /**
+     * Erases every object. Every handle becomes stale.
+     */
+    void clear();
+
+    /**
+     * Makes room for a number of objects.
+     *
+     * @param capacity The number of objects, which must not exceed MAX_SIZE.
+     * @return         If the pool has room for them.
+     */
+    bool reserve(Size capacity);
+
+    /**
+     * Gets the object of a handle.
+     *
+     * @param handle The handle.
+     * @return       The object, or null if the handle is stale or NONE.
+     */
+    T* get(ID handle);
+
+    /**
+     * Gets the object of a handle.
+     *
+     * @param handle The handle.
+     * @return       The object, or null if the handle is stale or NONE.
+     */
+    const T* get(ID handle) const;
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Checks if a handle references an object.
+     *
+     * @param handle The handle.
+     * @return       If the handle references an object.
+     */
+    bool contains(ID handle) const;
+
+    /**
+     * Gets the handle of an object by its position in the dense array.
+     *
+     * @param index The position, which must be less than size().
+     * @return      The handle.
+     */
+    ID handleAt(Size index) const;
+
+    /**
+     * Gets the dense array of objects.
+     *
+     * @return The first object.
+     */
+    T* data();
+
+    /**
+     * Gets the dense array of objects.
+     *
+     * @return The first object.
+     */
+    const T* data() const;
+
+    /**
+     * Gets the start of the dense array of objects.
+     *
+     * @return The first object.
+     */
+    T* begin();
+
+    /**
+     * Gets the start of the dense array of objects.
+     *
+     * @return The first object.
+     */
+    const T* begin() const;
+
+    /**
+     * Gets the end of the dense array of objects.
+     *
+     * @return The position after the last object.
+     */
+    T* end();
+
+    /**
+     * Gets the end of the dense array of objects.
+     *
+     * @return The position after the last object.
+     */
+    const T* end() const;
+
+    /**
+     * Gets the number of objects.
+     *
+     * @return The number of objects.
+     */
+    Size size() const;
+
+    /**
+     * Gets the number of objects there is room for without growing.
+     *
+     * @return The number of objects.
+     */
+    Size capacity() const;
+};
+
+template<typename T>
+const unsigned HandlePool<T>::INDEX_BITS;
+
+template<typename T>
+const unsigned HandlePool<T>::GENERATION_BITS;
+
+template<typename T>
+const Size HandlePool<T>::MAX_SIZE;
+
+template<typename T>
+const ID HandlePool<T>::NONE;
+
+template<typename T>
+const uint32 HandlePool<T>::INDEX_MASK;
+
+template<typename T>
+const uint32 HandlePool<T>::GENERATION_MASK;
+
+template<typename T>
+const uint32 HandlePool<T>::END;
+
+// CONSTRUCTORS
+template<typename T>
+inline
+HandlePool<T>::HandlePool(mem::IAllocator<T>& allocator,
+                          mem::IAllocator<uint32>& indices)
+    : _allocator(&allocator), _indices(&indices), _objects(0), _owners(0),
+      _slots(0), _generations(0), _freeHead(END), _freeTail(END),
+      _slotCount(0), _size(0), _capacity(0)
+{
+}
+
+template<typename T>
+inline
+HandlePool<T>::~HandlePool()
+{
+    clear();
+    if (_objects)
+    {
+        _allocator->free(_objects);
+    }
+    uint32* indices[] = { _owners, _slots, _generations };
+    for (Size i = 0; i < 3; ++i)
+    {
+        if (indices[i])
+        {
+            _indices->free(indices[i]);
+        }
+    }
+}
+
+// MEMBER FUNCTIONS
+template<typename T>
+inline
+ID HandlePool<T>::insert(const T& value)
+{
+    const T* source = &value;
+    if (_size == _capacity)
+    {
+        // the value may be one of the objects, which growing moves
+        const bool inside = source >= _objects && source < _objects + _size;
+        const Size index = inside ? source - _objects : 0;
+        if (_capacity == MAX_SIZE ||
+            !grow(_capacity ? 2 * _capacity : 16))
+        {
+            return NONE;
+        }
+        source = inside ? _objects + index : source;
+    }
+
+    uint32 slot;
+    if (_freeHead != END)
+    {
+        slot = _freeHead;
+        _freeHead = _slots[slot];
+        if (_freeHead == END)
+        {
+            _freeTail = END;
+        }
+    }
+    else
+    {
+        slot = static_cast<uint32>(_slotCount++);
+        _generations[slot] = 1;
+    }
+
+    new (_objects + _size) T(*source);
+    _owners[_size] = slot;
+    _slots[slot] = static_cast<uint32>(_size);
+    ++_size;
+    return (_generations[slot] << INDEX_BITS) | slot;
+}
+
+template<typename T>
+inline
+bool HandlePool<T>::erase(ID handle)
+{
+    uint32 slot;
+    if (!resolve(handle, slot))
+    {
+        return false;
+    }
+
+    // move the last object into the hole to keep the array dense
+    const uint32 index = _slots[slot];
+    const Size last = _size - 1;
+    if (index != last)
+    {
+        _objects[index] = std::move(_objects[last]);
+        _owners[index] = _owners[last];
+        _slots[_owners[index]] = index;
+    }
+    _objects[last].~T();
+    --_size;
+
+    // generation zero is skipped so that no handle equals NONE
+    _generations[slot] = (_generations[slot] + 1) & GENERATION_MASK;
+    if (!_generations[slot])
+    {
+        _generations[slot] = 1;
+    }
+
+    _slots[slot] = END;
+    if (_freeTail != END)
+    {
+        _slots[_freeTail] = slot;
+    }
+    else
+    {
+        _freeHead = slot;
+    }
+    _freeTail = slot;
+    return true;
+}
+
+template<typename T>
+inline
+void HandlePool<T>::clear()
+{
+    while (_size)
+    {
+        erase(handleAt(_size - 1));
+    }
+}
+
+template<typename T>
+inline
+bool HandlePool<T>::reserve(Size capacity)
+{
+    assert(capacity <= MAX_SIZE);
+    return capacity <= _capacity || grow(capacity);
+}
+
+template<typename T>
+inline
+T* HandlePool<T>::get(ID handle)
+{
+    uint32 slot;
+    return resolve(handle, slot) ? _objects + _slots[slot] : 0;
+}
+
+template<typename T>
+inline
+const T* HandlePool<T>::get(ID handle) const
+{
+    uint32 slot;
+    return resolve(handle, slot) ? _objects + _slots[slot] : 0;
+}
+
+// ACCESSOR FUNCTIONS
+template<typename T>
+inline
+bool HandlePool<T>::contains(ID handle) const
+{
+    uint32 slot;
+    return resolve(handle, slot);
+}
+
+template<typename T>
+inline
+ID HandlePool<T>::handleAt(Size index) const
+{
+    assert(index < _size);
+    const uint32 slot = _owners[index];
+    return (_generations[slot] << INDEX_BITS) | slot;
+}
+
+template<typename T>
+inline
+T* HandlePool<T>::data()
+{
+    return _objects;
+}
+
+template<typename T>
+inline
+const T* HandlePool<T>::data() const
+{
+    return _objects;
+}
+
+template<typename T>
+inline
+T* HandlePool<T>::begin()
+{
+    return _objects;
+}
+
+template<typename T>
+inline
+const T* HandlePool<T>::begin() const
+{
+    return _objects;
+}
+
+template<typename T>
+inline
+T* HandlePool<T>::end()
+{
+    return _objects + _size;
+}
+
+template<typename T>
+inline
+const T* HandlePool<T>::end() const
+{
+    return _objects + _size;
+}
+
+template<typename T>
+inline
+Size HandlePool<T>::size() const
+{
+    return _size;
+}
+
+template<typename T>
+inline
+Size HandlePool<T>::capacity() const
+{
+    return _capacity;
+}
+
+// HELPER FUNCTIONS
+template<typename T>
+inline
+bool HandlePool<T>::resolve(ID handle, uint32& slot) const
+{
+    // the generation can wrap around to that of a stale handle while its
+    // slot is free, so the slot must also own an object
+    slot = handle & INDEX_MASK;
+    return slot < _slotCount && _generations[slot] == (handle >> INDEX_BITS) &&
+           _slots[slot] < _size && _owners[_slots[slot]] == slot;
+}
+
+template<typename T>
+inline
+bool HandlePool<T>::grow(Size capacity)
+{
+    if (capacity > MAX_SIZE)
+    {
+        capacity = MAX_SIZE;
+    }
+
+    T* objects = _allocator->allocate(capacity);
+    if (!objects)
+    {
+        return false;
+    }
+    uint32* owners = _indices->reallocate(_owners, capacity);
+    if (owners)
+    {
+        _owners = owners;
+    }
+    uint32* slots = _indices->reallocate(_slots, capacity);
+    if (slots)
+    {
+        _slots = slots;
+    }
+    uint32* generations = _indices->reallocate(_generations, capacity);
+    if (generations)
+    {
+        _generations = generations;
+    }
+    if (!owners || !slots || !generations)
+    {
+        // the arrays that did grow keep their contents, so the pool is
+        // still valid at its old capacity
+        _allocator->free(objects);
+        return false;
+    }
+
+    for (Size i = 0; i < _size; ++i)
+    {
+        new (objects + i) T(std::move(_objects[i]));
+        _objects[i].~T();
+    }
+    if (_objects)
+    {
+        _allocator->free(_objects);
+    }
+    _objects = objects;
+    _capacity = capacity;
+    return true;
+}
+
+} // End nspc cntr
+
+} // End nspc gel
+
+#endif //GEL_HANDLE_POOL_H
@@ -0,0 +1,80 @@
+// hash.h
+#ifndef GEL_HASH_H
+#define GEL_HASH_H
+
+#include "gel/gellib.h"
+
+namespace gel
+{
+
+namespace cntr
+{
+
+/**
+ * Mixes the bits of an integer, so that every input bit affects every
+ * output bit. This is the finalizer of MurmurHash3.
+ *
+ * @param key The integer.
+ * @return    The hash.
+ */
+inline
+uint64 mix(uint64 key)
+{
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+    key *= 0xC4CEB9FE1A85EC53ULL;
+    key ^= key >> 33;
+    return key;
+}
+
+/**
+ * @brief Defines the default hash of the keys of the hashed containers.
+ *
+ * It hashes integers and enumerations by value, so the same value hashes
+ * the same whatever its type, which lets an ID be looked up by any integer.
+ * Other types need a specialization or their own hasher.
+ *
+ * @tparam K The type of the keys.
+ */
+template<typename K>
+struct Hash
+{
+    /**
+     * Hashes a key.
+     *
+     * @param key The key, or any integer that compares equal to one.
+     * @return    The hash.
+     */
+    template<typename Q>
+    uint64 operator()(const Q& key) const
+    {
+        return mix(static_cast<uint64>(key));
+    }
+};
+
+/**
+ * @brief Defines the hash of pointer keys, which hashes their address.
+ *
+ * @tparam T The type that is pointed to.
+ */
+template<typename T>
+struct Hash<T*>
+{
+    /**
+     * Hashes a key.
+     *
+     * @param key The key.
+     * @return    The hash.
+     */
+    uint64 operator()(const T* key) const
+    {
+        return mix(reinterpret_cast<uintptr_t>(key));
+    }
+};
+
+} // End nspc cntr
+
+} // End nspc gel
+
+#endif //GEL_HASH_H
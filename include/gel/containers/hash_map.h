@@ -0,0 +1,329 @@
+// hash_map.h
+#ifndef GEL_HASH_MAP_H
+#define GEL_HASH_MAP_H
+
+#include "gel/gellib.h"
+#include "gel/containers/control_group.h"
+#include "gel/containers/hash.h"
+#include "gel/containers/imap.h"
+#include "gel/containers/open_table.h"
+#include "gel/memory/heap_allocator.h"
+#include "gel/memory/iallocator.h"
+
+namespace gel
+{
+
+namespace cntr
+{
+
+/**
+ * @brief Defines an open addressing hash map with flat storage.
+ *
+ * Keys and values are stored inline in a detail::OpenTable, so there is no
+ * allocation per key. A lookup compares the control bytes of 16 slots at a
+ * time, with SSE2 where it is available, so keys are only compared on a
+ * likely match, and erase() shifts keys back instead of leaving tombstones,
+ * so lookups never slow down as keys come and go. The map grows by doubling
+ * once it is seven eighths full.
+ *
+ * find() takes any key type that the hasher accepts and that compares equal
+ * to K, so a map keyed by ID can be searched by any integer without a
+ * conversion. Inserting and erasing move the slots, so pointers to values
+ * are only valid until the map is next changed. The map is not thread safe.
+ *
+ * @tparam K The type of the keys, which must be equality comparable.
+ * @tparam V The type of the values.
+ * @tparam H The hasher, whose results must agree for keys that compare
+ *           equal.
+ */
+template<typename K, typename V, typename H = Hash<K> >
+class HashMap: public IMap<K, V>
+{
+  public:
+    /**
+     * The smallest number of slots of a map that has any.
+     */
+    static const Size MIN_CAPACITY = detail::ControlGroup::WIDTH;
+
+  private:
+    /**
+     * Defines a slot.
+     */
+    struct Entry
+    {
+        /**
+         * The key.
+         */
+        K key;
+
+        /**
+         * The value.
+         */
+        V value;
+
+        /**
+         * Constructs a new slot.
+         *
+         * @param key   The key.
+         * @param value The value.
+         */
+        Entry(const K& key, const V& value);
+    };
+
+    /**
+     * Gets the key of a slot.
+     */
+    struct EntryKey
+    {
+        /**
+         * Gets the key of a slot.
+         *
+         * @param entry The slot.
+         * @return      The key.
+         */
+        const K& operator()(const Entry& entry) const;
+    };
+
+    /**
+     * The table type.
+     */
+    typedef detail::OpenTable<Entry, H, EntryKey> Table;
+
+    /**
+     * The slots.
+     */
+    Table _table;
+
+    // DISABLED
+    HashMap(const HashMap<K, V, H>&);
+
+    HashMap<K, V, H>& operator=(const HashMap<K, V, H>&);
+
+  public:
+    // CONSTRUCTORS
+    /**
+     * Constructs a new empty map.
+     *
+     * @param allocator The allocator of the slots.
+     * @param hash      The hasher.
+     */
+    explicit HashMap(
+        mem::IAllocator<uint8>& allocator =
+            mem::HeapAllocator<uint8>::instance(),
+        const H& hash = H());
+
+    /**
+     * Destructor.
+     */
+    virtual ~HashMap();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Inserts a key and its value, unless the key is already present.
+     *
+     * @param key   The key.
+     * @param value The value.
+     * @return      If the key was inserted, which fails if it is already
+     *              present or the map cannot grow.
+     */
+    virtual bool insert(const K& key, const V& value);
+
+    /**
+     * Erases a key and its value, shifting the keys after it back.
+     *
+     * @param key The key.
+     * @return    If the key was present.
+     */
+    virtual bool erase(const K& key);
+
+    /**
+     * Erases every key.
+     */
+    virtual void clear();
+
+    /**
+     * Makes room for a number of keys, so that inserting them does not
+     * rehash.
+     *
+     * @param count The number of keys.
+     * @return      If the map has room for them.
+     */
+    bool reserve(Size count);
+
+    /**
+     * Finds the value of a key.
+     *
+     * @param key The key, or any value that hashes and compares equal to it.
+     * @return    The value, or null if the key is absent.
+     */
+    template<typename Q>
+    V* find(const Q& key);
+
+    /**
+     * Finds the value of a key.
+     *
+     * @param key The key, or any value that hashes and compares equal to it.
+     * @return    The value, or null if the key is absent.
+     */
+    template<typename Q>
+    const V* find(const Q& key) const;
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the value of a key.
+     *
+     * @param key   The key.
+     * @param value The value, which is only written if the key is present.
+     * @return      If the key is present.
+     */
+    virtual bool get(const K& key, V& value) const;
+
+    /**
+     * Checks if a key is present.
+     *
+     * @param key The key.
+     * @return    If the key is present.
+     */
+    virtual bool contains(const K& key) const;
+
+    /**
+     * Gets the number of keys.
+     *
+     * @return The number of keys.
+     */
+    virtual Size size() const;
+
+    /**
+     * Gets the number of slots.
+     *
+     * @return The number of slots.
+     */
+    Size capacity() const;
+};
+
+template<typename K, typename V, typename H>
+const Size HashMap<K, V, H>::MIN_CAPACITY;
+
+template<typename K, typename V, typename H>
+inline
+HashMap<K, V, H>::Entry::Entry(const K& key, const V& value)
+    : key(key), value(value)
+{
+}
+
+template<typename K, typename V, typename H>
+inline
+const K& HashMap<K, V, H>::EntryKey::operator()(const Entry& entry) const
+{
+    return entry.key;
+}
+
+// CONSTRUCTORS
+template<typename K, typename V, typename H>
+inline
+HashMap<K, V, H>::HashMap(mem::IAllocator<uint8>& allocator, const H& hash)
+    : _table(allocator, hash)
+{
+}
+
+template<typename K, typename V, typename H>
+inline
+HashMap<K, V, H>::~HashMap()
+{
+}
+
+// MEMBER FUNCTIONS
+template<typename K, typename V, typename H>
+inline
+bool HashMap<K, V, H>::insert(const K& key, const V& value)
+{
+    const uint64 hash = _table.hash(key);
+    return _table.locate(key, hash) == Table::NPOS &&
+           _table.insert(Entry(key, value), hash);
+}
+
+template<typename K, typename V, typename H>
+inline
+bool HashMap<K, V, H>::erase(const K& key)
+{
+    const Size index = _table.locate(key, _table.hash(key));
+    if (index == Table::NPOS)
+    {
+        return false;
+    }
+    _table.erase(index);
+    return true;
+}
+
+template<typename K, typename V, typename H>
+inline
+void HashMap<K, V, H>::clear()
+{
+    _table.clear();
+}
+
+template<typename K, typename V, typename H>
+inline
+bool HashMap<K, V, H>::reserve(Size count)
+{
+    return _table.reserve(count);
+}
+
+template<typename K, typename V, typename H>
+template<typename Q>
+inline
+V* HashMap<K, V, H>::find(const Q& key)
+{
+    const Size index = _table.locate(key, _table.hash(key));
+    return index != Table::NPOS ? &_table.at(index).value : 0;
+}
+
+template<typename K, typename V, typename H>
+template<typename Q>
+inline
+const V* HashMap<K, V, H>::find(const Q& key) const
+{
+    const Size index = _table.locate(key, _table.hash(key));
+    return index != Table::NPOS ? &_table.at(index).value : 0;
+}
+
+// ACCESSOR FUNCTIONS
+template<typename K, typename V, typename H>
+inline
+bool HashMap<K, V, H>::get(const K& key, V& value) const
+{
+    const V* found = find(key);
+    if (!found)
+    {
+        return false;
+    }
+    value = *found;
+    return true;
+}
+
+template<typename K, typename V, typename H>
+inline
+bool HashMap<K, V, H>::contains(const K& key) const
+{
+    return _table.locate(key, _table.hash(key)) != Table::NPOS;
+}
+
+template<typename K, typename V, typename H>
+inline
+Size HashMap<K, V, H>::size() const
+{
+    return _table.size();
+}
+
+template<typename K, typename V, typename H>
+inline
+Size HashMap<K, V, H>::capacity() const
+{
+    return _table.capacity();
+}
+
+} // End nspc cntr
+
+} // End nspc gel
+
+#endif //GEL_HASH_MAP_H
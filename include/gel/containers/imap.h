@@ -1,20 +1,89 @@
-// Map.h
+// imap.h
 #ifndef GEL_MAP_H
 #define GEL_MAP_H
 
+#include "gel/gellib.h"
+
 namespace gel
 {
 
 namespace cntr
 {
 
+/**
+ * @brief Defines a map from unique keys to values.
+ *
+ * Values are read by copying them out, so that implementations which move
+ * or reclaim their storage concurrently can honour the interface;
+ * implementations may additionally offer direct access to their storage.
+ *
+ * @tparam K The type of the keys.
+ * @tparam V The type of the values.
+ */
 template<typename K, typename V>
 class IMap
 {
+  public:
+    /**
+     * Destructor.
+     */
+    virtual ~IMap() = 0;
+
+    /**
+     * Inserts a key and its value, unless the key is already present.
+     *
+     * @param key   The key.
+     * @param value The value.
+     * @return      If the key was inserted, which fails if it is already
+     *              present or the map cannot grow.
+     */
+    virtual bool insert(const K& key, const V& value) = 0;
+
+    /**
+     * Erases a key and its value.
+     *
+     * @param key The key.
+     * @return    If the key was present.
+     */
+    virtual bool erase(const K& key) = 0;
+
+    /**
+     * Gets the value of a key.
+     *
+     * @param key   The key.
+     * @param value The value, which is only written if the key is present.
+     * @return      If the key is present.
+     */
+    virtual bool get(const K& key, V& value) const = 0;
+
+    /**
+     * Checks if a key is present.
+     *
+     * @param key The key.
+     * @return    If the key is present.
+     */
+    virtual bool contains(const K& key) const = 0;
 
+    /**
+     * Erases every key.
+     */
+    virtual void clear() = 0;
+
+    /**
+     * Gets the number of keys.
+     *
+     * @return The number of keys.
+     */
+    virtual Size size() const = 0;
 };
 
-} // End nspc
+template<typename K, typename V>
+inline
+IMap<K, V>::~IMap()
+{
+}
+
+} // End nspc cntr
 
 } // End nspc gel
 
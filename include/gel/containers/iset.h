@@ -2,18 +2,72 @@
 #ifndef GEL_ISET_H
 #define GEL_ISET_H
 
+#include "gel/gellib.h"
+
 namespace gel
 {
 
 namespace cntr
 {
 
+/**
+ * @brief Defines a set of unique keys.
+ *
+ * @tparam T The type of the keys.
+ */
 template<typename T>
 class ISet
 {
+  public:
+    /**
+     * Destructor.
+     */
+    virtual ~ISet() = 0;
+
+    /**
+     * Inserts a key, unless it is already present.
+     *
+     * @param key The key.
+     * @return    If the key was inserted, which fails if it is already
+     *            present or the set cannot grow.
+     */
+    virtual bool insert(const T& key) = 0;
+
+    /**
+     * Erases a key.
+     *
+     * @param key The key.
+     * @return    If the key was present.
+     */
+    virtual bool erase(const T& key) = 0;
+
+    /**
+     * Checks if a key is present.
+     *
+     * @param key The key.
+     * @return    If the key is present.
+     */
+    virtual bool contains(const T& key) const = 0;
 
+    /**
+     * Erases every key.
+     */
+    virtual void clear() = 0;
+
+    /**
+     * Gets the number of keys.
+     *
+     * @return The number of keys.
+     */
+    virtual Size size() const = 0;
 };
 
+template<typename T>
+inline
+ISet<T>::~ISet()
+{
+}
+
 } // End nspc cntr
 
 } // End nspc gel
@@ -0,0 +1,521 @@
+// open_table.h
+#ifndef GEL_OPEN_TABLE_H
+#define GEL_OPEN_TABLE_H
+
+#include <assert.h>
+#include <string.h>
+#include <new>
+#include <utility>
+#include "gel/gellib.h"
+#include "gel/containers/control_group.h"
+#include "gel/memory/iallocator.h"
+
+namespace gel
+{
+
+namespace cntr
+{
+
+namespace detail
+{
+
+/**
+ * @brief Defines the open addressing table of the flat hashed containers.
+ *
+ * The slots are stored inline in one array with a parallel array of control
+ * bytes, in a single block from the allocator. A control byte holds seven
+ * bits of the hash of the key in its slot or marks the slot as empty, and
+ * the home slot of a key is picked by the rest of the hash.
+ *
+ * Slots are probed linearly from the home slot, which lets erase() shift
+ * the following slots of the run back instead of leaving tombstones. The
+ * table grows by doubling once it is seven eighths full. Its owner hashes
+ * the keys, so that a hash can be computed once and used for both a lookup
+ * and an insertion.
+ *
+ * @tparam S The type of the slots.
+ * @tparam H The hasher.
+ * @tparam X The functor that gets the key of a slot.
+ */
+template<typename S, typename H, typename X>
+class OpenTable
+{
+  public:
+    /**
+     * The smallest number of slots of a table that has any.
+     */
+    static const Size MIN_CAPACITY = ControlGroup::WIDTH;
+
+    /**
+     * The position that is returned when a key is absent.
+     */
+    static const Size NPOS = ~Size(0);
+
+  private:
+    /**
+     * The allocator of the slots and control bytes.
+     */
+    mem::IAllocator<uint8>* _allocator;
+
+    /**
+     * The hasher.
+     */
+    H _hash;
+
+    /**
+     * The key getter.
+     */
+    X _key;
+
+    /**
+     * The slots.
+     */
+    S* _slots;
+
+    /**
+     * The control bytes, followed by a copy of the first group so that a
+     * group can be loaded from any slot without wrapping.
+     */
+    uint8* _control;
+
+    /**
+     * The number of slots.
+     */
+    Size _capacity;
+
+    /**
+     * The number of keys.
+     */
+    Size _size;
+
+    // HELPER FUNCTIONS
+    /**
+     * Finds the first empty slot from the home slot of a hash.
+     *
+     * @param hash The hash.
+     * @return     The slot.
+     */
+    Size vacancy(uint64 hash) const;
+
+    /**
+     * Sets a control byte and its copy.
+     *
+     * @param index The slot.
+     * @param value The control byte.
+     */
+    void setControl(Size index, uint8 value);
+
+    /**
+     * Moves every slot into a new array of slots.
+     *
+     * @param capacity The number of slots, which must be a power of two no
+     *                 smaller than MIN_CAPACITY.
+     * @return         If the allocator provided the slots.
+     */
+    bool rehash(Size capacity);
+
+    /**
+     * Gets the number of keys that a number of slots can hold.
+     *
+     * @param capacity The number of slots.
+     * @return         The number of keys.
+     */
+    static Size limit(Size capacity);
+
+    // DISABLED
+    OpenTable(const OpenTable<S, H, X>&);
+
+    OpenTable<S, H, X>& operator=(const OpenTable<S, H, X>&);
+
+  public:
+    // CONSTRUCTORS
+    /**
+     * Constructs a new empty table.
+     *
+     * @param allocator The allocator of the slots.
+     * @param hash      The hasher.
+     */
+    OpenTable(mem::IAllocator<uint8>& allocator, const H& hash);
+
+    /**
+     * Destructor.
+     */
+    ~OpenTable();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Inserts a slot whose key is absent, growing the table if it is full.
+     *
+     * @param slot The slot.
+     * @param hash The hash of its key.
+     * @return     If the slot was inserted, which fails if the table cannot
+     *             grow.
+     */
+    bool insert(const S& slot, uint64 hash);
+
+    /**
+     * Erases a slot, shifting the slots after it back.
+     *
+     * @param index The slot, which must be in use.
+     */
+    void erase(Size index);
+
+    /**
+     * Erases every slot.
+     */
+    void clear();
+
+    /**
+     * Makes room for a number of keys, so that inserting them does not
+     * rehash.
+     *
+     * @param count The number of keys.
+     * @return      If the table has room for them.
+     */
+    bool reserve(Size count);
+
+    /**
+     * Hints the processor to load the home slot of a hash.
+     *
+     * @param hash The hash.
+     */
+    void prefetch(uint64 hash) const;
+
+    /**
+     * Gets a slot.
+     *
+     * @param index The slot, which must be in use.
+     * @return      The slot.
+     */
+    S& at(Size index);
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Hashes a key.
+     *
+     * @param key The key.
+     * @return    The hash.
+     */
+    template<typename Q>
+    uint64 hash(const Q& key) const;
+
+    /**
+     * Finds the slot of a key.
+     *
+     * @param key  The key, or any value that compares equal to it.
+     * @param hash The hash of the key.
+     * @return     The slot, or NPOS if the key is absent.
+     */
+    template<typename Q>
+    Size locate(const Q& key, uint64 hash) const;
+
+    /**
+     * Gets a slot.
+     *
+     * @param index The slot, which must be in use.
+     * @return      The slot.
+     */
+    const S& at(Size index) const;
+
+    /**
+     * Checks if a slot is in use.
+     *
+     * @param index The slot.
+     * @return      If the slot holds a key.
+     */
+    bool isUsed(Size index) const;
+
+    /**
+     * Gets the number of keys.
+     *
+     * @return The number of keys.
+     */
+    Size size() const;
+
+    /**
+     * Gets the number of slots.
+     *
+     * @return The number of slots.
+     */
+    Size capacity() const;
+};
+
+template<typename S, typename H, typename X>
+const Size OpenTable<S, H, X>::MIN_CAPACITY;
+
+template<typename S, typename H, typename X>
+const Size OpenTable<S, H, X>::NPOS;
+
+// CONSTRUCTORS
+template<typename S, typename H, typename X>
+inline
+OpenTable<S, H, X>::OpenTable(mem::IAllocator<uint8>& allocator,
+                              const H& hash)
+    : _allocator(&allocator), _hash(hash), _key(), _slots(0), _control(0),
+      _capacity(0), _size(0)
+{
+}
+
+template<typename S, typename H, typename X>
+inline
+OpenTable<S, H, X>::~OpenTable()
+{
+    clear();
+    if (_slots)
+    {
+        _allocator->free(reinterpret_cast<uint8*>(_slots));
+    }
+}
+
+// MEMBER FUNCTIONS
+template<typename S, typename H, typename X>
+inline
+bool OpenTable<S, H, X>::insert(const S& slot, uint64 hash)
+{
+    if (_size + 1 > limit(_capacity) &&
+        !rehash(_capacity ? 2 * _capacity : MIN_CAPACITY))
+    {
+        return false;
+    }
+
+    const Size index = vacancy(hash);
+    new (_slots + index) S(slot);
+    setControl(index, static_cast<uint8>(hash & 0x7F));
+    ++_size;
+    return true;
+}
+
+template<typename S, typename H, typename X>
+inline
+void OpenTable<S, H, X>::erase(Size index)
+{
+    assert(index < _capacity && isUsed(index));
+
+    // shift back every following slot of the run that the hole separates
+    // from its home slot, which is when its home is not in (hole, index]
+    const Size mask = _capacity - 1;
+    Size hole = index;
+    _slots[hole].~S();
+    for (index = (hole + 1) & mask; _control[index] != ControlGroup::EMPTY;
+         index = (index + 1) & mask)
+    {
+        const Size home = (_hash(_key(_slots[index])) >> 7) & mask;
+        if (((index - home) & mask) < ((index - hole) & mask))
+        {
+            continue;
+        }
+        new (_slots + hole) S(std::move(_slots[index]));
+        _slots[index].~S();
+        setControl(hole, _control[index]);
+        hole = index;
+    }
+    setControl(hole, ControlGroup::EMPTY);
+    --_size;
+}
+
+template<typename S, typename H, typename X>
+inline
+void OpenTable<S, H, X>::clear()
+{
+    if (!_size)
+    {
+        return;
+    }
+    for (Size i = 0; i < _capacity; ++i)
+    {
+        if (_control[i] != ControlGroup::EMPTY)
+        {
+            _slots[i].~S();
+        }
+    }
+    memset(_control, ControlGroup::EMPTY, _capacity + ControlGroup::WIDTH);
+    _size = 0;
+}
+
+template<typename S, typename H, typename X>
+inline
+bool OpenTable<S, H, X>::reserve(Size count)
+{
+    Size capacity = _capacity ? _capacity : MIN_CAPACITY;
+    while (limit(capacity) < count)
+    {
+        capacity *= 2;
+    }
+    return capacity == _capacity || rehash(capacity);
+}
+
+template<typename S, typename H, typename X>
+inline
+void OpenTable<S, H, X>::prefetch(uint64 hash) const
+{
+    if (_capacity)
+    {
+        const Size home = (hash >> 7) & (_capacity - 1);
+        detail::prefetch(_control + home);
+        detail::prefetch(_slots + home);
+    }
+}
+
+template<typename S, typename H, typename X>
+inline
+S& OpenTable<S, H, X>::at(Size index)
+{
+    assert(index < _capacity && isUsed(index));
+    return _slots[index];
+}
+
+// ACCESSOR FUNCTIONS
+template<typename S, typename H, typename X>
+template<typename Q>
+inline
+uint64 OpenTable<S, H, X>::hash(const Q& key) const
+{
+    return _hash(key);
+}
+
+template<typename S, typename H, typename X>
+template<typename Q>
+inline
+Size OpenTable<S, H, X>::locate(const Q& key, uint64 hash) const
+{
+    if (!_size)
+    {
+        return NPOS;
+    }
+
+    // a key lies between its home slot and the first empty slot after it
+    const uint8 low = static_cast<uint8>(hash & 0x7F);
+    const Size mask = _capacity - 1;
+    for (Size group = (hash >> 7) & mask; ;
+         group = (group + ControlGroup::WIDTH) & mask)
+    {
+        const uint8* control = _control + group;
+        for (uint32 bits = ControlGroup::match(control, low); bits;
+             bits &= bits - 1)
+        {
+            const Size index = (group + ControlGroup::lowestBit(bits)) & mask;
+            if (_key(_slots[index]) == key)
+            {
+                return index;
+            }
+        }
+        if (ControlGroup::matchEmpty(control))
+        {
+            return NPOS;
+        }
+    }
+}
+
+template<typename S, typename H, typename X>
+inline
+const S& OpenTable<S, H, X>::at(Size index) const
+{
+    assert(index < _capacity && isUsed(index));
+    return _slots[index];
+}
+
+template<typename S, typename H, typename X>
+inline
+bool OpenTable<S, H, X>::isUsed(Size index) const
+{
+    return _control[index] != ControlGroup::EMPTY;
+}
+
+template<typename S, typename H, typename X>
+inline
+Size OpenTable<S, H, X>::size() const
+{
+    return _size;
+}
+
+template<typename S, typename H, typename X>
+inline
+Size OpenTable<S, H, X>::capacity() const
+{
+    return _capacity;
+}
+
+// HELPER FUNCTIONS
+template<typename S, typename H, typename X>
+inline
+Size OpenTable<S, H, X>::vacancy(uint64 hash) const
+{
+    const Size mask = _capacity - 1;
+    for (Size group = (hash >> 7) & mask; ;
+         group = (group + ControlGroup::WIDTH) & mask)
+    {
+        const uint32 bits = ControlGroup::matchEmpty(_control + group);
+        if (bits)
+        {
+            return (group + ControlGroup::lowestBit(bits)) & mask;
+        }
+    }
+}
+
+template<typename S, typename H, typename X>
+inline
+void OpenTable<S, H, X>::setControl(Size index, uint8 value)
+{
+    _control[index] = value;
+    if (index < ControlGroup::WIDTH)
+    {
+        _control[_capacity + index] = value;
+    }
+}
+
+template<typename S, typename H, typename X>
+inline
+bool OpenTable<S, H, X>::rehash(Size capacity)
+{
+    // the control bytes follow the slots in the same block, which the
+    // allocator aligns to at least 16 bytes
+    const Size slotBytes =
+        (capacity * sizeof(S) + ControlGroup::WIDTH - 1) &
+        ~(ControlGroup::WIDTH - 1);
+    uint8* block =
+        _allocator->allocate(slotBytes + capacity + ControlGroup::WIDTH);
+    if (!block)
+    {
+        return false;
+    }
+
+    S* slots = _slots;
+    uint8* control = _control;
+    const Size previous = _capacity;
+    _slots = reinterpret_cast<S*>(block);
+    _control = block + slotBytes;
+    _capacity = capacity;
+    memset(_control, ControlGroup::EMPTY, capacity + ControlGroup::WIDTH);
+
+    for (Size i = 0; i < previous; ++i)
+    {
+        if (control[i] == ControlGroup::EMPTY)
+        {
+            continue;
+        }
+        const Size index = vacancy(_hash(_key(slots[i])));
+        new (_slots + index) S(std::move(slots[i]));
+        setControl(index, control[i]);
+        slots[i].~S();
+    }
+    if (slots)
+    {
+        _allocator->free(reinterpret_cast<uint8*>(slots));
+    }
+    return true;
+}
+
+template<typename S, typename H, typename X>
+inline
+Size OpenTable<S, H, X>::limit(Size capacity)
+{
+    return capacity - capacity / 8;
+}
+
+} // End nspc detail
+
+} // End nspc cntr
+
+} // End nspc gel
+
+#endif //GEL_OPEN_TABLE_H
@@ -0,0 +1,680 @@
+// sparse_set.h
+#ifndef GEL_SPARSE_SET_H
+#define GEL_SPARSE_SET_H
+
+#include <assert.h>
+#include <new>
+#include <utility>
+#include "gel/gellib.h"
+#include "gel/memory/heap_allocator.h"
+#include "gel/memory/iallocator.h"
+
+namespace gel
+{
+
+namespace cntr
+{
+
+/**
+ * @brief Defines a set of objects keyed by IDs, which are stored densely.
+ *
+ * The objects and their IDs are stored packed in two parallel arrays, so
+ * they can be iterated as contiguous memory with data() and size(), which
+ * is what a system does with its components every frame. A sparse array
+ * maps every ID to the position of its object. It is split in pages that
+ * are allocated when the first ID of their block is inserted and freed
+ * when the last one is erased, and the table of pages ends at the highest
+ * page in use, so its memory scales with the blocks of IDs that are live
+ * rather than with the largest ID ever inserted. Erasing an object moves
+ * the last object into its place, so insert(), erase(), get() and
+ * contains() are O(1).
+ *
+ * Erasing reorders the objects and growing moves them, so pointers into the
+ * set are only valid until the next insert() or erase(). The set is not
+ * thread safe.
+ *
+ * @tparam T The type that is stored, which must be copy or move
+ *           constructible and assignable.
+ */
+template<typename T>
+class SparseSet
+{
+  public:
+    /**
+     * The number of bits of an ID that select its entry within a page.
+     */
+    static const unsigned PAGE_BITS = 10;
+
+    /**
+     * The number of IDs of a page.
+     */
+    static const Size PAGE_SIZE = Size(1) << PAGE_BITS;
+
+  private:
+    /**
+     * The entry of an ID that has no object.
+     */
+    static const uint32 EMPTY = ~uint32(0);
+
+    /**
+     * The allocator of the objects.
+     */
+    mem::IAllocator<T>* _allocator;
+
+    /**
+     * The allocator of the IDs, the pages and the page counts.
+     */
+    mem::IAllocator<uint32>* _indices;
+
+    /**
+     * The allocator of the page table.
+     */
+    mem::IAllocator<uint32*>* _tables;
+
+    /**
+     * The objects.
+     */
+    T* _objects;
+
+    /**
+     * The ID of every object.
+     */
+    ID* _ids;
+
+    /**
+     * The pages of the sparse array, which are null while they hold no ID.
+     */
+    uint32** _pages;
+
+    /**
+     * The number of IDs of every page.
+     */
+    uint32* _pageCounts;
+
+    /**
+     * The number of entries of the page table.
+     */
+    Size _pageCount;
+
+    /**
+     * The number of objects.
+     */
+    Size _size;
+
+    /**
+     * The number of objects there is room for.
+     */
+    Size _capacity;
+
+    // HELPER FUNCTIONS
+    /**
+     * Gets the position of the object of an ID.
+     *
+     * @param id The ID.
+     * @return   The position, or EMPTY if the ID has no object.
+     */
+    uint32 locate(ID id) const;
+
+    /**
+     * Gets the entry of an ID, allocating its page if needed.
+     *
+     * @param id The ID.
+     * @return   The entry, or null if the allocators are exhausted.
+     */
+    uint32* claim(ID id);
+
+    /**
+     * Shrinks the page table to end at the highest page in use.
+     */
+    void trim();
+
+    /**
+     * Moves the objects and IDs into larger arrays.
+     *
+     * @param capacity The new capacity.
+     * @return         If the allocators provided the arrays.
+     */
+    bool grow(Size capacity);
+
+    // DISABLED
+    SparseSet(const SparseSet<T>&);
+
+    SparseSet<T>& operator=(const SparseSet<T>&);
+
+  public:
+    // CONSTRUCTORS
+    /**
+     * Constructs a new empty set.
+     *
+     * @param allocator The allocator of the objects.
+     * @param indices   The allocator of the IDs and pages.
+     * @param tables    The allocator of the page table.
+     */
+    explicit SparseSet(
+        mem::IAllocator<T>& allocator = mem::HeapAllocator<T>::instance(),
+        mem::IAllocator<uint32>& indices =
+            mem::HeapAllocator<uint32>::instance(),
+        mem::IAllocator<uint32*>& tables =
+            mem::HeapAllocator<uint32*>::instance());
+
+    /**
+     * Destructor. This destroys every object.
+     */
+    ~SparseSet();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Inserts a copy of an object for an ID, unless the ID has one.
+     *
+     * @param id    The ID.
+     * @param value The object.
+     * @return      The inserted object, or null if the ID already has one
+     *              or the allocators are exhausted.
+     */
+    T* insert(ID id, const T& value);
+
+    /**
+     * Erases the object of an ID, moving the last object into its place.
+     *
+     * @param id The ID.
+     * @return   If the ID had an object.
+     */
+    bool erase(ID id);
+
+    /**
+     * Erases every object and frees every page.
+     */
+    void clear();
+
+    /**
+     * Makes room for a number of objects.
+     *
+     * @param capacity The number of objects.
+     * @return         If the set has room for them.
+     */
+    bool reserve(Size capacity);
+
+    /**
+     * Gets the object of an ID.
+     *
+     * @param id The ID.
+     * @return   The object, or null if the ID has none.
+     */
+    T* get(ID id);
+
+    /**
+     * Gets the object of an ID.
+     *
+     * @param id The ID.
+     * @return   The object, or null if the ID has none.
+     */
+    const T* get(ID id) const;
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Checks if an ID has an object.
+     *
+     * @param id The ID.
+     * @return   If the ID has an object.
+     */
+    bool contains(ID id) const;
+
+    /**
+     * Gets the ID of an object by its position in the dense array.
+     *
+     * @param index The position, which must be less than size().
+     * @return      The ID.
+     */
+    ID idAt(Size index) const;
+
+    /**
+     * Gets the dense array of IDs, in the order of the objects.
+     *
+     * @return The first ID.
+     */
+    const ID* ids() const;
+
+    /**
+     * Gets the dense array of objects.
+     *
+     * @return The first object.
+     */
+    T* data();
+
+    /**
+     * Gets the dense array of objects.
+     *
+     * @return The first object.
+     */
+    const T* data() const;
+
+    /**
+     * Gets the start of the dense array of objects.
+     *
+     * @return The first object.
+     */
+    T* begin();
+
+    /**
+     * Gets the start of the dense array of objects.
+     *
+     * @return The first object.
+     */
+    const T* begin() const;
+
+    /**
+     * Gets the end of the dense array of objects.
+     *
+     * @return The position after the last object.
+     */
+    T* end();
+
+    /**
+     * Gets the end of the dense array of objects.
+     *
+     * @return The position after the last object.
+     */
+    const T* end() const;
+
+    /**
+     * Gets the number of objects.
+     *
+     * @return The number of objects.
+     */
+    Size size() const;
+
+    /**
+     * Gets the number of objects there is room for without growing.
+     *
+     * @return The number of objects.
+     */
+    Size capacity() const;
+
+    /**
+     * Gets the number of pages of the sparse array that are allocated.
+     *
+     * @return The number of pages.
+     */
+    Size pages() const;
+};
+
+template<typename T>
+const unsigned SparseSet<T>::PAGE_BITS;
+
+template<typename T>
+const Size SparseSet<T>::PAGE_SIZE;
+
+template<typename T>
+const uint32 SparseSet<T>::EMPTY;
+
+// CONSTRUCTORS
+template<typename T>
+inline
+SparseSet<T>::SparseSet(mem::IAllocator<T>& allocator,
+                        mem::IAllocator<uint32>& indices,
+                        mem::IAllocator<uint32*>& tables)
+    : _allocator(&allocator), _indices(&indices), _tables(&tables),
+      _objects(0), _ids(0), _pages(0), _pageCounts(0), _pageCount(0),
+      _size(0), _capacity(0)
+{
+}
+
+template<typename T>
+inline
+SparseSet<T>::~SparseSet()
+{
+    clear();
+    if (_objects)
+    {
+        _allocator->free(_objects);
+    }
+    if (_ids)
+    {
+        _indices->free(_ids);
+    }
+    if (_pages)
+    {
+        _tables->free(_pages);
+    }
+    if (_pageCounts)
+    {
+        _indices->free(_pageCounts);
+    }
+}
+
+// MEMBER FUNCTIONS
+template<typename T>
+inline
+T* SparseSet<T>::insert(ID id, const T& value)
+{
+    if (locate(id) != EMPTY)
+    {
+        return 0;
+    }
+
+    const T* source = &value;
+    if (_size == _capacity)
+    {
+        // the value may be one of the objects, which growing moves
+        const bool inside = source >= _objects && source < _objects + _size;
+        const Size index = inside ? source - _objects : 0;
+        if (!grow(_capacity ? 2 * _capacity : 16))
+        {
+            return 0;
+        }
+        source = inside ? _objects + index : source;
+    }
+
+    uint32* entry = claim(id);
+    if (!entry)
+    {
+        return 0;
+    }
+    new (_objects + _size) T(*source);
+    _ids[_size] = id;
+    *entry = static_cast<uint32>(_size);
+    return _objects + _size++;
+}
+
+template<typename T>
+inline
+bool SparseSet<T>::erase(ID id)
+{
+    const uint32 index = locate(id);
+    if (index == EMPTY)
+    {
+        return false;
+    }
+
+    // move the last object into the hole to keep the array dense
+    const Size last = _size - 1;
+    if (index != last)
+    {
+        _objects[index] = std::move(_objects[last]);
+        _ids[index] = _ids[last];
+        _pages[_ids[index] >> PAGE_BITS][_ids[index] & (PAGE_SIZE - 1)] =
+            index;
+    }
+    _objects[last].~T();
+    --_size;
+
+    const Size page = id >> PAGE_BITS;
+    _pages[page][id & (PAGE_SIZE - 1)] = EMPTY;
+    if (!--_pageCounts[page])
+    {
+        _indices->free(_pages[page]);
+        _pages[page] = 0;
+        trim();
+    }
+    return true;
+}
+
+template<typename T>
+inline
+void SparseSet<T>::clear()
+{
+    for (Size i = 0; i < _size; ++i)
+    {
+        _objects[i].~T();
+    }
+    _size = 0;
+    for (Size page = 0; page < _pageCount; ++page)
+    {
+        if (_pages[page])
+        {
+            _indices->free(_pages[page]);
+            _pages[page] = 0;
+            _pageCounts[page] = 0;
+        }
+    }
+    trim();
+}
+
+template<typename T>
+inline
+bool SparseSet<T>::reserve(Size capacity)
+{
+    return capacity <= _capacity || grow(capacity);
+}
+
+template<typename T>
+inline
+T* SparseSet<T>::get(ID id)
+{
+    const uint32 index = locate(id);
+    return index != EMPTY ? _objects + index : 0;
+}
+
+template<typename T>
+inline
+const T* SparseSet<T>::get(ID id) const
+{
+    const uint32 index = locate(id);
+    return index != EMPTY ? _objects + index : 0;
+}
+
+// ACCESSOR FUNCTIONS
+template<typename T>
+inline
+bool SparseSet<T>::contains(ID id) const
+{
+    return locate(id) != EMPTY;
+}
+
+template<typename T>
+inline
+ID SparseSet<T>::idAt(Size index) const
+{
+    assert(index < _size);
+    return _ids[index];
+}
+
+template<typename T>
+inline
+const ID* SparseSet<T>::ids() const
+{
+    return _ids;
+}
+
+template<typename T>
+inline
+T* SparseSet<T>::data()
+{
+    return _objects;
+}
+
+template<typename T>
+inline
+const T* SparseSet<T>::data() const
+{
+    return _objects;
+}
+
+template<typename T>
+inline
+T* SparseSet<T>::begin()
+{
+    return _objects;
+}
+
+template<typename T>
+inline
+const T* SparseSet<T>::begin() const
+{
+    return _objects;
+}
+
+template<typename T>
+inline
+T* SparseSet<T>::end()
+{
+    return _objects + _size;
+}
+
+template<typename T>
+inline
+const T* SparseSet<T>::end() const
+{
+    return _objects + _size;
+}
+
+template<typename T>
+inline
+Size SparseSet<T>::size() const
+{
+    return _size;
+}
+
+template<typename T>
+inline
+Size SparseSet<T>::capacity() const
+{
+    return _capacity;
+}
+
+template<typename T>
+inline
+Size SparseSet<T>::pages() const
+{
+    Size count = 0;
+    for (Size page = 0; page < _pageCount; ++page)
+    {
+        count += _pages[page] != 0;
+    }
+    return count;
+}
+
+// HELPER FUNCTIONS
+template<typename T>
+inline
+uint32 SparseSet<T>::locate(ID id) const
+{
+    const Size page = id >> PAGE_BITS;
+    if (page >= _pageCount || !_pages[page])
+    {
+        return EMPTY;
+    }
+    return _pages[page][id & (PAGE_SIZE - 1)];
+}
+
+template<typename T>
+inline
+uint32* SparseSet<T>::claim(ID id)
+{
+    const Size page = id >> PAGE_BITS;
+    if (page >= _pageCount)
+    {
+        // the table only reaches the highest page in use
+        const Size count = page + 1;
+        uint32** pages = _tables->reallocate(_pages, count);
+        if (!pages)
+        {
+            return 0;
+        }
+        _pages = pages;
+        uint32* counts = _indices->reallocate(_pageCounts, count);
+        if (!counts)
+        {
+            return 0;
+        }
+        _pageCounts = counts;
+        for (Size i = _pageCount; i < count; ++i)
+        {
+            _pages[i] = 0;
+            _pageCounts[i] = 0;
+        }
+        _pageCount = count;
+    }
+
+    if (!_pages[page])
+    {
+        uint32* entries = _indices->allocate(PAGE_SIZE);
+        if (!entries)
+        {
+            return 0;
+        }
+        for (Size i = 0; i < PAGE_SIZE; ++i)
+        {
+            entries[i] = EMPTY;
+        }
+        _pages[page] = entries;
+    }
+    ++_pageCounts[page];
+    return _pages[page] + (id & (PAGE_SIZE - 1));
+}
+
+template<typename T>
+inline
+void SparseSet<T>::trim()
+{
+    Size count = _pageCount;
+    while (count && !_pages[count - 1])
+    {
+        --count;
+    }
+    if (count == _pageCount)
+    {
+        return;
+    }
+
+    if (!count)
+    {
+        _tables->free(_pages);
+        _indices->free(_pageCounts);
+        _pages = 0;
+        _pageCounts = 0;
+        _pageCount = 0;
+        return;
+    }
+
+    // shrinking keeps the contents, so a failure only keeps the memory
+    uint32** pages = _tables->reallocate(_pages, count);
+    if (pages)
+    {
+        _pages = pages;
+    }
+    uint32* counts = _indices->reallocate(_pageCounts, count);
+    if (counts)
+    {
+        _pageCounts = counts;
+    }
+    _pageCount = count;
+}
+
+template<typename T>
+inline
+bool SparseSet<T>::grow(Size capacity)
+{
+    assert(capacity < EMPTY);
+    T* objects = _allocator->allocate(capacity);
+    if (!objects)
+    {
+        return false;
+    }
+    ID* ids = _indices->reallocate(_ids, capacity);
+    if (!ids)
+    {
+        _allocator->free(objects);
+        return false;
+    }
+    _ids = ids;
+
+    for (Size i = 0; i < _size; ++i)
+    {
+        new (objects + i) T(std::move(_objects[i]));
+        _objects[i].~T();
+    }
+    if (_objects)
+    {
+        _allocator->free(_objects);
+    }
+    _objects = objects;
+    _capacity = capacity;
+    return true;
+}
+
+} // End nspc cntr
+
+} // End nspc gel
+
+#endif //GEL_SPARSE_SET_H
@@ -4,6 +4,53 @@
 
 #include "gel/gelint.h"
 
+/**
+ * CONSTEXPR SUPPORT
+ *
+ * Building with C++14 or later on a compiler that can detect constant
+ * evaluation defines GEL_HAS_CONSTEXPR to 1 and makes GEL_CONSTEXPR expand
+ * to constexpr, so the math types can be used in constant expressions.
+ * GEL_CONSTANT_EVALUATED() is true while a function is evaluated at compile
+ * time, which lets SIMD code fall back to scalar arithmetic there.
+ */
+#if __cplusplus >= 201402L && defined( __has_builtin )
+#if __has_builtin( __builtin_is_constant_evaluated )
+#define GEL_HAS_CONSTEXPR 1
+#endif
+#endif
+
+#ifdef GEL_HAS_CONSTEXPR
+#define GEL_CONSTEXPR constexpr
+#define GEL_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define GEL_HAS_CONSTEXPR 0
+#define GEL_CONSTEXPR
+#define GEL_CONSTANT_EVALUATED() false
+#endif
+
+/**
+ * SIMD DETECTION
+ *
+ * GEL_SSE and GEL_SSE2 are defined to 1 when SSE and SSE2 instructions may
+ * be used, SSE2 implying SSE. Defining GEL_NO_SIMD before including any gel
+ * header forces the scalar fallback.
+ */
+#if !defined( GEL_NO_SIMD ) && \
+    ( defined( __SSE2__ ) || defined( _M_X64 ) || \
+      ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 ) )
+#define GEL_SSE2 1
+#else
+#define GEL_SSE2 0
+#endif
+
+#if !defined( GEL_NO_SIMD ) && \
+    ( GEL_SSE2 || defined( __SSE__ ) || \
+      ( defined( _M_IX86_FP ) && _M_IX86_FP >= 1 ) )
+#define GEL_SSE 1
+#else
+#define GEL_SSE 0
+#endif
+
 namespace gel
 {
 
@@ -0,0 +1,315 @@
+// aabb.h
+#ifndef GEL_AABB_H
+#define GEL_AABB_H
+#include <limits>
+#include "gel/gellib.h"
+#include "gel/math/geometric.h"
+#include "gel/math/mat4.h"
+#include "gel/math/vec3.h"
+
+namespace gel
+{
+
+namespace math
+{
+
+/**
+ * @brief Defines an axis-aligned bounding box.
+ *
+ * The box is stored as its minimum and maximum corners. A default
+ * constructed box is empty, with its minimum above its maximum, so that
+ * expanding it by the first point makes it exactly that point.
+ *
+ * @tparam T The component type.
+ */
+template <typename T>
+class TAabb
+{
+  private:
+    /**
+     * The minimum corner.
+     */
+    TVec3<T> _min;
+
+    /**
+     * The maximum corner.
+     */
+    TVec3<T> _max;
+
+  public:
+    typedef T ValueType;
+
+    // IMPLICIT CONSTRUCTORS
+    /**
+     * Constructs a new empty box.
+     */
+    GEL_CONSTEXPR TAabb();
+
+    // EXPLICIT CONSTRUCTORS
+    /**
+     * Constructs a new box from its corners.
+     *
+     * @param min The minimum corner.
+     * @param max The maximum corner.
+     */
+    GEL_CONSTEXPR TAabb( const TVec3<T>& min, const TVec3<T>& max );
+
+    // MEMBER FUNCTIONS
+    /**
+     * Grows the box to contain a point.
+     *
+     * @param p The point.
+     */
+    GEL_CONSTEXPR TAabb<T>& expand( const TVec3<T>& p );
+
+    /**
+     * Grows the box to contain another box.
+     *
+     * @param b The box.
+     */
+    GEL_CONSTEXPR TAabb<T>& expand( const TAabb<T>& b );
+
+    /**
+     * Checks if a point is inside the box or on its boundary.
+     *
+     * @param p The point.
+     * @return If the box contains the point.
+     */
+    GEL_CONSTEXPR bool contains( const TVec3<T>& p ) const;
+
+    /**
+     * Checks if the box contains no points.
+     *
+     * @return If the box is empty.
+     */
+    GEL_CONSTEXPR bool isEmpty() const;
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the minimum corner.
+     */
+    GEL_CONSTEXPR const TVec3<T>& min() const;
+
+    /**
+     * Gets the maximum corner.
+     */
+    GEL_CONSTEXPR const TVec3<T>& max() const;
+
+    /**
+     * Gets the center of the box.
+     */
+    GEL_CONSTEXPR TVec3<T> center() const;
+
+    /**
+     * Gets the half-size of the box along each axis.
+     */
+    GEL_CONSTEXPR TVec3<T> extents() const;
+};
+
+// BINARY OPERATOR DECLARATIONS
+template <typename T>
+GEL_CONSTEXPR bool operator==( const TAabb<T>& a, const TAabb<T>& b );
+
+template <typename T>
+GEL_CONSTEXPR bool operator!=( const TAabb<T>& a, const TAabb<T>& b );
+
+// FUNCTION DECLARATIONS
+/**
+ * Creates a box from its center and half-size.
+ *
+ * @param center The center.
+ * @param extents The half-size along each axis.
+ * @return The box.
+ */
+template <typename T>
+GEL_CONSTEXPR TAabb<T> aabbFromCenter( const TVec3<T>& center,
+                                       const TVec3<T>& extents );
+
+/**
+ * Checks if two boxes overlap. Boxes that only touch overlap.
+ *
+ * @param a The first box.
+ * @param b The second box.
+ * @return If the boxes overlap.
+ */
+template <typename T>
+GEL_CONSTEXPR bool intersects( const TAabb<T>& a, const TAabb<T>& b );
+
+/**
+ * Finds the smallest box that contains two boxes.
+ *
+ * @param a The first box.
+ * @param b The second box.
+ * @return The box.
+ */
+template <typename T>
+GEL_CONSTEXPR TAabb<T> merge( const TAabb<T>& a, const TAabb<T>& b );
+
+/**
+ * Finds the smallest box that contains a transformed box.
+ *
+ * @param m The affine transformation.
+ * @param b The box.
+ * @return The box around the transformed corners.
+ */
+template <typename T>
+GEL_CONSTEXPR TAabb<T> transform( const TMat4<T>& m, const TAabb<T>& b );
+
+// IMPLEMENTATION
+
+// IMPLICIT CONSTRUCTORS
+template <typename T>
+GEL_CONSTEXPR inline
+TAabb<T>::TAabb()
+    : _min( std::numeric_limits<T>::max() ),
+      _max( -std::numeric_limits<T>::max() )
+{
+}
+
+// EXPLICIT CONSTRUCTORS
+template <typename T>
+GEL_CONSTEXPR inline
+TAabb<T>::TAabb( const TVec3<T>& min, const TVec3<T>& max )
+    : _min( min ), _max( max )
+{
+}
+
+// MEMBER FUNCTIONS
+template <typename T>
+GEL_CONSTEXPR inline
+TAabb<T>& TAabb<T>::expand( const TVec3<T>& p )
+{
+    _min = math::min( _min, p );
+    _max = math::max( _max, p );
+    return *this;
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TAabb<T>& TAabb<T>::expand( const TAabb<T>& b )
+{
+    _min = math::min( _min, b._min );
+    _max = math::max( _max, b._max );
+    return *this;
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+bool TAabb<T>::contains( const TVec3<T>& p ) const
+{
+    return p.x >= _min.x && p.y >= _min.y && p.z >= _min.z &&
+           p.x <= _max.x && p.y <= _max.y && p.z <= _max.z;
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+bool TAabb<T>::isEmpty() const
+{
+    return _min.x > _max.x || _min.y > _max.y || _min.z > _max.z;
+}
+
+// ACCESSOR FUNCTIONS
+template <typename T>
+GEL_CONSTEXPR inline
+const TVec3<T>& TAabb<T>::min() const
+{
+    return _min;
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+const TVec3<T>& TAabb<T>::max() const
+{
+    return _max;
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> TAabb<T>::center() const
+{
+    return ( _min + _max ) * static_cast<T>( 0.5 );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> TAabb<T>::extents() const
+{
+    return ( _max - _min ) * static_cast<T>( 0.5 );
+}
+
+// BINARY OPERATORS
+template <typename T>
+GEL_CONSTEXPR inline
+bool operator==( const TAabb<T>& a, const TAabb<T>& b )
+{
+    return a.min() == b.min() && a.max() == b.max();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+bool operator!=( const TAabb<T>& a, const TAabb<T>& b )
+{
+    return !( a == b );
+}
+
+// FUNCTIONS
+template <typename T>
+GEL_CONSTEXPR inline
+TAabb<T> aabbFromCenter( const TVec3<T>& center, const TVec3<T>& extents )
+{
+    return TAabb<T>( center - extents, center + extents );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+bool intersects( const TAabb<T>& a, const TAabb<T>& b )
+{
+    return a.min().x <= b.max().x && a.min().y <= b.max().y &&
+           a.min().z <= b.max().z && b.min().x <= a.max().x &&
+           b.min().y <= a.max().y && b.min().z <= a.max().z;
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TAabb<T> merge( const TAabb<T>& a, const TAabb<T>& b )
+{
+    return TAabb<T>( min( a.min(), b.min() ), max( a.max(), b.max() ) );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TAabb<T> transform( const TMat4<T>& m, const TAabb<T>& b )
+{
+    // each new extent sums the old extents scaled by the absolute value of
+    // the matrix row, which bounds all eight transformed corners at once
+    const TVec3<T> c = b.center();
+    const TVec3<T> e = b.extents();
+    TVec3<T> center( m[3].x, m[3].y, m[3].z );
+    TVec3<T> extents( 0 );
+    for ( Size i = 0; i < 3; ++i )
+    {
+        for ( Size j = 0; j < 3; ++j )
+        {
+            const T a = m[j][i];
+            center[i] += a * c[j];
+            extents[i] += ( a < 0 ? -a : a ) * e[j];
+        }
+    }
+    return aabbFromCenter( center, extents );
+}
+
+/**
+ * Defines a default axis-aligned bounding box.
+ */
+typedef TAabb<float> Aabb;
+
+/**
+ * Defines a double axis-aligned bounding box.
+ */
+typedef TAabb<double> DAabb;
+
+} // End nspc math
+
+} // End nspc gel
+
+#endif //GEL_AABB_H
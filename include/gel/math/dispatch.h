@@ -0,0 +1,124 @@
+// dispatch.h
+#ifndef GEL_DISPATCH_H
+#define GEL_DISPATCH_H
+#include "gel/gellib.h"
+#include "gel/math/precision.h"
+
+namespace gel
+{
+
+namespace math
+{
+
+/**
+ * @brief Defines the float batch kernels compiled for one instruction set.
+ *
+ * The kernels work on contiguous arrays of n values, such as the component
+ * arrays of a stream. Every output may be one of the inputs. The library
+ * compiles a table for each SIMD level and picks the one to use once at
+ * startup from the CPU features reported by cpuid, capped by the
+ * GEL_SIMD_DISPATCH option of the generated configuration.
+ */
+struct BatchKernels
+{
+    /**
+     * The instruction set the kernels were compiled for.
+     */
+    Precision level;
+
+    /**
+     * Adds two arrays.
+     */
+    void ( *add )( float* out, const float* a, const float* b, Size n );
+
+    /**
+     * Multiplies two arrays.
+     */
+    void ( *mul )( float* out, const float* a, const float* b, Size n );
+
+    /**
+     * Multiplies two arrays and adds a third.
+     */
+    void ( *madd )( float* out, const float* a, const float* b,
+                    const float* c, Size n );
+
+    /**
+     * Multiplies an array by a scalar.
+     */
+    void ( *scale )( float* out, const float* a, float s, Size n );
+
+    /**
+     * Linearly interpolates between two arrays.
+     */
+    void ( *lerp )( float* out, const float* a, const float* b, float t,
+                    Size n );
+
+    /**
+     * Computes the dot products of vectors given as dim component arrays.
+     */
+    void ( *dot )( float* out, const float* const* u, const float* const* v,
+                   Size dim, Size n );
+
+    /**
+     * Normalizes vectors given as dim component arrays.
+     */
+    void ( *normalize )( float* const* out, const float* const* v, Size dim,
+                         Size n );
+
+    /**
+     * Transforms points given as three component arrays by a column-major
+     * matrix.
+     */
+    void ( *transformPoints )( const float* m, float* const* out,
+                               const float* const* in, Size n );
+
+    /**
+     * Writes the indices of the boxes given as center and extent component
+     * arrays that are not entirely outside one of six planes, and returns
+     * how many were written.
+     */
+    Size ( *cullBoxes )( uint32* visible, const float* planes,
+                         const float* const* centers,
+                         const float* const* extents, Size n );
+
+    /**
+     * Writes the indices of the spheres given as center component arrays
+     * and radii that are not entirely outside one of six planes, and
+     * returns how many were written.
+     */
+    Size ( *cullSpheres )( uint32* visible, const float* planes,
+                           const float* const* centers, const float* radii,
+                           Size n );
+};
+
+/**
+ * Finds the best SIMD level the running CPU and operating system support.
+ *
+ * @return The level, SIMD_SCALAR when no SIMD instructions may be used.
+ */
+Precision detectSimd();
+
+/**
+ * Selects the SIMD level of the kernels returned for SIMD_BEST.
+ *
+ * The level is capped by what the CPU supports. This is not thread-safe
+ * and is intended for startup code and tests.
+ *
+ * @param level The requested level, SIMD_BEST to restore the default.
+ * @return The selected level.
+ */
+Precision selectSimd( Precision level );
+
+/**
+ * Gets the batch kernels for a SIMD level.
+ *
+ * @param level The level, which is capped by what the CPU supports.
+ * @return The kernels.
+ */
+const BatchKernels& batchKernels( Precision level = SIMD_BEST );
+
+} // End nspc math
+
+} // End nspc gel
+
+#endif //GEL_DISPATCH_H
@@ -0,0 +1,1309 @@
+// expr.h
+#ifndef GEL_EXPR_H
+#define GEL_EXPR_H
+
+/**
+ * FMA DETECTION
+ *
+ * GEL_FMA is defined to 1 when the target has fused multiply-add
+ * instructions, in which case fmadd rounds once instead of twice.
+ */
+#if defined( __FMA__ ) || defined( FP_FAST_FMAF )
+#define GEL_FMA 1
+#else
+#define GEL_FMA 0
+#endif
+
+#include <assert.h>
+#include <math.h>
+#include "gel/gellib.h"
+#include "gel/math/vec2.h"
+#include "gel/math/vec3.h"
+#include "gel/math/vec4.h"
+#include "gel/math/vec3_stream.h"
+#include "gel/math/vec4_stream.h"
+
+/**
+ * EXPRESSION TEMPLATES
+ *
+ * Wrapping a vector or stream with expr() makes the arithmetic operators
+ * build a lightweight expression instead of a value. The expression is
+ * evaluated component by component in a single pass when it is converted to
+ * a vector or written to a stream with assign(), so a chain such as
+ * expr( a ) * b + c * d - e allocates no intermediate vectors. A product
+ * that is added to or has something subtracted from it is fused into
+ * fmadd.
+ *
+ *     Vec3 r = expr( a ) * b + c;
+ *     assign( out, expr( u ) * s + v );
+ *
+ * Expressions hold references to their vector and stream operands and must
+ * be evaluated within the statement that creates them. Unwrapped vectors
+ * keep their value semantics, and the SIMD specialization of TVec4<float>
+ * is usually best left unwrapped as its operators already stay in
+ * registers.
+ */
+
+namespace gel
+{
+
+namespace math
+{
+
+// FUSED MULTIPLY-ADD
+/**
+ * Computes a * b + c.
+ *
+ * @param a The first factor.
+ * @param b The second factor.
+ * @param c The addend.
+ * @return The result.
+ */
+template <typename T>
+T fmadd( const T& a, const T& b, const T& c );
+
+/**
+ * Computes a * b + c with a single rounding when GEL_FMA is set.
+ *
+ * @param a The first factor.
+ * @param b The second factor.
+ * @param c The addend.
+ * @return The result.
+ */
+float fmadd( float a, float b, float c );
+
+/**
+ * Computes a * b + c with a single rounding when GEL_FMA is set.
+ *
+ * @param a The first factor.
+ * @param b The second factor.
+ * @param c The addend.
+ * @return The result.
+ */
+double fmadd( double a, double b, double c );
+
+// OPERATIONS
+/**
+ * Adds two components.
+ */
+struct ExprAdd
+{
+    template <typename T>
+    static T apply( const T& a, const T& b );
+};
+
+/**
+ * Subtracts two components.
+ */
+struct ExprSub
+{
+    template <typename T>
+    static T apply( const T& a, const T& b );
+};
+
+/**
+ * Multiplies two components.
+ */
+struct ExprMul
+{
+    template <typename T>
+    static T apply( const T& a, const T& b );
+};
+
+/**
+ * Divides two components.
+ */
+struct ExprDiv
+{
+    template <typename T>
+    static T apply( const T& a, const T& b );
+};
+
+// TRAITS
+/**
+ * Defines Type only when the condition holds.
+ *
+ * @tparam C The condition.
+ * @tparam U The type.
+ */
+template <bool C, typename U>
+struct TExprEnableIf
+{
+};
+
+template <typename U>
+struct TExprEnableIf<true, U>
+{
+    typedef U Type;
+};
+
+/**
+ * Selects one of two types.
+ *
+ * @tparam C The condition.
+ * @tparam U The type when the condition holds.
+ * @tparam V The type otherwise.
+ */
+template <bool C, typename U, typename V>
+struct TExprSelect
+{
+    typedef U Type;
+};
+
+template <typename U, typename V>
+struct TExprSelect<false, U, V>
+{
+    typedef V Type;
+};
+
+/**
+ * Maps a component type and count to a vector type.
+ *
+ * Broadcast operands have no components and map to the scalar type.
+ *
+ * @tparam T The component type.
+ * @tparam N The number of components.
+ */
+template <typename T, int N>
+struct TExprVecOf
+{
+};
+
+template <typename T>
+struct TExprVecOf<T, 0>
+{
+    typedef T Type;
+};
+
+template <typename T>
+struct TExprVecOf<T, 2>
+{
+    typedef TVec2<T> Type;
+};
+
+template <typename T>
+struct TExprVecOf<T, 3>
+{
+    typedef TVec3<T> Type;
+};
+
+template <typename T>
+struct TExprVecOf<T, 4>
+{
+    typedef TVec4<T> Type;
+};
+
+/**
+ * Maps a component type and count to a stream type.
+ *
+ * @tparam T The component type.
+ * @tparam N The number of components.
+ */
+template <typename T, int N>
+struct TExprStreamOf
+{
+};
+
+template <typename T>
+struct TExprStreamOf<T, 3>
+{
+    typedef TVec3Stream<T> Type;
+};
+
+template <typename T>
+struct TExprStreamOf<T, 4>
+{
+    typedef TVec4Stream<T> Type;
+};
+
+/**
+ * Combines the shapes of two operands.
+ *
+ * Scalars have no components and are broadcast, so the result takes the
+ * component type and count of whichever operand has components.
+ *
+ * @tparam L The left operand.
+ * @tparam R The right operand.
+ */
+template <typename L, typename R>
+struct TExprJoin
+{
+    typedef typename TExprSelect<( L::COMPONENTS > 0 ),
+                                 typename L::ValueType,
+                                 typename R::ValueType>::Type ValueType;
+
+    static const int COMPONENTS = L::COMPONENTS > R::COMPONENTS ?
+                                  L::COMPONENTS : R::COMPONENTS;
+
+    static const bool STREAM = L::STREAM || R::STREAM;
+
+    static_assert( L::COMPONENTS == 0 || R::COMPONENTS == 0 ||
+                   L::COMPONENTS == R::COMPONENTS,
+                   "operands have different numbers of components" );
+};
+
+// TERMINALS
+/**
+ * @brief A scalar broadcast to every component.
+ *
+ * @tparam T The scalar type.
+ */
+template <typename T>
+class TExprScalar
+{
+  private:
+    /**
+     * The scalar.
+     */
+    T _s;
+
+  public:
+    typedef T ValueType;
+
+    static const int COMPONENTS = 0;
+
+    static const bool STREAM = false;
+
+    /**
+     * Constructs a new scalar terminal.
+     *
+     * @param s The scalar.
+     */
+    explicit TExprScalar( const T& s );
+
+    /**
+     * Gets a component of an element.
+     *
+     * @param c The component index.
+     * @param i The element index.
+     * @return The scalar.
+     */
+    ValueType at( Size c, Size i ) const;
+
+    /**
+     * Gets the number of elements, which is 0 as scalars are broadcast.
+     */
+    Size size() const;
+};
+
+/**
+ * @brief A reference to a vector.
+ *
+ * @tparam T The component type.
+ * @tparam N The number of components.
+ */
+template <typename T, int N>
+class TExprVec
+{
+  private:
+    /**
+     * The vector.
+     */
+    const typename TExprVecOf<T, N>::Type& _v;
+
+  public:
+    typedef T ValueType;
+
+    static const int COMPONENTS = N;
+
+    static const bool STREAM = false;
+
+    /**
+     * Constructs a new vector terminal.
+     *
+     * @param v The vector, which must outlive the terminal.
+     */
+    explicit TExprVec( const typename TExprVecOf<T, N>::Type& v );
+
+    /**
+     * Gets a component of an element.
+     *
+     * @param c The component index.
+     * @param i The element index, which is ignored as vectors are broadcast.
+     * @return The component.
+     */
+    ValueType at( Size c, Size i ) const;
+
+    /**
+     * Gets the number of elements, which is 0 as vectors are broadcast.
+     */
+    Size size() const;
+};
+
+/**
+ * @brief A reference to the component arrays of a stream.
+ *
+ * @tparam T The component type.
+ * @tparam N The number of components.
+ */
+template <typename T, int N>
+class TExprStream
+{
+  private:
+    /**
+     * The component arrays.
+     */
+    const T* _data[N];
+
+    /**
+     * The number of elements.
+     */
+    Size _size;
+
+  public:
+    typedef T ValueType;
+
+    static const int COMPONENTS = N;
+
+    static const bool STREAM = true;
+
+    /**
+     * Constructs a new stream terminal.
+     *
+     * @param s The stream, which must outlive the terminal.
+     */
+    explicit TExprStream( const typename TExprStreamOf<T, N>::Type& s );
+
+    /**
+     * Gets a component of an element.
+     *
+     * @param c The component index.
+     * @param i The element index.
+     * @return The component.
+     */
+    ValueType at( Size c, Size i ) const;
+
+    /**
+     * Gets the number of elements.
+     */
+    Size size() const;
+};
+
+// NODES
+/**
+ * @brief Applies an operation to the components of two operands.
+ *
+ * @tparam L The left operand.
+ * @tparam R The right operand.
+ * @tparam Op The operation.
+ */
+template <typename L, typename R, typename Op>
+class TExprBinary
+{
+  private:
+    /**
+     * The left operand.
+     */
+    L _l;
+
+    /**
+     * The right operand.
+     */
+    R _r;
+
+  public:
+    typedef typename TExprJoin<L, R>::ValueType ValueType;
+
+    static const int COMPONENTS = TExprJoin<L, R>::COMPONENTS;
+
+    static const bool STREAM = TExprJoin<L, R>::STREAM;
+
+    /**
+     * Constructs a new binary node.
+     *
+     * @param l The left operand.
+     * @param r The right operand.
+     */
+    TExprBinary( const L& l, const R& r );
+
+    /**
+     * Gets the left operand.
+     */
+    const L& left() const;
+
+    /**
+     * Gets the right operand.
+     */
+    const R& right() const;
+
+    /**
+     * Gets a component of an element.
+     *
+     * @param c The component index.
+     * @param i The element index.
+     * @return The component.
+     */
+    ValueType at( Size c, Size i ) const;
+
+    /**
+     * Gets the number of elements.
+     */
+    Size size() const;
+
+    /**
+     * Evaluates the expression to a vector.
+     */
+    operator typename TExprVecOf<ValueType, COMPONENTS>::Type() const;
+};
+
+/**
+ * @brief Negates the components of an operand.
+ *
+ * @tparam E The operand.
+ */
+template <typename E>
+class TExprNeg
+{
+  private:
+    /**
+     * The operand.
+     */
+    E _e;
+
+  public:
+    typedef typename E::ValueType ValueType;
+
+    static const int COMPONENTS = E::COMPONENTS;
+
+    static const bool STREAM = E::STREAM;
+
+    /**
+     * Constructs a new negation node.
+     *
+     * @param e The operand.
+     */
+    explicit TExprNeg( const E& e );
+
+    /**
+     * Gets a component of an element.
+     *
+     * @param c The component index.
+     * @param i The element index.
+     * @return The component.
+     */
+    ValueType at( Size c, Size i ) const;
+
+    /**
+     * Gets the number of elements.
+     */
+    Size size() const;
+
+    /**
+     * Evaluates the expression to a vector.
+     */
+    operator typename TExprVecOf<ValueType, COMPONENTS>::Type() const;
+};
+
+/**
+ * @brief Computes a * b + c for the components of three operands.
+ *
+ * @tparam A The first factor.
+ * @tparam B The second factor.
+ * @tparam C The addend.
+ */
+template <typename A, typename B, typename C>
+class TExprFma
+{
+  private:
+    /**
+     * The first factor.
+     */
+    A _a;
+
+    /**
+     * The second factor.
+     */
+    B _b;
+
+    /**
+     * The addend.
+     */
+    C _c;
+
+  public:
+    typedef typename TExprJoin<TExprJoin<A, B>, C>::ValueType ValueType;
+
+    static const int COMPONENTS = TExprJoin<TExprJoin<A, B>, C>::COMPONENTS;
+
+    static const bool STREAM = TExprJoin<TExprJoin<A, B>, C>::STREAM;
+
+    /**
+     * Constructs a new fused multiply-add node.
+     *
+     * @param a The first factor.
+     * @param b The second factor.
+     * @param c The addend.
+     */
+    TExprFma( const A& a, const B& b, const C& c );
+
+    /**
+     * Gets a component of an element.
+     *
+     * @param c The component index.
+     * @param i The element index.
+     * @return The component.
+     */
+    ValueType at( Size c, Size i ) const;
+
+    /**
+     * Gets the number of elements.
+     */
+    Size size() const;
+
+    /**
+     * Evaluates the expression to a vector.
+     */
+    operator typename TExprVecOf<ValueType, COMPONENTS>::Type() const;
+};
+
+// OPERAND TRAITS
+/**
+ * Checks if a type is an expression.
+ *
+ * @tparam X The type.
+ */
+template <typename X>
+struct TIsExpr
+{
+    enum { VALUE = 0 };
+};
+
+template <typename T, int N>
+struct TIsExpr<TExprVec<T, N> >
+{
+    enum { VALUE = 1 };
+};
+
+template <typename T, int N>
+struct TIsExpr<TExprStream<T, N> >
+{
+    enum { VALUE = 1 };
+};
+
+template <typename L, typename R, typename Op>
+struct TIsExpr<TExprBinary<L, R, Op> >
+{
+    enum { VALUE = 1 };
+};
+
+template <typename E>
+struct TIsExpr<TExprNeg<E> >
+{
+    enum { VALUE = 1 };
+};
+
+template <typename A, typename B, typename C>
+struct TIsExpr<TExprFma<A, B, C> >
+{
+    enum { VALUE = 1 };
+};
+
+/**
+ * Maps an operand to the node that represents it.
+ *
+ * Expressions represent themselves, vectors and streams become terminals
+ * and anything else is treated as a scalar.
+ *
+ * @tparam X The operand type.
+ * @tparam E If the operand is an expression.
+ */
+template <typename X, bool E = TIsExpr<X>::VALUE>
+struct TExprOperand
+{
+    typedef TExprScalar<X> Type;
+
+    static Type wrap( const X& x );
+};
+
+template <typename X>
+struct TExprOperand<X, true>
+{
+    typedef X Type;
+
+    static const Type& wrap( const X& x );
+};
+
+template <typename T>
+struct TExprOperand<TVec2<T>, false>
+{
+    typedef TExprVec<T, 2> Type;
+
+    static Type wrap( const TVec2<T>& v );
+};
+
+template <typename T>
+struct TExprOperand<TVec3<T>, false>
+{
+    typedef TExprVec<T, 3> Type;
+
+    static Type wrap( const TVec3<T>& v );
+};
+
+template <typename T>
+struct TExprOperand<TVec4<T>, false>
+{
+    typedef TExprVec<T, 4> Type;
+
+    static Type wrap( const TVec4<T>& v );
+};
+
+template <typename T>
+struct TExprOperand<TVec3Stream<T>, false>
+{
+    typedef TExprStream<T, 3> Type;
+
+    static Type wrap( const TVec3Stream<T>& s );
+};
+
+template <typename T>
+struct TExprOperand<TVec4Stream<T>, false>
+{
+    typedef TExprStream<T, 4> Type;
+
+    static Type wrap( const TVec4Stream<T>& s );
+};
+
+/**
+ * Defines the node built by a binary operator when either operand is an
+ * expression.
+ *
+ * @tparam L The left operand type.
+ * @tparam R The right operand type.
+ * @tparam Op The operation.
+ */
+template <typename L, typename R, typename Op>
+struct TExprResult
+    : TExprEnableIf<TIsExpr<L>::VALUE || TIsExpr<R>::VALUE,
+                    TExprBinary<typename TExprOperand<L>::Type,
+                                typename TExprOperand<R>::Type, Op> >
+{
+};
+
+// FUNCTION DECLARATIONS
+/**
+ * Starts an expression from a vector.
+ *
+ * @param v The vector, which must outlive the expression.
+ * @return The expression.
+ */
+template <typename T>
+TExprVec<T, 2> expr( const TVec2<T>& v );
+
+/**
+ * Starts an expression from a vector.
+ *
+ * @param v The vector, which must outlive the expression.
+ * @return The expression.
+ */
+template <typename T>
+TExprVec<T, 3> expr( const TVec3<T>& v );
+
+/**
+ * Starts an expression from a vector.
+ *
+ * @param v The vector, which must outlive the expression.
+ * @return The expression.
+ */
+template <typename T>
+TExprVec<T, 4> expr( const TVec4<T>& v );
+
+/**
+ * Starts an expression from a stream.
+ *
+ * @param s The stream, which must outlive the expression.
+ * @return The expression.
+ */
+template <typename T>
+TExprStream<T, 3> expr( const TVec3Stream<T>& s );
+
+/**
+ * Starts an expression from a stream.
+ *
+ * @param s The stream, which must outlive the expression.
+ * @return The expression.
+ */
+template <typename T>
+TExprStream<T, 4> expr( const TVec4Stream<T>& s );
+
+/**
+ * Evaluates an expression without streams to a vector.
+ *
+ * @param e The expression.
+ * @return The vector.
+ */
+template <typename E>
+typename TExprVecOf<typename E::ValueType, E::COMPONENTS>::Type
+eval( const E& e );
+
+/**
+ * Evaluates an expression for every element of a stream in a single pass.
+ *
+ * The stream is resized to the number of elements in the expression, and an
+ * expression without streams is written to every element.
+ *
+ * @param out The destination, which may also be an operand.
+ * @param e The expression.
+ * @return If the expression was written, which fails if out could not be
+ *         resized, leaving it unchanged.
+ */
+template <typename T, typename E>
+bool assign( TVec3Stream<T>& out, const E& e );
+
+/**
+ * Evaluates an expression for every element of a stream in a single pass.
+ *
+ * The stream is resized to the number of elements in the expression, and an
+ * expression without streams is written to every element.
+ *
+ * @param out The destination, which may also be an operand.
+ * @param e The expression.
+ * @return If the expression was written, which fails if out could not be
+ *         resized, leaving it unchanged.
+ */
+template <typename T, typename E>
+bool assign( TVec4Stream<T>& out, const E& e );
+
+// EXPRESSION OPERATOR DECLARATIONS
+/**
+ * Adds the components of two operands, one of which is an expression.
+ */
+template <typename L, typename R>
+typename TExprResult<L, R, ExprAdd>::Type operator+( const L& l,
+                                                     const R& r );
+
+/**
+ * Subtracts the components of two operands, one of which is an expression.
+ */
+template <typename L, typename R>
+typename TExprResult<L, R, ExprSub>::Type operator-( const L& l,
+                                                     const R& r );
+
+/**
+ * Multiplies the components of two operands, one of which is an expression.
+ */
+template <typename L, typename R>
+typename TExprResult<L, R, ExprMul>::Type operator*( const L& l,
+                                                     const R& r );
+
+/**
+ * Divides the components of two operands, one of which is an expression.
+ */
+template <typename L, typename R>
+typename TExprResult<L, R, ExprDiv>::Type operator/( const L& l,
+                                                     const R& r );
+
+/**
+ * Negates the components of an expression.
+ */
+template <typename E>
+typename TExprEnableIf<TIsExpr<E>::VALUE, TExprNeg<E> >::Type
+operator-( const E& e );
+
+/**
+ * Fuses a product and an addend.
+ */
+template <typename A, typename B, typename R>
+TExprFma<A, B, typename TExprOperand<R>::Type>
+operator+( const TExprBinary<A, B, ExprMul>& l, const R& r );
+
+/**
+ * Fuses an addend and a product.
+ */
+template <typename L, typename A, typename B>
+TExprFma<A, B, typename TExprOperand<L>::Type>
+operator+( const L& l, const TExprBinary<A, B, ExprMul>& r );
+
+/**
+ * Fuses the left product with the right one.
+ */
+template <typename A, typename B, typename C, typename D>
+TExprFma<A, B, TExprBinary<C, D, ExprMul> >
+operator+( const TExprBinary<A, B, ExprMul>& l,
+           const TExprBinary<C, D, ExprMul>& r );
+
+/**
+ * Fuses a product and a negated subtrahend.
+ */
+template <typename A, typename B, typename R>
+TExprFma<A, B, TExprNeg<typename TExprOperand<R>::Type> >
+operator-( const TExprBinary<A, B, ExprMul>& l, const R& r );
+
+// IMPLEMENTATION
+
+// FUSED MULTIPLY-ADD
+template <typename T>
+inline
+T fmadd( const T& a, const T& b, const T& c )
+{
+    return a * b + c;
+}
+
+inline
+float fmadd( float a, float b, float c )
+{
+#if GEL_FMA
+    return ::fmaf( a, b, c );
+#else
+    return a * b + c;
+#endif
+}
+
+inline
+double fmadd( double a, double b, double c )
+{
+#if GEL_FMA
+    return ::fma( a, b, c );
+#else
+    return a * b + c;
+#endif
+}
+
+// OPERATIONS
+template <typename T>
+inline
+T ExprAdd::apply( const T& a, const T& b )
+{
+    return a + b;
+}
+
+template <typename T>
+inline
+T ExprSub::apply( const T& a, const T& b )
+{
+    return a - b;
+}
+
+template <typename T>
+inline
+T ExprMul::apply( const T& a, const T& b )
+{
+    return a * b;
+}
+
+template <typename T>
+inline
+T ExprDiv::apply( const T& a, const T& b )
+{
+    return a / b;
+}
+
+// SCALAR TERMINAL
+template <typename T>
+inline
+TExprScalar<T>::TExprScalar( const T& s ) : _s( s )
+{
+}
+
+template <typename T>
+inline
+T TExprScalar<T>::at( Size, Size ) const
+{
+    return _s;
+}
+
+template <typename T>
+inline
+Size TExprScalar<T>::size() const
+{
+    return 0;
+}
+
+// VECTOR TERMINAL
+template <typename T, int N>
+inline
+TExprVec<T, N>::TExprVec( const typename TExprVecOf<T, N>::Type& v )
+    : _v( v )
+{
+}
+
+template <typename T, int N>
+inline
+T TExprVec<T, N>::at( Size c, Size ) const
+{
+    return _v[c];
+}
+
+template <typename T, int N>
+inline
+Size TExprVec<T, N>::size() const
+{
+    return 0;
+}
+
+// STREAM TERMINAL
+template <typename T, int N>
+inline
+TExprStream<T, N>::TExprStream(
+    const typename TExprStreamOf<T, N>::Type& s ) : _size( s.size() )
+{
+    for ( Size c = 0; c < N; ++c )
+    {
+        _data[c] = s.component( c );
+    }
+}
+
+template <typename T, int N>
+inline
+T TExprStream<T, N>::at( Size c, Size i ) const
+{
+    assert( i < _size );
+    return _data[c][i];
+}
+
+template <typename T, int N>
+inline
+Size TExprStream<T, N>::size() const
+{
+    return _size;
+}
+
+// BINARY NODE
+template <typename L, typename R, typename Op>
+inline
+TExprBinary<L, R, Op>::TExprBinary( const L& l, const R& r )
+    : _l( l ), _r( r )
+{
+    assert( _l.size() == 0 || _r.size() == 0 || _l.size() == _r.size() );
+}
+
+template <typename L, typename R, typename Op>
+inline
+const L& TExprBinary<L, R, Op>::left() const
+{
+    return _l;
+}
+
+template <typename L, typename R, typename Op>
+inline
+const R& TExprBinary<L, R, Op>::right() const
+{
+    return _r;
+}
+
+template <typename L, typename R, typename Op>
+inline
+typename TExprBinary<L, R, Op>::ValueType
+TExprBinary<L, R, Op>::at( Size c, Size i ) const
+{
+    return Op::apply( static_cast<ValueType>( _l.at( c, i ) ),
+                      static_cast<ValueType>( _r.at( c, i ) ) );
+}
+
+template <typename L, typename R, typename Op>
+inline
+Size TExprBinary<L, R, Op>::size() const
+{
+    return _l.size() > _r.size() ? _l.size() : _r.size();
+}
+
+template <typename L, typename R, typename Op>
+inline
+TExprBinary<L, R, Op>::operator
+typename TExprVecOf<typename TExprBinary<L, R, Op>::ValueType,
+                    TExprBinary<L, R, Op>::COMPONENTS>::Type() const
+{
+    return eval( *this );
+}
+
+// NEGATION NODE
+template <typename E>
+inline
+TExprNeg<E>::TExprNeg( const E& e ) : _e( e )
+{
+}
+
+template <typename E>
+inline
+typename TExprNeg<E>::ValueType TExprNeg<E>::at( Size c, Size i ) const
+{
+    return -_e.at( c, i );
+}
+
+template <typename E>
+inline
+Size TExprNeg<E>::size() const
+{
+    return _e.size();
+}
+
+template <typename E>
+inline
+TExprNeg<E>::operator
+typename TExprVecOf<typename TExprNeg<E>::ValueType,
+                    TExprNeg<E>::COMPONENTS>::Type() const
+{
+    return eval( *this );
+}
+
+// FUSED MULTIPLY-ADD NODE
+template <typename A, typename B, typename C>
+inline
+TExprFma<A, B, C>::TExprFma( const A& a, const B& b, const C& c )
+    : _a( a ), _b( b ), _c( c )
+{
+    assert( _a.size() == 0 || _c.size() == 0 || _a.size() == _c.size() );
+    assert( _b.size() == 0 || _c.size() == 0 || _b.size() == _c.size() );
+}
+
+template <typename A, typename B, typename C>
+inline
+typename TExprFma<A, B, C>::ValueType
+TExprFma<A, B, C>::at( Size c, Size i ) const
+{
+    return fmadd( static_cast<ValueType>( _a.at( c, i ) ),
+                  static_cast<ValueType>( _b.at( c, i ) ),
+                  static_cast<ValueType>( _c.at( c, i ) ) );
+}
+
+template <typename A, typename B, typename C>
+inline
+Size TExprFma<A, B, C>::size() const
+{
+    Size s = _a.size() > _b.size() ? _a.size() : _b.size();
+    return s > _c.size() ? s : _c.size();
+}
+
+template <typename A, typename B, typename C>
+inline
+TExprFma<A, B, C>::operator
+typename TExprVecOf<typename TExprFma<A, B, C>::ValueType,
+                    TExprFma<A, B, C>::COMPONENTS>::Type() const
+{
+    return eval( *this );
+}
+
+// OPERAND TRAITS
+template <typename X, bool E>
+inline
+typename TExprOperand<X, E>::Type TExprOperand<X, E>::wrap( const X& x )
+{
+    return Type( x );
+}
+
+template <typename X>
+inline
+const X& TExprOperand<X, true>::wrap( const X& x )
+{
+    return x;
+}
+
+template <typename T>
+inline
+TExprVec<T, 2> TExprOperand<TVec2<T>, false>::wrap( const TVec2<T>& v )
+{
+    return TExprVec<T, 2>( v );
+}
+
+template <typename T>
+inline
+TExprVec<T, 3> TExprOperand<TVec3<T>, false>::wrap( const TVec3<T>& v )
+{
+    return TExprVec<T, 3>( v );
+}
+
+template <typename T>
+inline
+TExprVec<T, 4> TExprOperand<TVec4<T>, false>::wrap( const TVec4<T>& v )
+{
+    return TExprVec<T, 4>( v );
+}
+
+template <typename T>
+inline
+TExprStream<T, 3> TExprOperand<TVec3Stream<T>, false>::wrap(
+    const TVec3Stream<T>& s )
+{
+    return TExprStream<T, 3>( s );
+}
+
+template <typename T>
+inline
+TExprStream<T, 4> TExprOperand<TVec4Stream<T>, false>::wrap(
+    const TVec4Stream<T>& s )
+{
+    return TExprStream<T, 4>( s );
+}
+
+// FUNCTIONS
+template <typename T>
+inline
+TExprVec<T, 2> expr( const TVec2<T>& v )
+{
+    return TExprVec<T, 2>( v );
+}
+
+template <typename T>
+inline
+TExprVec<T, 3> expr( const TVec3<T>& v )
+{
+    return TExprVec<T, 3>( v );
+}
+
+template <typename T>
+inline
+TExprVec<T, 4> expr( const TVec4<T>& v )
+{
+    return TExprVec<T, 4>( v );
+}
+
+template <typename T>
+inline
+TExprStream<T, 3> expr( const TVec3Stream<T>& s )
+{
+    return TExprStream<T, 3>( s );
+}
+
+template <typename T>
+inline
+TExprStream<T, 4> expr( const TVec4Stream<T>& s )
+{
+    return TExprStream<T, 4>( s );
+}
+
+template <typename E>
+inline
+typename TExprVecOf<typename E::ValueType, E::COMPONENTS>::Type
+eval( const E& e )
+{
+    static_assert( !E::STREAM, "stream expressions must be assigned" );
+    typename TExprVecOf<typename E::ValueType, E::COMPONENTS>::Type v;
+    for ( Size c = 0; c < E::COMPONENTS; ++c )
+    {
+        v[c] = e.at( c, 0 );
+    }
+    return v;
+}
+
+template <typename T, typename E>
+inline
+bool assign( TVec3Stream<T>& out, const E& e )
+{
+    static_assert( E::COMPONENTS == 3, "expression must have 3 components" );
+    if ( e.size() > 0 && !out.resize( e.size() ) )
+    {
+        return false;
+    }
+
+    const Size n = out.size();
+    for ( Size c = 0; c < 3; ++c )
+    {
+        T* d = out.component( c );
+        for ( Size i = 0; i < n; ++i )
+        {
+            d[i] = static_cast<T>( e.at( c, i ) );
+        }
+    }
+    return true;
+}
+
+template <typename T, typename E>
+inline
+bool assign( TVec4Stream<T>& out, const E& e )
+{
+    static_assert( E::COMPONENTS == 4, "expression must have 4 components" );
+    if ( e.size() > 0 && !out.resize( e.size() ) )
+    {
+        return false;
+    }
+
+    const Size n = out.size();
+    for ( Size c = 0; c < 4; ++c )
+    {
+        T* d = out.component( c );
+        for ( Size i = 0; i < n; ++i )
+        {
+            d[i] = static_cast<T>( e.at( c, i ) );
+        }
+    }
+    return true;
+}
+
+// EXPRESSION OPERATORS
+template <typename L, typename R>
+inline
+typename TExprResult<L, R, ExprAdd>::Type operator+( const L& l,
+                                                     const R& r )
+{
+    return typename TExprResult<L, R, ExprAdd>::Type(
+        TExprOperand<L>::wrap( l ), TExprOperand<R>::wrap( r ) );
+}
+
+template <typename L, typename R>
+inline
+typename TExprResult<L, R, ExprSub>::Type operator-( const L& l,
+                                                     const R& r )
+{
+    return typename TExprResult<L, R, ExprSub>::Type(
+        TExprOperand<L>::wrap( l ), TExprOperand<R>::wrap( r ) );
+}
+
+template <typename L, typename R>
+inline
+typename TExprResult<L, R, ExprMul>::Type operator*( const L& l,
+                                                     const R& r )
+{
+    return typename TExprResult<L, R, ExprMul>::Type(
+        TExprOperand<L>::wrap( l ), TExprOperand<R>::wrap( r ) );
+}
+
+template <typename L, typename R>
+inline
+typename TExprResult<L, R, ExprDiv>::Type operator/( const L& l,
+                                                     const R& r )
+{
+    return typename TExprResult<L, R, ExprDiv>::Type(
+        TExprOperand<L>::wrap( l ), TExprOperand<R>::wrap( r ) );
+}
+
+template <typename E>
+inline
+typename TExprEnableIf<TIsExpr<E>::VALUE, TExprNeg<E> >::Type
+operator-( const E& e )
+{
+    return TExprNeg<E>( e );
+}
+
+template <typename A, typename B, typename R>
+inline
+TExprFma<A, B, typename TExprOperand<R>::Type>
+operator+( const TExprBinary<A, B, ExprMul>& l, const R& r )
+{
+    return TExprFma<A, B, typename TExprOperand<R>::Type>(
+        l.left(), l.right(), TExprOperand<R>::wrap( r ) );
+}
+
+template <typename L, typename A, typename B>
+inline
+TExprFma<A, B, typename TExprOperand<L>::Type>
+operator+( const L& l, const TExprBinary<A, B, ExprMul>& r )
+{
+    return TExprFma<A, B, typename TExprOperand<L>::Type>(
+        r.left(), r.right(), TExprOperand<L>::wrap( l ) );
+}
+
+template <typename A, typename B, typename C, typename D>
+inline
+TExprFma<A, B, TExprBinary<C, D, ExprMul> >
+operator+( const TExprBinary<A, B, ExprMul>& l,
+           const TExprBinary<C, D, ExprMul>& r )
+{
+    return TExprFma<A, B, TExprBinary<C, D, ExprMul> >( l.left(), l.right(),
+                                                        r );
+}
+
+template <typename A, typename B, typename R>
+inline
+TExprFma<A, B, TExprNeg<typename TExprOperand<R>::Type> >
+operator-( const TExprBinary<A, B, ExprMul>& l, const R& r )
+{
+    return TExprFma<A, B, TExprNeg<typename TExprOperand<R>::Type> >(
+        l.left(), l.right(),
+        TExprNeg<typename TExprOperand<R>::Type>(
+            TExprOperand<R>::wrap( r ) ) );
+}
+
+} // End nspc math
+
+} // End nspc gel
+
+#endif //GEL_EXPR_H
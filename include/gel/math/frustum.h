@@ -0,0 +1,345 @@
+// frustum.h
+#ifndef GEL_FRUSTUM_H
+#define GEL_FRUSTUM_H
+#include <assert.h>
+#include "gel/gellib.h"
+#include "gel/math/aabb.h"
+#include "gel/math/dispatch.h"
+#include "gel/math/geometric.h"
+#include "gel/math/mat4.h"
+#include "gel/math/vec3.h"
+#include "gel/math/vec3_stream.h"
+#include "gel/math/vec4.h"
+
+namespace gel
+{
+
+namespace math
+{
+
+/**
+ * @brief Defines a view frustum as six inward-facing planes.
+ *
+ * Each plane is a 4D vector (a, b, c, d) and a point p is on its inner side
+ * when a * p.x + b * p.y + c * p.z + d >= 0. Planes extracted from a matrix
+ * are normalized so that this is the signed distance to the plane. The
+ * planes are in the order left, right, bottom, top, near and far.
+ *
+ * @tparam T The component type.
+ */
+template <typename T>
+class TFrustum
+{
+  private:
+    /**
+     * The planes.
+     */
+    TVec4<T> _planes[6];
+
+  public:
+    typedef T ValueType;
+
+    /**
+     * The number of planes.
+     */
+    static const Size PLANES = 6;
+
+    // IMPLICIT CONSTRUCTORS
+    /**
+     * Constructs a new frustum that contains every point.
+     */
+    GEL_CONSTEXPR TFrustum();
+
+    // EXPLICIT CONSTRUCTORS
+    /**
+     * Constructs the frustum of a view-projection matrix.
+     *
+     * The matrix maps the visible volume to the clip cube where -w <= x, y,
+     * z <= w.
+     *
+     * @param m The view-projection matrix.
+     */
+    GEL_CONSTEXPR explicit TFrustum( const TMat4<T>& m );
+
+    // MEMBER FUNCTIONS
+    /**
+     * Checks if a point is inside the frustum or on its boundary.
+     *
+     * @param p The point.
+     * @return If the frustum contains the point.
+     */
+    GEL_CONSTEXPR bool contains( const TVec3<T>& p ) const;
+
+    /**
+     * Checks if a box may be visible.
+     *
+     * The test is conservative: a box outside the frustum that straddles
+     * the extension of two planes near a corner is reported as visible.
+     *
+     * @param b The box.
+     * @return If the box is not entirely outside a plane.
+     */
+    GEL_CONSTEXPR bool intersects( const TAabb<T>& b ) const;
+
+    /**
+     * Checks if a sphere may be visible.
+     *
+     * @param center The center of the sphere.
+     * @param radius The radius of the sphere.
+     * @return If the sphere is not entirely outside a plane.
+     */
+    GEL_CONSTEXPR bool intersects( const TVec3<T>& center,
+                                   const T& radius ) const;
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the plane at the given index.
+     */
+    GEL_CONSTEXPR TVec4<T>& plane( Size index );
+
+    /**
+     * Gets the plane at the given index.
+     */
+    GEL_CONSTEXPR const TVec4<T>& plane( Size index ) const;
+};
+
+// FUNCTION DECLARATIONS
+/**
+ * Culls a stream of boxes against a frustum.
+ *
+ * The boxes are given in structure-of-arrays form as their centers and
+ * half-sizes, and the indices of the boxes that may be visible are written
+ * in increasing order.
+ *
+ * @param visible The resultant indices, which must hold centers.size()
+ * values.
+ * @param f The frustum.
+ * @param centers The box centers.
+ * @param extents The box half-sizes.
+ * @return The number of visible boxes.
+ */
+template <typename T>
+Size cull( uint32* visible, const TFrustum<T>& f,
+           const TVec3Stream<T>& centers, const TVec3Stream<T>& extents );
+
+/**
+ * Culls spheres against a frustum.
+ *
+ * The indices of the spheres that may be visible are written in increasing
+ * order.
+ *
+ * @param visible The resultant indices, which must hold centers.size()
+ * values.
+ * @param f The frustum.
+ * @param centers The sphere centers.
+ * @param radii The sphere radii, which must hold centers.size() values.
+ * @return The number of visible spheres.
+ */
+template <typename T>
+Size cull( uint32* visible, const TFrustum<T>& f,
+           const TVec3Stream<T>& centers, const T* radii );
+
+// IMPLEMENTATION
+
+// IMPLICIT CONSTRUCTORS
+template <typename T>
+GEL_CONSTEXPR inline
+TFrustum<T>::TFrustum()
+{
+    for ( Size i = 0; i < PLANES; ++i )
+    {
+        _planes[i] = TVec4<T>( 0, 0, 0, 1 );
+    }
+}
+
+// EXPLICIT CONSTRUCTORS
+template <typename T>
+GEL_CONSTEXPR inline
+TFrustum<T>::TFrustum( const TMat4<T>& m )
+{
+    // the clip conditions -w <= x <= w etc. are dot products of the rows
+    const TMat4<T> rows = transpose( m );
+    _planes[0] = rows[3] + rows[0];
+    _planes[1] = rows[3] - rows[0];
+    _planes[2] = rows[3] + rows[1];
+    _planes[3] = rows[3] - rows[1];
+    _planes[4] = rows[3] + rows[2];
+    _planes[5] = rows[3] - rows[2];
+
+    for ( Size i = 0; i < PLANES; ++i )
+    {
+        const TVec4<T>& p = _planes[i];
+        _planes[i] *= 1 / squareRoot( p.x * p.x + p.y * p.y + p.z * p.z );
+    }
+}
+
+// MEMBER FUNCTIONS
+template <typename T>
+GEL_CONSTEXPR inline
+bool TFrustum<T>::contains( const TVec3<T>& p ) const
+{
+    for ( Size i = 0; i < PLANES; ++i )
+    {
+        const TVec4<T>& n = _planes[i];
+        if ( n.x * p.x + n.y * p.y + n.z * p.z + n.w < 0 )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+bool TFrustum<T>::intersects( const TAabb<T>& b ) const
+{
+    // the box is outside a plane when its center is further behind it than
+    // the projection of its extents onto the plane normal
+    const TVec3<T> c = b.center();
+    const TVec3<T> e = b.extents();
+    for ( Size i = 0; i < PLANES; ++i )
+    {
+        const TVec4<T>& n = _planes[i];
+        const T d = n.x * c.x + n.y * c.y + n.z * c.z + n.w;
+        const T r = ( n.x < 0 ? -n.x : n.x ) * e.x +
+                    ( n.y < 0 ? -n.y : n.y ) * e.y +
+                    ( n.z < 0 ? -n.z : n.z ) * e.z;
+        if ( d + r < 0 )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+bool TFrustum<T>::intersects( const TVec3<T>& center, const T& radius ) const
+{
+    for ( Size i = 0; i < PLANES; ++i )
+    {
+        const TVec4<T>& n = _planes[i];
+        if ( n.x * center.x + n.y * center.y + n.z * center.z + n.w +
+             radius < 0 )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ACCESSOR FUNCTIONS
+template <typename T>
+GEL_CONSTEXPR inline
+TVec4<T>& TFrustum<T>::plane( Size index )
+{
+    assert( index < PLANES );
+    return _planes[index];
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+const TVec4<T>& TFrustum<T>::plane( Size index ) const
+{
+    assert( index < PLANES );
+    return _planes[index];
+}
+
+template <typename T>
+const Size TFrustum<T>::PLANES;
+
+// FUNCTIONS
+template <typename T>
+inline
+Size cull( uint32* visible, const TFrustum<T>& f,
+           const TVec3Stream<T>& centers, const TVec3Stream<T>& extents )
+{
+    assert( centers.size() == extents.size() );
+    const Size n = centers.size();
+    Size count = 0;
+    for ( Size i = 0; i < n; ++i )
+    {
+        if ( f.intersects( aabbFromCenter( centers.get( i ),
+                                           extents.get( i ) ) ) )
+        {
+            visible[count++] = static_cast<uint32>( i );
+        }
+    }
+    return count;
+}
+
+template <typename T>
+inline
+Size cull( uint32* visible, const TFrustum<T>& f,
+           const TVec3Stream<T>& centers, const T* radii )
+{
+    const Size n = centers.size();
+    Size count = 0;
+    for ( Size i = 0; i < n; ++i )
+    {
+        if ( f.intersects( centers.get( i ), radii[i] ) )
+        {
+            visible[count++] = static_cast<uint32>( i );
+        }
+    }
+    return count;
+}
+
+template <>
+inline
+Size cull( uint32* visible, const TFrustum<float>& f,
+           const TVec3Stream<float>& centers,
+           const TVec3Stream<float>& extents )
+{
+    assert( centers.size() == extents.size() );
+    float planes[TFrustum<float>::PLANES * 4];
+    for ( Size i = 0; i < TFrustum<float>::PLANES; ++i )
+    {
+        const TVec4<float>& p = f.plane( i );
+        planes[i * 4] = p.x;
+        planes[i * 4 + 1] = p.y;
+        planes[i * 4 + 2] = p.z;
+        planes[i * 4 + 3] = p.w;
+    }
+
+    const float* cs[] = { centers.x(), centers.y(), centers.z() };
+    const float* es[] = { extents.x(), extents.y(), extents.z() };
+    return batchKernels().cullBoxes( visible, planes, cs, es,
+                                     centers.size() );
+}
+
+template <>
+inline
+Size cull( uint32* visible, const TFrustum<float>& f,
+           const TVec3Stream<float>& centers, const float* radii )
+{
+    float planes[TFrustum<float>::PLANES * 4];
+    for ( Size i = 0; i < TFrustum<float>::PLANES; ++i )
+    {
+        const TVec4<float>& p = f.plane( i );
+        planes[i * 4] = p.x;
+        planes[i * 4 + 1] = p.y;
+        planes[i * 4 + 2] = p.z;
+        planes[i * 4 + 3] = p.w;
+    }
+
+    const float* cs[] = { centers.x(), centers.y(), centers.z() };
+    return batchKernels().cullSpheres( visible, planes, cs, radii,
+                                       centers.size() );
+}
+
+/**
+ * Defines a default frustum.
+ */
+typedef TFrustum<float> Frustum;
+
+/**
+ * Defines a double frustum.
+ */
+typedef TFrustum<double> DFrustum;
+
+} // End nspc math
+
+} // End nspc gel
+
+#endif //GEL_FRUSTUM_H
@@ -0,0 +1,737 @@
+// geometric.h
+#ifndef GEL_GEOMETRIC_H
+#define GEL_GEOMETRIC_H
+#include <assert.h>
+#include <math.h>
+#include "gel/gellib.h"
+#include "gel/math/precision.h"
+#include "gel/math/simd.h"
+#include "gel/math/vec2.h"
+#include "gel/math/vec3.h"
+#include "gel/math/vec4.h"
+
+namespace gel
+{
+
+namespace math
+{
+
+/**
+ * @brief Computes reciprocal square roots at a given precision.
+ *
+ * HIGHP computes the exact value. For floats MEDIUMP refines the hardware
+ * estimate with one Newton-Raphson step, which is accurate to about 22 bits,
+ * and LOWP uses the raw estimate, which is accurate to about 11 bits. Other
+ * types and precisions are always exact.
+ *
+ * @tparam P The precision.
+ */
+template <Precision P>
+struct InverseSqrt
+{
+    /**
+     * Computes the reciprocal square root of a scalar.
+     *
+     * @param s The scalar, which must be positive.
+     * @return The reciprocal square root.
+     */
+    template <typename T>
+    GEL_CONSTEXPR static T scalar( const T& s );
+
+    /**
+     * Computes the reciprocal square root of each component of a register.
+     *
+     * @param a The register, whose components must be positive.
+     * @return The reciprocal square roots.
+     */
+    static simd::Float4 packed( simd::Float4 a );
+};
+
+template <>
+struct InverseSqrt<MEDIUMP>
+{
+    template <typename T>
+    GEL_CONSTEXPR static T scalar( const T& s );
+
+    GEL_CONSTEXPR static float scalar( const float& s );
+
+    static simd::Float4 packed( simd::Float4 a );
+};
+
+template <>
+struct InverseSqrt<LOWP>
+{
+    template <typename T>
+    GEL_CONSTEXPR static T scalar( const T& s );
+
+    GEL_CONSTEXPR static float scalar( const float& s );
+
+    static simd::Float4 packed( simd::Float4 a );
+};
+
+// FUNCTION DECLARATIONS
+/**
+ * Computes the square root of a scalar.
+ *
+ * Unlike sqrt this may be used in constant expressions, where it iterates
+ * Newton's method to double precision.
+ *
+ * @param s The scalar, which must not be negative.
+ * @return The square root.
+ */
+template <typename T>
+GEL_CONSTEXPR T squareRoot( const T& s );
+
+/**
+ * Computes the reciprocal square root of a scalar.
+ *
+ * @param s The scalar, which must be positive.
+ * @return The reciprocal square root.
+ * @tparam P The precision.
+ */
+template <Precision P, typename T>
+GEL_CONSTEXPR T inversesqrt( const T& s );
+
+/**
+ * Computes the dot product of two vectors.
+ *
+ * @param u The first vector.
+ * @param v The second vector.
+ * @return The dot product.
+ */
+template <typename T>
+GEL_CONSTEXPR T dot( const TVec2<T>& u, const TVec2<T>& v );
+
+/**
+ * Computes the dot product of two vectors.
+ *
+ * @param u The first vector.
+ * @param v The second vector.
+ * @return The dot product.
+ */
+template <typename T>
+GEL_CONSTEXPR T dot( const TVec3<T>& u, const TVec3<T>& v );
+
+/**
+ * Computes the dot product of two vectors.
+ *
+ * @param u The first vector.
+ * @param v The second vector.
+ * @return The dot product.
+ */
+template <typename T>
+GEL_CONSTEXPR T dot( const TVec4<T>& u, const TVec4<T>& v );
+
+/**
+ * Computes the cross product of two vectors.
+ *
+ * @param u The first vector.
+ * @param v The second vector.
+ * @return The cross product u x v.
+ */
+template <typename T>
+GEL_CONSTEXPR TVec3<T> cross( const TVec3<T>& u, const TVec3<T>& v );
+
+/**
+ * Computes the length of a vector.
+ *
+ * @param v The vector.
+ * @return The length.
+ */
+template <typename T>
+GEL_CONSTEXPR T length( const TVec2<T>& v );
+
+/**
+ * Computes the length of a vector.
+ *
+ * @param v The vector.
+ * @return The length.
+ */
+template <typename T>
+GEL_CONSTEXPR T length( const TVec3<T>& v );
+
+/**
+ * Computes the length of a vector.
+ *
+ * @param v The vector.
+ * @return The length.
+ */
+template <typename T>
+GEL_CONSTEXPR T length( const TVec4<T>& v );
+
+/**
+ * Computes the distance between two points.
+ *
+ * @param u The first point.
+ * @param v The second point.
+ * @return The distance.
+ */
+template <typename T>
+GEL_CONSTEXPR T distance( const TVec2<T>& u, const TVec2<T>& v );
+
+/**
+ * Computes the distance between two points.
+ *
+ * @param u The first point.
+ * @param v The second point.
+ * @return The distance.
+ */
+template <typename T>
+GEL_CONSTEXPR T distance( const TVec3<T>& u, const TVec3<T>& v );
+
+/**
+ * Computes the distance between two points.
+ *
+ * @param u The first point.
+ * @param v The second point.
+ * @return The distance.
+ */
+template <typename T>
+GEL_CONSTEXPR T distance( const TVec4<T>& u, const TVec4<T>& v );
+
+/**
+ * Scales a vector to unit length.
+ *
+ * @param v The vector, which must be non-zero.
+ * @return The unit vector.
+ * @tparam P The precision of the reciprocal square root.
+ */
+template <Precision P = DEAFULTP, typename T>
+GEL_CONSTEXPR TVec2<T> normalize( const TVec2<T>& v );
+
+/**
+ * Scales a vector to unit length.
+ *
+ * @param v The vector, which must be non-zero.
+ * @return The unit vector.
+ * @tparam P The precision of the reciprocal square root.
+ */
+template <Precision P = DEAFULTP, typename T>
+GEL_CONSTEXPR TVec3<T> normalize( const TVec3<T>& v );
+
+/**
+ * Scales a vector to unit length.
+ *
+ * @param v The vector, which must be non-zero.
+ * @return The unit vector.
+ * @tparam P The precision of the reciprocal square root.
+ */
+template <Precision P = DEAFULTP, typename T>
+GEL_CONSTEXPR TVec4<T> normalize( const TVec4<T>& v );
+
+/**
+ * Scales a vector to unit length entirely in SIMD registers.
+ *
+ * @param v The vector, which must be non-zero.
+ * @return The unit vector.
+ * @tparam P The precision of the reciprocal square root.
+ */
+template <Precision P = DEAFULTP>
+GEL_CONSTEXPR TVec4<float> normalize( const TVec4<float>& v );
+
+/**
+ * Reflects an incident vector about a normal.
+ *
+ * @param i The incident vector.
+ * @param n The unit normal.
+ * @return The reflected vector.
+ */
+template <typename T>
+GEL_CONSTEXPR TVec2<T> reflect( const TVec2<T>& i, const TVec2<T>& n );
+
+/**
+ * Reflects an incident vector about a normal.
+ *
+ * @param i The incident vector.
+ * @param n The unit normal.
+ * @return The reflected vector.
+ */
+template <typename T>
+GEL_CONSTEXPR TVec3<T> reflect( const TVec3<T>& i, const TVec3<T>& n );
+
+/**
+ * Reflects an incident vector about a normal.
+ *
+ * @param i The incident vector.
+ * @param n The unit normal.
+ * @return The reflected vector.
+ */
+template <typename T>
+GEL_CONSTEXPR TVec4<T> reflect( const TVec4<T>& i, const TVec4<T>& n );
+
+/**
+ * Takes the component-wise minimum of two vectors.
+ */
+template <typename T>
+GEL_CONSTEXPR TVec2<T> min( const TVec2<T>& u, const TVec2<T>& v );
+
+/**
+ * Takes the component-wise minimum of two vectors.
+ */
+template <typename T>
+GEL_CONSTEXPR TVec3<T> min( const TVec3<T>& u, const TVec3<T>& v );
+
+/**
+ * Takes the component-wise minimum of two vectors.
+ */
+template <typename T>
+GEL_CONSTEXPR TVec4<T> min( const TVec4<T>& u, const TVec4<T>& v );
+
+/**
+ * Takes the component-wise maximum of two vectors.
+ */
+template <typename T>
+GEL_CONSTEXPR TVec2<T> max( const TVec2<T>& u, const TVec2<T>& v );
+
+/**
+ * Takes the component-wise maximum of two vectors.
+ */
+template <typename T>
+GEL_CONSTEXPR TVec3<T> max( const TVec3<T>& u, const TVec3<T>& v );
+
+/**
+ * Takes the component-wise maximum of two vectors.
+ */
+template <typename T>
+GEL_CONSTEXPR TVec4<T> max( const TVec4<T>& u, const TVec4<T>& v );
+
+/**
+ * Clamps the components of a vector between two others.
+ *
+ * @param v The vector.
+ * @param lo The lower bounds.
+ * @param hi The upper bounds.
+ * @return The clamped vector.
+ */
+template <typename T>
+GEL_CONSTEXPR
+TVec2<T> clamp( const TVec2<T>& v, const TVec2<T>& lo, const TVec2<T>& hi );
+
+/**
+ * Clamps the components of a vector between two others.
+ *
+ * @param v The vector.
+ * @param lo The lower bounds.
+ * @param hi The upper bounds.
+ * @return The clamped vector.
+ */
+template <typename T>
+GEL_CONSTEXPR
+TVec3<T> clamp( const TVec3<T>& v, const TVec3<T>& lo, const TVec3<T>& hi );
+
+/**
+ * Clamps the components of a vector between two others.
+ *
+ * @param v The vector.
+ * @param lo The lower bounds.
+ * @param hi The upper bounds.
+ * @return The clamped vector.
+ */
+template <typename T>
+GEL_CONSTEXPR
+TVec4<T> clamp( const TVec4<T>& v, const TVec4<T>& lo, const TVec4<T>& hi );
+
+/**
+ * Clamps the components of a vector between two scalars.
+ *
+ * @param v The vector.
+ * @param lo The lower bound.
+ * @param hi The upper bound.
+ * @return The clamped vector.
+ */
+template <typename T>
+GEL_CONSTEXPR TVec2<T> clamp( const TVec2<T>& v, const T& lo, const T& hi );
+
+/**
+ * Clamps the components of a vector between two scalars.
+ *
+ * @param v The vector.
+ * @param lo The lower bound.
+ * @param hi The upper bound.
+ * @return The clamped vector.
+ */
+template <typename T>
+GEL_CONSTEXPR TVec3<T> clamp( const TVec3<T>& v, const T& lo, const T& hi );
+
+/**
+ * Clamps the components of a vector between two scalars.
+ *
+ * @param v The vector.
+ * @param lo The lower bound.
+ * @param hi The upper bound.
+ * @return The clamped vector.
+ */
+template <typename T>
+GEL_CONSTEXPR TVec4<T> clamp( const TVec4<T>& v, const T& lo, const T& hi );
+
+// IMPLEMENTATION
+
+// SQUARE ROOT
+template <typename T>
+GEL_CONSTEXPR inline
+T squareRoot( const T& s )
+{
+    assert( s >= 0 );
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        // starting above the root makes the iterates decrease monotonically
+        // until they converge
+        const double d = static_cast<double>( s );
+        double r = d > 1 ? d : 1;
+        double next = 0.5 * ( r + d / r );
+        while ( next < r )
+        {
+            r = next;
+            next = 0.5 * ( r + d / r );
+        }
+        return static_cast<T>( d == 0 ? 0 : r );
+    }
+
+    return static_cast<T>( sqrt( s ) );
+}
+
+// RECIPROCAL SQUARE ROOT
+template <Precision P>
+template <typename T>
+GEL_CONSTEXPR inline
+T InverseSqrt<P>::scalar( const T& s )
+{
+    assert( s > 0 );
+    return static_cast<T>( 1 ) / squareRoot( s );
+}
+
+template <Precision P>
+inline
+simd::Float4 InverseSqrt<P>::packed( simd::Float4 a )
+{
+    return simd::div( simd::set1( 1.0f ), simd::sqrt( a ) );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+T InverseSqrt<MEDIUMP>::scalar( const T& s )
+{
+    return InverseSqrt<HIGHP>::scalar( s );
+}
+
+GEL_CONSTEXPR inline
+float InverseSqrt<MEDIUMP>::scalar( const float& s )
+{
+    assert( s > 0 );
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return InverseSqrt<HIGHP>::scalar( s );
+    }
+
+    return TVec4<float>( packed( simd::set1( s ) ) ).x;
+}
+
+inline
+simd::Float4 InverseSqrt<MEDIUMP>::packed( simd::Float4 a )
+{
+    // y' = y * ( 1.5 - 0.5 * a * y * y )
+    simd::Float4 y = simd::rsqrt( a );
+    simd::Float4 h = simd::mul( simd::mul( simd::set1( 0.5f ), a ),
+                                simd::mul( y, y ) );
+    return simd::mul( y, simd::sub( simd::set1( 1.5f ), h ) );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+T InverseSqrt<LOWP>::scalar( const T& s )
+{
+    return InverseSqrt<HIGHP>::scalar( s );
+}
+
+GEL_CONSTEXPR inline
+float InverseSqrt<LOWP>::scalar( const float& s )
+{
+    assert( s > 0 );
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return InverseSqrt<HIGHP>::scalar( s );
+    }
+
+    return TVec4<float>( packed( simd::set1( s ) ) ).x;
+}
+
+inline
+simd::Float4 InverseSqrt<LOWP>::packed( simd::Float4 a )
+{
+    return simd::rsqrt( a );
+}
+
+template <Precision P, typename T>
+GEL_CONSTEXPR inline
+T inversesqrt( const T& s )
+{
+    return InverseSqrt<P>::scalar( s );
+}
+
+// DOT PRODUCT
+template <typename T>
+GEL_CONSTEXPR inline
+T dot( const TVec2<T>& u, const TVec2<T>& v )
+{
+    return u.x * v.x + u.y * v.y;
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+T dot( const TVec3<T>& u, const TVec3<T>& v )
+{
+    return u.x * v.x + u.y * v.y + u.z * v.z;
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+T dot( const TVec4<T>& u, const TVec4<T>& v )
+{
+    return ( u.x * v.x + u.y * v.y ) + ( u.z * v.z + u.w * v.w );
+}
+
+template <>
+GEL_CONSTEXPR inline
+float dot( const TVec4<float>& u, const TVec4<float>& v )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return ( u.x * v.x + u.y * v.y ) + ( u.z * v.z + u.w * v.w );
+    }
+
+    return TVec4<float>( simd::hadd( simd::mul( u.m, v.m ) ) ).x;
+}
+
+// CROSS PRODUCT
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> cross( const TVec3<T>& u, const TVec3<T>& v )
+{
+    return TVec3<T>( u.y * v.z - u.z * v.y,
+                     u.z * v.x - u.x * v.z,
+                     u.x * v.y - u.y * v.x );
+}
+
+// LENGTH
+template <typename T>
+GEL_CONSTEXPR inline
+T length( const TVec2<T>& v )
+{
+    return squareRoot( dot( v, v ) );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+T length( const TVec3<T>& v )
+{
+    return squareRoot( dot( v, v ) );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+T length( const TVec4<T>& v )
+{
+    return squareRoot( dot( v, v ) );
+}
+
+// DISTANCE
+template <typename T>
+GEL_CONSTEXPR inline
+T distance( const TVec2<T>& u, const TVec2<T>& v )
+{
+    return length( u - v );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+T distance( const TVec3<T>& u, const TVec3<T>& v )
+{
+    return length( u - v );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+T distance( const TVec4<T>& u, const TVec4<T>& v )
+{
+    return length( u - v );
+}
+
+// NORMALIZE
+template <Precision P, typename T>
+GEL_CONSTEXPR inline
+TVec2<T> normalize( const TVec2<T>& v )
+{
+    return v * inversesqrt<P>( dot( v, v ) );
+}
+
+template <Precision P, typename T>
+GEL_CONSTEXPR inline
+TVec3<T> normalize( const TVec3<T>& v )
+{
+    return v * inversesqrt<P>( dot( v, v ) );
+}
+
+template <Precision P, typename T>
+GEL_CONSTEXPR inline
+TVec4<T> normalize( const TVec4<T>& v )
+{
+    return v * inversesqrt<P>( dot( v, v ) );
+}
+
+template <Precision P>
+GEL_CONSTEXPR inline
+TVec4<float> normalize( const TVec4<float>& v )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return v * InverseSqrt<P>::scalar( dot( v, v ) );
+    }
+
+    simd::Float4 d = simd::hadd( simd::mul( v.m, v.m ) );
+    return TVec4<float>( simd::mul( v.m, InverseSqrt<P>::packed( d ) ) );
+}
+
+// REFLECT
+template <typename T>
+GEL_CONSTEXPR inline
+TVec2<T> reflect( const TVec2<T>& i, const TVec2<T>& n )
+{
+    return i - n * ( dot( n, i ) * static_cast<T>( 2 ) );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> reflect( const TVec3<T>& i, const TVec3<T>& n )
+{
+    return i - n * ( dot( n, i ) * static_cast<T>( 2 ) );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec4<T> reflect( const TVec4<T>& i, const TVec4<T>& n )
+{
+    return i - n * ( dot( n, i ) * static_cast<T>( 2 ) );
+}
+
+// MIN
+template <typename T>
+GEL_CONSTEXPR inline
+TVec2<T> min( const TVec2<T>& u, const TVec2<T>& v )
+{
+    return TVec2<T>( u.x < v.x ? u.x : v.x, u.y < v.y ? u.y : v.y );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> min( const TVec3<T>& u, const TVec3<T>& v )
+{
+    return TVec3<T>( u.x < v.x ? u.x : v.x, u.y < v.y ? u.y : v.y,
+                     u.z < v.z ? u.z : v.z );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec4<T> min( const TVec4<T>& u, const TVec4<T>& v )
+{
+    return TVec4<T>( u.x < v.x ? u.x : v.x, u.y < v.y ? u.y : v.y,
+                     u.z < v.z ? u.z : v.z, u.w < v.w ? u.w : v.w );
+}
+
+template <>
+GEL_CONSTEXPR inline
+TVec4<float> min( const TVec4<float>& u, const TVec4<float>& v )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return TVec4<float>( u.x < v.x ? u.x : v.x, u.y < v.y ? u.y : v.y,
+                             u.z < v.z ? u.z : v.z, u.w < v.w ? u.w : v.w );
+    }
+
+    return TVec4<float>( simd::min( u.m, v.m ) );
+}
+
+// MAX
+template <typename T>
+GEL_CONSTEXPR inline
+TVec2<T> max( const TVec2<T>& u, const TVec2<T>& v )
+{
+    return TVec2<T>( u.x > v.x ? u.x : v.x, u.y > v.y ? u.y : v.y );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> max( const TVec3<T>& u, const TVec3<T>& v )
+{
+    return TVec3<T>( u.x > v.x ? u.x : v.x, u.y > v.y ? u.y : v.y,
+                     u.z > v.z ? u.z : v.z );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec4<T> max( const TVec4<T>& u, const TVec4<T>& v )
+{
+    return TVec4<T>( u.x > v.x ? u.x : v.x, u.y > v.y ? u.y : v.y,
+                     u.z > v.z ? u.z : v.z, u.w > v.w ? u.w : v.w );
+}
+
+template <>
+GEL_CONSTEXPR inline
+TVec4<float> max( const TVec4<float>& u, const TVec4<float>& v )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return TVec4<float>( u.x > v.x ? u.x : v.x, u.y > v.y ? u.y : v.y,
+                             u.z > v.z ? u.z : v.z, u.w > v.w ? u.w : v.w );
+    }
+
+    return TVec4<float>( simd::max( u.m, v.m ) );
+}
+
+// CLAMP
+template <typename T>
+GEL_CONSTEXPR inline
+TVec2<T> clamp( const TVec2<T>& v, const TVec2<T>& lo, const TVec2<T>& hi )
+{
+    return min( max( v, lo ), hi );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> clamp( const TVec3<T>& v, const TVec3<T>& lo, const TVec3<T>& hi )
+{
+    return min( max( v, lo ), hi );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec4<T> clamp( const TVec4<T>& v, const TVec4<T>& lo, const TVec4<T>& hi )
+{
+    return min( max( v, lo ), hi );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec2<T> clamp( const TVec2<T>& v, const T& lo, const T& hi )
+{
+    return clamp( v, TVec2<T>( lo ), TVec2<T>( hi ) );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> clamp( const TVec3<T>& v, const T& lo, const T& hi )
+{
+    return clamp( v, TVec3<T>( lo ), TVec3<T>( hi ) );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec4<T> clamp( const TVec4<T>& v, const T& lo, const T& hi )
+{
+    return clamp( v, TVec4<T>( lo ), TVec4<T>( hi ) );
+}
+
+} // End nspc math
+
+} // End nspc gel
+
+#endif //GEL_GEOMETRIC_H
@@ -0,0 +1,26 @@
+// mat.h
+#ifndef GEL_MAT_H
+#define GEL_MAT_H
+#include "mat4.h"
+
+namespace gel
+{
+
+namespace math
+{
+
+/**
+ * Defines a default 4x4 matrix.
+ */
+typedef TMat4<float> Mat4;
+
+/**
+ * Defines a double 4x4 matrix.
+ */
+typedef TMat4<double> DMat4;
+
+} // End nspc math
+
+} // End nspc gel
+
+#endif
@@ -0,0 +1,627 @@
+// mat4.h
+#ifndef GEL_MAT4_H
+#define GEL_MAT4_H
+#include <assert.h>
+#include "gel/gellib.h"
+#include "gel/math/dispatch.h"
+#include "gel/math/simd.h"
+#include "gel/math/vec3.h"
+#include "gel/math/vec4.h"
+#include "gel/math/vec3_stream.h"
+
+namespace gel
+{
+
+namespace math
+{
+
+/**
+ * @brief Defines a column-major 4x4 matrix.
+ *
+ * The matrix is stored as four column vectors. For float matrices the columns
+ * are SIMD vectors so products, transposes and inverses run on packed
+ * registers and the matrix is 16-byte aligned.
+ *
+ * @tparam T The component type.
+ */
+template <typename T>
+class TMat4
+{
+  private:
+    /**
+     * The columns.
+     */
+    TVec4<T> _columns[4];
+
+  public:
+    typedef T ValueType;
+
+    // IMPLICIT CONSTRUCTORS
+    /**
+     * Constructs a new identity matrix.
+     */
+    GEL_CONSTEXPR TMat4();
+
+    /**
+     * Constructs this matrix as a copy of the other.
+     *
+     * @param m The matrix to copy.
+     */
+    GEL_CONSTEXPR TMat4( const TMat4<T>& m );
+
+    // EXPLICIT CONSTRUCTORS
+    /**
+     * Constructs a new matrix with the given value along the diagonal and
+     * zeros elsewhere.
+     *
+     * @param s The diagonal value.
+     */
+    GEL_CONSTEXPR explicit TMat4( const T& s );
+
+    /**
+     * Constructs a new matrix from its columns.
+     *
+     * @param c0 The first column.
+     * @param c1 The second column.
+     * @param c2 The third column.
+     * @param c3 The fourth column.
+     */
+    GEL_CONSTEXPR
+    TMat4( const TVec4<T>& c0, const TVec4<T>& c1, const TVec4<T>& c2,
+           const TVec4<T>& c3 );
+
+    // UNARY OPERATORS
+    /**
+     * Makes this a copy of the other matrix.
+     *
+     * @param m The matrix to copy.
+     */
+    GEL_CONSTEXPR TMat4<T>& operator=( const TMat4<T>& m );
+
+    /**
+     * Post-multiplies this matrix by another.
+     *
+     * @param m The matrix to multiply by.
+     */
+    GEL_CONSTEXPR TMat4<T>& operator*=( const TMat4<T>& m );
+
+    /**
+     * Multiplies every component by a scalar.
+     *
+     * @param s The scalar.
+     */
+    GEL_CONSTEXPR TMat4<T>& operator*=( const T& s );
+
+    // ACCESSOR OPERATORS
+    /**
+     * Gets the column at the given index.
+     */
+    GEL_CONSTEXPR TVec4<T>& operator[]( Size index );
+
+    /**
+     * Gets the column at the given index.
+     */
+    GEL_CONSTEXPR const TVec4<T>& operator[]( Size index ) const;
+};
+
+// BINARY OPERATOR DECLARATIONS
+/**
+ * Multiplies two matrices.
+ *
+ * @param a The first matrix.
+ * @param b The second matrix.
+ * @return The product a * b.
+ */
+template <typename T>
+GEL_CONSTEXPR TMat4<T> operator*( const TMat4<T>& a, const TMat4<T>& b );
+
+/**
+ * Transforms a column vector by a matrix.
+ *
+ * @param m The matrix.
+ * @param v The vector.
+ * @return The transformed vector.
+ */
+template <typename T>
+GEL_CONSTEXPR TVec4<T> operator*( const TMat4<T>& m, const TVec4<T>& v );
+
+/**
+ * Multiplies every component of a matrix by a scalar.
+ *
+ * @param m The matrix.
+ * @param s The scalar.
+ * @return The resultant matrix.
+ */
+template <typename T>
+GEL_CONSTEXPR TMat4<T> operator*( const TMat4<T>& m, const T& s );
+
+/**
+ * Checks if the components of two matrices are equal.
+ *
+ * @param a The first matrix.
+ * @param b The second matrix.
+ * @return If they are equal.
+ */
+template <typename T>
+GEL_CONSTEXPR bool operator==( const TMat4<T>& a, const TMat4<T>& b );
+
+/**
+ * Checks if the components of two matrices are not equal.
+ *
+ * @param a The first matrix.
+ * @param b The second matrix.
+ * @return If they are not equal.
+ */
+template <typename T>
+GEL_CONSTEXPR bool operator!=( const TMat4<T>& a, const TMat4<T>& b );
+
+// FUNCTION DECLARATIONS
+/**
+ * Transposes a matrix.
+ *
+ * @param m The matrix.
+ * @return The transposed matrix.
+ */
+template <typename T>
+GEL_CONSTEXPR TMat4<T> transpose( const TMat4<T>& m );
+
+/**
+ * Computes the determinant of a matrix.
+ *
+ * @param m The matrix.
+ * @return The determinant.
+ */
+template <typename T>
+GEL_CONSTEXPR T determinant( const TMat4<T>& m );
+
+/**
+ * Inverts a matrix.
+ *
+ * @param m The matrix, which must not be singular.
+ * @return The inverse matrix.
+ */
+template <typename T>
+GEL_CONSTEXPR TMat4<T> inverse( const TMat4<T>& m );
+
+/**
+ * Inverts an affine matrix.
+ *
+ * This only inverts the upper 3x3 block and the translation so it is
+ * considerably cheaper than inverse(). The last row must be (0, 0, 0, 1).
+ *
+ * @param m The affine matrix, which must not be singular.
+ * @return The inverse matrix.
+ */
+template <typename T>
+GEL_CONSTEXPR TMat4<T> affineInverse( const TMat4<T>& m );
+
+/**
+ * Transforms an array of points by a matrix.
+ *
+ * The points are treated as having a fourth component of one and the
+ * resultant fourth component is discarded.
+ *
+ * @param m The matrix.
+ * @param in The points.
+ * @param out The transformed points, which may be the input array.
+ * @param count The number of points.
+ */
+template <typename T>
+void transformPoints( const TMat4<T>& m, const TVec3<T>* in, TVec3<T>* out,
+                      Size count );
+
+/**
+ * Transforms an array of directions by a matrix.
+ *
+ * The directions are treated as having a fourth component of zero so the
+ * translation is ignored.
+ *
+ * @param m The matrix.
+ * @param in The directions.
+ * @param out The transformed directions, which may be the input array.
+ * @param count The number of directions.
+ */
+template <typename T>
+void transformVectors( const TMat4<T>& m, const TVec3<T>* in, TVec3<T>* out,
+                       Size count );
+
+/**
+ * Transforms an array of 4D vectors by a matrix.
+ *
+ * @param m The matrix.
+ * @param in The vectors.
+ * @param out The transformed vectors, which may be the input array.
+ * @param count The number of vectors.
+ */
+template <typename T>
+void transform( const TMat4<T>& m, const TVec4<T>* in, TVec4<T>* out,
+                Size count );
+
+/**
+ * Transforms a stream of points by a matrix.
+ *
+ * @param m The matrix.
+ * @param in The points.
+ * @param out The transformed points, which may be the input stream.
+ * @return If the points were written, which fails if out could not be
+ *         resized, leaving it unchanged.
+ */
+template <typename T>
+bool transformPoints( const TMat4<T>& m, const TVec3Stream<T>& in,
+                      TVec3Stream<T>& out );
+
+// IMPLEMENTATION
+
+// IMPLICIT CONSTRUCTORS
+template <typename T>
+GEL_CONSTEXPR inline
+TMat4<T>::TMat4()
+{
+    _columns[0] = TVec4<T>( 1, 0, 0, 0 );
+    _columns[1] = TVec4<T>( 0, 1, 0, 0 );
+    _columns[2] = TVec4<T>( 0, 0, 1, 0 );
+    _columns[3] = TVec4<T>( 0, 0, 0, 1 );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TMat4<T>::TMat4( const TMat4<T>& m )
+{
+    _columns[0] = m._columns[0];
+    _columns[1] = m._columns[1];
+    _columns[2] = m._columns[2];
+    _columns[3] = m._columns[3];
+}
+
+// EXPLICIT CONSTRUCTORS
+template <typename T>
+GEL_CONSTEXPR inline
+TMat4<T>::TMat4( const T& s )
+{
+    _columns[0] = TVec4<T>( s, 0, 0, 0 );
+    _columns[1] = TVec4<T>( 0, s, 0, 0 );
+    _columns[2] = TVec4<T>( 0, 0, s, 0 );
+    _columns[3] = TVec4<T>( 0, 0, 0, s );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TMat4<T>::TMat4( const TVec4<T>& c0, const TVec4<T>& c1, const TVec4<T>& c2,
+                 const TVec4<T>& c3 )
+{
+    _columns[0] = c0;
+    _columns[1] = c1;
+    _columns[2] = c2;
+    _columns[3] = c3;
+}
+
+// UNARY OPERATORS
+template <typename T>
+GEL_CONSTEXPR inline
+TMat4<T>& TMat4<T>::operator=( const TMat4<T>& m )
+{
+    _columns[0] = m._columns[0];
+    _columns[1] = m._columns[1];
+    _columns[2] = m._columns[2];
+    _columns[3] = m._columns[3];
+    return *this;
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TMat4<T>& TMat4<T>::operator*=( const TMat4<T>& m )
+{
+    return *this = *this * m;
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TMat4<T>& TMat4<T>::operator*=( const T& s )
+{
+    _columns[0] *= s;
+    _columns[1] *= s;
+    _columns[2] *= s;
+    _columns[3] *= s;
+    return *this;
+}
+
+// ACCESSOR OPERATORS
+template <typename T>
+GEL_CONSTEXPR inline
+TVec4<T>& TMat4<T>::operator[]( Size index )
+{
+    assert( index < 4 );
+    return _columns[index];
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+const TVec4<T>& TMat4<T>::operator[]( Size index ) const
+{
+    assert( index < 4 );
+    return _columns[index];
+}
+
+// BINARY OPERATORS
+template <typename T>
+GEL_CONSTEXPR inline
+TMat4<T> operator*( const TMat4<T>& a, const TMat4<T>& b )
+{
+    return TMat4<T>( a * b[0], a * b[1], a * b[2], a * b[3] );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec4<T> operator*( const TMat4<T>& m, const TVec4<T>& v )
+{
+    // a linear combination of the columns keeps every term a packed operation
+    return ( m[0] * v.x + m[1] * v.y ) + ( m[2] * v.z + m[3] * v.w );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TMat4<T> operator*( const TMat4<T>& m, const T& s )
+{
+    return TMat4<T>( m[0] * s, m[1] * s, m[2] * s, m[3] * s );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+bool operator==( const TMat4<T>& a, const TMat4<T>& b )
+{
+    return a[0] == b[0] && a[1] == b[1] && a[2] == b[2] && a[3] == b[3];
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+bool operator!=( const TMat4<T>& a, const TMat4<T>& b )
+{
+    return !( a == b );
+}
+
+// FUNCTIONS
+template <typename T>
+GEL_CONSTEXPR inline
+TMat4<T> transpose( const TMat4<T>& m )
+{
+    return TMat4<T>( TVec4<T>( m[0].x, m[1].x, m[2].x, m[3].x ),
+                     TVec4<T>( m[0].y, m[1].y, m[2].y, m[3].y ),
+                     TVec4<T>( m[0].z, m[1].z, m[2].z, m[3].z ),
+                     TVec4<T>( m[0].w, m[1].w, m[2].w, m[3].w ) );
+}
+
+template <>
+GEL_CONSTEXPR inline
+TMat4<float> transpose( const TMat4<float>& m )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return TMat4<float>( TVec4<float>( m[0].x, m[1].x, m[2].x, m[3].x ),
+                             TVec4<float>( m[0].y, m[1].y, m[2].y, m[3].y ),
+                             TVec4<float>( m[0].z, m[1].z, m[2].z, m[3].z ),
+                             TVec4<float>( m[0].w, m[1].w, m[2].w, m[3].w ) );
+    }
+
+    simd::Float4 c0 = m[0].m;
+    simd::Float4 c1 = m[1].m;
+    simd::Float4 c2 = m[2].m;
+    simd::Float4 c3 = m[3].m;
+    simd::transpose( c0, c1, c2, c3 );
+    return TMat4<float>( TVec4<float>( c0 ), TVec4<float>( c1 ),
+                         TVec4<float>( c2 ), TVec4<float>( c3 ) );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TMat4<T> inverse( const TMat4<T>& m )
+{
+    // cofactor expansion on 2x2 sub-determinants, grouped so each column of
+    // the adjugate is built from packed vector operations
+    T c00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+    T c02 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
+    T c03 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
+    T c04 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+    T c06 = m[1][1] * m[3][3] - m[3][1] * m[1][3];
+    T c07 = m[1][1] * m[2][3] - m[2][1] * m[1][3];
+    T c08 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+    T c10 = m[1][1] * m[3][2] - m[3][1] * m[1][2];
+    T c11 = m[1][1] * m[2][2] - m[2][1] * m[1][2];
+    T c12 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+    T c14 = m[1][0] * m[3][3] - m[3][0] * m[1][3];
+    T c15 = m[1][0] * m[2][3] - m[2][0] * m[1][3];
+    T c16 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+    T c18 = m[1][0] * m[3][2] - m[3][0] * m[1][2];
+    T c19 = m[1][0] * m[2][2] - m[2][0] * m[1][2];
+    T c20 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+    T c22 = m[1][0] * m[3][1] - m[3][0] * m[1][1];
+    T c23 = m[1][0] * m[2][1] - m[2][0] * m[1][1];
+
+    TVec4<T> f0( c00, c00, c02, c03 );
+    TVec4<T> f1( c04, c04, c06, c07 );
+    TVec4<T> f2( c08, c08, c10, c11 );
+    TVec4<T> f3( c12, c12, c14, c15 );
+    TVec4<T> f4( c16, c16, c18, c19 );
+    TVec4<T> f5( c20, c20, c22, c23 );
+
+    TVec4<T> v0( m[1][0], m[0][0], m[0][0], m[0][0] );
+    TVec4<T> v1( m[1][1], m[0][1], m[0][1], m[0][1] );
+    TVec4<T> v2( m[1][2], m[0][2], m[0][2], m[0][2] );
+    TVec4<T> v3( m[1][3], m[0][3], m[0][3], m[0][3] );
+
+    TVec4<T> signA( 1, -1, 1, -1 );
+    TVec4<T> signB( -1, 1, -1, 1 );
+    TMat4<T> inv( ( v1 * f0 - v2 * f1 + v3 * f2 ) * signA,
+                  ( v0 * f0 - v2 * f3 + v3 * f4 ) * signB,
+                  ( v0 * f1 - v1 * f3 + v3 * f5 ) * signA,
+                  ( v0 * f2 - v1 * f4 + v2 * f5 ) * signB );
+
+    TVec4<T> d = m[0] * TVec4<T>( inv[0][0], inv[1][0], inv[2][0], inv[3][0] );
+    T det = ( d.x + d.y ) + ( d.z + d.w );
+    assert( det != 0 );
+
+    return inv * ( static_cast<T>( 1 ) / det );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+T determinant( const TMat4<T>& m )
+{
+    T c00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+    T c01 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+    T c02 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+    T c03 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+    T c04 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+    T c05 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+
+    TVec4<T> cof( +( m[1][1] * c00 - m[1][2] * c01 + m[1][3] * c02 ),
+                  -( m[1][0] * c00 - m[1][2] * c03 + m[1][3] * c04 ),
+                  +( m[1][0] * c01 - m[1][1] * c03 + m[1][3] * c05 ),
+                  -( m[1][0] * c02 - m[1][1] * c04 + m[1][2] * c05 ) );
+
+    TVec4<T> d = m[0] * cof;
+    return ( d.x + d.y ) + ( d.z + d.w );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TMat4<T> affineInverse( const TMat4<T>& m )
+{
+    assert( m[0].w == 0 && m[1].w == 0 && m[2].w == 0 && m[3].w == 1 );
+
+    // the rows of the inverse of the upper 3x3 block are the cross products
+    // of its columns divided by the determinant
+    const TVec4<T>& a = m[0];
+    const TVec4<T>& b = m[1];
+    const TVec4<T>& c = m[2];
+    TVec3<T> r0( b.y * c.z - b.z * c.y, b.z * c.x - b.x * c.z,
+                 b.x * c.y - b.y * c.x );
+    TVec3<T> r1( c.y * a.z - c.z * a.y, c.z * a.x - c.x * a.z,
+                 c.x * a.y - c.y * a.x );
+    TVec3<T> r2( a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+                 a.x * b.y - a.y * b.x );
+
+    T det = a.x * r0.x + a.y * r0.y + a.z * r0.z;
+    assert( det != 0 );
+    T invDet = static_cast<T>( 1 ) / det;
+    r0 *= invDet;
+    r1 *= invDet;
+    r2 *= invDet;
+
+    const TVec4<T>& t = m[3];
+    return TMat4<T>(
+        TVec4<T>( r0.x, r1.x, r2.x, 0 ),
+        TVec4<T>( r0.y, r1.y, r2.y, 0 ),
+        TVec4<T>( r0.z, r1.z, r2.z, 0 ),
+        TVec4<T>( -( r0.x * t.x + r0.y * t.y + r0.z * t.z ),
+                  -( r1.x * t.x + r1.y * t.y + r1.z * t.z ),
+                  -( r2.x * t.x + r2.y * t.y + r2.z * t.z ), 1 ) );
+}
+
+template <typename T>
+inline
+void transformPoints( const TMat4<T>& m, const TVec3<T>* in, TVec3<T>* out,
+                      Size count )
+{
+    const TVec4<T> c0 = m[0];
+    const TVec4<T> c1 = m[1];
+    const TVec4<T> c2 = m[2];
+    const TVec4<T> c3 = m[3];
+
+    for ( Size i = 0; i < count; ++i )
+    {
+        TVec4<T> r = ( c0 * in[i].x + c1 * in[i].y ) + ( c2 * in[i].z + c3 );
+        out[i] = TVec3<T>( r.x, r.y, r.z );
+    }
+}
+
+template <typename T>
+inline
+void transformVectors( const TMat4<T>& m, const TVec3<T>* in, TVec3<T>* out,
+                       Size count )
+{
+    const TVec4<T> c0 = m[0];
+    const TVec4<T> c1 = m[1];
+    const TVec4<T> c2 = m[2];
+
+    for ( Size i = 0; i < count; ++i )
+    {
+        TVec4<T> r = c0 * in[i].x + c1 * in[i].y + c2 * in[i].z;
+        out[i] = TVec3<T>( r.x, r.y, r.z );
+    }
+}
+
+template <typename T>
+inline
+void transform( const TMat4<T>& m, const TVec4<T>* in, TVec4<T>* out,
+                Size count )
+{
+    for ( Size i = 0; i < count; ++i )
+    {
+        out[i] = m * in[i];
+    }
+}
+
+template <typename T>
+inline
+bool transformPoints( const TMat4<T>& m, const TVec3Stream<T>& in,
+                      TVec3Stream<T>& out )
+{
+    const Size n = in.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    const T m00 = m[0].x, m01 = m[0].y, m02 = m[0].z;
+    const T m10 = m[1].x, m11 = m[1].y, m12 = m[1].z;
+    const T m20 = m[2].x, m21 = m[2].y, m22 = m[2].z;
+    const T m30 = m[3].x, m31 = m[3].y, m32 = m[3].z;
+    const T* ix = in.x();
+    const T* iy = in.y();
+    const T* iz = in.z();
+    T* ox = out.x();
+    T* oy = out.y();
+    T* oz = out.z();
+
+    for ( Size i = 0; i < n; ++i )
+    {
+        const T x = ix[i];
+        const T y = iy[i];
+        const T z = iz[i];
+        ox[i] = m00 * x + m10 * y + m20 * z + m30;
+        oy[i] = m01 * x + m11 * y + m21 * z + m31;
+        oz[i] = m02 * x + m12 * y + m22 * z + m32;
+    }
+    return true;
+}
+
+template <>
+inline
+bool transformPoints( const TMat4<float>& m, const TVec3Stream<float>& in,
+                      TVec3Stream<float>& out )
+{
+    if ( !out.resize( in.size() ) )
+    {
+        return false;
+    }
+
+    float columns[16];
+    for ( Size c = 0; c < 4; ++c )
+    {
+        columns[c * 4] = m[c].x;
+        columns[c * 4 + 1] = m[c].y;
+        columns[c * 4 + 2] = m[c].z;
+        columns[c * 4 + 3] = m[c].w;
+    }
+
+    float* os[] = { out.x(), out.y(), out.z() };
+    const float* is[] = { in.x(), in.y(), in.z() };
+    batchKernels().transformPoints( columns, os, is, in.size() );
+    return true;
+}
+
+} // End nspc math
+
+} // End nspc gel
+
+#endif //GEL_MAT4_H
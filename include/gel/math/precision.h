@@ -2,12 +2,24 @@
 #ifndef GEL_PRECISION_H
 #define GEL_PRECISION_H
 
+/**
+ * Defines the precision or instruction set a math function is run with.
+ *
+ * The SIMD levels are ordered so that a later level supports every earlier
+ * one. SIMD_BEST selects the best level the running CPU supports.
+ */
 enum Precision
 {
     HIGHP,
     MEDIUMP,
     LOWP,
-    SIMD,
+    SIMD_SCALAR,
+    SIMD_SSE2,
+    SIMD_SSE41,
+    SIMD_AVX2,
+    SIMD_AVX512,
+    SIMD_BEST,
+    SIMD = SIMD_BEST,
     DEAFULTP = MEDIUMP
 };
 
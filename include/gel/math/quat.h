@@ -0,0 +1,436 @@
+// quat.h
+#ifndef GEL_QUAT_H
+#define GEL_QUAT_H
+#include <assert.h>
+#include <math.h>
+#include "gel/gellib.h"
+#include "gel/math/geometric.h"
+#include "gel/math/simd.h"
+#include "gel/math/vec3.h"
+#include "gel/math/vec4.h"
+
+namespace gel
+{
+
+namespace math
+{
+
+/**
+ * @brief Defines a rotation quaternion.
+ *
+ * The quaternion shares the storage of a 4D vector with the vector part in
+ * x, y and z and the scalar part in w. Component-wise vector arithmetic is
+ * inherited so float quaternions run on the SIMD path of TVec4<float>.
+ *
+ * @tparam T The component type.
+ */
+template <typename T>
+class TQuat: public TVec4<T>
+{
+  public:
+    // IMPLICIT CONSTRUCTORS
+    /**
+     * Constructs a new identity quaternion.
+     */
+    GEL_CONSTEXPR TQuat();
+
+    /**
+     * Constructs this quaternion as a copy of the other.
+     *
+     * @param q The quaternion to copy.
+     */
+    GEL_CONSTEXPR TQuat( const TQuat<T>& q );
+
+    // EXPLICIT CONSTRUCTORS
+    /**
+     * Constructs a new quaternion from its components.
+     *
+     * @param x The first vector component.
+     * @param y The second vector component.
+     * @param z The third vector component.
+     * @param w The scalar component.
+     */
+    GEL_CONSTEXPR TQuat( const T& x, const T& y, const T& z, const T& w );
+
+    /**
+     * Constructs a new quaternion from a vector of its components.
+     *
+     * @param v The components.
+     */
+    GEL_CONSTEXPR explicit TQuat( const TVec4<T>& v );
+
+    // UNARY OPERATORS
+    /**
+     * Makes this a copy of the other quaternion.
+     *
+     * @param q The quaternion to copy.
+     */
+    GEL_CONSTEXPR TQuat<T>& operator=( const TQuat<T>& q );
+
+    /**
+     * Post-multiplies this quaternion by another.
+     *
+     * @param q The quaternion to multiply by.
+     */
+    GEL_CONSTEXPR TQuat<T>& operator*=( const TQuat<T>& q );
+};
+
+// BINARY OPERATOR DECLARATIONS
+/**
+ * Multiplies two quaternions. The result applies q then p.
+ *
+ * @param p The first quaternion.
+ * @param q The second quaternion.
+ * @return The Hamilton product p * q.
+ */
+template <typename T>
+GEL_CONSTEXPR TQuat<T> operator*( const TQuat<T>& p, const TQuat<T>& q );
+
+/**
+ * Rotates a vector by a unit quaternion.
+ *
+ * @param q The quaternion.
+ * @param v The vector.
+ * @return The rotated vector.
+ */
+template <typename T>
+GEL_CONSTEXPR TVec3<T> operator*( const TQuat<T>& q, const TVec3<T>& v );
+
+// FUNCTION DECLARATIONS
+/**
+ * Creates a quaternion that rotates about an axis.
+ *
+ * @param angle The angle in radians.
+ * @param axis The unit axis.
+ * @return The quaternion.
+ */
+template <typename T>
+TQuat<T> angleAxis( const T& angle, const TVec3<T>& axis );
+
+/**
+ * Computes the dot product of two quaternions.
+ *
+ * @param p The first quaternion.
+ * @param q The second quaternion.
+ * @return The dot product.
+ */
+template <typename T>
+GEL_CONSTEXPR T dot( const TQuat<T>& p, const TQuat<T>& q );
+
+/**
+ * Gets the conjugate of a quaternion.
+ *
+ * @param q The quaternion.
+ * @return The conjugate, which is the inverse of a unit quaternion.
+ */
+template <typename T>
+GEL_CONSTEXPR TQuat<T> conjugate( const TQuat<T>& q );
+
+/**
+ * Gets the inverse of a quaternion.
+ *
+ * @param q The quaternion, which must be non-zero.
+ * @return The inverse.
+ */
+template <typename T>
+GEL_CONSTEXPR TQuat<T> inverse( const TQuat<T>& q );
+
+/**
+ * Normalizes a quaternion.
+ *
+ * @param q The quaternion, which must be non-zero.
+ * @return The unit quaternion.
+ */
+template <typename T>
+GEL_CONSTEXPR TQuat<T> normalize( const TQuat<T>& q );
+
+/**
+ * Linearly interpolates between two unit quaternions along the shortest
+ * path and normalizes the result.
+ *
+ * @param p The quaternion at t = 0.
+ * @param q The quaternion at t = 1.
+ * @param t The interpolation factor.
+ * @return The interpolated unit quaternion.
+ */
+template <typename T>
+GEL_CONSTEXPR
+TQuat<T> nlerp( const TQuat<T>& p, const TQuat<T>& q, const T& t );
+
+/**
+ * Spherically interpolates between two unit quaternions along the shortest
+ * path.
+ *
+ * @param p The quaternion at t = 0.
+ * @param q The quaternion at t = 1.
+ * @param t The interpolation factor.
+ * @return The interpolated unit quaternion.
+ */
+template <typename T>
+TQuat<T> slerp( const TQuat<T>& p, const TQuat<T>& q, const T& t );
+
+/**
+ * Rotates an array of vectors in place, each by its own unit quaternion.
+ *
+ * @param q The quaternions.
+ * @param v The vectors.
+ * @param count The number of vectors.
+ */
+template <typename T>
+void rotate( const TQuat<T>* q, TVec3<T>* v, Size count );
+
+// IMPLEMENTATION
+
+// IMPLICIT CONSTRUCTORS
+template <typename T>
+GEL_CONSTEXPR inline
+TQuat<T>::TQuat() : TVec4<T>( 0, 0, 0, 1 )
+{
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TQuat<T>::TQuat( const TQuat<T>& q )
+    : TVec4<T>( static_cast<const TVec4<T>&>( q ) )
+{
+}
+
+// EXPLICIT CONSTRUCTORS
+template <typename T>
+GEL_CONSTEXPR inline
+TQuat<T>::TQuat( const T& x, const T& y, const T& z, const T& w )
+    : TVec4<T>( x, y, z, w )
+{
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TQuat<T>::TQuat( const TVec4<T>& v ) : TVec4<T>( v )
+{
+}
+
+// UNARY OPERATORS
+template <typename T>
+GEL_CONSTEXPR inline
+TQuat<T>& TQuat<T>::operator=( const TQuat<T>& q )
+{
+    TVec4<T>::operator=( q );
+    return *this;
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TQuat<T>& TQuat<T>::operator*=( const TQuat<T>& q )
+{
+    return *this = *this * q;
+}
+
+// BINARY OPERATORS
+template <typename T>
+GEL_CONSTEXPR inline
+TQuat<T> operator*( const TQuat<T>& p, const TQuat<T>& q )
+{
+    return TQuat<T>(
+        p.w * q.x + p.x * q.w + p.y * q.z - p.z * q.y,
+        p.w * q.y - p.x * q.z + p.y * q.w + p.z * q.x,
+        p.w * q.z + p.x * q.y - p.y * q.x + p.z * q.w,
+        p.w * q.w - p.x * q.x - p.y * q.y - p.z * q.z );
+}
+
+template <>
+GEL_CONSTEXPR inline
+TQuat<float> operator*( const TQuat<float>& p, const TQuat<float>& q )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return TQuat<float>(
+            p.w * q.x + p.x * q.w + p.y * q.z - p.z * q.y,
+            p.w * q.y - p.x * q.z + p.y * q.w + p.z * q.x,
+            p.w * q.z + p.x * q.y - p.y * q.x + p.z * q.w,
+            p.w * q.w - p.x * q.x - p.y * q.y - p.z * q.z );
+    }
+
+    // the product is a sum of the broadcast components of p, each scaling a
+    // signed permutation of q
+    using namespace simd;
+    Float4 r = mul( set1( p.w ), q.m );
+    r = add( r, mul( mul( set1( p.x ), shuffle<3, 2, 1, 0>( q.m ) ),
+                     set( 1, -1, 1, -1 ) ) );
+    r = add( r, mul( mul( set1( p.y ), shuffle<2, 3, 0, 1>( q.m ) ),
+                     set( 1, 1, -1, -1 ) ) );
+    r = add( r, mul( mul( set1( p.z ), shuffle<1, 0, 3, 2>( q.m ) ),
+                     set( -1, 1, 1, -1 ) ) );
+    return TQuat<float>( TVec4<float>( r ) );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> operator*( const TQuat<T>& q, const TVec3<T>& v )
+{
+    // v' = v + w * t + u x t where u is the vector part and t = 2 * u x v
+    T tx = 2 * ( q.y * v.z - q.z * v.y );
+    T ty = 2 * ( q.z * v.x - q.x * v.z );
+    T tz = 2 * ( q.x * v.y - q.y * v.x );
+    return TVec3<T>( v.x + q.w * tx + ( q.y * tz - q.z * ty ),
+                     v.y + q.w * ty + ( q.z * tx - q.x * tz ),
+                     v.z + q.w * tz + ( q.x * ty - q.y * tx ) );
+}
+
+// FUNCTIONS
+template <typename T>
+inline
+TQuat<T> angleAxis( const T& angle, const TVec3<T>& axis )
+{
+    T s = static_cast<T>( sin( angle * static_cast<T>( 0.5 ) ) );
+    T c = static_cast<T>( cos( angle * static_cast<T>( 0.5 ) ) );
+    return TQuat<T>( axis.x * s, axis.y * s, axis.z * s, c );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+T dot( const TQuat<T>& p, const TQuat<T>& q )
+{
+    TVec4<T> d = static_cast<const TVec4<T>&>( p ) *
+                 static_cast<const TVec4<T>&>( q );
+    return ( d.x + d.y ) + ( d.z + d.w );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TQuat<T> conjugate( const TQuat<T>& q )
+{
+    return TQuat<T>( static_cast<const TVec4<T>&>( q ) *
+                     TVec4<T>( -1, -1, -1, 1 ) );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TQuat<T> inverse( const TQuat<T>& q )
+{
+    T len2 = dot( q, q );
+    assert( len2 != 0 );
+    return TQuat<T>( static_cast<const TVec4<T>&>( conjugate( q ) ) / len2 );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TQuat<T> normalize( const TQuat<T>& q )
+{
+    T len = squareRoot( dot( q, q ) );
+    assert( len != 0 );
+    return TQuat<T>( static_cast<const TVec4<T>&>( q ) / len );
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TQuat<T> nlerp( const TQuat<T>& p, const TQuat<T>& q, const T& t )
+{
+    const TVec4<T>& a = p;
+    TVec4<T> b = q;
+    if ( dot( p, q ) < 0 )
+    {
+        b = -b;
+    }
+    return normalize( TQuat<T>( a + ( b - a ) * t ) );
+}
+
+template <typename T>
+inline
+TQuat<T> slerp( const TQuat<T>& p, const TQuat<T>& q, const T& t )
+{
+    const TVec4<T>& a = p;
+    TVec4<T> b = q;
+    T c = dot( p, q );
+    if ( c < 0 )
+    {
+        b = -b;
+        c = -c;
+    }
+
+    // sin( theta ) vanishes as the quaternions converge, where the linear
+    // interpolation is indistinguishable
+    if ( c > static_cast<T>( 0.9995 ) )
+    {
+        return normalize( TQuat<T>( a + ( b - a ) * t ) );
+    }
+
+    T theta = static_cast<T>( acos( c ) );
+    T invSin = static_cast<T>( 1 ) / static_cast<T>( sin( theta ) );
+    T sa = static_cast<T>( sin( ( 1 - t ) * theta ) ) * invSin;
+    T sb = static_cast<T>( sin( t * theta ) ) * invSin;
+    return TQuat<T>( a * sa + b * sb );
+}
+
+template <typename T>
+inline
+void rotate( const TQuat<T>* q, TVec3<T>* v, Size count )
+{
+    for ( Size i = 0; i < count; ++i )
+    {
+        v[i] = q[i] * v[i];
+    }
+}
+
+template <>
+inline
+void rotate( const TQuat<float>* q, TVec3<float>* v, Size count )
+{
+    using namespace simd;
+    const Float4 two = set1( 2.0f );
+
+    // transposes four quaternions at a time so that each register holds one
+    // component of four rotations
+    Size i = 0;
+    for ( ; i + 4 <= count; i += 4 )
+    {
+        Float4 qx = q[i].m;
+        Float4 qy = q[i + 1].m;
+        Float4 qz = q[i + 2].m;
+        Float4 qw = q[i + 3].m;
+        transpose( qx, qy, qz, qw );
+
+        Float4 vx = set( v[i].x, v[i + 1].x, v[i + 2].x, v[i + 3].x );
+        Float4 vy = set( v[i].y, v[i + 1].y, v[i + 2].y, v[i + 3].y );
+        Float4 vz = set( v[i].z, v[i + 1].z, v[i + 2].z, v[i + 3].z );
+
+        Float4 tx = mul( two, sub( mul( qy, vz ), mul( qz, vy ) ) );
+        Float4 ty = mul( two, sub( mul( qz, vx ), mul( qx, vz ) ) );
+        Float4 tz = mul( two, sub( mul( qx, vy ), mul( qy, vx ) ) );
+
+        alignas( 16 ) float rx[4];
+        alignas( 16 ) float ry[4];
+        alignas( 16 ) float rz[4];
+        store( rx, add( add( vx, mul( qw, tx ) ),
+                        sub( mul( qy, tz ), mul( qz, ty ) ) ) );
+        store( ry, add( add( vy, mul( qw, ty ) ),
+                        sub( mul( qz, tx ), mul( qx, tz ) ) ) );
+        store( rz, add( add( vz, mul( qw, tz ) ),
+                        sub( mul( qx, ty ), mul( qy, tx ) ) ) );
+
+        for ( Size j = 0; j < 4; ++j )
+        {
+            v[i + j] = TVec3<float>( rx[j], ry[j], rz[j] );
+        }
+    }
+
+    for ( ; i < count; ++i )
+    {
+        v[i] = q[i] * v[i];
+    }
+}
+
+/**
+ * Defines a default quaternion.
+ */
+typedef TQuat<float> Quat;
+
+/**
+ * Defines a double quaternion.
+ */
+typedef TQuat<double> DQuat;
+
+} // End nspc math
+
+} // End nspc gel
+
+#endif //GEL_QUAT_H
@@ -0,0 +1,457 @@
+// simd.h
+#ifndef GEL_SIMD_H
+#define GEL_SIMD_H
+
+#include <math.h>
+#include "gel/gellib.h"
+
+#if GEL_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace gel
+{
+
+namespace math
+{
+
+namespace simd
+{
+
+#if GEL_SSE
+/**
+ * Defines a register of four packed floats.
+ */
+typedef __m128 Float4;
+#else
+/**
+ * Defines four packed floats for targets without SIMD support.
+ */
+struct alignas( 16 ) Float4
+{
+    float v[4];
+};
+#endif
+
+/**
+ * Creates a register from four scalars.
+ *
+ * @param x The first component.
+ * @param y The second component.
+ * @param z The third component.
+ * @param w The fourth component.
+ * @return The register.
+ */
+Float4 set( float x, float y, float z, float w );
+
+/**
+ * Creates a register with every component set to the same scalar.
+ *
+ * @param s The scalar.
+ * @return The register.
+ */
+Float4 set1( float s );
+
+/**
+ * Creates a register of zeros.
+ *
+ * @return The register.
+ */
+Float4 zero();
+
+/**
+ * Loads a register from 16-byte aligned memory.
+ *
+ * @param p The aligned source.
+ * @return The register.
+ */
+Float4 load( const float* p );
+
+/**
+ * Loads a register from memory of any alignment.
+ *
+ * @param p The source.
+ * @return The register.
+ */
+Float4 loadu( const float* p );
+
+/**
+ * Stores a register to 16-byte aligned memory.
+ *
+ * @param p The aligned destination.
+ * @param a The register.
+ */
+void store( float* p, Float4 a );
+
+/**
+ * Stores a register to memory of any alignment.
+ *
+ * @param p The destination.
+ * @param a The register.
+ */
+void storeu( float* p, Float4 a );
+
+/**
+ * Adds two registers.
+ */
+Float4 add( Float4 a, Float4 b );
+
+/**
+ * Subtracts two registers.
+ */
+Float4 sub( Float4 a, Float4 b );
+
+/**
+ * Multiplies two registers.
+ */
+Float4 mul( Float4 a, Float4 b );
+
+/**
+ * Divides two registers.
+ */
+Float4 div( Float4 a, Float4 b );
+
+/**
+ * Negates a register.
+ */
+Float4 neg( Float4 a );
+
+/**
+ * Takes the square root of each component of a register.
+ */
+Float4 sqrt( Float4 a );
+
+/**
+ * Approximates the reciprocal square root of each component of a register.
+ *
+ * The relative error is at most 1.5 * 2^-12.
+ */
+Float4 rsqrt( Float4 a );
+
+/**
+ * Takes the minimum of each component of two registers.
+ */
+Float4 min( Float4 a, Float4 b );
+
+/**
+ * Takes the maximum of each component of two registers.
+ */
+Float4 max( Float4 a, Float4 b );
+
+/**
+ * Sums the components of a register.
+ *
+ * @param a The register.
+ * @return A register with every component set to the sum.
+ */
+Float4 hadd( Float4 a );
+
+/**
+ * Rearranges the components of a register.
+ *
+ * @param a The register.
+ * @return The register ( a[X], a[Y], a[Z], a[W] ).
+ * @tparam X The source index of the first component.
+ * @tparam Y The source index of the second component.
+ * @tparam Z The source index of the third component.
+ * @tparam W The source index of the fourth component.
+ */
+template <int X, int Y, int Z, int W>
+Float4 shuffle( Float4 a );
+
+/**
+ * Transposes the 4x4 matrix formed by four registers in place.
+ *
+ * @param a The first row, which becomes the first column.
+ * @param b The second row, which becomes the second column.
+ * @param c The third row, which becomes the third column.
+ * @param d The fourth row, which becomes the fourth column.
+ */
+void transpose( Float4& a, Float4& b, Float4& c, Float4& d );
+
+/**
+ * Checks if every component of two registers is equal.
+ *
+ * @param a The first register.
+ * @param b The second register.
+ * @return If all four components are equal.
+ */
+bool equal( Float4 a, Float4 b );
+
+// IMPLEMENTATION
+#if GEL_SSE
+inline
+Float4 set( float x, float y, float z, float w )
+{
+    return _mm_setr_ps( x, y, z, w );
+}
+
+inline
+Float4 set1( float s )
+{
+    return _mm_set1_ps( s );
+}
+
+inline
+Float4 zero()
+{
+    return _mm_setzero_ps();
+}
+
+inline
+Float4 load( const float* p )
+{
+    return _mm_load_ps( p );
+}
+
+inline
+Float4 loadu( const float* p )
+{
+    return _mm_loadu_ps( p );
+}
+
+inline
+void store( float* p, Float4 a )
+{
+    _mm_store_ps( p, a );
+}
+
+inline
+void storeu( float* p, Float4 a )
+{
+    _mm_storeu_ps( p, a );
+}
+
+inline
+Float4 add( Float4 a, Float4 b )
+{
+    return _mm_add_ps( a, b );
+}
+
+inline
+Float4 sub( Float4 a, Float4 b )
+{
+    return _mm_sub_ps( a, b );
+}
+
+inline
+Float4 mul( Float4 a, Float4 b )
+{
+    return _mm_mul_ps( a, b );
+}
+
+inline
+Float4 div( Float4 a, Float4 b )
+{
+    return _mm_div_ps( a, b );
+}
+
+inline
+Float4 neg( Float4 a )
+{
+    return _mm_xor_ps( a, _mm_set1_ps( -0.0f ) );
+}
+
+inline
+Float4 sqrt( Float4 a )
+{
+    return _mm_sqrt_ps( a );
+}
+
+inline
+Float4 rsqrt( Float4 a )
+{
+    return _mm_rsqrt_ps( a );
+}
+
+inline
+Float4 min( Float4 a, Float4 b )
+{
+    return _mm_min_ps( a, b );
+}
+
+inline
+Float4 max( Float4 a, Float4 b )
+{
+    return _mm_max_ps( a, b );
+}
+
+inline
+Float4 hadd( Float4 a )
+{
+    Float4 s = _mm_add_ps( a, _mm_shuffle_ps( a, a, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+    return _mm_add_ps( s, _mm_shuffle_ps( s, s, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+}
+
+template <int X, int Y, int Z, int W>
+inline
+Float4 shuffle( Float4 a )
+{
+    return _mm_shuffle_ps( a, a, _MM_SHUFFLE( W, Z, Y, X ) );
+}
+
+inline
+void transpose( Float4& a, Float4& b, Float4& c, Float4& d )
+{
+    _MM_TRANSPOSE4_PS( a, b, c, d );
+}
+
+inline
+bool equal( Float4 a, Float4 b )
+{
+    return _mm_movemask_ps( _mm_cmpeq_ps( a, b ) ) == 0xF;
+}
+#else
+inline
+Float4 set( float x, float y, float z, float w )
+{
+    Float4 r = { { x, y, z, w } };
+    return r;
+}
+
+inline
+Float4 set1( float s )
+{
+    return set( s, s, s, s );
+}
+
+inline
+Float4 zero()
+{
+    return set1( 0.0f );
+}
+
+inline
+Float4 load( const float* p )
+{
+    return set( p[0], p[1], p[2], p[3] );
+}
+
+inline
+Float4 loadu( const float* p )
+{
+    return load( p );
+}
+
+inline
+void store( float* p, Float4 a )
+{
+    p[0] = a.v[0];
+    p[1] = a.v[1];
+    p[2] = a.v[2];
+    p[3] = a.v[3];
+}
+
+inline
+void storeu( float* p, Float4 a )
+{
+    store( p, a );
+}
+
+inline
+Float4 add( Float4 a, Float4 b )
+{
+    return set( a.v[0] + b.v[0], a.v[1] + b.v[1],
+                a.v[2] + b.v[2], a.v[3] + b.v[3] );
+}
+
+inline
+Float4 sub( Float4 a, Float4 b )
+{
+    return set( a.v[0] - b.v[0], a.v[1] - b.v[1],
+                a.v[2] - b.v[2], a.v[3] - b.v[3] );
+}
+
+inline
+Float4 mul( Float4 a, Float4 b )
+{
+    return set( a.v[0] * b.v[0], a.v[1] * b.v[1],
+                a.v[2] * b.v[2], a.v[3] * b.v[3] );
+}
+
+inline
+Float4 div( Float4 a, Float4 b )
+{
+    return set( a.v[0] / b.v[0], a.v[1] / b.v[1],
+                a.v[2] / b.v[2], a.v[3] / b.v[3] );
+}
+
+inline
+Float4 neg( Float4 a )
+{
+    return set( -a.v[0], -a.v[1], -a.v[2], -a.v[3] );
+}
+
+inline
+Float4 sqrt( Float4 a )
+{
+    return set( ::sqrtf( a.v[0] ), ::sqrtf( a.v[1] ),
+                ::sqrtf( a.v[2] ), ::sqrtf( a.v[3] ) );
+}
+
+inline
+Float4 rsqrt( Float4 a )
+{
+    return set( 1.0f / ::sqrtf( a.v[0] ), 1.0f / ::sqrtf( a.v[1] ),
+                1.0f / ::sqrtf( a.v[2] ), 1.0f / ::sqrtf( a.v[3] ) );
+}
+
+inline
+Float4 min( Float4 a, Float4 b )
+{
+    return set( a.v[0] < b.v[0] ? a.v[0] : b.v[0],
+                a.v[1] < b.v[1] ? a.v[1] : b.v[1],
+                a.v[2] < b.v[2] ? a.v[2] : b.v[2],
+                a.v[3] < b.v[3] ? a.v[3] : b.v[3] );
+}
+
+inline
+Float4 max( Float4 a, Float4 b )
+{
+    return set( a.v[0] > b.v[0] ? a.v[0] : b.v[0],
+                a.v[1] > b.v[1] ? a.v[1] : b.v[1],
+                a.v[2] > b.v[2] ? a.v[2] : b.v[2],
+                a.v[3] > b.v[3] ? a.v[3] : b.v[3] );
+}
+
+inline
+Float4 hadd( Float4 a )
+{
+    return set1( ( a.v[0] + a.v[1] ) + ( a.v[2] + a.v[3] ) );
+}
+
+template <int X, int Y, int Z, int W>
+inline
+Float4 shuffle( Float4 a )
+{
+    return set( a.v[X], a.v[Y], a.v[Z], a.v[W] );
+}
+
+inline
+void transpose( Float4& a, Float4& b, Float4& c, Float4& d )
+{
+    Float4 r0 = set( a.v[0], b.v[0], c.v[0], d.v[0] );
+    Float4 r1 = set( a.v[1], b.v[1], c.v[1], d.v[1] );
+    Float4 r2 = set( a.v[2], b.v[2], c.v[2], d.v[2] );
+    Float4 r3 = set( a.v[3], b.v[3], c.v[3], d.v[3] );
+    a = r0;
+    b = r1;
+    c = r2;
+    d = r3;
+}
+
+inline
+bool equal( Float4 a, Float4 b )
+{
+    return a.v[0] == b.v[0] && a.v[1] == b.v[1] &&
+           a.v[2] == b.v[2] && a.v[3] == b.v[3];
+}
+#endif
+
+} // End nspc simd
+
+} // End nspc math
+
+} // End nspc gel
+
+#endif //GEL_SIMD_H
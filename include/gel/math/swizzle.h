@@ -29,4 +29,69 @@ enum VComp
     ALPHA
 };
 
+namespace gel
+{
+
+namespace math
+{
+
+/**
+ * Maps a vector component identifier to its index.
+ *
+ * @tparam C The component identifier.
+ */
+template <VComp C>
+struct SwizzleIndex
+{
+    static const int VALUE = C % 4;
+};
+
+/**
+ * Finds the source position of a destination index for a four component
+ * write mask.
+ *
+ * @tparam N The destination index.
+ * @tparam C1 The component written by the first source component.
+ * @tparam C2 The component written by the second source component.
+ * @tparam C3 The component written by the third source component.
+ * @tparam C4 The component written by the fourth source component.
+ */
+template <int N, VComp C1, VComp C2, VComp C3, VComp C4>
+struct SwizzleInverse
+{
+    static const int VALUE = SwizzleIndex<C1>::VALUE == N ? 0 :
+                             SwizzleIndex<C2>::VALUE == N ? 1 :
+                             SwizzleIndex<C3>::VALUE == N ? 2 : 3;
+};
+
+/**
+ * Checks that a write mask never writes the same component twice.
+ *
+ * @tparam C1 The first component.
+ * @tparam C2 The second component.
+ * @tparam C3 The third component, or the first when unused.
+ * @tparam C4 The fourth component, or the first when unused.
+ */
+template <VComp C1, VComp C2, VComp C3 = C1, VComp C4 = C1>
+struct SwizzleMask
+{
+    static const int I1 = SwizzleIndex<C1>::VALUE;
+
+    static const int I2 = SwizzleIndex<C2>::VALUE;
+
+    static const int I3 = SwizzleIndex<C3>::VALUE;
+
+    static const int I4 = SwizzleIndex<C4>::VALUE;
+
+    static const bool UNIQUE2 = I1 != I2;
+
+    static const bool UNIQUE3 = UNIQUE2 && I3 != I1 && I3 != I2;
+
+    static const bool UNIQUE4 = UNIQUE3 && I4 != I1 && I4 != I2 && I4 != I3;
+};
+
+} // End nspc math
+
+} // End nspc gel
+
 #endif
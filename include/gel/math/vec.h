@@ -4,6 +4,8 @@
 #include "vec2.h"
 #include "vec3.h"
 #include "vec4.h"
+#include "vec3_stream.h"
+#include "vec4_stream.h"
 
 namespace gel
 {
@@ -41,6 +43,25 @@ typedef TVec4<float> Vec4;
  */
 typedef TVec4<double> DVec4;
 
+/**
+ * Defines a SIMD 4D vector.
+ *
+ * This is the same type as Vec4: every float 4D vector uses the SIMD
+ * specialization, so all of them are 16-byte aligned and their operators
+ * are performed on a SIMD register.
+ */
+typedef TVec4<float> SVec4;
+
+/**
+ * Defines a default 3D vector stream.
+ */
+typedef TVec3Stream<float> Vec3Stream;
+
+/**
+ * Defines a default 4D vector stream.
+ */
+typedef TVec4Stream<float> Vec4Stream;
+
 } // End nspc math
 
 } // End nspc gel
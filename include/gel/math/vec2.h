@@ -3,6 +3,7 @@
 #define GEL_VEC2_H
 #include <assert.h>
 #include "gel/gellib.h"
+#include "gel/math/swizzle.h"
 
 namespace gel
 {
@@ -10,20 +11,11 @@ namespace gel
 namespace math
 {
 
-template <typename T>
-class TRef2;
-
-template <typename T>
-class TRef2;
-
-template <typename T>
-class TRef4;
-
 template <typename T>
 class TVec2;
 
 template <typename T>
-class TVec2;
+class TVec3;
 
 template <typename T>
 class TVec4;
@@ -47,19 +39,14 @@ class TVec2
     /**
      * Constructs a new vector.
      */
-    TVec2();
+    GEL_CONSTEXPR TVec2();
 
     /**
      * Constructs this vector as a copy of the other.
      *
      * @param v The vector to copy.
      */
-    TVec2( const TVec2<T>& v );
-
-    /**
-     * Destructs the vector.
-     */
-    ~TVec2();
+    GEL_CONSTEXPR TVec2( const TVec2<T>& v );
 
     // EXPLICIT CONSTRUCTORS
     /**
@@ -69,7 +56,7 @@ class TVec2
      * @tparam U The component value type.
      */
     template <typename U>
-    explicit TVec2( const U& s );
+    GEL_CONSTEXPR explicit TVec2( const U& s );
 
     /**
      * Constructs a new vector.
@@ -80,7 +67,7 @@ class TVec2
      * @tparam V The second component value type.
      */
     template <typename U, typename V>
-    explicit TVec2( const U& s1, const V& s2 );
+    GEL_CONSTEXPR explicit TVec2( const U& s1, const V& s2 );
 
     /**
      * Constructs a copy of the vector.
@@ -89,15 +76,7 @@ class TVec2
      * @tparam U The component type.
      */
     template <typename U>
-    explicit TVec2( const TVec2<U>& v );
-
-    // SWIZZLE CONSTRUCTORS
-    /**
-     * Construct from a reference vector.
-     *
-     * @param r The reference vector.
-     */
-    TVec2( const TRef2<T>& r );
+    GEL_CONSTEXPR explicit TVec2( const TVec2<U>& v );
 
     // UNARY OPERATORS
     /**
@@ -105,7 +84,7 @@ class TVec2
      *
      * @param v The vector to copy.
      */
-    TVec2<T>& operator=( const TVec2<T>& v );
+    GEL_CONSTEXPR TVec2<T>& operator=( const TVec2<T>& v );
 
     /**
      * Makes this a copy of the other vector.
@@ -114,7 +93,7 @@ class TVec2
      * @tparam U The component value type..
      */
     template <typename U>
-    TVec2<T>& operator=( const TVec2<U>& v );
+    GEL_CONSTEXPR TVec2<T>& operator=( const TVec2<U>& v );
 
     /**
      * Adds a scalar value to the components.
@@ -123,7 +102,7 @@ class TVec2
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec2<T>& operator+=( const U& s );
+    GEL_CONSTEXPR TVec2<T>& operator+=( const U& s );
 
     /**
      * Adds another vector to this.
@@ -132,7 +111,7 @@ class TVec2
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec2<T>& operator+=( const TVec2<U>& v );
+    GEL_CONSTEXPR TVec2<T>& operator+=( const TVec2<U>& v );
 
     /**
      * Subtracts a scale from the components.
@@ -141,7 +120,7 @@ class TVec2
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec2<T>& operator-=( const U& s );
+    GEL_CONSTEXPR TVec2<T>& operator-=( const U& s );
 
     /**
      * Subtracts another vector from this.
@@ -150,7 +129,7 @@ class TVec2
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec2<T>& operator-=( const TVec2<U>& v );
+    GEL_CONSTEXPR TVec2<T>& operator-=( const TVec2<U>& v );
 
     /**
      * Multiplies the this by a scalar.
@@ -159,7 +138,7 @@ class TVec2
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec2<T>& operator*=( const U& s );
+    GEL_CONSTEXPR TVec2<T>& operator*=( const U& s );
 
     /**
      * Multiplies this vector by another.
@@ -168,7 +147,7 @@ class TVec2
      * @tparam The component value type.
      */
     template <typename U>
-    TVec2<T>& operator*=( const TVec2<U>& v );
+    GEL_CONSTEXPR TVec2<T>& operator*=( const TVec2<U>& v );
 
     /**
      * Divides this vector by a scalar.
@@ -177,7 +156,7 @@ class TVec2
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec2<T>& operator/=( const U& s );
+    GEL_CONSTEXPR TVec2<T>& operator/=( const U& s );
 
     /**
      * Divides this vector by another.
@@ -186,42 +165,42 @@ class TVec2
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec2<T>& operator/=( const TVec2<U>& v );
+    GEL_CONSTEXPR TVec2<T>& operator/=( const TVec2<U>& v );
 
     /**
      * Adds one to the vector's component values.
      *
      * @return The resultant vector.
      */
-    TVec2<T>& operator++( );
+    GEL_CONSTEXPR TVec2<T>& operator++( );
 
     /**
      * Subtracts one from the vector's component values.
      *
      * @return The resultant vector.
      */
-    TVec2<T>& operator--( );
+    GEL_CONSTEXPR TVec2<T>& operator--( );
 
     /**
      * Adds one to the vector's component values.
      *
      * @return The resultant vector.
      */
-    TVec2<T>& operator++( int );
+    GEL_CONSTEXPR TVec2<T>& operator++( int );
 
     /**
      * Subtracts one from the vector's component values.
      *
      * @return The resultant vector.
      */
-    TVec2<T>& operator--( int );
+    GEL_CONSTEXPR TVec2<T>& operator--( int );
 
     /**
      * Multiplies the vector by negative one.
      *
      * @return The negative vector.
      */
-    TVec2<T> operator-() const;
+    GEL_CONSTEXPR TVec2<T> operator-() const;
 
     // UNARY BIT OPERATORS
     /**
@@ -231,7 +210,7 @@ class TVec2
      * @tparam The scalar value type.
      */
     template <typename U>
-    TVec2<T>& operator%=( const U& s );
+    GEL_CONSTEXPR TVec2<T>& operator%=( const U& s );
 
     /**
      * Performs a component-wise modulus.
@@ -240,7 +219,7 @@ class TVec2
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec2<T>& operator%=( const TVec2<U>& v );
+    GEL_CONSTEXPR TVec2<T>& operator%=( const TVec2<U>& v );
 
     /**
      * Performs the bitwise-and operation with each of the components.
@@ -249,7 +228,7 @@ class TVec2
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec2<T>& operator&=( const U& s );
+    GEL_CONSTEXPR TVec2<T>& operator&=( const U& s );
 
     /**
      * Performs a component-wise bitwise-and operation.
@@ -258,7 +237,7 @@ class TVec2
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec2<T>& operator&=( const TVec2<U>& v );
+    GEL_CONSTEXPR TVec2<T>& operator&=( const TVec2<U>& v );
 
     /**
      * Performs the bitwise-or operation with each of the components.
@@ -267,7 +246,7 @@ class TVec2
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec2<T>& operator|=( const U& s );
+    GEL_CONSTEXPR TVec2<T>& operator|=( const U& s );
 
     /**
      * Performs a component-wise bitwise-or operation.
@@ -276,7 +255,7 @@ class TVec2
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec2<T>& operator|=( const TVec2<U>& v );
+    GEL_CONSTEXPR TVec2<T>& operator|=( const TVec2<U>& v );
 
     /**
      * Performs the bitwise-xor operation with each of the components.
@@ -285,7 +264,7 @@ class TVec2
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec2<T>& operator^=( const U& s );
+    GEL_CONSTEXPR TVec2<T>& operator^=( const U& s );
 
     /**
      * Performs a component-wise bitwise-xor operation.
@@ -294,7 +273,7 @@ class TVec2
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec2<T>& operator^=( const TVec2<U>& v );
+    GEL_CONSTEXPR TVec2<T>& operator^=( const TVec2<U>& v );
 
     /**
      * Performs the shift-left operation with each of the components.
@@ -303,7 +282,7 @@ class TVec2
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec2<T>& operator<<=( const U& s );
+    GEL_CONSTEXPR TVec2<T>& operator<<=( const U& s );
 
     /**
      * Performs a component-wise bitwise-shift left operation.
@@ -312,7 +291,7 @@ class TVec2
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec2<T>& operator<<=( const TVec2<U>& v );
+    GEL_CONSTEXPR TVec2<T>& operator<<=( const TVec2<U>& v );
 
     /**
      * Performs the shift-right operation with each of the components.
@@ -321,7 +300,7 @@ class TVec2
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec2<T>& operator>>=( const U& s );
+    GEL_CONSTEXPR TVec2<T>& operator>>=( const U& s );
 
     /**
      * Performs a component-wise bitwise-shift right operation.
@@ -330,57 +309,75 @@ class TVec2
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec2<T>& operator>>=( const TVec2<U>& v );
+    GEL_CONSTEXPR TVec2<T>& operator>>=( const TVec2<U>& v );
 
     /**
      * Gets the bitwise inverse vector.
      *
      * @return The bitwise inverse vector.
      */
-    TVec2<T> operator~() const;
+    GEL_CONSTEXPR TVec2<T> operator~() const;
 
     // ACCESSOR OPERATORS
     /**
      * Sets the vector component value at the given index.
      */
-    ValueType& operator[]( Size index );
+    GEL_CONSTEXPR ValueType& operator[]( Size index );
 
     /**
      * Gets the vector component value at the given index.
      */
-    const ValueType& operator[]( Size index ) const;
-};
+    GEL_CONSTEXPR const ValueType& operator[]( Size index ) const;
 
-template <typename T>
-class TRef2
-{
-  public:
-    T& x;
-    T& y;
-    // CONSTRUCTORS
+    // SWIZZLE FUNCTIONS
     /**
-     * Constructs reference vector for the reference components.
-     * @param s1 The first reference component.
-     * @param s2 The second reference component.
+     * Gets a 2D vector made from the given components of this vector.
+     *
+     * @return The swizzled vector.
+     * @tparam C1 The component to use as the first component.
+     * @tparam C2 The component to use as the second component.
      */
-    TRef2( T& s1, T& s2 );
+    template <VComp C1, VComp C2>
+    GEL_CONSTEXPR TVec2<T> swizzle() const;
 
     /**
-     * Constructs a new reference vector for an existing reference vector.
-     * @param r The reference vector.
+     * Gets a 3D vector made from the given components of this vector.
+     *
+     * @return The swizzled vector.
+     * @tparam C1 The component to use as the first component.
+     * @tparam C2 The component to use as the second component.
+     * @tparam C3 The component to use as the third component.
      */
-    TRef2( TRef2<T>& r );
+    template <VComp C1, VComp C2, VComp C3>
+    GEL_CONSTEXPR TVec3<T> swizzle() const;
 
     /**
-     * Constructs a new reference vector for the given vector.
-     * @param v The vector to reference.
+     * Gets a 4D vector made from the given components of this vector.
+     *
+     * @return The swizzled vector.
+     * @tparam C1 The component to use as the first component.
+     * @tparam C2 The component to use as the second component.
+     * @tparam C3 The component to use as the third component.
+     * @tparam C4 The component to use as the fourth component.
+     */
+    template <VComp C1, VComp C2, VComp C3, VComp C4>
+    GEL_CONSTEXPR TVec4<T> swizzle() const;
+
+    /**
+     * Writes the components of a 2D vector to the given components of this
+     * vector, leaving the others unchanged.
+     *
+     * @param v The vector to write.
+     * @tparam C1 The component written by the first component of v.
+     * @tparam C2 The component written by the second component of v.
      */
-    TRef2( TVec2<T>& v );
+    template <VComp C1, VComp C2>
+    GEL_CONSTEXPR void assign( const TVec2<T>& v );
 
     /**
-     * Destructs the reference vector.
+     * Gets the vector ( y, x ).
      */
-    ~TRef2();
+    GEL_CONSTEXPR TVec2<T> yx() const;
 };
 
 // ARITHMETIC BINARY OPERATOR DECLARATIONS
@@ -392,7 +389,7 @@ class TRef2
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator+( const TVec2<T>& v, const T& s );
+GEL_CONSTEXPR TVec2<T> operator+( const TVec2<T>& v, const T& s );
 
 /**
  * Adds the components of two vectors.
@@ -402,7 +399,7 @@ TVec2<T> operator+( const TVec2<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator+( const TVec2<T>& u, const TVec2<T>& v );
+GEL_CONSTEXPR TVec2<T> operator+( const TVec2<T>& u, const TVec2<T>& v );
 
 /**
  * Subtracts a scalar value from the components of a vector.
@@ -412,7 +409,7 @@ TVec2<T> operator+( const TVec2<T>& u, const TVec2<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator-( const TVec2<T>& v, const T& s );
+GEL_CONSTEXPR TVec2<T> operator-( const TVec2<T>& v, const T& s );
 
 /**
  * Subtracts the components of two vectors.
@@ -422,7 +419,7 @@ TVec2<T> operator-( const TVec2<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator-( const TVec2<T>& u, const TVec2<T>& v );
+GEL_CONSTEXPR TVec2<T> operator-( const TVec2<T>& u, const TVec2<T>& v );
 
 /**
  * Multiplies the components of a vector by a scalar value.
@@ -432,7 +429,7 @@ TVec2<T> operator-( const TVec2<T>& u, const TVec2<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator*( const TVec2<T>& v, const T& s );
+GEL_CONSTEXPR TVec2<T> operator*( const TVec2<T>& v, const T& s );
 
 /**
  * Multiplies the components of a vector by a scalar value.
@@ -442,7 +439,7 @@ TVec2<T> operator*( const TVec2<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator*( const T& s, const TVec2<T>& v );
+GEL_CONSTEXPR TVec2<T> operator*( const T& s, const TVec2<T>& v );
 
 /**
  * Multiplies the components of two vectors.
@@ -452,7 +449,7 @@ TVec2<T> operator*( const T& s, const TVec2<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator*( const TVec2<T>& u, const TVec2<T>& v );
+GEL_CONSTEXPR TVec2<T> operator*( const TVec2<T>& u, const TVec2<T>& v );
 
 /**
  * Multiplies the components of a vector by a scalar value.
@@ -462,7 +459,7 @@ TVec2<T> operator*( const TVec2<T>& u, const TVec2<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator/( const TVec2<T>& v, const T& s );
+GEL_CONSTEXPR TVec2<T> operator/( const TVec2<T>& v, const T& s );
 
 /**
  * Multiplies the components of a vector by a scalar value.
@@ -472,7 +469,7 @@ TVec2<T> operator/( const TVec2<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator/( const T& s, const TVec2<T>& v );
+GEL_CONSTEXPR TVec2<T> operator/( const T& s, const TVec2<T>& v );
 
 /**
  * Divides the components of two vectors.
@@ -482,7 +479,7 @@ TVec2<T> operator/( const T& s, const TVec2<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator/( const TVec2<T>& u, const TVec2<T>& v );
+GEL_CONSTEXPR TVec2<T> operator/( const TVec2<T>& u, const TVec2<T>& v );
 
 /**
  * Performs modulus on a vector and a scalar.
@@ -492,7 +489,7 @@ TVec2<T> operator/( const TVec2<T>& u, const TVec2<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator%( const TVec2<T>& v, const T& s );
+GEL_CONSTEXPR TVec2<T> operator%( const TVec2<T>& v, const T& s );
 
 /**
  * Performs modulus on a vector and a scalar.
@@ -502,7 +499,7 @@ TVec2<T> operator%( const TVec2<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator%( const T& s, const TVec2<T>& v );
+GEL_CONSTEXPR TVec2<T> operator%( const T& s, const TVec2<T>& v );
 
 /**
  * Performs modulus on the components of two vectors.
@@ -512,7 +509,7 @@ TVec2<T> operator%( const T& s, const TVec2<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator%( const TVec2<T>& u, const TVec2<T>& v );
+GEL_CONSTEXPR TVec2<T> operator%( const TVec2<T>& u, const TVec2<T>& v );
 
 // BINARY BITWISE OPERATOR DECLARATIONS
 /**
@@ -523,7 +520,7 @@ TVec2<T> operator%( const TVec2<T>& u, const TVec2<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator&( const TVec2<T>& v, const T& s );
+GEL_CONSTEXPR TVec2<T> operator&( const TVec2<T>& v, const T& s );
 
 /**
  * Performs bitwise AND on the components from the two vectors.
@@ -533,7 +530,7 @@ TVec2<T> operator&( const TVec2<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator&( const TVec2<T>& u, const TVec2<T>& v );
+GEL_CONSTEXPR TVec2<T> operator&( const TVec2<T>& u, const TVec2<T>& v );
 
 /**
  * Performs bitwise OR on the components with the scalar.
@@ -543,7 +540,7 @@ TVec2<T> operator&( const TVec2<T>& u, const TVec2<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator|( const TVec2<T>& v, const T& s );
+GEL_CONSTEXPR TVec2<T> operator|( const TVec2<T>& v, const T& s );
 
 /**
  * Performs bitwise OR on the components from the two vectors.
@@ -553,7 +550,7 @@ TVec2<T> operator|( const TVec2<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator|( const TVec2<T>& u, const TVec2<T>& v );
+GEL_CONSTEXPR TVec2<T> operator|( const TVec2<T>& u, const TVec2<T>& v );
 
 
 /**
@@ -564,7 +561,7 @@ TVec2<T> operator|( const TVec2<T>& u, const TVec2<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator^( const TVec2<T>& v, const T& s );
+GEL_CONSTEXPR TVec2<T> operator^( const TVec2<T>& v, const T& s );
 
 /**
  * Performs bitwise XOR on the components from the two vectors.
@@ -574,7 +571,7 @@ TVec2<T> operator^( const TVec2<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator^( const TVec2<T>& u, const TVec2<T>& v );
+GEL_CONSTEXPR TVec2<T> operator^( const TVec2<T>& u, const TVec2<T>& v );
 
 /**
  * Shifts the bits of the components left.
@@ -584,7 +581,7 @@ TVec2<T> operator^( const TVec2<T>& u, const TVec2<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator<<( const TVec2<T>& v, unsigned int shift );
+GEL_CONSTEXPR TVec2<T> operator<<( const TVec2<T>& v, unsigned int shift );
 
 /**
  * Shifts the bits of the components right.
@@ -594,7 +591,7 @@ TVec2<T> operator<<( const TVec2<T>& v, unsigned int shift );
  * @return The resultant vector.
  */
 template <typename T>
-TVec2<T> operator>>( const TVec2<T>& u, unsigned int shift );
+GEL_CONSTEXPR TVec2<T> operator>>( const TVec2<T>& u, unsigned int shift );
 
 // COMPARISON OPERATOR DECLARATIONS
 /**
@@ -605,7 +602,7 @@ TVec2<T> operator>>( const TVec2<T>& u, unsigned int shift );
  * @return If they are equal.
  */
 template <typename T>
-bool operator==( const TVec2<T>& u, const TVec2<T>& v );
+GEL_CONSTEXPR bool operator==( const TVec2<T>& u, const TVec2<T>& v );
 
 /**
  * Checks if the components of two vectors are not equal.
@@ -615,33 +612,27 @@ bool operator==( const TVec2<T>& u, const TVec2<T>& v );
  * @return If they are not equal.
  */
 template <typename T>
-bool operator!=( const TVec2<T>& u, const TVec2<T>& v );
+GEL_CONSTEXPR bool operator!=( const TVec2<T>& u, const TVec2<T>& v );
 
 // IMPLEMENTATION
 
 // IMPLICIT CONSTRUCTORS
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>::TVec2( ) : x( 0 ), y( 0 )
 {
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>::TVec2( const TVec2<T>& v ) : x( v.x ), y( v.y )
 {
 }
 
-template <typename T>
-inline
-TVec2<T>::~TVec2()
-{
-}
-
 // EXPLICIT CONSTRUCTORS
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>::TVec2( const U& s ) : x( static_cast<T>( s ) ),
                                 y( static_cast<T>( s ) )
 {
@@ -649,7 +640,7 @@ TVec2<T>::TVec2( const U& s ) : x( static_cast<T>( s ) ),
 
 template <typename T>
 template <typename U, typename V>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>::TVec2( const U& s1, const V& s2 )
     : x( static_cast<T>( s1 ) ), y( static_cast<T>( s2 ) )
 {
@@ -657,22 +648,15 @@ TVec2<T>::TVec2( const U& s1, const V& s2 )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>::TVec2( const TVec2<U>& v )
     : x( static_cast<T>( v.x ) ), y( static_cast<T>( v.y ) )
 {
 }
 
-// SWIZZLE CONSTRUCTORS
-template <typename T>
-inline
-TVec2<T>::TVec2( const TRef2<T>& r ) : x( r.x ), y( r.y )
-{
-}
-
 // UNARY OPERATORS
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator=( const TVec2<T>& v )
 {
     x = v.x;
@@ -682,7 +666,7 @@ TVec2<T>& TVec2<T>::operator=( const TVec2<T>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator=( const TVec2<U>& v )
 {
     x = static_cast<T>( v.x );
@@ -692,7 +676,7 @@ TVec2<T>& TVec2<T>::operator=( const TVec2<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator+=( const U& s )
 {
     x += static_cast<T>( s );
@@ -702,7 +686,7 @@ TVec2<T>& TVec2<T>::operator+=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator+=( const TVec2<U>& v )
 {
     x += static_cast<T>( v.x );
@@ -712,7 +696,7 @@ TVec2<T>& TVec2<T>::operator+=( const TVec2<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator-=( const U& s )
 {
     x -= static_cast<T>( s );
@@ -722,7 +706,7 @@ TVec2<T>& TVec2<T>::operator-=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator-=( const TVec2<U>& v )
 {
     x -= static_cast<T>( v.x );
@@ -732,7 +716,7 @@ TVec2<T>& TVec2<T>::operator-=( const TVec2<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator*=( const U& s )
 {
     x *= static_cast<T>( s );
@@ -742,7 +726,7 @@ TVec2<T>& TVec2<T>::operator*=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator*=( const TVec2<U>& v )
 {
     x *= static_cast<T>( v.x );
@@ -752,7 +736,7 @@ TVec2<T>& TVec2<T>::operator*=( const TVec2<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator/=( const U& s )
 {
     assert( s != 0 );
@@ -763,7 +747,7 @@ TVec2<T>& TVec2<T>::operator/=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator/=( const TVec2<U>& v )
 {
     assert( v.x != 0 && v.y != 0 );
@@ -773,7 +757,7 @@ TVec2<T>& TVec2<T>::operator/=( const TVec2<U>& v )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator++()
 {
     ++x;
@@ -782,7 +766,7 @@ TVec2<T>& TVec2<T>::operator++()
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator--()
 {
     --x;
@@ -791,7 +775,7 @@ TVec2<T>& TVec2<T>::operator--()
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator++( int )
 {
     ++x;
@@ -800,7 +784,7 @@ TVec2<T>& TVec2<T>::operator++( int )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator--( int )
 {
     --x;
@@ -809,7 +793,7 @@ TVec2<T>& TVec2<T>::operator--( int )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> TVec2<T>::operator-() const
 {
     return TVec2<T>( -x, -y );
@@ -817,7 +801,7 @@ TVec2<T> TVec2<T>::operator-() const
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator%=( const U& s )
 {
     assert( s != 0 );
@@ -828,7 +812,7 @@ TVec2<T>& TVec2<T>::operator%=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator%=( const TVec2<U>& v )
 {
     assert( v.x != 0 && v.y != 0 );
@@ -840,7 +824,7 @@ TVec2<T>& TVec2<T>::operator%=( const TVec2<U>& v )
 // UNARY BITWISE OPERATORS
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator&=( const U& s )
 {
     x &= static_cast<T>( s );
@@ -850,7 +834,7 @@ TVec2<T>& TVec2<T>::operator&=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator&=( const TVec2<U>& v )
 {
     x &= static_cast<T>( v.x );
@@ -860,7 +844,7 @@ TVec2<T>& TVec2<T>::operator&=( const TVec2<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator|=( const U& s )
 {
     x |= static_cast<T>( s );
@@ -870,7 +854,7 @@ TVec2<T>& TVec2<T>::operator|=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator|=( const TVec2<U>& v )
 {
     x |= static_cast<T>( v.x );
@@ -880,7 +864,7 @@ TVec2<T>& TVec2<T>::operator|=( const TVec2<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator^=( const U& s )
 {
     x ^= static_cast<T>( s );
@@ -890,7 +874,7 @@ TVec2<T>& TVec2<T>::operator^=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator^=( const TVec2<U>& v )
 {
     x ^= static_cast<T>( v.x );
@@ -900,7 +884,7 @@ TVec2<T>& TVec2<T>::operator^=( const TVec2<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator<<=( const U& s )
 {
     x <<= static_cast<T>( s );
@@ -910,7 +894,7 @@ TVec2<T>& TVec2<T>::operator<<=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator<<=( const TVec2<U>& v )
 {
     x <<= static_cast<T>( v.x );
@@ -920,7 +904,7 @@ TVec2<T>& TVec2<T>::operator<<=( const TVec2<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator>>=( const U& s )
 {
     x >>= static_cast<T>( s );
@@ -930,7 +914,7 @@ TVec2<T>& TVec2<T>::operator>>=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec2<T>& TVec2<T>::operator>>=( const TVec2<U>& v )
 {
     x >>= static_cast<T>( v.x );
@@ -939,7 +923,7 @@ TVec2<T>& TVec2<T>::operator>>=( const TVec2<U>& v )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> TVec2<T>::operator~() const
 {
     return TVec2<T>( ~x, ~y );
@@ -947,73 +931,147 @@ TVec2<T> TVec2<T>::operator~() const
 
 // ACCESSOR OPERATORS
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 const T& TVec2<T>::operator[]( Size index ) const
 {
-    assert( index >= 0 && index < 2 );
+    assert( index < 2 );
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return index == 0 ? x : y;
+    }
+
     return ( &x )[index];
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 T& TVec2<T>::operator[]( Size index )
 {
-    assert( index >= 0 && index < 2 );
+    assert( index < 2 );
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return index == 0 ? x : y;
+    }
+
     return ( &x )[index];
 }
 
+// SWIZZLE FUNCTIONS
+template <typename T>
+template <VComp C1, VComp C2>
+GEL_CONSTEXPR inline
+TVec2<T> TVec2<T>::swizzle() const
+{
+    static_assert( SwizzleIndex<C1>::VALUE < 2 &&
+                   SwizzleIndex<C2>::VALUE < 2,
+                   "component out of range" );
+    return TVec2<T>( ( *this )[SwizzleIndex<C1>::VALUE],
+                     ( *this )[SwizzleIndex<C2>::VALUE] );
+}
+
+template <typename T>
+template <VComp C1, VComp C2, VComp C3>
+GEL_CONSTEXPR inline
+TVec3<T> TVec2<T>::swizzle() const
+{
+    static_assert( SwizzleIndex<C1>::VALUE < 2 &&
+                   SwizzleIndex<C2>::VALUE < 2 &&
+                   SwizzleIndex<C3>::VALUE < 2,
+                   "component out of range" );
+    return TVec3<T>( ( *this )[SwizzleIndex<C1>::VALUE],
+                     ( *this )[SwizzleIndex<C2>::VALUE],
+                     ( *this )[SwizzleIndex<C3>::VALUE] );
+}
+
+template <typename T>
+template <VComp C1, VComp C2, VComp C3, VComp C4>
+GEL_CONSTEXPR inline
+TVec4<T> TVec2<T>::swizzle() const
+{
+    static_assert( SwizzleIndex<C1>::VALUE < 2 &&
+                   SwizzleIndex<C2>::VALUE < 2 &&
+                   SwizzleIndex<C3>::VALUE < 2 &&
+                   SwizzleIndex<C4>::VALUE < 2,
+                   "component out of range" );
+    return TVec4<T>( ( *this )[SwizzleIndex<C1>::VALUE],
+                     ( *this )[SwizzleIndex<C2>::VALUE],
+                     ( *this )[SwizzleIndex<C3>::VALUE],
+                     ( *this )[SwizzleIndex<C4>::VALUE] );
+}
+
+template <typename T>
+template <VComp C1, VComp C2>
+GEL_CONSTEXPR inline
+void TVec2<T>::assign( const TVec2<T>& v )
+{
+    static_assert( SwizzleIndex<C1>::VALUE < 2 &&
+                   SwizzleIndex<C2>::VALUE < 2,
+                   "component out of range" );
+    static_assert( SwizzleMask<C1, C2>::UNIQUE2,
+                   "component written twice" );
+    ( *this )[SwizzleIndex<C1>::VALUE] = v.x;
+    ( *this )[SwizzleIndex<C2>::VALUE] = v.y;
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec2<T> TVec2<T>::yx() const
+{
+    return swizzle<Y, X>();
+}
+
 // BINARY ARITHMETIC OPERATORS
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator+( const TVec2<T>& v, const T& s )
 {
     return TVec2<T>( v.x + s, v.y + s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator+( const TVec2<T>& u, const TVec2<T>& v )
 {
     return TVec2<T>( u.x + v.x, u.y + v.y );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator-( const TVec2<T>& v, const T& s )
 {
     return TVec2<T>( v.x - s, v.y - s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator-( const TVec2<T>& u, const TVec2<T>& v )
 {
     return TVec2<T>( u.x - v.x, u.y - v.y );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator*( const TVec2<T>& v, const T& s )
 {
     return TVec2<T>( v.x * s, v.y * s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator*( const T& s, const TVec2<T>& v )
 {
     return TVec2<T>( s * v.x, s * v.y );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator*( const TVec2<T>& u, const TVec2<T>& v )
 {
     return TVec2<T>( u.x * v.x, u.y * v.y );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator/( const TVec2<T>& v, const T& s )
 {
     assert( s != T( 0 ) );
@@ -1021,7 +1079,7 @@ TVec2<T> operator/( const TVec2<T>& v, const T& s )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator/( const T& s, const TVec2<T>& v )
 {
     assert( v.x != 0 && v.y != 0 );
@@ -1029,7 +1087,7 @@ TVec2<T> operator/( const T& s, const TVec2<T>& v )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator/( const TVec2<T>& u, const TVec2<T>& v )
 {
     assert ( v.x != 0 && v.y != 0  );
@@ -1037,7 +1095,7 @@ TVec2<T> operator/( const TVec2<T>& u, const TVec2<T>& v )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator%( const TVec2<T>& v, const T& s )
 {
     assert( s != 0 );
@@ -1045,7 +1103,7 @@ TVec2<T> operator%( const TVec2<T>& v, const T& s )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator%( const T& s, const TVec2<T>& v )
 {
     assert( v.x != 0 && v.y != 0  );
@@ -1053,7 +1111,7 @@ TVec2<T> operator%( const T& s, const TVec2<T>& v )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator%( const TVec2<T>& u, const TVec2<T>& v )
 {
     assert ( v.x != 0 && v.y != 0  );
@@ -1062,144 +1120,75 @@ TVec2<T> operator%( const TVec2<T>& u, const TVec2<T>& v )
 
 // BINARY BITWISE OPERATORS
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator&( const TVec2<T>& v, const T& s )
 {
     return TVec2<T>( v.x & s, v.y & s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator&( const TVec2<T>& u, const TVec2<T>& v )
 {
     return TVec2<T>( u.x & v.x, u.y & v.y );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator|( const TVec2<T>& v, const T& s )
 {
     return TVec2<T>( v.x | s, v.y | s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator|( const TVec2<T>& u, const TVec2<T>& v )
 {
     return TVec2<T>( u.x | v.x, u.y | v.y );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator^( const TVec2<T>& v, const T& s )
 {
     return TVec2<T>( v.x ^ s, v.y ^ s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator^( const TVec2<T>& u, const TVec2<T>& v )
 {
     return TVec2<T>( u.x ^ v.x, u.y ^ v.y );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator<<( const TVec2<T>& v, unsigned int shift )
 {
     return TVec2<T>( v.x << shift, v.y << shift );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec2<T> operator>>( const TVec2<T>& u, unsigned int shift )
 {
     return TVec2<T>( u.x >> shift, u.y >> shift );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 bool operator==( const TVec2<T>& u, const TVec2<T>& v )
 {
     return u.x == v.x && u.y == v.y;
 }
 
 template <typename T>
-inline
-bool operator==( const TVec2<T>& u, const TRef2<T>& v )
-{
-    return u.x == v.x || u.y == v.y;
-}
-
-template <typename T>
-inline
-bool operator==( const TRef2<T>& u, const TVec2<T>& v )
-{
-    return u.x == v.x || u.y == v.y;
-}
-
-template <typename T>
-inline
-bool operator==( const TRef2<T>& u, const TRef2<T>& v )
-{
-    return u.x == v.x || u.y == v.y;
-}
-
-template <typename T>
-inline
+GEL_CONSTEXPR inline
 bool operator!=( const TVec2<T>& u, const TVec2<T>& v )
 {
     return u.x != v.x || u.y != v.y;
 }
 
-template <typename T>
-inline
-bool operator!=( const TVec2<T>& u, const TRef2<T>& v )
-{
-    return u.x != v.x || u.y != v.y;
-}
-
-template <typename T>
-inline
-bool operator!=( const TRef2<T>& u, const TVec2<T>& v )
-{
-    return u.x != v.x || u.y != v.y;
-}
-
-template <typename T>
-inline
-bool operator!=( const TRef2<T>& u, const TRef2<T>& v )
-{
-    return u.x != v.x || u.y != v.y;
-}
-
-// 4D REFERENCE VECTOR
-
-// CONSTRUCTORS
-template <typename T>
-inline
-TRef2<T>::TRef2( T& s1, T& s2 ) : x( s1 ), y( s2 )
-{
-}
-
-template <typename T>
-inline
-TRef2<T>::TRef2( TRef2<T>& r ) : x( r.x ), y( r.y )
-{
-}
-
-template <typename T>
-inline
-TRef2<T>::TRef2( TVec2<T>& v ) : x( v.x ), y( v.y )
-{
-}
-
-template <typename T>
-inline
-TRef2<T>::~TRef2()
-{
-}
-
 } // End nspc math
 
 } // End nspc gel
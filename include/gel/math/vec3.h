@@ -3,6 +3,7 @@
 #define GEL_VEC3_H
 #include <assert.h>
 #include "gel/gellib.h"
+#include "gel/math/swizzle.h"
 
 namespace gel
 {
@@ -10,15 +11,6 @@ namespace gel
 namespace math
 {
 
-template <typename T>
-class TRef2;
-
-template <typename T>
-class TRef3;
-
-template <typename T>
-class TRef4;
-
 template <typename T>
 class TVec2;
 
@@ -47,19 +39,14 @@ class TVec3
     /**
      * Constructs a new vector.
      */
-    TVec3();
+    GEL_CONSTEXPR TVec3();
 
     /**
      * Constructs this vector as a copy of the other.
      *
      * @param v The vector to copy.
      */
-    TVec3( const TVec3<T>& v );
-
-    /**
-     * Destructs the vector.
-     */
-    ~TVec3();
+    GEL_CONSTEXPR TVec3( const TVec3<T>& v );
 
     // EXPLICIT CONSTRUCTORS
     /**
@@ -69,7 +56,7 @@ class TVec3
      * @tparam U The component value type.
      */
     template <typename U>
-    explicit TVec3( const U& s );
+    GEL_CONSTEXPR explicit TVec3( const U& s );
 
     /**
      * Constructs a new vector.
@@ -82,7 +69,7 @@ class TVec3
      * @tparam W The third component value type.
      */
     template <typename U, typename V, typename W>
-    explicit TVec3( const U& s1, const V& s2, const W& s3 );
+    GEL_CONSTEXPR explicit TVec3( const U& s1, const V& s2, const W& s3 );
 
     /**
      * Constructs a copy of the vector with the given last component value.
@@ -94,7 +81,7 @@ class TVec3
      * @tparam W The fourth component type.
      */
     template <typename U, typename V>
-    explicit TVec3( const TVec2<U>& v, const V& s );
+    GEL_CONSTEXPR explicit TVec3( const TVec2<U>& v, const V& s );
 
     /**
      * Constructs a copy of the vector with the given last component value.
@@ -105,7 +92,7 @@ class TVec3
      * @tparam V The vector type.
      */
     template <typename U, typename V>
-    explicit TVec3( const U& ss, const TVec2<V>& v );
+    GEL_CONSTEXPR explicit TVec3( const U& ss, const TVec2<V>& v );
 
     /**
      * Constructs a copy of the vector.
@@ -114,15 +101,7 @@ class TVec3
      * @tparam U The component type.
      */
     template <typename U>
-    explicit TVec3( const TVec3<U>& v );
-
-    // SWIZZLE CONSTRUCTORS
-    /**
-     * Construct from a reference vector.
-     *
-     * @param r The reference vector.
-     */
-    TVec3( const TRef3<T>& r );
+    GEL_CONSTEXPR explicit TVec3( const TVec3<U>& v );
 
     // UNARY OPERATORS
     /**
@@ -130,7 +109,7 @@ class TVec3
      *
      * @param v The vector to copy.
      */
-    TVec3<T>& operator=( const TVec3<T>& v );
+    GEL_CONSTEXPR TVec3<T>& operator=( const TVec3<T>& v );
 
     /**
      * Makes this a copy of the other vector.
@@ -139,7 +118,7 @@ class TVec3
      * @tparam U The component value type..
      */
     template <typename U>
-    TVec3<T>& operator=( const TVec3<U>& v );
+    GEL_CONSTEXPR TVec3<T>& operator=( const TVec3<U>& v );
 
     /**
      * Adds a scalar value to the components.
@@ -148,7 +127,7 @@ class TVec3
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec3<T>& operator+=( const U& s );
+    GEL_CONSTEXPR TVec3<T>& operator+=( const U& s );
 
     /**
      * Adds another vector to this.
@@ -157,7 +136,7 @@ class TVec3
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec3<T>& operator+=( const TVec3<U>& v );
+    GEL_CONSTEXPR TVec3<T>& operator+=( const TVec3<U>& v );
 
     /**
      * Subtracts a scale from the components.
@@ -166,7 +145,7 @@ class TVec3
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec3<T>& operator-=( const U& s );
+    GEL_CONSTEXPR TVec3<T>& operator-=( const U& s );
 
     /**
      * Subtracts another vector from this.
@@ -175,7 +154,7 @@ class TVec3
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec3<T>& operator-=( const TVec3<U>& v );
+    GEL_CONSTEXPR TVec3<T>& operator-=( const TVec3<U>& v );
 
     /**
      * Multiplies the this by a scalar.
@@ -184,7 +163,7 @@ class TVec3
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec3<T>& operator*=( const U& s );
+    GEL_CONSTEXPR TVec3<T>& operator*=( const U& s );
 
     /**
      * Multiplies this vector by another.
@@ -193,7 +172,7 @@ class TVec3
      * @tparam The component value type.
      */
     template <typename U>
-    TVec3<T>& operator*=( const TVec3<U>& v );
+    GEL_CONSTEXPR TVec3<T>& operator*=( const TVec3<U>& v );
 
     /**
      * Divides this vector by a scalar.
@@ -202,7 +181,7 @@ class TVec3
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec3<T>& operator/=( const U& s );
+    GEL_CONSTEXPR TVec3<T>& operator/=( const U& s );
 
     /**
      * Divides this vector by another.
@@ -211,42 +190,42 @@ class TVec3
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec3<T>& operator/=( const TVec3<U>& v );
+    GEL_CONSTEXPR TVec3<T>& operator/=( const TVec3<U>& v );
 
     /**
      * Adds one to the vector's component values.
      *
      * @return The resultant vector.
      */
-    TVec3<T>& operator++( );
+    GEL_CONSTEXPR TVec3<T>& operator++( );
 
     /**
      * Subtracts one from the vector's component values.
      *
      * @return The resultant vector.
      */
-    TVec3<T>& operator--( );
+    GEL_CONSTEXPR TVec3<T>& operator--( );
 
     /**
      * Adds one to the vector's component values.
      *
      * @return The resultant vector.
      */
-    TVec3<T>& operator++( int );
+    GEL_CONSTEXPR TVec3<T>& operator++( int );
 
     /**
      * Subtracts one from the vector's component values.
      *
      * @return The resultant vector.
      */
-    TVec3<T>& operator--( int );
+    GEL_CONSTEXPR TVec3<T>& operator--( int );
 
     /**
      * Multiplies the vector by negative one.
      *
      * @return The negative vector.
      */
-    TVec3<T> operator-() const;
+    GEL_CONSTEXPR TVec3<T> operator-() const;
 
     // UNARY BIT OPERATORS
     /**
@@ -256,7 +235,7 @@ class TVec3
      * @tparam The scalar value type.
      */
     template <typename U>
-    TVec3<T>& operator%=( const U& s );
+    GEL_CONSTEXPR TVec3<T>& operator%=( const U& s );
 
     /**
      * Performs a component-wise modulus.
@@ -265,7 +244,7 @@ class TVec3
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec3<T>& operator%=( const TVec3<U>& v );
+    GEL_CONSTEXPR TVec3<T>& operator%=( const TVec3<U>& v );
 
     /**
      * Performs the bitwise-and operation with each of the components.
@@ -274,7 +253,7 @@ class TVec3
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec3<T>& operator&=( const U& s );
+    GEL_CONSTEXPR TVec3<T>& operator&=( const U& s );
 
     /**
      * Performs a component-wise bitwise-and operation.
@@ -283,7 +262,7 @@ class TVec3
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec3<T>& operator&=( const TVec3<U>& v );
+    GEL_CONSTEXPR TVec3<T>& operator&=( const TVec3<U>& v );
 
     /**
      * Performs the bitwise-or operation with each of the components.
@@ -292,7 +271,7 @@ class TVec3
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec3<T>& operator|=( const U& s );
+    GEL_CONSTEXPR TVec3<T>& operator|=( const U& s );
 
     /**
      * Performs a component-wise bitwise-or operation.
@@ -301,7 +280,7 @@ class TVec3
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec3<T>& operator|=( const TVec3<U>& v );
+    GEL_CONSTEXPR TVec3<T>& operator|=( const TVec3<U>& v );
 
     /**
      * Performs the bitwise-xor operation with each of the components.
@@ -310,7 +289,7 @@ class TVec3
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec3<T>& operator^=( const U& s );
+    GEL_CONSTEXPR TVec3<T>& operator^=( const U& s );
 
     /**
      * Performs a component-wise bitwise-xor operation.
@@ -319,7 +298,7 @@ class TVec3
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec3<T>& operator^=( const TVec3<U>& v );
+    GEL_CONSTEXPR TVec3<T>& operator^=( const TVec3<U>& v );
 
     /**
      * Performs the shift-left operation with each of the components.
@@ -328,7 +307,7 @@ class TVec3
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec3<T>& operator<<=( const U& s );
+    GEL_CONSTEXPR TVec3<T>& operator<<=( const U& s );
 
     /**
      * Performs a component-wise bitwise-shift left operation.
@@ -337,7 +316,7 @@ class TVec3
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec3<T>& operator<<=( const TVec3<U>& v );
+    GEL_CONSTEXPR TVec3<T>& operator<<=( const TVec3<U>& v );
 
     /**
      * Performs the shift-right operation with each of the components.
@@ -346,7 +325,7 @@ class TVec3
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec3<T>& operator>>=( const U& s );
+    GEL_CONSTEXPR TVec3<T>& operator>>=( const U& s );
 
     /**
      * Performs a component-wise bitwise-shift right operation.
@@ -355,60 +334,127 @@ class TVec3
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec3<T>& operator>>=( const TVec3<U>& v );
+    GEL_CONSTEXPR TVec3<T>& operator>>=( const TVec3<U>& v );
 
     /**
      * Gets the bitwise inverse vector.
      *
      * @return The bitwise inverse vector.
      */
-    TVec3<T> operator~() const;
+    GEL_CONSTEXPR TVec3<T> operator~() const;
 
     // ACCESSOR OPERATORS
     /**
      * Sets the vector component value at the given index.
      */
-    ValueType& operator[]( Size index );
+    GEL_CONSTEXPR ValueType& operator[]( Size index );
 
     /**
      * Gets the vector component value at the given index.
      */
-    const ValueType& operator[]( Size index ) const;
-};
+    GEL_CONSTEXPR const ValueType& operator[]( Size index ) const;
 
-template <typename T>
-class TRef3
-{
-  public:
-    T& x;
-    T& y;
-    T& z;
+    // SWIZZLE FUNCTIONS
+    /**
+     * Gets a 2D vector made from the given components of this vector.
+     *
+     * @return The swizzled vector.
+     * @tparam C1 The component to use as the first component.
+     * @tparam C2 The component to use as the second component.
+     */
+    template <VComp C1, VComp C2>
+    GEL_CONSTEXPR TVec2<T> swizzle() const;
+
+    /**
+     * Gets a 3D vector made from the given components of this vector.
+     *
+     * @return The swizzled vector.
+     * @tparam C1 The component to use as the first component.
+     * @tparam C2 The component to use as the second component.
+     * @tparam C3 The component to use as the third component.
+     */
+    template <VComp C1, VComp C2, VComp C3>
+    GEL_CONSTEXPR TVec3<T> swizzle() const;
+
+    /**
+     * Gets a 4D vector made from the given components of this vector.
+     *
+     * @return The swizzled vector.
+     * @tparam C1 The component to use as the first component.
+     * @tparam C2 The component to use as the second component.
+     * @tparam C3 The component to use as the third component.
+     * @tparam C4 The component to use as the fourth component.
+     */
+    template <VComp C1, VComp C2, VComp C3, VComp C4>
+    GEL_CONSTEXPR TVec4<T> swizzle() const;
+
+    /**
+     * Writes the components of a 2D vector to the given components of this
+     * vector, leaving the others unchanged.
+     *
+     * @param v The vector to write.
+     * @tparam C1 The component written by the first component of v.
+     * @tparam C2 The component written by the second component of v.
+     */
+    template <VComp C1, VComp C2>
+    GEL_CONSTEXPR void assign( const TVec2<T>& v );
+
+    /**
+     * Writes the components of a 3D vector to the given components of this
+     * vector, leaving the others unchanged.
+     *
+     * @param v The vector to write.
+     * @tparam C1 The component written by the first component of v.
+     * @tparam C2 The component written by the second component of v.
+     * @tparam C3 The component written by the third component of v.
+     */
+    template <VComp C1, VComp C2, VComp C3>
+    GEL_CONSTEXPR void assign( const TVec3<T>& v );
+
+    /**
+     * Gets the vector ( x, y ).
+     */
+    GEL_CONSTEXPR TVec2<T> xy() const;
+
+    /**
+     * Gets the vector ( x, z ).
+     */
+    GEL_CONSTEXPR TVec2<T> xz() const;
+
+    /**
+     * Gets the vector ( y, z ).
+     */
+    GEL_CONSTEXPR TVec2<T> yz() const;
 
-    // CONSTRUCTORS
     /**
-     * Constructs reference vector for the reference components.
-     * @param s1 The first reference component.
-     * @param s2 The second reference component.
-     * @param s3 The third reference component.
+     * Gets the vector ( y, x ).
      */
-    TRef3( T& s1, T& s2, T& s3 );
+    GEL_CONSTEXPR TVec2<T> yx() const;
 
     /**
-     * Constructs a new reference vector for an existing reference vector.
-     * @param r The reference vector.
+     * Gets the vector ( x, z, y ).
      */
-    TRef3( TRef3<T>& r );
+    GEL_CONSTEXPR TVec3<T> xzy() const;
 
     /**
-     * Constructs a new reference vector for the given vector.
-     * @param v The vector to reference.
+     * Gets the vector ( y, x, z ).
      */
-    TRef3( TVec3<T>& v );
+    GEL_CONSTEXPR TVec3<T> yxz() const;
 
     /**
-     * Destructs the reference vector.
+     * Gets the vector ( y, z, x ).
      */
-    ~TRef3();
+    GEL_CONSTEXPR TVec3<T> yzx() const;
+
+    /**
+     * Gets the vector ( z, x, y ).
+     */
+    GEL_CONSTEXPR TVec3<T> zxy() const;
+
+    /**
+     * Gets the vector ( z, y, x ).
+     */
+    GEL_CONSTEXPR TVec3<T> zyx() const;
 };
 
 // ARITHMETIC BINARY OPERATOR DECLARATIONS
@@ -420,7 +466,7 @@ class TRef3
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator+( const TVec3<T>& v, const T& s );
+GEL_CONSTEXPR TVec3<T> operator+( const TVec3<T>& v, const T& s );
 
 /**
  * Adds the components of two vectors.
@@ -430,7 +476,7 @@ TVec3<T> operator+( const TVec3<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator+( const TVec3<T>& u, const TVec3<T>& v );
+GEL_CONSTEXPR TVec3<T> operator+( const TVec3<T>& u, const TVec3<T>& v );
 
 /**
  * Subtracts a scalar value from the components of a vector.
@@ -440,7 +486,7 @@ TVec3<T> operator+( const TVec3<T>& u, const TVec3<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator-( const TVec3<T>& v, const T& s );
+GEL_CONSTEXPR TVec3<T> operator-( const TVec3<T>& v, const T& s );
 
 /**
  * Subtracts the components of two vectors.
@@ -450,7 +496,7 @@ TVec3<T> operator-( const TVec3<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator-( const TVec3<T>& u, const TVec3<T>& v );
+GEL_CONSTEXPR TVec3<T> operator-( const TVec3<T>& u, const TVec3<T>& v );
 
 /**
  * Multiplies the components of a vector by a scalar value.
@@ -460,7 +506,7 @@ TVec3<T> operator-( const TVec3<T>& u, const TVec3<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator*( const TVec3<T>& v, const T& s );
+GEL_CONSTEXPR TVec3<T> operator*( const TVec3<T>& v, const T& s );
 
 /**
  * Multiplies the components of a vector by a scalar value.
@@ -470,7 +516,7 @@ TVec3<T> operator*( const TVec3<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator*( const T& s, const TVec3<T>& v );
+GEL_CONSTEXPR TVec3<T> operator*( const T& s, const TVec3<T>& v );
 
 /**
  * Multiplies the components of two vectors.
@@ -480,7 +526,7 @@ TVec3<T> operator*( const T& s, const TVec3<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator*( const TVec3<T>& u, const TVec3<T>& v );
+GEL_CONSTEXPR TVec3<T> operator*( const TVec3<T>& u, const TVec3<T>& v );
 
 /**
  * Multiplies the components of a vector by a scalar value.
@@ -490,7 +536,7 @@ TVec3<T> operator*( const TVec3<T>& u, const TVec3<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator/( const TVec3<T>& v, const T& s );
+GEL_CONSTEXPR TVec3<T> operator/( const TVec3<T>& v, const T& s );
 
 /**
  * Multiplies the components of a vector by a scalar value.
@@ -500,7 +546,7 @@ TVec3<T> operator/( const TVec3<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator/( const T& s, const TVec3<T>& v );
+GEL_CONSTEXPR TVec3<T> operator/( const T& s, const TVec3<T>& v );
 
 /**
  * Divides the components of two vectors.
@@ -510,7 +556,7 @@ TVec3<T> operator/( const T& s, const TVec3<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator/( const TVec3<T>& u, const TVec3<T>& v );
+GEL_CONSTEXPR TVec3<T> operator/( const TVec3<T>& u, const TVec3<T>& v );
 
 /**
  * Performs modulus on a vector and a scalar.
@@ -520,7 +566,7 @@ TVec3<T> operator/( const TVec3<T>& u, const TVec3<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator%( const TVec3<T>& v, const T& s );
+GEL_CONSTEXPR TVec3<T> operator%( const TVec3<T>& v, const T& s );
 
 /**
  * Performs modulus on a vector and a scalar.
@@ -530,7 +576,7 @@ TVec3<T> operator%( const TVec3<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator%( const T& s, const TVec3<T>& v );
+GEL_CONSTEXPR TVec3<T> operator%( const T& s, const TVec3<T>& v );
 
 /**
  * Performs modulus on the components of two vectors.
@@ -540,7 +586,7 @@ TVec3<T> operator%( const T& s, const TVec3<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator%( const TVec3<T>& u, const TVec3<T>& v );
+GEL_CONSTEXPR TVec3<T> operator%( const TVec3<T>& u, const TVec3<T>& v );
 
 // BINARY BITWISE OPERATOR DECLARATIONS
 /**
@@ -551,7 +597,7 @@ TVec3<T> operator%( const TVec3<T>& u, const TVec3<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator&( const TVec3<T>& v, const T& s );
+GEL_CONSTEXPR TVec3<T> operator&( const TVec3<T>& v, const T& s );
 
 /**
  * Performs bitwise AND on the components from the two vectors.
@@ -561,7 +607,7 @@ TVec3<T> operator&( const TVec3<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator&( const TVec3<T>& u, const TVec3<T>& v );
+GEL_CONSTEXPR TVec3<T> operator&( const TVec3<T>& u, const TVec3<T>& v );
 
 /**
  * Performs bitwise OR on the components with the scalar.
@@ -571,7 +617,7 @@ TVec3<T> operator&( const TVec3<T>& u, const TVec3<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator|( const TVec3<T>& v, const T& s );
+GEL_CONSTEXPR TVec3<T> operator|( const TVec3<T>& v, const T& s );
 
 /**
  * Performs bitwise OR on the components from the two vectors.
@@ -581,7 +627,7 @@ TVec3<T> operator|( const TVec3<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator|( const TVec3<T>& u, const TVec3<T>& v );
+GEL_CONSTEXPR TVec3<T> operator|( const TVec3<T>& u, const TVec3<T>& v );
 
 
 /**
@@ -592,7 +638,7 @@ TVec3<T> operator|( const TVec3<T>& u, const TVec3<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator^( const TVec3<T>& v, const T& s );
+GEL_CONSTEXPR TVec3<T> operator^( const TVec3<T>& v, const T& s );
 
 /**
  * Performs bitwise XOR on the components from the two vectors.
@@ -602,7 +648,7 @@ TVec3<T> operator^( const TVec3<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator^( const TVec3<T>& u, const TVec3<T>& v );
+GEL_CONSTEXPR TVec3<T> operator^( const TVec3<T>& u, const TVec3<T>& v );
 
 /**
  * Shifts the bits of the components left.
@@ -612,7 +658,7 @@ TVec3<T> operator^( const TVec3<T>& u, const TVec3<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator<<( const TVec3<T>& v, unsigned int shift );
+GEL_CONSTEXPR TVec3<T> operator<<( const TVec3<T>& v, unsigned int shift );
 
 /**
  * Shifts the bits of the components right.
@@ -622,7 +668,7 @@ TVec3<T> operator<<( const TVec3<T>& v, unsigned int shift );
  * @return The resultant vector.
  */
 template <typename T>
-TVec3<T> operator>>( const TVec3<T>& u, unsigned int shift );
+GEL_CONSTEXPR TVec3<T> operator>>( const TVec3<T>& u, unsigned int shift );
 
 // COMPARISON OPERATOR DECLARATIONS
 /**
@@ -633,7 +679,7 @@ TVec3<T> operator>>( const TVec3<T>& u, unsigned int shift );
  * @return If they are equal.
  */
 template <typename T>
-bool operator==( const TVec3<T>& u, const TVec3<T>& v );
+GEL_CONSTEXPR bool operator==( const TVec3<T>& u, const TVec3<T>& v );
 
 /**
  * Checks if the components of two vectors are not equal.
@@ -643,33 +689,27 @@ bool operator==( const TVec3<T>& u, const TVec3<T>& v );
  * @return If they are not equal.
  */
 template <typename T>
-bool operator!=( const TVec3<T>& u, const TVec3<T>& v );
+GEL_CONSTEXPR bool operator!=( const TVec3<T>& u, const TVec3<T>& v );
 
 // IMPLEMENTATION
 
 // IMPLICIT CONSTRUCTORS
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>::TVec3( ) : x( 0 ), y( 0 ), z( 0 )
 {
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>::TVec3( const TVec3<T>& v ) : x( v.x ), y( v.y ), z( v.z )
 {
 }
 
-template <typename T>
-inline
-TVec3<T>::~TVec3()
-{
-}
-
 // EXPLICIT CONSTRUCTORS
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>::TVec3( const U& s ) : x( static_cast<T>( s ) ),
                                 y( static_cast<T>( s ) ),
                                 z( static_cast<T>( s ) )
@@ -678,7 +718,7 @@ TVec3<T>::TVec3( const U& s ) : x( static_cast<T>( s ) ),
 
 template <typename T>
 template <typename U, typename V, typename W>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>::TVec3( const U& s1, const V& s2, const W& s3 )
     : x( static_cast<T>( s1 ) ), y( static_cast<T>( s2 ) ),
       z( static_cast<T>( s3 ) )
@@ -687,7 +727,7 @@ TVec3<T>::TVec3( const U& s1, const V& s2, const W& s3 )
 
 template <typename T>
 template <typename U, typename V>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>::TVec3( const TVec2<U>& v, const V& s )
     : x( static_cast<T>( v.x ) ), y( static_cast<T>( v.y ) ),
       z( static_cast<T>( s ) )
@@ -696,7 +736,7 @@ TVec3<T>::TVec3( const TVec2<U>& v, const V& s )
 
 template <typename T>
 template <typename U, typename V>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>::TVec3( const U& s, const TVec2<V>& v )
     : x( static_cast<T>( s ) ), y( static_cast<T>( v.x ) ),
       z( static_cast<T>( v.y ) )
@@ -705,23 +745,16 @@ TVec3<T>::TVec3( const U& s, const TVec2<V>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>::TVec3( const TVec3<U>& v )
     : x( static_cast<T>( v.x ) ), y( static_cast<T>( v.y ) ),
       z( static_cast<T>( v.z ) )
 {
 }
 
-// SWIZZLE CONSTRUCTORS
-template <typename T>
-inline
-TVec3<T>::TVec3( const TRef3<T>& r ) : x( r.x ), y( r.y ), z( r.z )
-{
-}
-
 // UNARY OPERATORS
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator=( const TVec3<T>& v )
 {
     x = v.x;
@@ -732,7 +765,7 @@ TVec3<T>& TVec3<T>::operator=( const TVec3<T>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator=( const TVec3<U>& v )
 {
     x = static_cast<T>( v.x );
@@ -743,7 +776,7 @@ TVec3<T>& TVec3<T>::operator=( const TVec3<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator+=( const U& s )
 {
     x += static_cast<T>( s );
@@ -754,7 +787,7 @@ TVec3<T>& TVec3<T>::operator+=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator+=( const TVec3<U>& v )
 {
     x += static_cast<T>( v.x );
@@ -765,7 +798,7 @@ TVec3<T>& TVec3<T>::operator+=( const TVec3<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator-=( const U& s )
 {
     x -= static_cast<T>( s );
@@ -776,7 +809,7 @@ TVec3<T>& TVec3<T>::operator-=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator-=( const TVec3<U>& v )
 {
     x -= static_cast<T>( v.x );
@@ -787,7 +820,7 @@ TVec3<T>& TVec3<T>::operator-=( const TVec3<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator*=( const U& s )
 {
     x *= static_cast<T>( s );
@@ -798,7 +831,7 @@ TVec3<T>& TVec3<T>::operator*=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator*=( const TVec3<U>& v )
 {
     x *= static_cast<T>( v.x );
@@ -809,7 +842,7 @@ TVec3<T>& TVec3<T>::operator*=( const TVec3<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator/=( const U& s )
 {
     assert( s != 0 );
@@ -821,7 +854,7 @@ TVec3<T>& TVec3<T>::operator/=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator/=( const TVec3<U>& v )
 {
     assert( v.x != 0 && v.y != 0 && v.z != 0 );
@@ -832,7 +865,7 @@ TVec3<T>& TVec3<T>::operator/=( const TVec3<U>& v )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator++()
 {
     ++x;
@@ -842,7 +875,7 @@ TVec3<T>& TVec3<T>::operator++()
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator--()
 {
     --x;
@@ -852,7 +885,7 @@ TVec3<T>& TVec3<T>::operator--()
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator++( int )
 {
     ++x;
@@ -862,7 +895,7 @@ TVec3<T>& TVec3<T>::operator++( int )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator--( int )
 {
     --x;
@@ -872,7 +905,7 @@ TVec3<T>& TVec3<T>::operator--( int )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> TVec3<T>::operator-() const
 {
     return TVec3<T>( -x, -y, -z );
@@ -880,7 +913,7 @@ TVec3<T> TVec3<T>::operator-() const
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator%=( const U& s )
 {
     assert( s != 0 );
@@ -892,7 +925,7 @@ TVec3<T>& TVec3<T>::operator%=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator%=( const TVec3<U>& v )
 {
     assert( v.x != 0 && v.y != 0 && v.z != 0 );
@@ -905,7 +938,7 @@ TVec3<T>& TVec3<T>::operator%=( const TVec3<U>& v )
 // UNARY BITWISE OPERATORS
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator&=( const U& s )
 {
     x &= static_cast<T>( s );
@@ -916,7 +949,7 @@ TVec3<T>& TVec3<T>::operator&=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator&=( const TVec3<U>& v )
 {
     x &= static_cast<T>( v.x );
@@ -927,7 +960,7 @@ TVec3<T>& TVec3<T>::operator&=( const TVec3<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator|=( const U& s )
 {
     x |= static_cast<T>( s );
@@ -938,7 +971,7 @@ TVec3<T>& TVec3<T>::operator|=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator|=( const TVec3<U>& v )
 {
     x |= static_cast<T>( v.x );
@@ -949,7 +982,7 @@ TVec3<T>& TVec3<T>::operator|=( const TVec3<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator^=( const U& s )
 {
     x ^= static_cast<T>( s );
@@ -960,7 +993,7 @@ TVec3<T>& TVec3<T>::operator^=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator^=( const TVec3<U>& v )
 {
     x ^= static_cast<T>( v.x );
@@ -971,7 +1004,7 @@ TVec3<T>& TVec3<T>::operator^=( const TVec3<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator<<=( const U& s )
 {
     x <<= static_cast<T>( s );
@@ -982,7 +1015,7 @@ TVec3<T>& TVec3<T>::operator<<=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator<<=( const TVec3<U>& v )
 {
     x <<= static_cast<T>( v.x );
@@ -993,7 +1026,7 @@ TVec3<T>& TVec3<T>::operator<<=( const TVec3<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator>>=( const U& s )
 {
     x >>= static_cast<T>( s );
@@ -1004,7 +1037,7 @@ TVec3<T>& TVec3<T>::operator>>=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec3<T>& TVec3<T>::operator>>=( const TVec3<U>& v )
 {
     x >>= static_cast<T>( v.x );
@@ -1014,7 +1047,7 @@ TVec3<T>& TVec3<T>::operator>>=( const TVec3<U>& v )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> TVec3<T>::operator~() const
 {
     return TVec3<T>( ~x, ~y, ~z );
@@ -1022,73 +1055,219 @@ TVec3<T> TVec3<T>::operator~() const
 
 // ACCESSOR OPERATORS
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 const T& TVec3<T>::operator[]( Size index ) const
 {
-    assert( index >= 0 && index < 3 );
+    assert( index < 3 );
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return index == 0 ? x : index == 1 ? y : z;
+    }
+
     return ( &x )[index];
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 T& TVec3<T>::operator[]( Size index )
 {
-    assert( index >= 0 && index < 3 );
+    assert( index < 3 );
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return index == 0 ? x : index == 1 ? y : z;
+    }
+
     return ( &x )[index];
 }
 
+// SWIZZLE FUNCTIONS
+template <typename T>
+template <VComp C1, VComp C2>
+GEL_CONSTEXPR inline
+TVec2<T> TVec3<T>::swizzle() const
+{
+    static_assert( SwizzleIndex<C1>::VALUE < 3 &&
+                   SwizzleIndex<C2>::VALUE < 3,
+                   "component out of range" );
+    return TVec2<T>( ( *this )[SwizzleIndex<C1>::VALUE],
+                     ( *this )[SwizzleIndex<C2>::VALUE] );
+}
+
+template <typename T>
+template <VComp C1, VComp C2, VComp C3>
+GEL_CONSTEXPR inline
+TVec3<T> TVec3<T>::swizzle() const
+{
+    static_assert( SwizzleIndex<C1>::VALUE < 3 &&
+                   SwizzleIndex<C2>::VALUE < 3 &&
+                   SwizzleIndex<C3>::VALUE < 3,
+                   "component out of range" );
+    return TVec3<T>( ( *this )[SwizzleIndex<C1>::VALUE],
+                     ( *this )[SwizzleIndex<C2>::VALUE],
+                     ( *this )[SwizzleIndex<C3>::VALUE] );
+}
+
+template <typename T>
+template <VComp C1, VComp C2, VComp C3, VComp C4>
+GEL_CONSTEXPR inline
+TVec4<T> TVec3<T>::swizzle() const
+{
+    static_assert( SwizzleIndex<C1>::VALUE < 3 &&
+                   SwizzleIndex<C2>::VALUE < 3 &&
+                   SwizzleIndex<C3>::VALUE < 3 &&
+                   SwizzleIndex<C4>::VALUE < 3,
+                   "component out of range" );
+    return TVec4<T>( ( *this )[SwizzleIndex<C1>::VALUE],
+                     ( *this )[SwizzleIndex<C2>::VALUE],
+                     ( *this )[SwizzleIndex<C3>::VALUE],
+                     ( *this )[SwizzleIndex<C4>::VALUE] );
+}
+
+template <typename T>
+template <VComp C1, VComp C2>
+GEL_CONSTEXPR inline
+void TVec3<T>::assign( const TVec2<T>& v )
+{
+    static_assert( SwizzleIndex<C1>::VALUE < 3 &&
+                   SwizzleIndex<C2>::VALUE < 3,
+                   "component out of range" );
+    static_assert( SwizzleMask<C1, C2>::UNIQUE2,
+                   "component written twice" );
+    ( *this )[SwizzleIndex<C1>::VALUE] = v.x;
+    ( *this )[SwizzleIndex<C2>::VALUE] = v.y;
+}
+
+template <typename T>
+template <VComp C1, VComp C2, VComp C3>
+GEL_CONSTEXPR inline
+void TVec3<T>::assign( const TVec3<T>& v )
+{
+    static_assert( SwizzleIndex<C1>::VALUE < 3 &&
+                   SwizzleIndex<C2>::VALUE < 3 &&
+                   SwizzleIndex<C3>::VALUE < 3,
+                   "component out of range" );
+    static_assert( SwizzleMask<C1, C2, C3>::UNIQUE3,
+                   "component written twice" );
+    ( *this )[SwizzleIndex<C1>::VALUE] = v.x;
+    ( *this )[SwizzleIndex<C2>::VALUE] = v.y;
+    ( *this )[SwizzleIndex<C3>::VALUE] = v.z;
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec2<T> TVec3<T>::xy() const
+{
+    return swizzle<X, Y>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec2<T> TVec3<T>::xz() const
+{
+    return swizzle<X, Z>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec2<T> TVec3<T>::yz() const
+{
+    return swizzle<Y, Z>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec2<T> TVec3<T>::yx() const
+{
+    return swizzle<Y, X>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> TVec3<T>::xzy() const
+{
+    return swizzle<X, Z, Y>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> TVec3<T>::yxz() const
+{
+    return swizzle<Y, X, Z>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> TVec3<T>::yzx() const
+{
+    return swizzle<Y, Z, X>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> TVec3<T>::zxy() const
+{
+    return swizzle<Z, X, Y>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> TVec3<T>::zyx() const
+{
+    return swizzle<Z, Y, X>();
+}
+
 // BINARY ARITHMETIC OPERATORS
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator+( const TVec3<T>& v, const T& s )
 {
     return TVec3<T>( v.x + s, v.y + s, v.z + s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator+( const TVec3<T>& u, const TVec3<T>& v )
 {
     return TVec3<T>( u.x + v.x, u.y + v.y, u.z + v.z );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator-( const TVec3<T>& v, const T& s )
 {
     return TVec3<T>( v.x - s, v.y - s, v.z - s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator-( const TVec3<T>& u, const TVec3<T>& v )
 {
     return TVec3<T>( u.x - v.x, u.y - v.y, u.z - v.z );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator*( const TVec3<T>& v, const T& s )
 {
     return TVec3<T>( v.x * s, v.y * s, v.z * s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator*( const T& s, const TVec3<T>& v )
 {
     return TVec3<T>( s * v.x, s * v.y, s * v.z );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator*( const TVec3<T>& u, const TVec3<T>& v )
 {
     return TVec3<T>( u.x * v.x, u.y * v.y, u.z * v.z );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator/( const TVec3<T>& v, const T& s )
 {
     assert( s != T( 0 ) );
@@ -1096,7 +1275,7 @@ TVec3<T> operator/( const TVec3<T>& v, const T& s )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator/( const T& s, const TVec3<T>& v )
 {
     assert( v.x != 0 && v.y != 0 && v.z != 0 );
@@ -1104,7 +1283,7 @@ TVec3<T> operator/( const T& s, const TVec3<T>& v )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator/( const TVec3<T>& u, const TVec3<T>& v )
 {
     assert ( v.x != 0 && v.y != 0 && v.z != 0 );
@@ -1112,7 +1291,7 @@ TVec3<T> operator/( const TVec3<T>& u, const TVec3<T>& v )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator%( const TVec3<T>& v, const T& s )
 {
     assert( s != 0 );
@@ -1120,7 +1299,7 @@ TVec3<T> operator%( const TVec3<T>& v, const T& s )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator%( const T& s, const TVec3<T>& v )
 {
     assert( v.x != 0 && v.y != 0 && v.z != 0 );
@@ -1128,7 +1307,7 @@ TVec3<T> operator%( const T& s, const TVec3<T>& v )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator%( const TVec3<T>& u, const TVec3<T>& v )
 {
     assert ( v.x != 0 && v.y != 0 && v.z != 0 );
@@ -1137,144 +1316,75 @@ TVec3<T> operator%( const TVec3<T>& u, const TVec3<T>& v )
 
 // BINARY BITWISE OPERATORS
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator&( const TVec3<T>& v, const T& s )
 {
     return TVec3<T>( v.x & s, v.y & s, v.z & s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator&( const TVec3<T>& u, const TVec3<T>& v )
 {
     return TVec3<T>( u.x & v.x, u.y & v.y, u.z & v.z );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator|( const TVec3<T>& v, const T& s )
 {
     return TVec3<T>( v.x | s, v.y | s, v.z | s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator|( const TVec3<T>& u, const TVec3<T>& v )
 {
     return TVec3<T>( u.x | v.x, u.y | v.y, u.z | v.z );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator^( const TVec3<T>& v, const T& s )
 {
     return TVec3<T>( v.x ^ s, v.y ^ s, v.z ^ s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator^( const TVec3<T>& u, const TVec3<T>& v )
 {
     return TVec3<T>( u.x ^ v.x, u.y ^ v.y, u.z ^ v.z );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator<<( const TVec3<T>& v, unsigned int shift )
 {
     return TVec3<T>( v.x << shift, v.y << shift, v.z << shift );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec3<T> operator>>( const TVec3<T>& u, unsigned int shift )
 {
     return TVec3<T>( u.x >> shift, u.y >> shift, u.z >> shift );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 bool operator==( const TVec3<T>& u, const TVec3<T>& v )
 {
     return u.x == v.x && u.y == v.y && u.z == v.z;
 }
 
 template <typename T>
-inline
-bool operator==( const TVec3<T>& u, const TRef3<T>& v )
-{
-    return u.x == v.x || u.y == v.y || u.z == v.z;
-}
-
-template <typename T>
-inline
-bool operator==( const TRef3<T>& u, const TVec3<T>& v )
-{
-    return u.x == v.x || u.y == v.y || u.z == v.z;
-}
-
-template <typename T>
-inline
-bool operator==( const TRef3<T>& u, const TRef3<T>& v )
-{
-    return u.x == v.x || u.y == v.y || u.z == v.z;
-}
-
-template <typename T>
-inline
+GEL_CONSTEXPR inline
 bool operator!=( const TVec3<T>& u, const TVec3<T>& v )
 {
     return u.x != v.x || u.y != v.y || u.z != v.z;
 }
 
-template <typename T>
-inline
-bool operator!=( const TVec3<T>& u, const TRef3<T>& v )
-{
-    return u.x != v.x || u.y != v.y || u.z != v.z;
-}
-
-template <typename T>
-inline
-bool operator!=( const TRef3<T>& u, const TVec3<T>& v )
-{
-    return u.x != v.x || u.y != v.y || u.z != v.z;
-}
-
-template <typename T>
-inline
-bool operator!=( const TRef3<T>& u, const TRef3<T>& v )
-{
-    return u.x != v.x || u.y != v.y || u.z != v.z;
-}
-
-// 4D REFERENCE VECTOR
-
-// CONSTRUCTORS
-template <typename T>
-inline
-TRef3<T>::TRef3( T& s1, T& s2, T& s3 ) : x( s1 ), y( s2 ), z( s3 )
-{
-}
-
-template <typename T>
-inline
-TRef3<T>::TRef3( TRef3<T>& r ) : x( r.x ), y( r.y ), z( r.z )
-{
-}
-
-template <typename T>
-inline
-TRef3<T>::TRef3( TVec3<T>& v ) : x( v.x ), y( v.y ), z( v.z )
-{
-}
-
-template <typename T>
-inline
-TRef3<T>::~TRef3()
-{
-}
-
 } // End nspc math
 
 } // End nspc gel
@@ -0,0 +1,882 @@
+// vec3_stream.h
+#ifndef GEL_VEC3_STREAM_H
+#define GEL_VEC3_STREAM_H
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+#include "gel/gellib.h"
+#include "gel/math/dispatch.h"
+#include "gel/math/vec3.h"
+#include "gel/memory/iallocator.h"
+#include "gel/memory/heap_allocator.h"
+
+namespace gel
+{
+
+namespace math
+{
+
+/**
+ * @brief Defines a structure-of-arrays stream of 3D vectors.
+ *
+ * Each component is kept in its own contiguous array so that batch kernels
+ * process several vectors per instruction. The component arrays share a
+ * single block from the allocator and are padded to a multiple of LANES
+ * values so that each starts with the alignment of the block.
+ *
+ * @tparam T The component type. This must be an arithmetic type.
+ */
+template <typename T>
+class TVec3Stream
+{
+  private:
+    /**
+     * The allocator that owns the component block.
+     */
+    mem::IAllocator<T>* _allocator;
+
+    /**
+     * The component block.
+     */
+    T* _data;
+
+    /**
+     * The number of vectors in the stream.
+     */
+    Size _size;
+
+    /**
+     * The number of vectors that fit in each component array.
+     */
+    Size _capacity;
+
+    // HELPER FUNCTIONS
+    /**
+     * Moves the stream into a new block of the given capacity.
+     *
+     * @param capacity The new capacity, a multiple of LANES.
+     * @return If the stream moved, which fails if the allocator is exhausted,
+     *         leaving the stream unchanged.
+     */
+    bool grow( Size capacity );
+
+  public:
+    /**
+     * The number of values each component array is padded to.
+     */
+    static const Size LANES = 16;
+
+    // CONSTRUCTORS
+    /**
+     * Constructs a new empty stream.
+     *
+     * @param allocator The allocator for the component arrays.
+     */
+    explicit TVec3Stream( mem::IAllocator<T>& allocator =
+                              mem::HeapAllocator<T>::instance() );
+
+    /**
+     * Constructs a new stream of zero vectors, which is left empty if the
+     * allocator is exhausted.
+     *
+     * @param size The number of vectors.
+     * @param allocator The allocator for the component arrays.
+     */
+    explicit TVec3Stream( Size size, mem::IAllocator<T>& allocator =
+                                         mem::HeapAllocator<T>::instance() );
+
+    /**
+     * Constructs a copy of another stream that uses the same allocator.
+     *
+     * @param stream The stream to copy.
+     */
+    TVec3Stream( const TVec3Stream<T>& stream );
+
+    /**
+     * Destructs the stream.
+     */
+    ~TVec3Stream();
+
+    // OPERATORS
+    /**
+     * Makes this a copy of another stream, which leaves this unchanged if
+     * the allocator is exhausted.
+     *
+     * @param stream The stream to copy.
+     */
+    TVec3Stream<T>& operator=( const TVec3Stream<T>& stream );
+
+    // MEMBER FUNCTIONS
+    /**
+     * Ensures the stream can hold at least the given number of vectors.
+     *
+     * @param capacity The number of vectors.
+     * @return If the stream can hold them, which fails if the allocator is
+     *         exhausted, leaving the stream unchanged.
+     */
+    bool reserve( Size capacity );
+
+    /**
+     * Resizes the stream. New vectors are zeroed.
+     *
+     * @param size The number of vectors.
+     * @return If the stream was resized, which fails if the allocator is
+     *         exhausted, leaving the stream unchanged.
+     */
+    bool resize( Size size );
+
+    /**
+     * Removes all vectors from the stream.
+     */
+    void clear();
+
+    /**
+     * Appends a vector to the end of the stream.
+     *
+     * @param v The vector.
+     * @return If the vector was appended, which fails if the allocator is
+     *         exhausted, leaving the stream unchanged.
+     */
+    bool push( const TVec3<T>& v );
+
+    /**
+     * Gets the vector at the given index.
+     *
+     * @param index The index.
+     * @return The vector.
+     */
+    TVec3<T> get( Size index ) const;
+
+    /**
+     * Sets the vector at the given index.
+     *
+     * @param index The index.
+     * @param v The vector.
+     */
+    void set( Size index, const TVec3<T>& v );
+
+    /**
+     * Replaces the contents of the stream with an array of vectors.
+     *
+     * @param in The vectors.
+     * @param count The number of vectors.
+     * @return If the vectors were loaded, which fails if the allocator is
+     *         exhausted, leaving the stream unchanged.
+     */
+    bool load( const TVec3<T>* in, Size count );
+
+    /**
+     * Copies the contents of the stream to an array of vectors.
+     *
+     * @param out The destination, which must hold size() vectors.
+     */
+    void store( TVec3<T>* out ) const;
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the number of vectors in the stream.
+     *
+     * @return The size.
+     */
+    Size size() const;
+
+    /**
+     * Gets the number of vectors the stream can hold without reallocating.
+     *
+     * @return The capacity.
+     */
+    Size capacity() const;
+
+    /**
+     * Gets the array for the given component.
+     *
+     * @param index The component index.
+     * @return The component array.
+     */
+    T* component( Size index );
+
+    /**
+     * Gets the array for the given component.
+     *
+     * @param index The component index.
+     * @return The component array.
+     */
+    const T* component( Size index ) const;
+
+    /**
+     * Gets the x component array.
+     */
+    T* x();
+
+    /**
+     * Gets the x component array.
+     */
+    const T* x() const;
+
+    /**
+     * Gets the y component array.
+     */
+    T* y();
+
+    /**
+     * Gets the y component array.
+     */
+    const T* y() const;
+
+    /**
+     * Gets the z component array.
+     */
+    T* z();
+
+    /**
+     * Gets the z component array.
+     */
+    const T* z() const;
+};
+
+// BATCH KERNEL DECLARATIONS
+/**
+ * Adds the vectors of two streams.
+ *
+ * @param out The resultant stream, which may be one of the inputs.
+ * @param u The first stream.
+ * @param v The second stream.
+ * @return If the result was written, which fails if out could not be
+ *         resized, leaving it unchanged.
+ */
+template <typename T>
+bool add( TVec3Stream<T>& out, const TVec3Stream<T>& u,
+          const TVec3Stream<T>& v );
+
+/**
+ * Multiplies the components of the vectors of two streams.
+ *
+ * @param out The resultant stream, which may be one of the inputs.
+ * @param u The first stream.
+ * @param v The second stream.
+ * @return If the result was written, which fails if out could not be
+ *         resized, leaving it unchanged.
+ */
+template <typename T>
+bool mul( TVec3Stream<T>& out, const TVec3Stream<T>& u,
+          const TVec3Stream<T>& v );
+
+/**
+ * Multiplies the vectors of two streams and adds a third.
+ *
+ * @param out The resultant stream, which may be one of the inputs.
+ * @param u The first factor stream.
+ * @param v The second factor stream.
+ * @param w The addend stream.
+ * @return If the result was written, which fails if out could not be
+ *         resized, leaving it unchanged.
+ */
+template <typename T>
+bool madd( TVec3Stream<T>& out, const TVec3Stream<T>& u,
+           const TVec3Stream<T>& v, const TVec3Stream<T>& w );
+
+/**
+ * Multiplies the vectors of a stream by a scalar.
+ *
+ * @param out The resultant stream, which may be the input.
+ * @param v The stream.
+ * @param s The scalar.
+ * @return If the result was written, which fails if out could not be
+ *         resized, leaving it unchanged.
+ */
+template <typename T>
+bool scale( TVec3Stream<T>& out, const TVec3Stream<T>& v, const T& s );
+
+/**
+ * Computes the dot products of the vectors of two streams.
+ *
+ * @param out The resultant array, which must hold u.size() values.
+ * @param u The first stream.
+ * @param v The second stream.
+ */
+template <typename T>
+void dot( T* out, const TVec3Stream<T>& u, const TVec3Stream<T>& v );
+
+/**
+ * Normalizes the vectors of a stream.
+ *
+ * @param out The resultant stream, which may be the input.
+ * @param v The stream.
+ * @return If the result was written, which fails if out could not be
+ *         resized, leaving it unchanged.
+ */
+template <typename T>
+bool normalize( TVec3Stream<T>& out, const TVec3Stream<T>& v );
+
+/**
+ * Linearly interpolates between the vectors of two streams.
+ *
+ * @param out The resultant stream, which may be one of the inputs.
+ * @param u The stream at t = 0.
+ * @param v The stream at t = 1.
+ * @param t The interpolation factor.
+ * @return If the result was written, which fails if out could not be
+ *         resized, leaving it unchanged.
+ */
+template <typename T>
+bool lerp( TVec3Stream<T>& out, const TVec3Stream<T>& u,
+           const TVec3Stream<T>& v, const T& t );
+
+// IMPLEMENTATION
+
+// CONSTRUCTORS
+template <typename T>
+inline
+TVec3Stream<T>::TVec3Stream( mem::IAllocator<T>& allocator )
+    : _allocator( &allocator ), _data( 0 ), _size( 0 ), _capacity( 0 )
+{
+}
+
+template <typename T>
+inline
+TVec3Stream<T>::TVec3Stream( Size size, mem::IAllocator<T>& allocator )
+    : _allocator( &allocator ), _data( 0 ), _size( 0 ), _capacity( 0 )
+{
+    resize( size );
+}
+
+template <typename T>
+inline
+TVec3Stream<T>::TVec3Stream( const TVec3Stream<T>& stream )
+    : _allocator( stream._allocator ), _data( 0 ), _size( 0 ), _capacity( 0 )
+{
+    *this = stream;
+}
+
+template <typename T>
+inline
+TVec3Stream<T>::~TVec3Stream()
+{
+    if ( _data )
+    {
+        _allocator->free( _data );
+    }
+}
+
+// OPERATORS
+template <typename T>
+inline
+TVec3Stream<T>& TVec3Stream<T>::operator=( const TVec3Stream<T>& stream )
+{
+    if ( this != &stream && reserve( stream._size ) )
+    {
+        _size = stream._size;
+        for ( Size c = 0; c < 3; ++c )
+        {
+            memcpy( component( c ), stream.component( c ), _size * sizeof( T ) );
+        }
+    }
+    return *this;
+}
+
+// MEMBER FUNCTIONS
+template <typename T>
+inline
+bool TVec3Stream<T>::reserve( Size capacity )
+{
+    if ( capacity > _capacity )
+    {
+        return grow( ( capacity + LANES - 1 ) & ~( LANES - 1 ) );
+    }
+    return true;
+}
+
+template <typename T>
+inline
+bool TVec3Stream<T>::resize( Size size )
+{
+    if ( !reserve( size ) )
+    {
+        return false;
+    }
+    if ( size > _size )
+    {
+        for ( Size c = 0; c < 3; ++c )
+        {
+            memset( component( c ) + _size, 0, ( size - _size ) * sizeof( T ) );
+        }
+    }
+    _size = size;
+    return true;
+}
+
+template <typename T>
+inline
+void TVec3Stream<T>::clear()
+{
+    _size = 0;
+}
+
+template <typename T>
+inline
+bool TVec3Stream<T>::push( const TVec3<T>& v )
+{
+    if ( _size == _capacity && !reserve( _capacity ? _capacity * 2 : LANES ) )
+    {
+        return false;
+    }
+    set( _size++, v );
+    return true;
+}
+
+template <typename T>
+inline
+TVec3<T> TVec3Stream<T>::get( Size index ) const
+{
+    assert( index < _size );
+    return TVec3<T>( x()[index], y()[index], z()[index] );
+}
+
+template <typename T>
+inline
+void TVec3Stream<T>::set( Size index, const TVec3<T>& v )
+{
+    assert( index < _size );
+    x()[index] = v.x;
+    y()[index] = v.y;
+    z()[index] = v.z;
+}
+
+template <typename T>
+inline
+bool TVec3Stream<T>::load( const TVec3<T>* in, Size count )
+{
+    if ( !reserve( count ) )
+    {
+        return false;
+    }
+    _size = count;
+
+    T* xs = x();
+    T* ys = y();
+    T* zs = z();
+    for ( Size i = 0; i < count; ++i )
+    {
+        xs[i] = in[i].x;
+        ys[i] = in[i].y;
+        zs[i] = in[i].z;
+    }
+    return true;
+}
+
+template <typename T>
+inline
+void TVec3Stream<T>::store( TVec3<T>* out ) const
+{
+    const T* xs = x();
+    const T* ys = y();
+    const T* zs = z();
+    for ( Size i = 0; i < _size; ++i )
+    {
+        out[i].x = xs[i];
+        out[i].y = ys[i];
+        out[i].z = zs[i];
+    }
+}
+
+// ACCESSOR FUNCTIONS
+template <typename T>
+inline
+Size TVec3Stream<T>::size() const
+{
+    return _size;
+}
+
+template <typename T>
+inline
+Size TVec3Stream<T>::capacity() const
+{
+    return _capacity;
+}
+
+template <typename T>
+inline
+T* TVec3Stream<T>::component( Size index )
+{
+    assert( index < 3 );
+    return _data + index * _capacity;
+}
+
+template <typename T>
+inline
+const T* TVec3Stream<T>::component( Size index ) const
+{
+    assert( index < 3 );
+    return _data + index * _capacity;
+}
+
+template <typename T>
+inline
+T* TVec3Stream<T>::x()
+{
+    return _data;
+}
+
+template <typename T>
+inline
+const T* TVec3Stream<T>::x() const
+{
+    return _data;
+}
+
+template <typename T>
+inline
+T* TVec3Stream<T>::y()
+{
+    return _data + _capacity;
+}
+
+template <typename T>
+inline
+const T* TVec3Stream<T>::y() const
+{
+    return _data + _capacity;
+}
+
+template <typename T>
+inline
+T* TVec3Stream<T>::z()
+{
+    return _data + 2 * _capacity;
+}
+
+template <typename T>
+inline
+const T* TVec3Stream<T>::z() const
+{
+    return _data + 2 * _capacity;
+}
+
+template <typename T>
+const Size TVec3Stream<T>::LANES;
+
+// HELPER FUNCTIONS
+template <typename T>
+inline
+bool TVec3Stream<T>::grow( Size capacity )
+{
+    T* data = _allocator->allocate( capacity * 3 );
+    if ( !data )
+    {
+        return false;
+    }
+
+    if ( _data )
+    {
+        for ( Size c = 0; c < 3; ++c )
+        {
+            memcpy( data + c * capacity, component( c ), _size * sizeof( T ) );
+        }
+        _allocator->free( _data );
+    }
+
+    _data = data;
+    _capacity = capacity;
+    return true;
+}
+
+// BATCH KERNELS
+template <typename T>
+inline
+bool add( TVec3Stream<T>& out, const TVec3Stream<T>& u,
+          const TVec3Stream<T>& v )
+{
+    assert( u.size() == v.size() );
+    const Size n = u.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    for ( Size c = 0; c < 3; ++c )
+    {
+        T* o = out.component( c );
+        const T* a = u.component( c );
+        const T* b = v.component( c );
+        for ( Size i = 0; i < n; ++i )
+        {
+            o[i] = a[i] + b[i];
+        }
+    }
+    return true;
+}
+
+template <typename T>
+inline
+bool mul( TVec3Stream<T>& out, const TVec3Stream<T>& u,
+          const TVec3Stream<T>& v )
+{
+    assert( u.size() == v.size() );
+    const Size n = u.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    for ( Size c = 0; c < 3; ++c )
+    {
+        T* o = out.component( c );
+        const T* a = u.component( c );
+        const T* b = v.component( c );
+        for ( Size i = 0; i < n; ++i )
+        {
+            o[i] = a[i] * b[i];
+        }
+    }
+    return true;
+}
+
+template <typename T>
+inline
+bool madd( TVec3Stream<T>& out, const TVec3Stream<T>& u,
+           const TVec3Stream<T>& v, const TVec3Stream<T>& w )
+{
+    assert( u.size() == v.size() && v.size() == w.size() );
+    const Size n = u.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    for ( Size c = 0; c < 3; ++c )
+    {
+        T* o = out.component( c );
+        const T* a = u.component( c );
+        const T* b = v.component( c );
+        const T* d = w.component( c );
+        for ( Size i = 0; i < n; ++i )
+        {
+            o[i] = a[i] * b[i] + d[i];
+        }
+    }
+    return true;
+}
+
+template <typename T>
+inline
+bool scale( TVec3Stream<T>& out, const TVec3Stream<T>& v, const T& s )
+{
+    const Size n = v.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    for ( Size c = 0; c < 3; ++c )
+    {
+        T* o = out.component( c );
+        const T* a = v.component( c );
+        for ( Size i = 0; i < n; ++i )
+        {
+            o[i] = a[i] * s;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+inline
+void dot( T* out, const TVec3Stream<T>& u, const TVec3Stream<T>& v )
+{
+    assert( u.size() == v.size() );
+    const Size n = u.size();
+    const T* ux = u.x();
+    const T* uy = u.y();
+    const T* uz = u.z();
+    const T* vx = v.x();
+    const T* vy = v.y();
+    const T* vz = v.z();
+
+    for ( Size i = 0; i < n; ++i )
+    {
+        out[i] = ux[i] * vx[i] + uy[i] * vy[i] + uz[i] * vz[i];
+    }
+}
+
+template <typename T>
+inline
+bool normalize( TVec3Stream<T>& out, const TVec3Stream<T>& v )
+{
+    const Size n = v.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+    const T* vx = v.x();
+    const T* vy = v.y();
+    const T* vz = v.z();
+    T* ox = out.x();
+    T* oy = out.y();
+    T* oz = out.z();
+
+    for ( Size i = 0; i < n; ++i )
+    {
+        T len = static_cast<T>( sqrt( vx[i] * vx[i] + vy[i] * vy[i] +
+                                      vz[i] * vz[i] ) );
+        ox[i] = vx[i] / len;
+        oy[i] = vy[i] / len;
+        oz[i] = vz[i] / len;
+    }
+    return true;
+}
+
+template <typename T>
+inline
+bool lerp( TVec3Stream<T>& out, const TVec3Stream<T>& u,
+           const TVec3Stream<T>& v, const T& t )
+{
+    assert( u.size() == v.size() );
+    const Size n = u.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    for ( Size c = 0; c < 3; ++c )
+    {
+        T* o = out.component( c );
+        const T* a = u.component( c );
+        const T* b = v.component( c );
+        for ( Size i = 0; i < n; ++i )
+        {
+            o[i] = a[i] + ( b[i] - a[i] ) * t;
+        }
+    }
+    return true;
+}
+
+// FLOAT BATCH KERNELS
+template <>
+inline
+bool add( TVec3Stream<float>& out, const TVec3Stream<float>& u,
+          const TVec3Stream<float>& v )
+{
+    assert( u.size() == v.size() );
+    const Size n = u.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    const BatchKernels& k = batchKernels();
+    for ( Size c = 0; c < 3; ++c )
+    {
+        k.add( out.component( c ), u.component( c ), v.component( c ), n );
+    }
+    return true;
+}
+
+template <>
+inline
+bool mul( TVec3Stream<float>& out, const TVec3Stream<float>& u,
+          const TVec3Stream<float>& v )
+{
+    assert( u.size() == v.size() );
+    const Size n = u.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    const BatchKernels& k = batchKernels();
+    for ( Size c = 0; c < 3; ++c )
+    {
+        k.mul( out.component( c ), u.component( c ), v.component( c ), n );
+    }
+    return true;
+}
+
+template <>
+inline
+bool madd( TVec3Stream<float>& out, const TVec3Stream<float>& u,
+           const TVec3Stream<float>& v, const TVec3Stream<float>& w )
+{
+    assert( u.size() == v.size() && v.size() == w.size() );
+    const Size n = u.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    const BatchKernels& k = batchKernels();
+    for ( Size c = 0; c < 3; ++c )
+    {
+        k.madd( out.component( c ), u.component( c ), v.component( c ),
+                w.component( c ), n );
+    }
+    return true;
+}
+
+template <>
+inline
+bool scale( TVec3Stream<float>& out, const TVec3Stream<float>& v,
+            const float& s )
+{
+    const Size n = v.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    const BatchKernels& k = batchKernels();
+    for ( Size c = 0; c < 3; ++c )
+    {
+        k.scale( out.component( c ), v.component( c ), s, n );
+    }
+    return true;
+}
+
+template <>
+inline
+void dot( float* out, const TVec3Stream<float>& u, const TVec3Stream<float>& v )
+{
+    assert( u.size() == v.size() );
+    const float* us[] = { u.x(), u.y(), u.z() };
+    const float* vs[] = { v.x(), v.y(), v.z() };
+    batchKernels().dot( out, us, vs, 3, u.size() );
+}
+
+template <>
+inline
+bool normalize( TVec3Stream<float>& out, const TVec3Stream<float>& v )
+{
+    if ( !out.resize( v.size() ) )
+    {
+        return false;
+    }
+    float* os[] = { out.x(), out.y(), out.z() };
+    const float* vs[] = { v.x(), v.y(), v.z() };
+    batchKernels().normalize( os, vs, 3, v.size() );
+    return true;
+}
+
+template <>
+inline
+bool lerp( TVec3Stream<float>& out, const TVec3Stream<float>& u,
+           const TVec3Stream<float>& v, const float& t )
+{
+    assert( u.size() == v.size() );
+    const Size n = u.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    const BatchKernels& k = batchKernels();
+    for ( Size c = 0; c < 3; ++c )
+    {
+        k.lerp( out.component( c ), u.component( c ), v.component( c ), t, n );
+    }
+    return true;
+}
+
+} // End nspc math
+
+} // End nspc gel
+
+#endif //GEL_VEC3_STREAM_H
@@ -3,6 +3,7 @@
 #define GEL_VEC4_H
 #include <assert.h>
 #include "gel/gellib.h"
+#include "gel/math/swizzle.h"
 
 namespace gel
 {
@@ -10,15 +11,6 @@ namespace gel
 namespace math
 {
 
-template <typename T>
-class TRef2;
-
-template <typename T>
-class TRef3;
-
-template <typename T>
-class TRef4;
-
 template <typename T>
 class TVec2;
 
@@ -47,19 +39,14 @@ class TVec4
     /**
      * Constructs a new vector.
      */
-    TVec4();
+    GEL_CONSTEXPR TVec4();
 
     /**
      * Constructs this vector as a copy of the other.
      *
      * @param v The vector to copy.
      */
-    TVec4( const TVec4<T>& v );
-
-    /**
-     * Destructs the vector.
-     */
-    ~TVec4();
+    GEL_CONSTEXPR TVec4( const TVec4<T>& v );
 
     // EXPLICIT CONSTRUCTORS
     /**
@@ -69,7 +56,7 @@ class TVec4
      * @tparam U The component value type.
      */
     template <typename U>
-    explicit TVec4( const U& s );
+    GEL_CONSTEXPR explicit TVec4( const U& s );
 
     /**
      * Constructs a new vector.
@@ -84,6 +71,7 @@ class TVec4
      * @tparam X The fourth component value type.
      */
     template <typename U, typename V, typename W, typename X>
+    GEL_CONSTEXPR
     explicit TVec4( const U& s1, const V& s2, const W& s3, const X& s4 );
 
     /**
@@ -97,7 +85,7 @@ class TVec4
      * @tparam W The fourth component type.
      */
     template <typename U, typename V, typename W>
-    explicit TVec4( const TVec2<U>& v, const V& s3, const W& s4 );
+    GEL_CONSTEXPR explicit TVec4( const TVec2<U>& v, const V& s3, const W& s4 );
 
     /**
      * Constructs a copy of the vector with the given last component value.
@@ -111,7 +99,7 @@ class TVec4
      * @tparam W The fourth component type.
      */
     template <typename U, typename V, typename W>
-    explicit TVec4( const U& s1, const TVec2<V>& v, const W& s4 );
+    GEL_CONSTEXPR explicit TVec4( const U& s1, const TVec2<V>& v, const W& s4 );
 
     /**
      * Constructs a copy of the vector with the given last component value.
@@ -124,7 +112,7 @@ class TVec4
      * @tparm W The vector type.
      */
     template <typename U, typename V, typename W>
-    explicit TVec4( const U& s1, const V& s2, const TVec2<W>& v );
+    GEL_CONSTEXPR explicit TVec4( const U& s1, const V& s2, const TVec2<W>& v );
 
     /**
      * Constructs a composition of the two given vectors.
@@ -135,7 +123,7 @@ class TVec4
      * @tparam V The second vector type.
      */
     template <typename U, typename V>
-    explicit TVec4( const TVec2<U> v1, const TVec2<V>& v2 );
+    GEL_CONSTEXPR explicit TVec4( const TVec2<U> v1, const TVec2<V>& v2 );
 
     /**
      * Constructs a copy of the vector with the given first component value.
@@ -146,7 +134,7 @@ class TVec4
      * @tparam V The vector type.
      */
     template <typename U, typename V>
-    explicit TVec4( const U& s, const TVec3<V>& v );
+    GEL_CONSTEXPR explicit TVec4( const U& s, const TVec3<V>& v );
 
     /**
      * Constructs a copy of the vector with the given first component value.
@@ -157,7 +145,7 @@ class TVec4
      * @tparam V The fourth component type.
      */
     template <typename U, typename V>
-    explicit TVec4( const TVec3<U>& v, const V& s );
+    GEL_CONSTEXPR explicit TVec4( const TVec3<U>& v, const V& s );
 
     /**
      * Constructs a copy of the vector.
@@ -165,15 +153,7 @@ class TVec4
      * @tparam U The component type.
      */
     template <typename U>
-    explicit TVec4( const TVec4<U>& v );
-
-    // SWIZZLE CONSTRUCTORS
-    /**
-     * Construct from a reference vector.
-     *
-     * @param r The reference vector.
-     */
-    TVec4( const TRef4<T>& r );
+    GEL_CONSTEXPR explicit TVec4( const TVec4<U>& v );
 
     // UNARY OPERATORS
     /**
@@ -181,7 +161,7 @@ class TVec4
      *
      * @param v The vector to copy.
      */
-    TVec4<T>& operator=( const TVec4<T>& v );
+    GEL_CONSTEXPR TVec4<T>& operator=( const TVec4<T>& v );
 
     /**
      * Makes this a copy of the other vector.
@@ -190,7 +170,7 @@ class TVec4
      * @tparam U The component value type..
      */
     template <typename U>
-    TVec4<T>& operator=( const TVec4<U>& v );
+    GEL_CONSTEXPR TVec4<T>& operator=( const TVec4<U>& v );
 
     /**
      * Adds a scalar value to the components.
@@ -199,7 +179,7 @@ class TVec4
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec4<T>& operator+=( const U& s );
+    GEL_CONSTEXPR TVec4<T>& operator+=( const U& s );
 
     /**
      * Adds another vector to this.
@@ -208,7 +188,7 @@ class TVec4
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec4<T>& operator+=( const TVec4<U>& v );
+    GEL_CONSTEXPR TVec4<T>& operator+=( const TVec4<U>& v );
 
     /**
      * Subtracts a scale from the components.
@@ -217,7 +197,7 @@ class TVec4
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec4<T>& operator-=( const U& s );
+    GEL_CONSTEXPR TVec4<T>& operator-=( const U& s );
 
     /**
      * Subtracts another vector from this.
@@ -226,7 +206,7 @@ class TVec4
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec4<T>& operator-=( const TVec4<U>& v );
+    GEL_CONSTEXPR TVec4<T>& operator-=( const TVec4<U>& v );
 
     /**
      * Multiplies the this by a scalar.
@@ -235,7 +215,7 @@ class TVec4
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec4<T>& operator*=( const U& s );
+    GEL_CONSTEXPR TVec4<T>& operator*=( const U& s );
 
     /**
      * Multiplies this vector by another.
@@ -244,7 +224,7 @@ class TVec4
      * @tparam The component value type.
      */
     template <typename U>
-    TVec4<T>& operator*=( const TVec4<U>& v );
+    GEL_CONSTEXPR TVec4<T>& operator*=( const TVec4<U>& v );
 
     /**
      * Divides this vector by a scalar.
@@ -253,7 +233,7 @@ class TVec4
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec4<T>& operator/=( const U& s );
+    GEL_CONSTEXPR TVec4<T>& operator/=( const U& s );
 
     /**
      * Divides this vector by another.
@@ -262,42 +242,42 @@ class TVec4
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec4<T>& operator/=( const TVec4<U>& v );
+    GEL_CONSTEXPR TVec4<T>& operator/=( const TVec4<U>& v );
 
     /**
      * Adds one to the vector's component values.
      *
      * @return The resultant vector.
      */
-    TVec4<T>& operator++( );
+    GEL_CONSTEXPR TVec4<T>& operator++( );
 
     /**
      * Subtracts one from the vector's component values.
      *
      * @return The resultant vector.
      */
-    TVec4<T>& operator--( );
+    GEL_CONSTEXPR TVec4<T>& operator--( );
 
     /**
      * Adds one to the vector's component values.
      *
      * @return The resultant vector.
      */
-    TVec4<T>& operator++( int );
+    GEL_CONSTEXPR TVec4<T>& operator++( int );
 
     /**
      * Subtracts one from the vector's component values.
      *
      * @return The resultant vector.
      */
-    TVec4<T>& operator--( int );
+    GEL_CONSTEXPR TVec4<T>& operator--( int );
 
     /**
      * Multiplies the vector by negative one.
      *
      * @return The negative vector.
      */
-    TVec4<T> operator-() const;
+    GEL_CONSTEXPR TVec4<T> operator-() const;
 
     // UNARY BIT OPERATORS
     /**
@@ -307,7 +287,7 @@ class TVec4
      * @tparam The scalar value type.
      */
     template <typename U>
-    TVec4<T>& operator%=( const U& s );
+    GEL_CONSTEXPR TVec4<T>& operator%=( const U& s );
 
     /**
      * Performs a component-wise modulus.
@@ -316,7 +296,7 @@ class TVec4
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec4<T>& operator%=( const TVec4<U>& v );
+    GEL_CONSTEXPR TVec4<T>& operator%=( const TVec4<U>& v );
 
     /**
      * Performs the bitwise-and operation with each of the components.
@@ -325,7 +305,7 @@ class TVec4
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec4<T>& operator&=( const U& s );
+    GEL_CONSTEXPR TVec4<T>& operator&=( const U& s );
 
     /**
      * Performs a component-wise bitwise-and operation.
@@ -334,7 +314,7 @@ class TVec4
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec4<T>& operator&=( const TVec4<U>& v );
+    GEL_CONSTEXPR TVec4<T>& operator&=( const TVec4<U>& v );
 
     /**
      * Performs the bitwise-or operation with each of the components.
@@ -343,7 +323,7 @@ class TVec4
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec4<T>& operator|=( const U& s );
+    GEL_CONSTEXPR TVec4<T>& operator|=( const U& s );
 
     /**
      * Performs a component-wise bitwise-or operation.
@@ -352,7 +332,7 @@ class TVec4
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec4<T>& operator|=( const TVec4<U>& v );
+    GEL_CONSTEXPR TVec4<T>& operator|=( const TVec4<U>& v );
 
     /**
      * Performs the bitwise-xor operation with each of the components.
@@ -361,7 +341,7 @@ class TVec4
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec4<T>& operator^=( const U& s );
+    GEL_CONSTEXPR TVec4<T>& operator^=( const U& s );
 
     /**
      * Performs a component-wise bitwise-xor operation.
@@ -370,7 +350,7 @@ class TVec4
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec4<T>& operator^=( const TVec4<U>& v );
+    GEL_CONSTEXPR TVec4<T>& operator^=( const TVec4<U>& v );
 
     /**
      * Performs the shift-left operation with each of the components.
@@ -379,7 +359,7 @@ class TVec4
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec4<T>& operator<<=( const U& s );
+    GEL_CONSTEXPR TVec4<T>& operator<<=( const U& s );
 
     /**
      * Performs a component-wise bitwise-shift left operation.
@@ -388,7 +368,7 @@ class TVec4
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec4<T>& operator<<=( const TVec4<U>& v );
+    GEL_CONSTEXPR TVec4<T>& operator<<=( const TVec4<U>& v );
 
     /**
      * Performs the shift-right operation with each of the components.
@@ -397,7 +377,7 @@ class TVec4
      * @tparam U The scalar value type.
      */
     template <typename U>
-    TVec4<T>& operator>>=( const U& s );
+    GEL_CONSTEXPR TVec4<T>& operator>>=( const U& s );
 
     /**
      * Performs a component-wise bitwise-shift right operation.
@@ -406,62 +386,155 @@ class TVec4
      * @tparam U The component value type.
      */
     template <typename U>
-    TVec4<T>& operator>>=( const TVec4<U>& v );
+    GEL_CONSTEXPR TVec4<T>& operator>>=( const TVec4<U>& v );
 
     /**
      * Gets the bitwise inverse vector.
      *
      * @return The bitwise inverse vector.
      */
-    TVec4<T> operator~() const;
+    GEL_CONSTEXPR TVec4<T> operator~() const;
 
     // ACCESSOR OPERATORS
     /**
      * Sets the vector component value at the given index.
      */
-    ValueType& operator[]( Size index );
+    GEL_CONSTEXPR ValueType& operator[]( Size index );
 
     /**
      * Gets the vector component value at the given index.
      */
-    const ValueType& operator[]( Size index ) const;
-};
+    GEL_CONSTEXPR const ValueType& operator[]( Size index ) const;
 
-template <typename T>
-class TRef4
-{
-  public:
-    T& x;
-    T& y;
-    T& z;
-    T& w;
+    // SWIZZLE FUNCTIONS
+    /**
+     * Gets a 2D vector made from the given components of this vector.
+     *
+     * @return The swizzled vector.
+     * @tparam C1 The component to use as the first component.
+     * @tparam C2 The component to use as the second component.
+     */
+    template <VComp C1, VComp C2>
+    GEL_CONSTEXPR TVec2<T> swizzle() const;
+
+    /**
+     * Gets a 3D vector made from the given components of this vector.
+     *
+     * @return The swizzled vector.
+     * @tparam C1 The component to use as the first component.
+     * @tparam C2 The component to use as the second component.
+     * @tparam C3 The component to use as the third component.
+     */
+    template <VComp C1, VComp C2, VComp C3>
+    GEL_CONSTEXPR TVec3<T> swizzle() const;
+
+    /**
+     * Gets a 4D vector made from the given components of this vector.
+     *
+     * @return The swizzled vector.
+     * @tparam C1 The component to use as the first component.
+     * @tparam C2 The component to use as the second component.
+     * @tparam C3 The component to use as the third component.
+     * @tparam C4 The component to use as the fourth component.
+     */
+    template <VComp C1, VComp C2, VComp C3, VComp C4>
+    GEL_CONSTEXPR TVec4<T> swizzle() const;
+
+    /**
+     * Writes the components of a 2D vector to the given components of this
+     * vector, leaving the others unchanged.
+     *
+     * @param v The vector to write.
+     * @tparam C1 The component written by the first component of v.
+     * @tparam C2 The component written by the second component of v.
+     */
+    template <VComp C1, VComp C2>
+    GEL_CONSTEXPR void assign( const TVec2<T>& v );
+
+    /**
+     * Writes the components of a 3D vector to the given components of this
+     * vector, leaving the others unchanged.
+     *
+     * @param v The vector to write.
+     * @tparam C1 The component written by the first component of v.
+     * @tparam C2 The component written by the second component of v.
+     * @tparam C3 The component written by the third component of v.
+     */
+    template <VComp C1, VComp C2, VComp C3>
+    GEL_CONSTEXPR void assign( const TVec3<T>& v );
+
+    /**
+     * Writes the components of a 4D vector to the given components of this
+     * vector, leaving the others unchanged.
+     *
+     * @param v The vector to write.
+     * @tparam C1 The component written by the first component of v.
+     * @tparam C2 The component written by the second component of v.
+     * @tparam C3 The component written by the third component of v.
+     * @tparam C4 The component written by the fourth component of v.
+     */
+    template <VComp C1, VComp C2, VComp C3, VComp C4>
+    GEL_CONSTEXPR void assign( const TVec4<T>& v );
+
+    /**
+     * Gets the vector ( x, y ).
+     */
+    GEL_CONSTEXPR TVec2<T> xy() const;
+
+    /**
+     * Gets the vector ( x, z ).
+     */
+    GEL_CONSTEXPR TVec2<T> xz() const;
+
+    /**
+     * Gets the vector ( y, z ).
+     */
+    GEL_CONSTEXPR TVec2<T> yz() const;
 
-    // CONSTRUCTORS
     /**
-     * Constructs reference vector for the reference components.
-     * @param s1 The first reference component.
-     * @param s2 The second reference component.
-     * @param s3 The third reference component.
-     * @param s3 The fourth reference component.
+     * Gets the vector ( x, y, z ).
      */
-    TRef4( T& s1, T& s2, T& s3, T& s4 );
+    GEL_CONSTEXPR TVec3<T> xyz() const;
 
     /**
-     * Constructs a new reference vector for an existing reference vector.
-     * @param r The reference vector.
+     * Gets the vector ( x, z, y ).
      */
-    TRef4( TRef4<T>& r );
+    GEL_CONSTEXPR TVec3<T> xzy() const;
 
     /**
-     * Constructs a new reference vector for the given vector.
-     * @param v The vector to reference.
+     * Gets the vector ( y, x, z ).
      */
-    TRef4( TVec4<T>& v );
+    GEL_CONSTEXPR TVec3<T> yxz() const;
 
     /**
-     * Destructs the reference vector.
+     * Gets the vector ( y, z, x ).
      */
-    ~TRef4();
+    GEL_CONSTEXPR TVec3<T> yzx() const;
+
+    /**
+     * Gets the vector ( z, x, y ).
+     */
+    GEL_CONSTEXPR TVec3<T> zxy() const;
+
+    /**
+     * Gets the vector ( z, y, x ).
+     */
+    GEL_CONSTEXPR TVec3<T> zyx() const;
+
+    /**
+     * Gets the vector ( r, g, b ).
+     */
+    GEL_CONSTEXPR TVec3<T> rgb() const;
+
+    /**
+     * Gets the vector ( b, g, r ).
+     */
+    GEL_CONSTEXPR TVec3<T> bgr() const;
+
+    /**
+     * Gets the vector ( w, z, y, x ).
+     */
+    GEL_CONSTEXPR TVec4<T> wzyx() const;
 };
 
 // ARITHMETIC BINARY OPERATOR DECLARATIONS
@@ -473,7 +546,7 @@ class TRef4
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator+( const TVec4<T>& v, const T& s );
+GEL_CONSTEXPR TVec4<T> operator+( const TVec4<T>& v, const T& s );
 
 /**
  * Adds the components of two vectors.
@@ -483,7 +556,7 @@ TVec4<T> operator+( const TVec4<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator+( const TVec4<T>& u, const TVec4<T>& v );
+GEL_CONSTEXPR TVec4<T> operator+( const TVec4<T>& u, const TVec4<T>& v );
 
 /**
  * Subtracts a scalar value from the components of a vector.
@@ -493,7 +566,7 @@ TVec4<T> operator+( const TVec4<T>& u, const TVec4<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator-( const TVec4<T>& v, const T& s );
+GEL_CONSTEXPR TVec4<T> operator-( const TVec4<T>& v, const T& s );
 
 /**
  * Subtracts the components of two vectors.
@@ -503,7 +576,7 @@ TVec4<T> operator-( const TVec4<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator-( const TVec4<T>& u, const TVec4<T>& v );
+GEL_CONSTEXPR TVec4<T> operator-( const TVec4<T>& u, const TVec4<T>& v );
 
 /**
  * Multiplies the components of a vector by a scalar value.
@@ -513,7 +586,7 @@ TVec4<T> operator-( const TVec4<T>& u, const TVec4<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator*( const TVec4<T>& v, const T& s );
+GEL_CONSTEXPR TVec4<T> operator*( const TVec4<T>& v, const T& s );
 
 /**
  * Multiplies the components of a vector by a scalar value.
@@ -523,7 +596,7 @@ TVec4<T> operator*( const TVec4<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator*( const T& s, const TVec4<T>& v );
+GEL_CONSTEXPR TVec4<T> operator*( const T& s, const TVec4<T>& v );
 
 /**
  * Multiplies the components of two vectors.
@@ -533,7 +606,7 @@ TVec4<T> operator*( const T& s, const TVec4<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator*( const TVec4<T>& u, const TVec4<T>& v );
+GEL_CONSTEXPR TVec4<T> operator*( const TVec4<T>& u, const TVec4<T>& v );
 
 /**
  * Multiplies the components of a vector by a scalar value.
@@ -543,7 +616,7 @@ TVec4<T> operator*( const TVec4<T>& u, const TVec4<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator/( const TVec4<T>& v, const T& s );
+GEL_CONSTEXPR TVec4<T> operator/( const TVec4<T>& v, const T& s );
 
 /**
  * Multiplies the components of a vector by a scalar value.
@@ -553,7 +626,7 @@ TVec4<T> operator/( const TVec4<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator/( const T& s, const TVec4<T>& v );
+GEL_CONSTEXPR TVec4<T> operator/( const T& s, const TVec4<T>& v );
 
 /**
  * Divides the components of two vectors.
@@ -563,7 +636,7 @@ TVec4<T> operator/( const T& s, const TVec4<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator/( const TVec4<T>& u, const TVec4<T>& v );
+GEL_CONSTEXPR TVec4<T> operator/( const TVec4<T>& u, const TVec4<T>& v );
 
 /**
  * Performs modulus on a vector and a scalar.
@@ -573,7 +646,7 @@ TVec4<T> operator/( const TVec4<T>& u, const TVec4<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator%( const TVec4<T>& v, const T& s );
+GEL_CONSTEXPR TVec4<T> operator%( const TVec4<T>& v, const T& s );
 
 /**
  * Performs modulus on a vector and a scalar.
@@ -583,7 +656,7 @@ TVec4<T> operator%( const TVec4<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator%( const T& s, const TVec4<T>& v );
+GEL_CONSTEXPR TVec4<T> operator%( const T& s, const TVec4<T>& v );
 
 /**
  * Performs modulus on the components of two vectors.
@@ -593,7 +666,7 @@ TVec4<T> operator%( const T& s, const TVec4<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator%( const TVec4<T>& u, const TVec4<T>& v );
+GEL_CONSTEXPR TVec4<T> operator%( const TVec4<T>& u, const TVec4<T>& v );
 
 // BINARY BITWISE OPERATOR DECLARATIONS
 /**
@@ -604,7 +677,7 @@ TVec4<T> operator%( const TVec4<T>& u, const TVec4<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator&( const TVec4<T>& v, const T& s );
+GEL_CONSTEXPR TVec4<T> operator&( const TVec4<T>& v, const T& s );
 
 /**
  * Performs bitwise AND on the components from the two vectors.
@@ -614,7 +687,7 @@ TVec4<T> operator&( const TVec4<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator&( const TVec4<T>& u, const TVec4<T>& v );
+GEL_CONSTEXPR TVec4<T> operator&( const TVec4<T>& u, const TVec4<T>& v );
 
 /**
  * Performs bitwise OR on the components with the scalar.
@@ -624,7 +697,7 @@ TVec4<T> operator&( const TVec4<T>& u, const TVec4<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator|( const TVec4<T>& v, const T& s );
+GEL_CONSTEXPR TVec4<T> operator|( const TVec4<T>& v, const T& s );
 
 /**
  * Performs bitwise OR on the components from the two vectors.
@@ -634,7 +707,7 @@ TVec4<T> operator|( const TVec4<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator|( const TVec4<T>& u, const TVec4<T>& v );
+GEL_CONSTEXPR TVec4<T> operator|( const TVec4<T>& u, const TVec4<T>& v );
 
 
 /**
@@ -645,7 +718,7 @@ TVec4<T> operator|( const TVec4<T>& u, const TVec4<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator^( const TVec4<T>& v, const T& s );
+GEL_CONSTEXPR TVec4<T> operator^( const TVec4<T>& v, const T& s );
 
 /**
  * Performs bitwise XOR on the components from the two vectors.
@@ -655,7 +728,7 @@ TVec4<T> operator^( const TVec4<T>& v, const T& s );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator^( const TVec4<T>& u, const TVec4<T>& v );
+GEL_CONSTEXPR TVec4<T> operator^( const TVec4<T>& u, const TVec4<T>& v );
 
 /**
  * Shifts the bits of the components left.
@@ -665,7 +738,7 @@ TVec4<T> operator^( const TVec4<T>& u, const TVec4<T>& v );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator<<( const TVec4<T>& v, unsigned int shift );
+GEL_CONSTEXPR TVec4<T> operator<<( const TVec4<T>& v, unsigned int shift );
 
 /**
  * Shifts the bits of the components right.
@@ -675,7 +748,7 @@ TVec4<T> operator<<( const TVec4<T>& v, unsigned int shift );
  * @return The resultant vector.
  */
 template <typename T>
-TVec4<T> operator>>( const TVec4<T>& u, unsigned int shift );
+GEL_CONSTEXPR TVec4<T> operator>>( const TVec4<T>& u, unsigned int shift );
 
 // COMPARISON OPERATOR DECLARATIONS
 /**
@@ -686,7 +759,7 @@ TVec4<T> operator>>( const TVec4<T>& u, unsigned int shift );
  * @return If they are equal.
  */
 template <typename T>
-bool operator==( const TVec4<T>& u, const TVec4<T>& v );
+GEL_CONSTEXPR bool operator==( const TVec4<T>& u, const TVec4<T>& v );
 
 /**
  * Checks if the components of two vectors are not equal.
@@ -696,33 +769,27 @@ bool operator==( const TVec4<T>& u, const TVec4<T>& v );
  * @return If they are not equal.
  */
 template <typename T>
-bool operator!=( const TVec4<T>& u, const TVec4<T>& v );
+GEL_CONSTEXPR bool operator!=( const TVec4<T>& u, const TVec4<T>& v );
 
 // IMPLEMENTATION
 
 // IMPLICIT CONSTRUCTORS
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>::TVec4( ) : x( 0 ), y( 0 ), z( 0 ), w( 0 )
 {
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>::TVec4( const TVec4<T>& v ) : x( v.x ), y( v.y ), z( v.z ), w( v.w )
 {
 }
 
-template <typename T>
-inline
-TVec4<T>::~TVec4()
-{
-}
-
 // EXPLICIT CONSTRUCTORS
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>::TVec4( const U& s ) : x( static_cast<T>( s ) ),
                                 y( static_cast<T>( s ) ),
                                 z( static_cast<T>( s ) ),
@@ -732,7 +799,7 @@ TVec4<T>::TVec4( const U& s ) : x( static_cast<T>( s ) ),
 
 template <typename T>
 template <typename U, typename V, typename W, typename X>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>::TVec4( const U& s1, const V& s2, const W& s3, const X& s4 )
     : x( static_cast<T>( s1 ) ), y( static_cast<T>( s2 ) ),
       z( static_cast<T>( s3 ) ), w( static_cast<T>( s4 ) )
@@ -741,7 +808,7 @@ TVec4<T>::TVec4( const U& s1, const V& s2, const W& s3, const X& s4 )
 
 template <typename T>
 template <typename U, typename V, typename W>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>::TVec4( const TVec2<U>& v, const V& s3, const W& s4 )
     : x( static_cast<T>( v.x ) ), y( static_cast<T>( v.y ) ),
       z( static_cast<T>( s3 ) ), w( static_cast<T>( s4 ) )
@@ -750,7 +817,7 @@ TVec4<T>::TVec4( const TVec2<U>& v, const V& s3, const W& s4 )
 
 template <typename T>
 template <typename U, typename V, typename W>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>::TVec4( const U& s1, const TVec2<V>& v, const W& s4 )
     : x( static_cast<T>( s1 ) ), y( static_cast<T>( v.x ) ),
       z( static_cast<T>( v.y ) ), w( static_cast<T>( s4 ) )
@@ -759,7 +826,7 @@ TVec4<T>::TVec4( const U& s1, const TVec2<V>& v, const W& s4 )
 
 template <typename T>
 template <typename U, typename V, typename W>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>::TVec4( const U& s1, const V& s2, const TVec2<W>& v )
     : x( static_cast<T>( s1 ) ), y( static_cast<T>( s2 ) ),
       z( static_cast<T>( v.x ) ), w( static_cast<T>( v.y ) )
@@ -768,7 +835,7 @@ TVec4<T>::TVec4( const U& s1, const V& s2, const TVec2<W>& v )
 
 template <typename T>
 template <typename U, typename V>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>::TVec4( const TVec2<U> v1, const TVec2<V>& v2 )
     : x( static_cast<T>( v1.x ) ), y( static_cast<T>( v1.y ) ),
       z( static_cast<T>( v2.x ) ), w( static_cast<T>( v2.y ) )
@@ -777,7 +844,7 @@ TVec4<T>::TVec4( const TVec2<U> v1, const TVec2<V>& v2 )
 
 template <typename T>
 template <typename U, typename V>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>::TVec4( const TVec3<U>& v, const V& s )
     : x( static_cast<T>( v.x ) ), y( static_cast<T>( v.y ) ),
       z( static_cast<T>( v.z ) ), w( static_cast<T>( s ) )
@@ -786,7 +853,7 @@ TVec4<T>::TVec4( const TVec3<U>& v, const V& s )
 
 template <typename T>
 template <typename U, typename V>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>::TVec4( const U& s, const TVec3<V>& v )
     : x( static_cast<T>( s ) ), y( static_cast<T>( v.x ) ),
       z( static_cast<T>( v.y ) ), w( static_cast<T>( v.z ) )
@@ -795,23 +862,16 @@ TVec4<T>::TVec4( const U& s, const TVec3<V>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>::TVec4( const TVec4<U>& v )
     : x( static_cast<T>( v.x ) ), y( static_cast<T>( v.y ) ),
       z( static_cast<T>( v.z ) ), w( static_cast<T>( v.w ) )
 {
 }
 
-// SWIZZLE CONSTRUCTORS
-template <typename T>
-inline
-TVec4<T>::TVec4( const TRef4<T>& r ) : x( r.x ), y( r.y ), y( r.z ), w( r.w )
-{
-}
-
 // UNARY OPERATORS
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator=( const TVec4<T>& v )
 {
     x = v.x;
@@ -823,7 +883,7 @@ TVec4<T>& TVec4<T>::operator=( const TVec4<T>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator=( const TVec4<U>& v )
 {
     x = static_cast<T>( v.x );
@@ -835,7 +895,7 @@ TVec4<T>& TVec4<T>::operator=( const TVec4<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator+=( const U& s )
 {
     x += static_cast<T>( s );
@@ -847,7 +907,7 @@ TVec4<T>& TVec4<T>::operator+=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator+=( const TVec4<U>& v )
 {
     x += static_cast<T>( v.x );
@@ -859,7 +919,7 @@ TVec4<T>& TVec4<T>::operator+=( const TVec4<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator-=( const U& s )
 {
     x -= static_cast<T>( s );
@@ -871,7 +931,7 @@ TVec4<T>& TVec4<T>::operator-=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator-=( const TVec4<U>& v )
 {
     x -= static_cast<T>( v.x );
@@ -883,7 +943,7 @@ TVec4<T>& TVec4<T>::operator-=( const TVec4<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator*=( const U& s )
 {
     x *= static_cast<T>( s );
@@ -895,7 +955,7 @@ TVec4<T>& TVec4<T>::operator*=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator*=( const TVec4<U>& v )
 {
     x *= static_cast<T>( v.x );
@@ -907,7 +967,7 @@ TVec4<T>& TVec4<T>::operator*=( const TVec4<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator/=( const U& s )
 {
     assert( s != 0 );
@@ -920,7 +980,7 @@ TVec4<T>& TVec4<T>::operator/=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator/=( const TVec4<U>& v )
 {
     assert( v.x != 0 && v.y != 0 && v.z != 0 && v.w != 0 );
@@ -932,7 +992,7 @@ TVec4<T>& TVec4<T>::operator/=( const TVec4<U>& v )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator++()
 {
     ++x;
@@ -943,7 +1003,7 @@ TVec4<T>& TVec4<T>::operator++()
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator--()
 {
     --x;
@@ -954,7 +1014,7 @@ TVec4<T>& TVec4<T>::operator--()
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator++( int )
 {
     ++x;
@@ -965,7 +1025,7 @@ TVec4<T>& TVec4<T>::operator++( int )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator--( int )
 {
     --x;
@@ -976,7 +1036,7 @@ TVec4<T>& TVec4<T>::operator--( int )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> TVec4<T>::operator-() const
 {
     return TVec4<T>( -x, -y, -z, -w );
@@ -984,7 +1044,7 @@ TVec4<T> TVec4<T>::operator-() const
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator%=( const U& s )
 {
     assert( s != 0 );
@@ -997,7 +1057,7 @@ TVec4<T>& TVec4<T>::operator%=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator%=( const TVec4<U>& v )
 {
     assert( v.x != 0 && v.y != 0 && v.z != 0 && v.w != 0 );
@@ -1011,7 +1071,7 @@ TVec4<T>& TVec4<T>::operator%=( const TVec4<U>& v )
 // UNARY BITWISE OPERATORS
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator&=( const U& s )
 {
     x &= static_cast<T>( s );
@@ -1023,7 +1083,7 @@ TVec4<T>& TVec4<T>::operator&=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator&=( const TVec4<U>& v )
 {
     x &= static_cast<T>( v.x );
@@ -1035,7 +1095,7 @@ TVec4<T>& TVec4<T>::operator&=( const TVec4<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator|=( const U& s )
 {
     x |= static_cast<T>( s );
@@ -1047,7 +1107,7 @@ TVec4<T>& TVec4<T>::operator|=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator|=( const TVec4<U>& v )
 {
     x |= static_cast<T>( v.x );
@@ -1059,7 +1119,7 @@ TVec4<T>& TVec4<T>::operator|=( const TVec4<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator^=( const U& s )
 {
     x ^= static_cast<T>( s );
@@ -1071,7 +1131,7 @@ TVec4<T>& TVec4<T>::operator^=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator^=( const TVec4<U>& v )
 {
     x ^= static_cast<T>( v.x );
@@ -1083,7 +1143,7 @@ TVec4<T>& TVec4<T>::operator^=( const TVec4<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator<<=( const U& s )
 {
     x <<= static_cast<T>( s );
@@ -1095,7 +1155,7 @@ TVec4<T>& TVec4<T>::operator<<=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator<<=( const TVec4<U>& v )
 {
     x <<= static_cast<T>( v.x );
@@ -1107,7 +1167,7 @@ TVec4<T>& TVec4<T>::operator<<=( const TVec4<U>& v )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator>>=( const U& s )
 {
     x >>= static_cast<T>( s );
@@ -1119,7 +1179,7 @@ TVec4<T>& TVec4<T>::operator>>=( const U& s )
 
 template <typename T>
 template <typename U>
-inline
+GEL_CONSTEXPR inline
 TVec4<T>& TVec4<T>::operator>>=( const TVec4<U>& v )
 {
     x >>= static_cast<T>( v.x );
@@ -1130,7 +1190,7 @@ TVec4<T>& TVec4<T>::operator>>=( const TVec4<U>& v )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> TVec4<T>::operator~() const
 {
     return TVec4<T>( ~x, ~y, ~z, ~w );
@@ -1138,73 +1198,234 @@ TVec4<T> TVec4<T>::operator~() const
 
 // ACCESSOR OPERATORS
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 const T& TVec4<T>::operator[]( Size index ) const
 {
-    assert( index >= 0 && index < 4 );
+    assert( index < 4 );
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return index == 0 ? x : index == 1 ? y : index == 2 ? z : w;
+    }
+
     return ( &x )[index];
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 T& TVec4<T>::operator[]( Size index )
 {
-    assert( index >= 0 && index < 4 );
+    assert( index < 4 );
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return index == 0 ? x : index == 1 ? y : index == 2 ? z : w;
+    }
+
     return ( &x )[index];
 }
 
+// SWIZZLE FUNCTIONS
+template <typename T>
+template <VComp C1, VComp C2>
+GEL_CONSTEXPR inline
+TVec2<T> TVec4<T>::swizzle() const
+{
+    return TVec2<T>( ( *this )[SwizzleIndex<C1>::VALUE],
+                     ( *this )[SwizzleIndex<C2>::VALUE] );
+}
+
+template <typename T>
+template <VComp C1, VComp C2, VComp C3>
+GEL_CONSTEXPR inline
+TVec3<T> TVec4<T>::swizzle() const
+{
+    return TVec3<T>( ( *this )[SwizzleIndex<C1>::VALUE],
+                     ( *this )[SwizzleIndex<C2>::VALUE],
+                     ( *this )[SwizzleIndex<C3>::VALUE] );
+}
+
+template <typename T>
+template <VComp C1, VComp C2, VComp C3, VComp C4>
+GEL_CONSTEXPR inline
+TVec4<T> TVec4<T>::swizzle() const
+{
+    return TVec4<T>( ( *this )[SwizzleIndex<C1>::VALUE],
+                     ( *this )[SwizzleIndex<C2>::VALUE],
+                     ( *this )[SwizzleIndex<C3>::VALUE],
+                     ( *this )[SwizzleIndex<C4>::VALUE] );
+}
+
+template <typename T>
+template <VComp C1, VComp C2>
+GEL_CONSTEXPR inline
+void TVec4<T>::assign( const TVec2<T>& v )
+{
+    static_assert( SwizzleMask<C1, C2>::UNIQUE2,
+                   "component written twice" );
+    ( *this )[SwizzleIndex<C1>::VALUE] = v.x;
+    ( *this )[SwizzleIndex<C2>::VALUE] = v.y;
+}
+
+template <typename T>
+template <VComp C1, VComp C2, VComp C3>
+GEL_CONSTEXPR inline
+void TVec4<T>::assign( const TVec3<T>& v )
+{
+    static_assert( SwizzleMask<C1, C2, C3>::UNIQUE3,
+                   "component written twice" );
+    ( *this )[SwizzleIndex<C1>::VALUE] = v.x;
+    ( *this )[SwizzleIndex<C2>::VALUE] = v.y;
+    ( *this )[SwizzleIndex<C3>::VALUE] = v.z;
+}
+
+template <typename T>
+template <VComp C1, VComp C2, VComp C3, VComp C4>
+GEL_CONSTEXPR inline
+void TVec4<T>::assign( const TVec4<T>& v )
+{
+    static_assert( SwizzleMask<C1, C2, C3, C4>::UNIQUE4,
+                   "component written twice" );
+    ( *this )[SwizzleIndex<C1>::VALUE] = v.x;
+    ( *this )[SwizzleIndex<C2>::VALUE] = v.y;
+    ( *this )[SwizzleIndex<C3>::VALUE] = v.z;
+    ( *this )[SwizzleIndex<C4>::VALUE] = v.w;
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec2<T> TVec4<T>::xy() const
+{
+    return swizzle<X, Y>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec2<T> TVec4<T>::xz() const
+{
+    return swizzle<X, Z>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec2<T> TVec4<T>::yz() const
+{
+    return swizzle<Y, Z>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> TVec4<T>::xyz() const
+{
+    return swizzle<X, Y, Z>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> TVec4<T>::xzy() const
+{
+    return swizzle<X, Z, Y>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> TVec4<T>::yxz() const
+{
+    return swizzle<Y, X, Z>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> TVec4<T>::yzx() const
+{
+    return swizzle<Y, Z, X>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> TVec4<T>::zxy() const
+{
+    return swizzle<Z, X, Y>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> TVec4<T>::zyx() const
+{
+    return swizzle<Z, Y, X>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> TVec4<T>::rgb() const
+{
+    return swizzle<R, G, B>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec3<T> TVec4<T>::bgr() const
+{
+    return swizzle<B, G, R>();
+}
+
+template <typename T>
+GEL_CONSTEXPR inline
+TVec4<T> TVec4<T>::wzyx() const
+{
+    return swizzle<W, Z, Y, X>();
+}
+
 // BINARY ARITHMETIC OPERATORS
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator+( const TVec4<T>& v, const T& s )
 {
     return TVec4<T>( v.x + s, v.y + s, v.z + s, v.w + s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator+( const TVec4<T>& u, const TVec4<T>& v )
 {
     return TVec4<T>( u.x + v.x, u.y + v.y, u.z + v.z, u.w + v.w );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator-( const TVec4<T>& v, const T& s )
 {
     return TVec4<T>( v.x - s, v.y - s, v.z - s, v.w - s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator-( const TVec4<T>& u, const TVec4<T>& v )
 {
     return TVec4<T>( u.x - v.x, u.y - v.y, u.z - v.z, u.w - v.w );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator*( const TVec4<T>& v, const T& s )
 {
     return TVec4<T>( v.x * s, v.y * s, v.z * s, v.w * s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator*( const T& s, const TVec4<T>& v )
 {
     return TVec4<T>( s * v.x, s * v.y, s * v.z, s * v.w );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator*( const TVec4<T>& u, const TVec4<T>& v )
 {
     return TVec4<T>( u.x * v.x, u.y * v.y, u.z * v.z, u.w * v.w );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator/( const TVec4<T>& v, const T& s )
 {
     assert( s != T( 0 ) );
@@ -1212,7 +1433,7 @@ TVec4<T> operator/( const TVec4<T>& v, const T& s )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator/( const T& s, const TVec4<T>& v )
 {
     assert( v.x != 0 && v.y != 0 && v.z != 0 && v.w != 0 );
@@ -1220,7 +1441,7 @@ TVec4<T> operator/( const T& s, const TVec4<T>& v )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator/( const TVec4<T>& u, const TVec4<T>& v )
 {
     assert ( v.x != 0 && v.y != 0 && v.z != 0 && v.w != 0 );
@@ -1228,7 +1449,7 @@ TVec4<T> operator/( const TVec4<T>& u, const TVec4<T>& v )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator%( const TVec4<T>& v, const T& s )
 {
     assert( s != 0 );
@@ -1236,7 +1457,7 @@ TVec4<T> operator%( const TVec4<T>& v, const T& s )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator%( const T& s, const TVec4<T>& v )
 {
     assert( v.x != 0 && v.y != 0 && v.z != 0 && v.w != 0 );
@@ -1244,7 +1465,7 @@ TVec4<T> operator%( const T& s, const TVec4<T>& v )
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator%( const TVec4<T>& u, const TVec4<T>& v )
 {
     assert ( v.x != 0 && v.y != 0 && v.z != 0 && v.w != 0 );
@@ -1253,147 +1474,79 @@ TVec4<T> operator%( const TVec4<T>& u, const TVec4<T>& v )
 
 // BINARY BITWISE OPERATORS
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator&( const TVec4<T>& v, const T& s )
 {
     return TVec4<T>( v.x & s, v.y & s, v.z & s, v.w & s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator&( const TVec4<T>& u, const TVec4<T>& v )
 {
     return TVec4<T>( u.x & v.x, u.y & v.y, u.z & v.z, u.w & v.w );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator|( const TVec4<T>& v, const T& s )
 {
     return TVec4<T>( v.x | s, v.y | s, v.z | s, v.w | s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator|( const TVec4<T>& u, const TVec4<T>& v )
 {
     return TVec4<T>( u.x | v.x, u.y | v.y, u.z | v.z, u.w | v.w );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator^( const TVec4<T>& v, const T& s )
 {
     return TVec4<T>( v.x ^ s, v.y ^ s, v.z ^ s, v.w ^ s );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator^( const TVec4<T>& u, const TVec4<T>& v )
 {
     return TVec4<T>( u.x ^ v.x, u.y ^ v.y, u.z ^ v.z, u.w ^ v.w );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator<<( const TVec4<T>& v, unsigned int shift )
 {
     return TVec4<T>( v.x << shift, v.y << shift, v.z << shift, v.w << shift );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 TVec4<T> operator>>( const TVec4<T>& u, unsigned int shift )
 {
     return TVec4<T>( u.x >> shift, u.y >> shift, u.z >> shift, u.w >> shift );
 }
 
 template <typename T>
-inline
+GEL_CONSTEXPR inline
 bool operator==( const TVec4<T>& u, const TVec4<T>& v )
 {
     return u.x == v.x && u.y == v.y && u.z == v.z && u.w == v.w;
 }
 
 template <typename T>
-inline
-bool operator==( const TVec4<T>& u, const TRef4<T>& v )
-{
-    return u.x == v.x || u.y == v.y || u.z == v.z || u.w == v.w;
-}
-
-template <typename T>
-inline
-bool operator==( const TRef4<T>& u, const TVec4<T>& v )
-{
-    return u.x == v.x || u.y == v.y || u.z == v.z || u.w == v.w;
-}
-
-template <typename T>
-inline
-bool operator==( const TRef4<T>& u, const TRef4<T>& v )
-{
-    return u.x == v.x || u.y == v.y || u.z == v.z || u.w == v.w;
-}
-
-template <typename T>
-inline
+GEL_CONSTEXPR inline
 bool operator!=( const TVec4<T>& u, const TVec4<T>& v )
 {
     return u.x != v.x || u.y != v.y || u.z != v.z || u.w != v.w;
 }
 
-template <typename T>
-inline
-bool operator!=( const TVec4<T>& u, const TRef4<T>& v )
-{
-    return u.x != v.x || u.y != v.y || u.z != v.z || u.w != v.w;
-}
-
-template <typename T>
-inline
-bool operator!=( const TRef4<T>& u, const TVec4<T>& v )
-{
-    return u.x != v.x || u.y != v.y || u.z != v.z || u.w != v.w;
-}
-
-template <typename T>
-inline
-bool operator!=( const TRef4<T>& u, const TRef4<T>& v )
-{
-    return u.x != v.x || u.y != v.y || u.z != v.z || u.w != v.w;
-}
-
-// 4D REFERENCE VECTOR
-
-// CONSTRUCTORS
-template <typename T>
-inline
-TRef4<T>::TRef4( T& s1, T& s2, T& s3, T& s4 ) : x( s1 ), y( s2 ), z( s3 ),
-                                                w( s4 )
-{
-}
-
-template <typename T>
-inline
-TRef4<T>::TRef4( TRef4<T>& r ) : x( r.x ), y( r.y ), z( r.z ), w( r.w )
-{
-}
-
-template <typename T>
-inline
-TRef4<T>::TRef4( TVec4<T>& v ) : x( v.x ), y( v.y ), z( v.z ), w( v.w )
-{
-}
-
-template <typename T>
-inline
-TRef4<T>::~TRef4()
-{
-}
-
 } // End nspc math
 
 } // End nspc gel
 
+#include "gel/math/vec4_simd.h"
+
 #endif //GEL_VEC4_H
@@ -0,0 +1,1139 @@
+// vec4_simd.h
+#ifndef GEL_VEC4_SIMD_H
+#define GEL_VEC4_SIMD_H
+#include <assert.h>
+#include "gel/gellib.h"
+#include "gel/math/simd.h"
+#include "gel/math/vec2.h"
+#include "gel/math/vec3.h"
+#include "gel/math/vec4.h"
+
+namespace gel
+{
+
+namespace math
+{
+
+/**
+ * @brief Defines the SIMD specialization of the 4D float vector.
+ *
+ * The components share storage with a SIMD register so the arithmetic,
+ * comparison and negation operators each lower to a single packed
+ * instruction. The bitwise and modulus operators of the generic vector are
+ * not provided as they are undefined for floating point values.
+ */
+template <>
+class alignas( 16 ) TVec4<float>
+{
+  public:
+    typedef float ValueType;
+
+    union
+    {
+        struct { ValueType x, y, z, w; };
+        struct { ValueType r, g, b, a; };
+        struct { ValueType s, t, p, q; };
+        struct { ValueType i, j, k, l; };
+        struct { ValueType hue, lum, sat, alpha; };
+        simd::Float4 m;
+    };
+
+    // IMPLICIT CONSTRUCTORS
+    /**
+     * Constructs a new vector.
+     */
+    GEL_CONSTEXPR TVec4();
+
+    /**
+     * Constructs this vector as a copy of the other.
+     *
+     * @param v The vector to copy.
+     */
+    GEL_CONSTEXPR TVec4( const TVec4<float>& v );
+
+    /**
+     * Constructs a vector from a SIMD register.
+     *
+     * @param m The register.
+     */
+    TVec4( const simd::Float4& m );
+
+    // EXPLICIT CONSTRUCTORS
+    /**
+     * Constructs a new vector and initializes its components to v.
+     *
+     * @param v The component value.
+     * @tparam U The component value type.
+     */
+    template <typename U>
+    GEL_CONSTEXPR explicit TVec4( const U& s );
+
+    /**
+     * Constructs a new vector.
+     *
+     * @param s1 The first component value.
+     * @param s2 The second component value
+     * @param s3 The third component value.
+     * @param s4 The fourth component value.
+     * @tparam U The first component value type.
+     * @tparam V The second component value type.
+     * @tparam W The third component value type.
+     * @tparam X The fourth component value type.
+     */
+    template <typename U, typename V, typename W, typename X>
+    GEL_CONSTEXPR
+    explicit TVec4( const U& s1, const V& s2, const W& s3, const X& s4 );
+
+    /**
+     * Constructs a copy of the vector with the given last component values.
+     *
+     * @param v The vector to copy.
+     * @param s3 The third component value.
+     * @param s4 The fourth component value.
+     */
+    template <typename U, typename V, typename W>
+    GEL_CONSTEXPR explicit TVec4( const TVec2<U>& v, const V& s3, const W& s4 );
+
+    /**
+     * Constructs a copy of the vector with the given outer component values.
+     *
+     * @param s1 The first component value.
+     * @param v The vector to copy.
+     * @param s4 The fourth component value.
+     */
+    template <typename U, typename V, typename W>
+    GEL_CONSTEXPR explicit TVec4( const U& s1, const TVec2<V>& v, const W& s4 );
+
+    /**
+     * Constructs a copy of the vector with the given first component values.
+     *
+     * @param s1 The first component value.
+     * @param s2 The second component value.
+     * @param v The vector to copy.
+     */
+    template <typename U, typename V, typename W>
+    GEL_CONSTEXPR explicit TVec4( const U& s1, const V& s2, const TVec2<W>& v );
+
+    /**
+     * Constructs a composition of the two given vectors.
+     *
+     * @param v1 The first vector to copy.
+     * @param v2 The second vector to copy.
+     */
+    template <typename U, typename V>
+    GEL_CONSTEXPR explicit TVec4( const TVec2<U> v1, const TVec2<V>& v2 );
+
+    /**
+     * Constructs a copy of the vector with the given first component value.
+     *
+     * @param s The first component value.
+     * @param v The vector to copy.
+     */
+    template <typename U, typename V>
+    GEL_CONSTEXPR explicit TVec4( const U& s, const TVec3<V>& v );
+
+    /**
+     * Constructs a copy of the vector with the given fourth component value.
+     *
+     * @param v The vector to copy.
+     * @param s The fourth component value.
+     */
+    template <typename U, typename V>
+    GEL_CONSTEXPR explicit TVec4( const TVec3<U>& v, const V& s );
+
+    /**
+     * Constructs a copy of the vector.
+     *
+     * @param v The vector to copy.
+     * @tparam U The component type.
+     */
+    template <typename U>
+    GEL_CONSTEXPR explicit TVec4( const TVec4<U>& v );
+
+    // UNARY OPERATORS
+    /**
+     * Makes this a copy of the other vector.
+     *
+     * @param v The vector to copy.
+     */
+    GEL_CONSTEXPR TVec4<float>& operator=( const TVec4<float>& v );
+
+    /**
+     * Makes this a copy of the other vector.
+     *
+     * @param v The vector to copy.
+     * @tparam U The component value type.
+     */
+    template <typename U>
+    GEL_CONSTEXPR TVec4<float>& operator=( const TVec4<U>& v );
+
+    /**
+     * Adds a scalar value to the components.
+     *
+     * @param s The scalar value to add.
+     * @tparam U The scalar value type.
+     */
+    template <typename U>
+    GEL_CONSTEXPR TVec4<float>& operator+=( const U& s );
+
+    /**
+     * Adds another vector to this.
+     *
+     * @param v The vector to add.
+     */
+    GEL_CONSTEXPR TVec4<float>& operator+=( const TVec4<float>& v );
+
+    /**
+     * Adds another vector to this.
+     *
+     * @param v The vector to add.
+     * @tparam U The component value type.
+     */
+    template <typename U>
+    GEL_CONSTEXPR TVec4<float>& operator+=( const TVec4<U>& v );
+
+    /**
+     * Subtracts a scalar from the components.
+     *
+     * @param s The scalar to subtract.
+     * @tparam U The scalar value type.
+     */
+    template <typename U>
+    GEL_CONSTEXPR TVec4<float>& operator-=( const U& s );
+
+    /**
+     * Subtracts another vector from this.
+     *
+     * @param v The vector to subtract.
+     */
+    GEL_CONSTEXPR TVec4<float>& operator-=( const TVec4<float>& v );
+
+    /**
+     * Subtracts another vector from this.
+     *
+     * @param v The vector to subtract.
+     * @tparam U The component value type.
+     */
+    template <typename U>
+    GEL_CONSTEXPR TVec4<float>& operator-=( const TVec4<U>& v );
+
+    /**
+     * Multiplies the this by a scalar.
+     *
+     * @param s The scalar to multiply by.
+     * @tparam U The scalar value type.
+     */
+    template <typename U>
+    GEL_CONSTEXPR TVec4<float>& operator*=( const U& s );
+
+    /**
+     * Multiplies this vector by another.
+     *
+     * @param v The vector to multiply by.
+     */
+    GEL_CONSTEXPR TVec4<float>& operator*=( const TVec4<float>& v );
+
+    /**
+     * Multiplies this vector by another.
+     *
+     * @param v The vector to multiply by.
+     * @tparam U The component value type.
+     */
+    template <typename U>
+    GEL_CONSTEXPR TVec4<float>& operator*=( const TVec4<U>& v );
+
+    /**
+     * Divides this vector by a scalar.
+     *
+     * @param s The scalar to divide by.
+     * @tparam U The scalar value type.
+     */
+    template <typename U>
+    GEL_CONSTEXPR TVec4<float>& operator/=( const U& s );
+
+    /**
+     * Divides this vector by another.
+     *
+     * @param v The vector to divide by.
+     */
+    GEL_CONSTEXPR TVec4<float>& operator/=( const TVec4<float>& v );
+
+    /**
+     * Divides this vector by another.
+     *
+     * @param v The vector to divide by.
+     * @tparam U The component value type.
+     */
+    template <typename U>
+    GEL_CONSTEXPR TVec4<float>& operator/=( const TVec4<U>& v );
+
+    /**
+     * Adds one to the vector's component values.
+     *
+     * @return The resultant vector.
+     */
+    GEL_CONSTEXPR TVec4<float>& operator++( );
+
+    /**
+     * Subtracts one from the vector's component values.
+     *
+     * @return The resultant vector.
+     */
+    GEL_CONSTEXPR TVec4<float>& operator--( );
+
+    /**
+     * Adds one to the vector's component values.
+     *
+     * @return The resultant vector.
+     */
+    GEL_CONSTEXPR TVec4<float>& operator++( int );
+
+    /**
+     * Subtracts one from the vector's component values.
+     *
+     * @return The resultant vector.
+     */
+    GEL_CONSTEXPR TVec4<float>& operator--( int );
+
+    /**
+     * Multiplies the vector by negative one.
+     *
+     * @return The negative vector.
+     */
+    GEL_CONSTEXPR TVec4<float> operator-() const;
+
+    // ACCESSOR OPERATORS
+    /**
+     * Sets the vector component value at the given index.
+     */
+    GEL_CONSTEXPR ValueType& operator[]( Size index );
+
+    /**
+     * Gets the vector component value at the given index.
+     */
+    GEL_CONSTEXPR const ValueType& operator[]( Size index ) const;
+
+    // SWIZZLE FUNCTIONS
+    /**
+     * Gets a 2D vector made from the given components of this vector.
+     *
+     * @return The swizzled vector.
+     * @tparam C1 The component to use as the first component.
+     * @tparam C2 The component to use as the second component.
+     */
+    template <VComp C1, VComp C2>
+    GEL_CONSTEXPR TVec2<float> swizzle() const;
+
+    /**
+     * Gets a 3D vector made from the given components of this vector.
+     *
+     * @return The swizzled vector.
+     * @tparam C1 The component to use as the first component.
+     * @tparam C2 The component to use as the second component.
+     * @tparam C3 The component to use as the third component.
+     */
+    template <VComp C1, VComp C2, VComp C3>
+    GEL_CONSTEXPR TVec3<float> swizzle() const;
+
+    /**
+     * Gets a 4D vector made from the given components of this vector.
+     *
+     * @return The swizzled vector.
+     * @tparam C1 The component to use as the first component.
+     * @tparam C2 The component to use as the second component.
+     * @tparam C3 The component to use as the third component.
+     * @tparam C4 The component to use as the fourth component.
+     */
+    template <VComp C1, VComp C2, VComp C3, VComp C4>
+    GEL_CONSTEXPR TVec4<float> swizzle() const;
+
+    /**
+     * Writes the components of a 2D vector to the given components of this
+     * vector, leaving the others unchanged.
+     *
+     * @param v The vector to write.
+     * @tparam C1 The component written by the first component of v.
+     * @tparam C2 The component written by the second component of v.
+     */
+    template <VComp C1, VComp C2>
+    GEL_CONSTEXPR void assign( const TVec2<float>& v );
+
+    /**
+     * Writes the components of a 3D vector to the given components of this
+     * vector, leaving the others unchanged.
+     *
+     * @param v The vector to write.
+     * @tparam C1 The component written by the first component of v.
+     * @tparam C2 The component written by the second component of v.
+     * @tparam C3 The component written by the third component of v.
+     */
+    template <VComp C1, VComp C2, VComp C3>
+    GEL_CONSTEXPR void assign( const TVec3<float>& v );
+
+    /**
+     * Writes the components of a 4D vector to the given components of this
+     * vector, leaving the others unchanged.
+     *
+     * @param v The vector to write.
+     * @tparam C1 The component written by the first component of v.
+     * @tparam C2 The component written by the second component of v.
+     * @tparam C3 The component written by the third component of v.
+     * @tparam C4 The component written by the fourth component of v.
+     */
+    template <VComp C1, VComp C2, VComp C3, VComp C4>
+    GEL_CONSTEXPR void assign( const TVec4<float>& v );
+
+    /**
+     * Gets the vector ( x, y ).
+     */
+    GEL_CONSTEXPR TVec2<float> xy() const;
+
+    /**
+     * Gets the vector ( x, z ).
+     */
+    GEL_CONSTEXPR TVec2<float> xz() const;
+
+    /**
+     * Gets the vector ( y, z ).
+     */
+    GEL_CONSTEXPR TVec2<float> yz() const;
+
+    /**
+     * Gets the vector ( x, y, z ).
+     */
+    GEL_CONSTEXPR TVec3<float> xyz() const;
+
+    /**
+     * Gets the vector ( x, z, y ).
+     */
+    GEL_CONSTEXPR TVec3<float> xzy() const;
+
+    /**
+     * Gets the vector ( y, x, z ).
+     */
+    GEL_CONSTEXPR TVec3<float> yxz() const;
+
+    /**
+     * Gets the vector ( y, z, x ).
+     */
+    GEL_CONSTEXPR TVec3<float> yzx() const;
+
+    /**
+     * Gets the vector ( z, x, y ).
+     */
+    GEL_CONSTEXPR TVec3<float> zxy() const;
+
+    /**
+     * Gets the vector ( z, y, x ).
+     */
+    GEL_CONSTEXPR TVec3<float> zyx() const;
+
+    /**
+     * Gets the vector ( r, g, b ).
+     */
+    GEL_CONSTEXPR TVec3<float> rgb() const;
+
+    /**
+     * Gets the vector ( b, g, r ).
+     */
+    GEL_CONSTEXPR TVec3<float> bgr() const;
+
+    /**
+     * Gets the vector ( w, z, y, x ).
+     */
+    GEL_CONSTEXPR TVec4<float> wzyx() const;
+};
+
+// IMPLEMENTATION
+
+// IMPLICIT CONSTRUCTORS
+GEL_CONSTEXPR inline
+TVec4<float>::TVec4( ) : x( 0 ), y( 0 ), z( 0 ), w( 0 )
+{
+}
+
+GEL_CONSTEXPR inline
+TVec4<float>::TVec4( const TVec4<float>& v )
+    : x( v.x ), y( v.y ), z( v.z ), w( v.w )
+{
+}
+
+inline
+TVec4<float>::TVec4( const simd::Float4& m ) : m( m )
+{
+}
+
+// EXPLICIT CONSTRUCTORS
+template <typename U>
+GEL_CONSTEXPR inline
+TVec4<float>::TVec4( const U& s )
+    : x( static_cast<float>( s ) ), y( static_cast<float>( s ) ),
+      z( static_cast<float>( s ) ), w( static_cast<float>( s ) )
+{
+}
+
+template <typename U, typename V, typename W, typename X>
+GEL_CONSTEXPR inline
+TVec4<float>::TVec4( const U& s1, const V& s2, const W& s3, const X& s4 )
+    : x( static_cast<float>( s1 ) ), y( static_cast<float>( s2 ) ),
+      z( static_cast<float>( s3 ) ), w( static_cast<float>( s4 ) )
+{
+}
+
+template <typename U, typename V, typename W>
+GEL_CONSTEXPR inline
+TVec4<float>::TVec4( const TVec2<U>& v, const V& s3, const W& s4 )
+    : x( static_cast<float>( v.x ) ), y( static_cast<float>( v.y ) ),
+      z( static_cast<float>( s3 ) ), w( static_cast<float>( s4 ) )
+{
+}
+
+template <typename U, typename V, typename W>
+GEL_CONSTEXPR inline
+TVec4<float>::TVec4( const U& s1, const TVec2<V>& v, const W& s4 )
+    : x( static_cast<float>( s1 ) ), y( static_cast<float>( v.x ) ),
+      z( static_cast<float>( v.y ) ), w( static_cast<float>( s4 ) )
+{
+}
+
+template <typename U, typename V, typename W>
+GEL_CONSTEXPR inline
+TVec4<float>::TVec4( const U& s1, const V& s2, const TVec2<W>& v )
+    : x( static_cast<float>( s1 ) ), y( static_cast<float>( s2 ) ),
+      z( static_cast<float>( v.x ) ), w( static_cast<float>( v.y ) )
+{
+}
+
+template <typename U, typename V>
+GEL_CONSTEXPR inline
+TVec4<float>::TVec4( const TVec2<U> v1, const TVec2<V>& v2 )
+    : x( static_cast<float>( v1.x ) ), y( static_cast<float>( v1.y ) ),
+      z( static_cast<float>( v2.x ) ), w( static_cast<float>( v2.y ) )
+{
+}
+
+template <typename U, typename V>
+GEL_CONSTEXPR inline
+TVec4<float>::TVec4( const TVec3<U>& v, const V& s )
+    : x( static_cast<float>( v.x ) ), y( static_cast<float>( v.y ) ),
+      z( static_cast<float>( v.z ) ), w( static_cast<float>( s ) )
+{
+}
+
+template <typename U, typename V>
+GEL_CONSTEXPR inline
+TVec4<float>::TVec4( const U& s, const TVec3<V>& v )
+    : x( static_cast<float>( s ) ), y( static_cast<float>( v.x ) ),
+      z( static_cast<float>( v.y ) ), w( static_cast<float>( v.z ) )
+{
+}
+
+template <typename U>
+GEL_CONSTEXPR inline
+TVec4<float>::TVec4( const TVec4<U>& v )
+    : x( static_cast<float>( v.x ) ), y( static_cast<float>( v.y ) ),
+      z( static_cast<float>( v.z ) ), w( static_cast<float>( v.w ) )
+{
+}
+
+// UNARY OPERATORS
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator=( const TVec4<float>& v )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        x = v.x;
+        y = v.y;
+        z = v.z;
+        w = v.w;
+        return *this;
+    }
+
+    m = v.m;
+    return *this;
+}
+
+template <typename U>
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator=( const TVec4<U>& v )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        x = static_cast<float>( v.x );
+        y = static_cast<float>( v.y );
+        z = static_cast<float>( v.z );
+        w = static_cast<float>( v.w );
+        return *this;
+    }
+
+    m = simd::set( static_cast<float>( v.x ), static_cast<float>( v.y ),
+                   static_cast<float>( v.z ), static_cast<float>( v.w ) );
+    return *this;
+}
+
+template <typename U>
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator+=( const U& s )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        x += static_cast<float>( s );
+        y += static_cast<float>( s );
+        z += static_cast<float>( s );
+        w += static_cast<float>( s );
+        return *this;
+    }
+
+    m = simd::add( m, simd::set1( static_cast<float>( s ) ) );
+    return *this;
+}
+
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator+=( const TVec4<float>& v )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        x += v.x;
+        y += v.y;
+        z += v.z;
+        w += v.w;
+        return *this;
+    }
+
+    m = simd::add( m, v.m );
+    return *this;
+}
+
+template <typename U>
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator+=( const TVec4<U>& v )
+{
+    return *this += TVec4<float>( v );
+}
+
+template <typename U>
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator-=( const U& s )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        x -= static_cast<float>( s );
+        y -= static_cast<float>( s );
+        z -= static_cast<float>( s );
+        w -= static_cast<float>( s );
+        return *this;
+    }
+
+    m = simd::sub( m, simd::set1( static_cast<float>( s ) ) );
+    return *this;
+}
+
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator-=( const TVec4<float>& v )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        x -= v.x;
+        y -= v.y;
+        z -= v.z;
+        w -= v.w;
+        return *this;
+    }
+
+    m = simd::sub( m, v.m );
+    return *this;
+}
+
+template <typename U>
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator-=( const TVec4<U>& v )
+{
+    return *this -= TVec4<float>( v );
+}
+
+template <typename U>
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator*=( const U& s )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        x *= static_cast<float>( s );
+        y *= static_cast<float>( s );
+        z *= static_cast<float>( s );
+        w *= static_cast<float>( s );
+        return *this;
+    }
+
+    m = simd::mul( m, simd::set1( static_cast<float>( s ) ) );
+    return *this;
+}
+
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator*=( const TVec4<float>& v )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        x *= v.x;
+        y *= v.y;
+        z *= v.z;
+        w *= v.w;
+        return *this;
+    }
+
+    m = simd::mul( m, v.m );
+    return *this;
+}
+
+template <typename U>
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator*=( const TVec4<U>& v )
+{
+    return *this *= TVec4<float>( v );
+}
+
+template <typename U>
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator/=( const U& s )
+{
+    assert( s != 0 );
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        x /= static_cast<float>( s );
+        y /= static_cast<float>( s );
+        z /= static_cast<float>( s );
+        w /= static_cast<float>( s );
+        return *this;
+    }
+
+    m = simd::div( m, simd::set1( static_cast<float>( s ) ) );
+    return *this;
+}
+
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator/=( const TVec4<float>& v )
+{
+    assert( v.x != 0 && v.y != 0 && v.z != 0 && v.w != 0 );
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        x /= v.x;
+        y /= v.y;
+        z /= v.z;
+        w /= v.w;
+        return *this;
+    }
+
+    m = simd::div( m, v.m );
+    return *this;
+}
+
+template <typename U>
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator/=( const TVec4<U>& v )
+{
+    return *this /= TVec4<float>( v );
+}
+
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator++()
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        x += 1;
+        y += 1;
+        z += 1;
+        w += 1;
+        return *this;
+    }
+
+    m = simd::add( m, simd::set1( 1.0f ) );
+    return *this;
+}
+
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator--()
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        x -= 1;
+        y -= 1;
+        z -= 1;
+        w -= 1;
+        return *this;
+    }
+
+    m = simd::sub( m, simd::set1( 1.0f ) );
+    return *this;
+}
+
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator++( int )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        x += 1;
+        y += 1;
+        z += 1;
+        w += 1;
+        return *this;
+    }
+
+    m = simd::add( m, simd::set1( 1.0f ) );
+    return *this;
+}
+
+GEL_CONSTEXPR inline
+TVec4<float>& TVec4<float>::operator--( int )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        x -= 1;
+        y -= 1;
+        z -= 1;
+        w -= 1;
+        return *this;
+    }
+
+    m = simd::sub( m, simd::set1( 1.0f ) );
+    return *this;
+}
+
+GEL_CONSTEXPR inline
+TVec4<float> TVec4<float>::operator-() const
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return TVec4<float>( -x, -y, -z, -w );
+    }
+
+    return TVec4<float>( simd::neg( m ) );
+}
+
+// ACCESSOR OPERATORS
+GEL_CONSTEXPR inline
+const float& TVec4<float>::operator[]( Size index ) const
+{
+    assert( index < 4 );
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return index == 0 ? x : index == 1 ? y : index == 2 ? z : w;
+    }
+
+    return ( &x )[index];
+}
+
+GEL_CONSTEXPR inline
+float& TVec4<float>::operator[]( Size index )
+{
+    assert( index < 4 );
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return index == 0 ? x : index == 1 ? y : index == 2 ? z : w;
+    }
+
+    return ( &x )[index];
+}
+
+// SWIZZLE FUNCTIONS
+template <VComp C1, VComp C2>
+GEL_CONSTEXPR inline
+TVec2<float> TVec4<float>::swizzle() const
+{
+    return TVec2<float>( ( *this )[SwizzleIndex<C1>::VALUE],
+                         ( *this )[SwizzleIndex<C2>::VALUE] );
+}
+
+template <VComp C1, VComp C2, VComp C3>
+GEL_CONSTEXPR inline
+TVec3<float> TVec4<float>::swizzle() const
+{
+    return TVec3<float>( ( *this )[SwizzleIndex<C1>::VALUE],
+                         ( *this )[SwizzleIndex<C2>::VALUE],
+                         ( *this )[SwizzleIndex<C3>::VALUE] );
+}
+
+template <VComp C1, VComp C2, VComp C3, VComp C4>
+GEL_CONSTEXPR inline
+TVec4<float> TVec4<float>::swizzle() const
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return TVec4<float>( ( *this )[SwizzleIndex<C1>::VALUE],
+                             ( *this )[SwizzleIndex<C2>::VALUE],
+                             ( *this )[SwizzleIndex<C3>::VALUE],
+                             ( *this )[SwizzleIndex<C4>::VALUE] );
+    }
+
+    return TVec4<float>( simd::shuffle<SwizzleIndex<C1>::VALUE,
+                                       SwizzleIndex<C2>::VALUE,
+                                       SwizzleIndex<C3>::VALUE,
+                                       SwizzleIndex<C4>::VALUE>( m ) );
+}
+
+template <VComp C1, VComp C2>
+GEL_CONSTEXPR inline
+void TVec4<float>::assign( const TVec2<float>& v )
+{
+    static_assert( SwizzleMask<C1, C2>::UNIQUE2,
+                   "component written twice" );
+    ( *this )[SwizzleIndex<C1>::VALUE] = v.x;
+    ( *this )[SwizzleIndex<C2>::VALUE] = v.y;
+}
+
+template <VComp C1, VComp C2, VComp C3>
+GEL_CONSTEXPR inline
+void TVec4<float>::assign( const TVec3<float>& v )
+{
+    static_assert( SwizzleMask<C1, C2, C3>::UNIQUE3,
+                   "component written twice" );
+    ( *this )[SwizzleIndex<C1>::VALUE] = v.x;
+    ( *this )[SwizzleIndex<C2>::VALUE] = v.y;
+    ( *this )[SwizzleIndex<C3>::VALUE] = v.z;
+}
+
+template <VComp C1, VComp C2, VComp C3, VComp C4>
+GEL_CONSTEXPR inline
+void TVec4<float>::assign( const TVec4<float>& v )
+{
+    static_assert( SwizzleMask<C1, C2, C3, C4>::UNIQUE4,
+                   "component written twice" );
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        ( *this )[SwizzleIndex<C1>::VALUE] = v.x;
+        ( *this )[SwizzleIndex<C2>::VALUE] = v.y;
+        ( *this )[SwizzleIndex<C3>::VALUE] = v.z;
+        ( *this )[SwizzleIndex<C4>::VALUE] = v.w;
+        return;
+    }
+
+    m = simd::shuffle<SwizzleInverse<0, C1, C2, C3, C4>::VALUE,
+                      SwizzleInverse<1, C1, C2, C3, C4>::VALUE,
+                      SwizzleInverse<2, C1, C2, C3, C4>::VALUE,
+                      SwizzleInverse<3, C1, C2, C3, C4>::VALUE>( v.m );
+}
+
+GEL_CONSTEXPR inline
+TVec2<float> TVec4<float>::xy() const
+{
+    return swizzle<X, Y>();
+}
+
+GEL_CONSTEXPR inline
+TVec2<float> TVec4<float>::xz() const
+{
+    return swizzle<X, Z>();
+}
+
+GEL_CONSTEXPR inline
+TVec2<float> TVec4<float>::yz() const
+{
+    return swizzle<Y, Z>();
+}
+
+GEL_CONSTEXPR inline
+TVec3<float> TVec4<float>::xyz() const
+{
+    return swizzle<X, Y, Z>();
+}
+
+GEL_CONSTEXPR inline
+TVec3<float> TVec4<float>::xzy() const
+{
+    return swizzle<X, Z, Y>();
+}
+
+GEL_CONSTEXPR inline
+TVec3<float> TVec4<float>::yxz() const
+{
+    return swizzle<Y, X, Z>();
+}
+
+GEL_CONSTEXPR inline
+TVec3<float> TVec4<float>::yzx() const
+{
+    return swizzle<Y, Z, X>();
+}
+
+GEL_CONSTEXPR inline
+TVec3<float> TVec4<float>::zxy() const
+{
+    return swizzle<Z, X, Y>();
+}
+
+GEL_CONSTEXPR inline
+TVec3<float> TVec4<float>::zyx() const
+{
+    return swizzle<Z, Y, X>();
+}
+
+GEL_CONSTEXPR inline
+TVec3<float> TVec4<float>::rgb() const
+{
+    return swizzle<R, G, B>();
+}
+
+GEL_CONSTEXPR inline
+TVec3<float> TVec4<float>::bgr() const
+{
+    return swizzle<B, G, R>();
+}
+
+GEL_CONSTEXPR inline
+TVec4<float> TVec4<float>::wzyx() const
+{
+    return swizzle<W, Z, Y, X>();
+}
+
+// BINARY ARITHMETIC OPERATORS
+template <>
+GEL_CONSTEXPR inline
+TVec4<float> operator+( const TVec4<float>& v, const float& s )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return TVec4<float>( v.x + s, v.y + s, v.z + s, v.w + s );
+    }
+
+    return TVec4<float>( simd::add( v.m, simd::set1( s ) ) );
+}
+
+template <>
+GEL_CONSTEXPR inline
+TVec4<float> operator+( const TVec4<float>& u, const TVec4<float>& v )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return TVec4<float>( u.x + v.x, u.y + v.y, u.z + v.z, u.w + v.w );
+    }
+
+    return TVec4<float>( simd::add( u.m, v.m ) );
+}
+
+template <>
+GEL_CONSTEXPR inline
+TVec4<float> operator-( const TVec4<float>& v, const float& s )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return TVec4<float>( v.x - s, v.y - s, v.z - s, v.w - s );
+    }
+
+    return TVec4<float>( simd::sub( v.m, simd::set1( s ) ) );
+}
+
+template <>
+GEL_CONSTEXPR inline
+TVec4<float> operator-( const TVec4<float>& u, const TVec4<float>& v )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return TVec4<float>( u.x - v.x, u.y - v.y, u.z - v.z, u.w - v.w );
+    }
+
+    return TVec4<float>( simd::sub( u.m, v.m ) );
+}
+
+template <>
+GEL_CONSTEXPR inline
+TVec4<float> operator*( const TVec4<float>& v, const float& s )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return TVec4<float>( v.x * s, v.y * s, v.z * s, v.w * s );
+    }
+
+    return TVec4<float>( simd::mul( v.m, simd::set1( s ) ) );
+}
+
+template <>
+GEL_CONSTEXPR inline
+TVec4<float> operator*( const float& s, const TVec4<float>& v )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return TVec4<float>( s * v.x, s * v.y, s * v.z, s * v.w );
+    }
+
+    return TVec4<float>( simd::mul( simd::set1( s ), v.m ) );
+}
+
+template <>
+GEL_CONSTEXPR inline
+TVec4<float> operator*( const TVec4<float>& u, const TVec4<float>& v )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return TVec4<float>( u.x * v.x, u.y * v.y, u.z * v.z, u.w * v.w );
+    }
+
+    return TVec4<float>( simd::mul( u.m, v.m ) );
+}
+
+template <>
+GEL_CONSTEXPR inline
+TVec4<float> operator/( const TVec4<float>& v, const float& s )
+{
+    assert( s != 0.0f );
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return TVec4<float>( v.x / s, v.y / s, v.z / s, v.w / s );
+    }
+
+    return TVec4<float>( simd::div( v.m, simd::set1( s ) ) );
+}
+
+template <>
+GEL_CONSTEXPR inline
+TVec4<float> operator/( const float& s, const TVec4<float>& v )
+{
+    assert( v.x != 0 && v.y != 0 && v.z != 0 && v.w != 0 );
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return TVec4<float>( s / v.x, s / v.y, s / v.z, s / v.w );
+    }
+
+    return TVec4<float>( simd::div( simd::set1( s ), v.m ) );
+}
+
+template <>
+GEL_CONSTEXPR inline
+TVec4<float> operator/( const TVec4<float>& u, const TVec4<float>& v )
+{
+    assert ( v.x != 0 && v.y != 0 && v.z != 0 && v.w != 0 );
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return TVec4<float>( u.x / v.x, u.y / v.y, u.z / v.z, u.w / v.w );
+    }
+
+    return TVec4<float>( simd::div( u.m, v.m ) );
+}
+
+// COMPARISON OPERATORS
+template <>
+GEL_CONSTEXPR inline
+bool operator==( const TVec4<float>& u, const TVec4<float>& v )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return u.x == v.x && u.y == v.y && u.z == v.z && u.w == v.w;
+    }
+
+    return simd::equal( u.m, v.m );
+}
+
+template <>
+GEL_CONSTEXPR inline
+bool operator!=( const TVec4<float>& u, const TVec4<float>& v )
+{
+    if ( GEL_CONSTANT_EVALUATED() )
+    {
+        return !( u == v );
+    }
+
+    return !simd::equal( u.m, v.m );
+}
+
+} // End nspc math
+
+} // End nspc gel
+
+#endif //GEL_VEC4_SIMD_H
@@ -0,0 +1,917 @@
+// vec4_stream.h
+#ifndef GEL_VEC4_STREAM_H
+#define GEL_VEC4_STREAM_H
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+#include "gel/gellib.h"
+#include "gel/math/dispatch.h"
+#include "gel/math/vec4.h"
+#include "gel/memory/iallocator.h"
+#include "gel/memory/heap_allocator.h"
+
+namespace gel
+{
+
+namespace math
+{
+
+/**
+ * @brief Defines a structure-of-arrays stream of 4D vectors.
+ *
+ * Each component is kept in its own contiguous array so that batch kernels
+ * process several vectors per instruction. The component arrays share a
+ * single block from the allocator and are padded to a multiple of LANES
+ * values so that each starts with the alignment of the block.
+ *
+ * @tparam T The component type. This must be an arithmetic type.
+ */
+template <typename T>
+class TVec4Stream
+{
+  private:
+    /**
+     * The allocator that owns the component block.
+     */
+    mem::IAllocator<T>* _allocator;
+
+    /**
+     * The component block.
+     */
+    T* _data;
+
+    /**
+     * The number of vectors in the stream.
+     */
+    Size _size;
+
+    /**
+     * The number of vectors that fit in each component array.
+     */
+    Size _capacity;
+
+    // HELPER FUNCTIONS
+    /**
+     * Moves the stream into a new block of the given capacity.
+     *
+     * @param capacity The new capacity, a multiple of LANES.
+     * @return If the stream moved, which fails if the allocator is exhausted,
+     *         leaving the stream unchanged.
+     */
+    bool grow( Size capacity );
+
+  public:
+    /**
+     * The number of values each component array is padded to.
+     */
+    static const Size LANES = 16;
+
+    // CONSTRUCTORS
+    /**
+     * Constructs a new empty stream.
+     *
+     * @param allocator The allocator for the component arrays.
+     */
+    explicit TVec4Stream( mem::IAllocator<T>& allocator =
+                              mem::HeapAllocator<T>::instance() );
+
+    /**
+     * Constructs a new stream of zero vectors, which is left empty if the
+     * allocator is exhausted.
+     *
+     * @param size The number of vectors.
+     * @param allocator The allocator for the component arrays.
+     */
+    explicit TVec4Stream( Size size, mem::IAllocator<T>& allocator =
+                                         mem::HeapAllocator<T>::instance() );
+
+    /**
+     * Constructs a copy of another stream that uses the same allocator.
+     *
+     * @param stream The stream to copy.
+     */
+    TVec4Stream( const TVec4Stream<T>& stream );
+
+    /**
+     * Destructs the stream.
+     */
+    ~TVec4Stream();
+
+    // OPERATORS
+    /**
+     * Makes this a copy of another stream, which leaves this unchanged if
+     * the allocator is exhausted.
+     *
+     * @param stream The stream to copy.
+     */
+    TVec4Stream<T>& operator=( const TVec4Stream<T>& stream );
+
+    // MEMBER FUNCTIONS
+    /**
+     * Ensures the stream can hold at least the given number of vectors.
+     *
+     * @param capacity The number of vectors.
+     * @return If the stream can hold them, which fails if the allocator is
+     *         exhausted, leaving the stream unchanged.
+     */
+    bool reserve( Size capacity );
+
+    /**
+     * Resizes the stream. New vectors are zeroed.
+     *
+     * @param size The number of vectors.
+     * @return If the stream was resized, which fails if the allocator is
+     *         exhausted, leaving the stream unchanged.
+     */
+    bool resize( Size size );
+
+    /**
+     * Removes all vectors from the stream.
+     */
+    void clear();
+
+    /**
+     * Appends a vector to the end of the stream.
+     *
+     * @param v The vector.
+     * @return If the vector was appended, which fails if the allocator is
+     *         exhausted, leaving the stream unchanged.
+     */
+    bool push( const TVec4<T>& v );
+
+    /**
+     * Gets the vector at the given index.
+     *
+     * @param index The index.
+     * @return The vector.
+     */
+    TVec4<T> get( Size index ) const;
+
+    /**
+     * Sets the vector at the given index.
+     *
+     * @param index The index.
+     * @param v The vector.
+     */
+    void set( Size index, const TVec4<T>& v );
+
+    /**
+     * Replaces the contents of the stream with an array of vectors.
+     *
+     * @param in The vectors.
+     * @param count The number of vectors.
+     * @return If the vectors were loaded, which fails if the allocator is
+     *         exhausted, leaving the stream unchanged.
+     */
+    bool load( const TVec4<T>* in, Size count );
+
+    /**
+     * Copies the contents of the stream to an array of vectors.
+     *
+     * @param out The destination, which must hold size() vectors.
+     */
+    void store( TVec4<T>* out ) const;
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the number of vectors in the stream.
+     *
+     * @return The size.
+     */
+    Size size() const;
+
+    /**
+     * Gets the number of vectors the stream can hold without reallocating.
+     *
+     * @return The capacity.
+     */
+    Size capacity() const;
+
+    /**
+     * Gets the array for the given component.
+     *
+     * @param index The component index.
+     * @return The component array.
+     */
+    T* component( Size index );
+
+    /**
+     * Gets the array for the given component.
+     *
+     * @param index The component index.
+     * @return The component array.
+     */
+    const T* component( Size index ) const;
+
+    /**
+     * Gets the x component array.
+     */
+    T* x();
+
+    /**
+     * Gets the x component array.
+     */
+    const T* x() const;
+
+    /**
+     * Gets the y component array.
+     */
+    T* y();
+
+    /**
+     * Gets the y component array.
+     */
+    const T* y() const;
+
+    /**
+     * Gets the z component array.
+     */
+    T* z();
+
+    /**
+     * Gets the z component array.
+     */
+    const T* z() const;
+
+    /**
+     * Gets the w component array.
+     */
+    T* w();
+
+    /**
+     * Gets the w component array.
+     */
+    const T* w() const;
+};
+
+// BATCH KERNEL DECLARATIONS
+/**
+ * Adds the vectors of two streams.
+ *
+ * @param out The resultant stream, which may be one of the inputs.
+ * @param u The first stream.
+ * @param v The second stream.
+ * @return If the result was written, which fails if out could not be
+ *         resized, leaving it unchanged.
+ */
+template <typename T>
+bool add( TVec4Stream<T>& out, const TVec4Stream<T>& u,
+          const TVec4Stream<T>& v );
+
+/**
+ * Multiplies the components of the vectors of two streams.
+ *
+ * @param out The resultant stream, which may be one of the inputs.
+ * @param u The first stream.
+ * @param v The second stream.
+ * @return If the result was written, which fails if out could not be
+ *         resized, leaving it unchanged.
+ */
+template <typename T>
+bool mul( TVec4Stream<T>& out, const TVec4Stream<T>& u,
+          const TVec4Stream<T>& v );
+
+/**
+ * Multiplies the vectors of two streams and adds a third.
+ *
+ * @param out The resultant stream, which may be one of the inputs.
+ * @param u The first factor stream.
+ * @param v The second factor stream.
+ * @param w The addend stream.
+ * @return If the result was written, which fails if out could not be
+ *         resized, leaving it unchanged.
+ */
+template <typename T>
+bool madd( TVec4Stream<T>& out, const TVec4Stream<T>& u,
+           const TVec4Stream<T>& v, const TVec4Stream<T>& w );
+
+/**
+ * Multiplies the vectors of a stream by a scalar.
+ *
+ * @param out The resultant stream, which may be the input.
+ * @param v The stream.
+ * @param s The scalar.
+ * @return If the result was written, which fails if out could not be
+ *         resized, leaving it unchanged.
+ */
+template <typename T>
+bool scale( TVec4Stream<T>& out, const TVec4Stream<T>& v, const T& s );
+
+/**
+ * Computes the dot products of the vectors of two streams.
+ *
+ * @param out The resultant array, which must hold u.size() values.
+ * @param u The first stream.
+ * @param v The second stream.
+ */
+template <typename T>
+void dot( T* out, const TVec4Stream<T>& u, const TVec4Stream<T>& v );
+
+/**
+ * Normalizes the vectors of a stream.
+ *
+ * @param out The resultant stream, which may be the input.
+ * @param v The stream.
+ * @return If the result was written, which fails if out could not be
+ *         resized, leaving it unchanged.
+ */
+template <typename T>
+bool normalize( TVec4Stream<T>& out, const TVec4Stream<T>& v );
+
+/**
+ * Linearly interpolates between the vectors of two streams.
+ *
+ * @param out The resultant stream, which may be one of the inputs.
+ * @param u The stream at t = 0.
+ * @param v The stream at t = 1.
+ * @param t The interpolation factor.
+ * @return If the result was written, which fails if out could not be
+ *         resized, leaving it unchanged.
+ */
+template <typename T>
+bool lerp( TVec4Stream<T>& out, const TVec4Stream<T>& u,
+           const TVec4Stream<T>& v, const T& t );
+
+// IMPLEMENTATION
+
+// CONSTRUCTORS
+template <typename T>
+inline
+TVec4Stream<T>::TVec4Stream( mem::IAllocator<T>& allocator )
+    : _allocator( &allocator ), _data( 0 ), _size( 0 ), _capacity( 0 )
+{
+}
+
+template <typename T>
+inline
+TVec4Stream<T>::TVec4Stream( Size size, mem::IAllocator<T>& allocator )
+    : _allocator( &allocator ), _data( 0 ), _size( 0 ), _capacity( 0 )
+{
+    resize( size );
+}
+
+template <typename T>
+inline
+TVec4Stream<T>::TVec4Stream( const TVec4Stream<T>& stream )
+    : _allocator( stream._allocator ), _data( 0 ), _size( 0 ), _capacity( 0 )
+{
+    *this = stream;
+}
+
+template <typename T>
+inline
+TVec4Stream<T>::~TVec4Stream()
+{
+    if ( _data )
+    {
+        _allocator->free( _data );
+    }
+}
+
+// OPERATORS
+template <typename T>
+inline
+TVec4Stream<T>& TVec4Stream<T>::operator=( const TVec4Stream<T>& stream )
+{
+    if ( this != &stream && reserve( stream._size ) )
+    {
+        _size = stream._size;
+        for ( Size c = 0; c < 4; ++c )
+        {
+            memcpy( component( c ), stream.component( c ), _size * sizeof( T ) );
+        }
+    }
+    return *this;
+}
+
+// MEMBER FUNCTIONS
+template <typename T>
+inline
+bool TVec4Stream<T>::reserve( Size capacity )
+{
+    if ( capacity > _capacity )
+    {
+        return grow( ( capacity + LANES - 1 ) & ~( LANES - 1 ) );
+    }
+    return true;
+}
+
+template <typename T>
+inline
+bool TVec4Stream<T>::resize( Size size )
+{
+    if ( !reserve( size ) )
+    {
+        return false;
+    }
+    if ( size > _size )
+    {
+        for ( Size c = 0; c < 4; ++c )
+        {
+            memset( component( c ) + _size, 0, ( size - _size ) * sizeof( T ) );
+        }
+    }
+    _size = size;
+    return true;
+}
+
+template <typename T>
+inline
+void TVec4Stream<T>::clear()
+{
+    _size = 0;
+}
+
+template <typename T>
+inline
+bool TVec4Stream<T>::push( const TVec4<T>& v )
+{
+    if ( _size == _capacity && !reserve( _capacity ? _capacity * 2 : LANES ) )
+    {
+        return false;
+    }
+    set( _size++, v );
+    return true;
+}
+
+template <typename T>
+inline
+TVec4<T> TVec4Stream<T>::get( Size index ) const
+{
+    assert( index < _size );
+    return TVec4<T>( x()[index], y()[index], z()[index], w()[index] );
+}
+
+template <typename T>
+inline
+void TVec4Stream<T>::set( Size index, const TVec4<T>& v )
+{
+    assert( index < _size );
+    x()[index] = v.x;
+    y()[index] = v.y;
+    z()[index] = v.z;
+    w()[index] = v.w;
+}
+
+template <typename T>
+inline
+bool TVec4Stream<T>::load( const TVec4<T>* in, Size count )
+{
+    if ( !reserve( count ) )
+    {
+        return false;
+    }
+    _size = count;
+
+    T* xs = x();
+    T* ys = y();
+    T* zs = z();
+    T* ws = w();
+    for ( Size i = 0; i < count; ++i )
+    {
+        xs[i] = in[i].x;
+        ys[i] = in[i].y;
+        zs[i] = in[i].z;
+        ws[i] = in[i].w;
+    }
+    return true;
+}
+
+template <typename T>
+inline
+void TVec4Stream<T>::store( TVec4<T>* out ) const
+{
+    const T* xs = x();
+    const T* ys = y();
+    const T* zs = z();
+    const T* ws = w();
+    for ( Size i = 0; i < _size; ++i )
+    {
+        out[i].x = xs[i];
+        out[i].y = ys[i];
+        out[i].z = zs[i];
+        out[i].w = ws[i];
+    }
+}
+
+// ACCESSOR FUNCTIONS
+template <typename T>
+inline
+Size TVec4Stream<T>::size() const
+{
+    return _size;
+}
+
+template <typename T>
+inline
+Size TVec4Stream<T>::capacity() const
+{
+    return _capacity;
+}
+
+template <typename T>
+inline
+T* TVec4Stream<T>::component( Size index )
+{
+    assert( index < 4 );
+    return _data + index * _capacity;
+}
+
+template <typename T>
+inline
+const T* TVec4Stream<T>::component( Size index ) const
+{
+    assert( index < 4 );
+    return _data + index * _capacity;
+}
+
+template <typename T>
+inline
+T* TVec4Stream<T>::x()
+{
+    return _data;
+}
+
+template <typename T>
+inline
+const T* TVec4Stream<T>::x() const
+{
+    return _data;
+}
+
+template <typename T>
+inline
+T* TVec4Stream<T>::y()
+{
+    return _data + _capacity;
+}
+
+template <typename T>
+inline
+const T* TVec4Stream<T>::y() const
+{
+    return _data + _capacity;
+}
+
+template <typename T>
+inline
+T* TVec4Stream<T>::z()
+{
+    return _data + 2 * _capacity;
+}
+
+template <typename T>
+inline
+const T* TVec4Stream<T>::z() const
+{
+    return _data + 2 * _capacity;
+}
+
+template <typename T>
+inline
+T* TVec4Stream<T>::w()
+{
+    return _data + 3 * _capacity;
+}
+
+template <typename T>
+inline
+const T* TVec4Stream<T>::w() const
+{
+    return _data + 3 * _capacity;
+}
+
+template <typename T>
+const Size TVec4Stream<T>::LANES;
+
+// HELPER FUNCTIONS
+template <typename T>
+inline
+bool TVec4Stream<T>::grow( Size capacity )
+{
+    T* data = _allocator->allocate( capacity * 4 );
+    if ( !data )
+    {
+        return false;
+    }
+
+    if ( _data )
+    {
+        for ( Size c = 0; c < 4; ++c )
+        {
+            memcpy( data + c * capacity, component( c ), _size * sizeof( T ) );
+        }
+        _allocator->free( _data );
+    }
+
+    _data = data;
+    _capacity = capacity;
+    return true;
+}
+
+// BATCH KERNELS
+template <typename T>
+inline
+bool add( TVec4Stream<T>& out, const TVec4Stream<T>& u,
+          const TVec4Stream<T>& v )
+{
+    assert( u.size() == v.size() );
+    const Size n = u.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    for ( Size c = 0; c < 4; ++c )
+    {
+        T* o = out.component( c );
+        const T* a = u.component( c );
+        const T* b = v.component( c );
+        for ( Size i = 0; i < n; ++i )
+        {
+            o[i] = a[i] + b[i];
+        }
+    }
+    return true;
+}
+
+template <typename T>
+inline
+bool mul( TVec4Stream<T>& out, const TVec4Stream<T>& u,
+          const TVec4Stream<T>& v )
+{
+    assert( u.size() == v.size() );
+    const Size n = u.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    for ( Size c = 0; c < 4; ++c )
+    {
+        T* o = out.component( c );
+        const T* a = u.component( c );
+        const T* b = v.component( c );
+        for ( Size i = 0; i < n; ++i )
+        {
+            o[i] = a[i] * b[i];
+        }
+    }
+    return true;
+}
+
+template <typename T>
+inline
+bool madd( TVec4Stream<T>& out, const TVec4Stream<T>& u,
+           const TVec4Stream<T>& v, const TVec4Stream<T>& w )
+{
+    assert( u.size() == v.size() && v.size() == w.size() );
+    const Size n = u.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    for ( Size c = 0; c < 4; ++c )
+    {
+        T* o = out.component( c );
+        const T* a = u.component( c );
+        const T* b = v.component( c );
+        const T* d = w.component( c );
+        for ( Size i = 0; i < n; ++i )
+        {
+            o[i] = a[i] * b[i] + d[i];
+        }
+    }
+    return true;
+}
+
+template <typename T>
+inline
+bool scale( TVec4Stream<T>& out, const TVec4Stream<T>& v, const T& s )
+{
+    const Size n = v.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    for ( Size c = 0; c < 4; ++c )
+    {
+        T* o = out.component( c );
+        const T* a = v.component( c );
+        for ( Size i = 0; i < n; ++i )
+        {
+            o[i] = a[i] * s;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+inline
+void dot( T* out, const TVec4Stream<T>& u, const TVec4Stream<T>& v )
+{
+    assert( u.size() == v.size() );
+    const Size n = u.size();
+    const T* ux = u.x();
+    const T* uy = u.y();
+    const T* uz = u.z();
+    const T* uw = u.w();
+    const T* vx = v.x();
+    const T* vy = v.y();
+    const T* vz = v.z();
+    const T* vw = v.w();
+
+    for ( Size i = 0; i < n; ++i )
+    {
+        out[i] = ux[i] * vx[i] + uy[i] * vy[i] + uz[i] * vz[i] +
+                 uw[i] * vw[i];
+    }
+}
+
+template <typename T>
+inline
+bool normalize( TVec4Stream<T>& out, const TVec4Stream<T>& v )
+{
+    const Size n = v.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+    const T* vx = v.x();
+    const T* vy = v.y();
+    const T* vz = v.z();
+    const T* vw = v.w();
+    T* ox = out.x();
+    T* oy = out.y();
+    T* oz = out.z();
+    T* ow = out.w();
+
+    for ( Size i = 0; i < n; ++i )
+    {
+        T len = static_cast<T>( sqrt( vx[i] * vx[i] + vy[i] * vy[i] +
+                                      vz[i] * vz[i] + vw[i] * vw[i] ) );
+        ox[i] = vx[i] / len;
+        oy[i] = vy[i] / len;
+        oz[i] = vz[i] / len;
+        ow[i] = vw[i] / len;
+    }
+    return true;
+}
+
+template <typename T>
+inline
+bool lerp( TVec4Stream<T>& out, const TVec4Stream<T>& u,
+           const TVec4Stream<T>& v, const T& t )
+{
+    assert( u.size() == v.size() );
+    const Size n = u.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    for ( Size c = 0; c < 4; ++c )
+    {
+        T* o = out.component( c );
+        const T* a = u.component( c );
+        const T* b = v.component( c );
+        for ( Size i = 0; i < n; ++i )
+        {
+            o[i] = a[i] + ( b[i] - a[i] ) * t;
+        }
+    }
+    return true;
+}
+
+// FLOAT BATCH KERNELS
+template <>
+inline
+bool add( TVec4Stream<float>& out, const TVec4Stream<float>& u,
+          const TVec4Stream<float>& v )
+{
+    assert( u.size() == v.size() );
+    const Size n = u.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    const BatchKernels& k = batchKernels();
+    for ( Size c = 0; c < 4; ++c )
+    {
+        k.add( out.component( c ), u.component( c ), v.component( c ), n );
+    }
+    return true;
+}
+
+template <>
+inline
+bool mul( TVec4Stream<float>& out, const TVec4Stream<float>& u,
+          const TVec4Stream<float>& v )
+{
+    assert( u.size() == v.size() );
+    const Size n = u.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    const BatchKernels& k = batchKernels();
+    for ( Size c = 0; c < 4; ++c )
+    {
+        k.mul( out.component( c ), u.component( c ), v.component( c ), n );
+    }
+    return true;
+}
+
+template <>
+inline
+bool madd( TVec4Stream<float>& out, const TVec4Stream<float>& u,
+           const TVec4Stream<float>& v, const TVec4Stream<float>& w )
+{
+    assert( u.size() == v.size() && v.size() == w.size() );
+    const Size n = u.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    const BatchKernels& k = batchKernels();
+    for ( Size c = 0; c < 4; ++c )
+    {
+        k.madd( out.component( c ), u.component( c ), v.component( c ),
+                w.component( c ), n );
+    }
+    return true;
+}
+
+template <>
+inline
+bool scale( TVec4Stream<float>& out, const TVec4Stream<float>& v,
+            const float& s )
+{
+    const Size n = v.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    const BatchKernels& k = batchKernels();
+    for ( Size c = 0; c < 4; ++c )
+    {
+        k.scale( out.component( c ), v.component( c ), s, n );
+    }
+    return true;
+}
+
+template <>
+inline
+void dot( float* out, const TVec4Stream<float>& u, const TVec4Stream<float>& v )
+{
+    assert( u.size() == v.size() );
+    const float* us[] = { u.x(), u.y(), u.z(), u.w() };
+    const float* vs[] = { v.x(), v.y(), v.z(), v.w() };
+    batchKernels().dot( out, us, vs, 4, u.size() );
+}
+
+template <>
+inline
+bool normalize( TVec4Stream<float>& out, const TVec4Stream<float>& v )
+{
+    if ( !out.resize( v.size() ) )
+    {
+        return false;
+    }
+    float* os[] = { out.x(), out.y(), out.z(), out.w() };
+    const float* vs[] = { v.x(), v.y(), v.z(), v.w() };
+    batchKernels().normalize( os, vs, 4, v.size() );
+    return true;
+}
+
+template <>
+inline
+bool lerp( TVec4Stream<float>& out, const TVec4Stream<float>& u,
+           const TVec4Stream<float>& v, const float& t )
+{
+    assert( u.size() == v.size() );
+    const Size n = u.size();
+    if ( !out.resize( n ) )
+    {
+        return false;
+    }
+
+    const BatchKernels& k = batchKernels();
+    for ( Size c = 0; c < 4; ++c )
+    {
+        k.lerp( out.component( c ), u.component( c ), v.component( c ), t, n );
+    }
+    return true;
+}
+
+} // End nspc math
+
+} // End nspc gel
+
+#endif //GEL_VEC4_STREAM_H
@@ -0,0 +1,328 @@
+// buddy_memory.h
+#ifndef GEL_BUDDY_MEMORY_H
+#define GEL_BUDDY_MEMORY_H
+
+#include "gel/memory/imemory.h"
+#include "gel/memory/heap_memory.h"
+
+namespace gel
+{
+
+namespace mem
+{
+
+/**
+ * @brief Defines a binary buddy memory pool over one region.
+ *
+ * The region is a power of two multiple of the minimum block size and is
+ * split in halves, recursively, down to the minimum block. Every level has
+ * a free list, and two bitmaps over the tree of blocks hold the rest of the
+ * state: one bit per block that records if it is split, and one bit per
+ * pair of buddies that records if exactly one of them is in use. Releasing
+ * a block reads its size from the split bits and merges it with its buddy
+ * for as long as the pair bits say the buddy is free, so no block carries a
+ * header and blocks can be handed out whole, such as for I/O and staging
+ * buffers.
+ *
+ * Every block is a power of two multiple of the minimum block size and is
+ * aligned to the minimum block size. The pool is not thread safe.
+ */
+class BuddyMemory: public IMemory
+{
+  public:
+    /**
+     * The largest number of levels of the tree.
+     */
+    static const unsigned MAX_LEVELS = 32;
+
+  private:
+    /**
+     * Defines a free block.
+     */
+    struct Block
+    {
+        /**
+         * The next free block of the same level.
+         */
+        Block* next;
+
+        /**
+         * The previous free block of the same level.
+         */
+        Block* previous;
+    };
+
+    /**
+     * The memory that the region is allocated from.
+     */
+    IMemory* _memory;
+
+    /**
+     * The region, as allocated.
+     */
+    void* _region;
+
+    /**
+     * The start of the region.
+     */
+    char* _base;
+
+    /**
+     * The bitmaps, as allocated.
+     */
+    uint64* _bits;
+
+    /**
+     * The bits of the split blocks.
+     */
+    uint64* _split;
+
+    /**
+     * The bits of the pairs of buddies of which exactly one is in use,
+     * indexed by their parent.
+     */
+    uint64* _pairs;
+
+    /**
+     * The heads of the free lists, by level.
+     */
+    Block* _free[MAX_LEVELS];
+
+    /**
+     * The number of free blocks, by level.
+     */
+    Size _freeCounts[MAX_LEVELS];
+
+    /**
+     * The base two logarithm of the size of the region.
+     */
+    unsigned _log2;
+
+    /**
+     * The number of levels, the last of which holds the minimum blocks.
+     */
+    unsigned _levels;
+
+    /**
+     * The size of the region, in bytes.
+     */
+    Size _capacity;
+
+    /**
+     * The number of allocated bytes.
+     */
+    Size _size;
+
+    // HELPER FUNCTIONS
+    /**
+     * Gets the smallest level whose blocks hold a size.
+     *
+     * @param size The size, in bytes, which must not exceed the capacity.
+     * @return     The level.
+     */
+    unsigned levelFor(Size size) const;
+
+    /**
+     * Gets the node of the block at a level that holds an address.
+     *
+     * @param ptr   The address.
+     * @param level The level.
+     * @return      The node.
+     */
+    Size nodeOf(const char* ptr, unsigned level) const;
+
+    /**
+     * Gets the start of the block of a node.
+     *
+     * @param node  The node.
+     * @param level The level of the node.
+     * @return      The start.
+     */
+    char* blockOf(Size node, unsigned level) const;
+
+    /**
+     * Finds the allocated block that starts at an address.
+     *
+     * @param ptr   The address.
+     * @param node  The node of the block.
+     * @param level The level of the block.
+     */
+    void locate(const char* ptr, Size& node, unsigned& level) const;
+
+    /**
+     * Splits an allocated block down to a level, freeing the upper halves.
+     *
+     * @param node   The node of the block, which becomes its lowest part.
+     * @param level  The level of the block, which becomes the target.
+     * @param target The level to split down to.
+     */
+    void split(Size& node, unsigned& level, unsigned target);
+
+    /**
+     * Pushes a block onto a free list.
+     *
+     * @param level The level.
+     * @param ptr   The block.
+     */
+    void push(unsigned level, char* ptr);
+
+    /**
+     * Removes a block from a free list.
+     *
+     * @param level The level.
+     * @param ptr   The block.
+     */
+    void unlink(unsigned level, char* ptr);
+
+    // DISABLED
+    BuddyMemory(const BuddyMemory&);
+
+    BuddyMemory& operator=(const BuddyMemory&);
+
+  public:
+    // CONSTRUCTORS
+    /**
+     * Constructs a new pool.
+     *
+     * @param capacity The size of the region, in bytes, which is rounded
+     *                 down to a power of two multiple of the minimum block.
+     * @param minBlock The size of the smallest block, in bytes, which must
+     *                 be a power of two that can hold two pointers.
+     * @param memory   The memory that the region is allocated from.
+     */
+    explicit BuddyMemory(Size capacity, Size minBlock = 4096,
+                         IMemory& memory = HeapMemory::instance());
+
+    /**
+     * Destructor. This releases the region.
+     */
+    virtual ~BuddyMemory();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Allocates a block of memory.
+     *
+     * @param size The size of the memory block, in bytes.
+     * @return     A pointer to the allocated block, or null for a size of
+     *             zero or if no free block is large enough.
+     */
+    virtual void* allocate(Size size);
+
+    /**
+     * Reallocates a block of memory. The block shrinks in place by freeing
+     * its upper halves and grows in place while it is the lower buddy of a
+     * free block, and is otherwise moved.
+     *
+     * @param pointer The pointer to the previously allocated block, or null.
+     * @param size    The new size for the memory block, in bytes.
+     * @return        A pointer to the reallocated block, or null if the size
+     *                is zero or no free block is large enough.
+     */
+    virtual void* reallocate(void* pointer, Size size);
+
+    /**
+     * Releases a block of memory and merges it with its free buddies.
+     *
+     * @param pointer The pointer to the allocated block, or null.
+     */
+    virtual void release(void* pointer);
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the size of an allocated block, which is the request rounded up
+     * to a power of two multiple of the minimum block.
+     *
+     * @param pointer The pointer to the allocated block.
+     * @return        The size, in bytes.
+     */
+    Size blockSize(const void* pointer) const;
+
+    /**
+     * Gets the number of allocated bytes.
+     *
+     * @return The size, in bytes.
+     */
+    Size size() const;
+
+    /**
+     * Gets the size of the region.
+     *
+     * @return The capacity, in bytes.
+     */
+    Size capacity() const;
+
+    /**
+     * Gets the size of the smallest block.
+     *
+     * @return The size, in bytes.
+     */
+    Size minBlock() const;
+
+    /**
+     * Gets the number of levels of the tree. Level zero is the whole region
+     * and the last level holds the smallest blocks.
+     *
+     * @return The number of levels.
+     */
+    unsigned levels() const;
+
+    /**
+     * Gets the number of free blocks at a level.
+     *
+     * @param level The level.
+     * @return      The number of blocks.
+     */
+    Size freeBlocks(unsigned level) const;
+
+    /**
+     * Gets the size of the largest free block.
+     *
+     * @return The size, in bytes.
+     */
+    Size largestFree() const;
+
+    /**
+     * Gets the external fragmentation, which is the share of free memory
+     * that is not in the largest free block.
+     *
+     * @return The fragmentation, between zero and one.
+     */
+    float fragmentation() const;
+};
+
+// ACCESSOR FUNCTIONS
+inline
+Size BuddyMemory::size() const
+{
+    return _size;
+}
+
+inline
+Size BuddyMemory::capacity() const
+{
+    return _capacity;
+}
+
+inline
+Size BuddyMemory::minBlock() const
+{
+    return _levels ? _capacity >> (_levels - 1) : 0;
+}
+
+inline
+unsigned BuddyMemory::levels() const
+{
+    return _levels;
+}
+
+inline
+Size BuddyMemory::freeBlocks(unsigned level) const
+{
+    return level < _levels ? _freeCounts[level] : 0;
+}
+
+} // End nspc mem
+
+} // End nspc gel
+
+#endif //GEL_BUDDY_MEMORY_H
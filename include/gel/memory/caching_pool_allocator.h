@@ -0,0 +1,685 @@
+// caching_pool_allocator.h
+#ifndef GEL_CACHING_POOL_ALLOCATOR_H
+#define GEL_CACHING_POOL_ALLOCATOR_H
+
+#include <assert.h>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <thread>
+#include "gel/memory/iallocator.h"
+#include "gel/memory/imemory.h"
+#include "gel/memory/heap_memory.h"
+#include "gel/memory/pool_allocator.h"
+
+namespace gel
+{
+
+namespace mem
+{
+
+/**
+ * @brief Defines a pool allocator with a per-thread cache in front of it.
+ *
+ * Each thread that uses the allocator gets a cache of two magazines, which
+ * are fixed-size stacks of free blocks. Allocating pops from the loaded
+ * magazine and freeing pushes to it, swapping with the other magazine when
+ * it runs empty or full, so the common path takes no lock and touches no
+ * atomics. Only when both magazines are exhausted does the thread lock the
+ * shared depot to exchange a whole magazine, which refills from or returns
+ * to a PoolAllocator in one batch.
+ *
+ * A thread caches at most two magazines of blocks and the depot keeps at
+ * most a fixed number of full magazines, returning any more to the pool.
+ * A thread has one cache per allocator, which it finds again when its
+ * binding to the allocator has been evicted. Blocks cached by a thread stay
+ * there until it calls flush(), so worker threads should flush before they
+ * exit. The allocation policy is that of PoolAllocator: only single
+ * instances of T are served.
+ *
+ * @tparam T The type that is allocated.
+ */
+template<typename T>
+class CachingPoolAllocator: public IAllocator<T>
+{
+  private:
+    /**
+     * Defines a stack of free blocks.
+     */
+    struct Magazine
+    {
+        /**
+         * The next magazine in a depot list.
+         */
+        Magazine* next;
+
+        /**
+         * The number of blocks in the magazine.
+         */
+        Size count;
+
+        /**
+         * The blocks, which follow the magazine in memory.
+         */
+        T** rounds;
+    };
+
+    /**
+     * Defines the magazines of one thread.
+     */
+    struct Cache
+    {
+        /**
+         * The magazine blocks are taken from and given to.
+         */
+        Magazine* loaded;
+
+        /**
+         * The magazine swapped in when the loaded one is empty or full.
+         */
+        Magazine* previous;
+
+        /**
+         * The next cache owned by the allocator.
+         */
+        Cache* next;
+
+        /**
+         * The thread that uses the cache.
+         */
+        std::thread::id thread;
+    };
+
+    /**
+     * Defines the cache a thread uses for an allocator.
+     */
+    struct Binding
+    {
+        /**
+         * The identifier of the allocator, which is never reused.
+         */
+        uint64 owner;
+
+        /**
+         * The cache.
+         */
+        Cache* cache;
+    };
+
+    /**
+     * The number of allocators a thread keeps a cache binding for.
+     */
+    static const Size BINDINGS = 8;
+
+    /**
+     * The memory that magazines and caches are allocated from.
+     */
+    IMemory* _memory;
+
+    /**
+     * The identifier of this allocator.
+     */
+    uint64 _id;
+
+    /**
+     * The number of blocks in each magazine.
+     */
+    Size _magazineSize;
+
+    /**
+     * The most full magazines the depot keeps.
+     */
+    Size _depotLimit;
+
+    /**
+     * Guards the depot, the pool and the cache list.
+     */
+    std::mutex _lock;
+
+    /**
+     * The full magazines in the depot.
+     */
+    Magazine* _full;
+
+    /**
+     * The number of full magazines in the depot.
+     */
+    Size _fullCount;
+
+    /**
+     * The empty magazines in the depot.
+     */
+    Magazine* _empty;
+
+    /**
+     * Every cache created for a thread.
+     */
+    Cache* _caches;
+
+    /**
+     * The pool behind the depot.
+     */
+    PoolAllocator<T> _pool;
+
+    // HELPER FUNCTIONS
+    /**
+     * Gets the cache of the calling thread, creating it if needed. This
+     * returns null if the memory is exhausted.
+     */
+    Cache* cache();
+
+    /**
+     * Creates the cache of a thread while the depot is locked. This returns
+     * null if the memory is exhausted.
+     */
+    Cache* createCache(std::thread::id thread);
+
+    /**
+     * Gets the cache bindings of the calling thread.
+     */
+    static Binding* bindings();
+
+    /**
+     * Creates a magazine while the depot is locked. This returns null if
+     * the memory is exhausted.
+     */
+    Magazine* createMagazine();
+
+    /**
+     * Gets a full magazine from the depot while it is locked, refilling
+     * one from the pool when there are none. This returns null if the
+     * memory is exhausted.
+     */
+    Magazine* takeFull();
+
+    /**
+     * Gets an empty magazine from the depot while it is locked. This
+     * returns null if the memory is exhausted.
+     */
+    Magazine* takeEmpty();
+
+    /**
+     * Gives a full magazine to the depot while it is locked.
+     */
+    void giveFull(Magazine* magazine);
+
+    /**
+     * Returns every block of a magazine to the pool while the depot is
+     * locked.
+     */
+    void drain(Magazine* magazine);
+
+    /**
+     * Allocates a block when both magazines of a cache are empty.
+     */
+    T* allocateSlow(Cache* cache);
+
+    /**
+     * Frees a block when both magazines of a cache are full.
+     */
+    void freeSlow(Cache* cache, T* ptr);
+
+    // DISABLED
+    CachingPoolAllocator(const CachingPoolAllocator<T>&);
+
+    CachingPoolAllocator<T>& operator=(const CachingPoolAllocator<T>&);
+
+  public:
+    // CONSTRUCTORS
+    /**
+     * Constructs a new empty allocator.
+     *
+     * @param magazineSize The number of blocks in each magazine.
+     * @param depotLimit   The most full magazines the depot keeps.
+     * @param slabSlots    The number of slots in each slab of the pool.
+     * @param memory       The memory that everything is allocated from.
+     */
+    explicit CachingPoolAllocator(Size magazineSize = 32,
+                                  Size depotLimit = 64,
+                                  Size slabSlots = 256,
+                                  IMemory& memory = HeapMemory::instance());
+
+    /**
+     * Destructor. This releases every slab and magazine, so no thread may
+     * use the allocator while or after it is destroyed.
+     */
+    virtual ~CachingPoolAllocator();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Allocates a block of memory.
+     *
+     * @param count The size of the memory block, in instances of T. This
+     *              must be zero or one.
+     * @return      A pointer to the allocated block, or null for a count of
+     *              zero or if the backing memory is exhausted.
+     */
+    virtual T* allocate(Size count);
+
+    /**
+     * Reallocates a pre-existing block of memory.
+     *
+     * @param ptr   A pointer to the existing memory block, or null.
+     * @param count The new size of the memory block, in instances of T.
+     *              This must be zero or one.
+     * @return      A pointer to the reallocated block, which is ptr when it
+     *              was already allocated, or null when it was freed.
+     */
+    virtual T* reallocate(T* ptr, Size count);
+
+    /**
+     * Releases a block of memory. Any thread may free a block allocated by
+     * another.
+     *
+     * @param ptr A pointer to the allocated memory block, or null.
+     */
+    virtual void free(T* ptr);
+
+    /**
+     * Returns the blocks cached by the calling thread to the depot.
+     */
+    void flush();
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the number of blocks in each magazine.
+     *
+     * @return The magazine size.
+     */
+    Size magazineSize() const;
+
+    /**
+     * Gets the most full magazines the depot keeps.
+     *
+     * @return The depot limit.
+     */
+    Size depotLimit() const;
+};
+
+// CONSTRUCTORS
+template<typename T>
+inline
+CachingPoolAllocator<T>::CachingPoolAllocator(Size magazineSize,
+                                              Size depotLimit,
+                                              Size slabSlots,
+                                              IMemory& memory)
+    : _memory(&memory), _magazineSize(magazineSize),
+      _depotLimit(depotLimit), _full(0), _fullCount(0), _empty(0),
+      _caches(0), _pool(slabSlots, memory)
+{
+    static std::atomic<uint64> ids(1);
+
+    assert(magazineSize > 0);
+    _id = ids.fetch_add(1, std::memory_order_relaxed);
+}
+
+template<typename T>
+inline
+CachingPoolAllocator<T>::~CachingPoolAllocator()
+{
+    // the blocks themselves belong to the pool, which releases its slabs
+    Magazine* lists[] = { _full, _empty };
+    for (Size i = 0; i < 2; ++i)
+    {
+        while (lists[i])
+        {
+            Magazine* next = lists[i]->next;
+            _memory->release(lists[i]);
+            lists[i] = next;
+        }
+    }
+
+    while (_caches)
+    {
+        Cache* next = _caches->next;
+        _memory->release(_caches->loaded);
+        _memory->release(_caches->previous);
+        _caches->~Cache();
+        _memory->release(_caches);
+        _caches = next;
+    }
+}
+
+// MEMBER FUNCTIONS
+template<typename T>
+inline
+T* CachingPoolAllocator<T>::allocate(Size count)
+{
+    assert(count <= 1);
+    if (count != 1)
+    {
+        return 0;
+    }
+
+    Cache* c = cache();
+    if (!c)
+    {
+        return 0;
+    }
+    if (c->loaded->count == 0 && c->previous->count > 0)
+    {
+        Magazine* m = c->loaded;
+        c->loaded = c->previous;
+        c->previous = m;
+    }
+    if (c->loaded->count > 0)
+    {
+        Magazine* m = c->loaded;
+        return m->rounds[--m->count];
+    }
+    return allocateSlow(c);
+}
+
+template<typename T>
+inline
+T* CachingPoolAllocator<T>::reallocate(T* ptr, Size count)
+{
+    if (!ptr)
+    {
+        return allocate(count);
+    }
+
+    assert(count <= 1);
+    if (count == 0)
+    {
+        free(ptr);
+    }
+    return count == 1 ? ptr : 0;
+}
+
+template<typename T>
+inline
+void CachingPoolAllocator<T>::free(T* ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    Cache* c = cache();
+    if (!c)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _pool.free(ptr);
+        return;
+    }
+    if (c->loaded->count == _magazineSize &&
+        c->previous->count < _magazineSize)
+    {
+        Magazine* m = c->loaded;
+        c->loaded = c->previous;
+        c->previous = m;
+    }
+    if (c->loaded->count < _magazineSize)
+    {
+        Magazine* m = c->loaded;
+        m->rounds[m->count++] = ptr;
+        return;
+    }
+    freeSlow(c, ptr);
+}
+
+template<typename T>
+inline
+void CachingPoolAllocator<T>::flush()
+{
+    Cache* c = cache();
+    if (!c)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(_lock);
+    Magazine* magazines[] = { c->loaded, c->previous };
+    for (Size i = 0; i < 2; ++i)
+    {
+        Magazine* empty =
+            magazines[i]->count == _magazineSize ? takeEmpty() : 0;
+        if (empty)
+        {
+            giveFull(magazines[i]);
+            magazines[i] = empty;
+        }
+        else
+        {
+            drain(magazines[i]);
+        }
+    }
+    c->loaded = magazines[0];
+    c->previous = magazines[1];
+}
+
+// ACCESSOR FUNCTIONS
+template<typename T>
+inline
+Size CachingPoolAllocator<T>::magazineSize() const
+{
+    return _magazineSize;
+}
+
+template<typename T>
+inline
+Size CachingPoolAllocator<T>::depotLimit() const
+{
+    return _depotLimit;
+}
+
+template<typename T>
+const Size CachingPoolAllocator<T>::BINDINGS;
+
+// HELPER FUNCTIONS
+template<typename T>
+inline
+typename CachingPoolAllocator<T>::Cache* CachingPoolAllocator<T>::cache()
+{
+    Binding* b = bindings();
+    for (Size i = 0; i < BINDINGS; ++i)
+    {
+        if (b[i].owner == _id)
+        {
+            return b[i].cache;
+        }
+    }
+
+    // a thread whose binding was evicted gets its own cache back, so an
+    // allocator never has more caches than threads that used it
+    const std::thread::id thread = std::this_thread::get_id();
+    Cache* c;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        for (c = _caches; c && c->thread != thread; c = c->next)
+        {
+        }
+        if (!c)
+        {
+            c = createCache(thread);
+            if (!c)
+            {
+                return 0;
+            }
+        }
+    }
+
+    // bindings are never dereferenced for other allocators, so the oldest
+    // one can be replaced even when its allocator is still alive
+    for (Size i = BINDINGS - 1; i > 0; --i)
+    {
+        b[i] = b[i - 1];
+    }
+    b[0].owner = _id;
+    b[0].cache = c;
+    return c;
+}
+
+template<typename T>
+inline
+typename CachingPoolAllocator<T>::Cache*
+CachingPoolAllocator<T>::createCache(std::thread::id thread)
+{
+    void* block = _memory->allocate(sizeof(Cache));
+    Magazine* loaded = block ? takeEmpty() : 0;
+    Magazine* previous = loaded ? takeEmpty() : 0;
+    if (!previous)
+    {
+        if (loaded)
+        {
+            loaded->next = _empty;
+            _empty = loaded;
+        }
+        if (block)
+        {
+            _memory->release(block);
+        }
+        return 0;
+    }
+
+    Cache* c = new (block) Cache();
+    c->loaded = loaded;
+    c->previous = previous;
+    c->thread = thread;
+    c->next = _caches;
+    _caches = c;
+    return c;
+}
+
+template<typename T>
+inline
+typename CachingPoolAllocator<T>::Binding*
+CachingPoolAllocator<T>::bindings()
+{
+    static thread_local Binding b[BINDINGS];
+    return b;
+}
+
+template<typename T>
+inline
+typename CachingPoolAllocator<T>::Magazine*
+CachingPoolAllocator<T>::createMagazine()
+{
+    Magazine* m = static_cast<Magazine*>(
+        _memory->allocate(sizeof(Magazine) + _magazineSize * sizeof(T*)));
+    if (!m)
+    {
+        return 0;
+    }
+    m->next = 0;
+    m->count = 0;
+    m->rounds = reinterpret_cast<T**>(m + 1);
+    return m;
+}
+
+template<typename T>
+inline
+typename CachingPoolAllocator<T>::Magazine*
+CachingPoolAllocator<T>::takeFull()
+{
+    if (_full)
+    {
+        Magazine* m = _full;
+        _full = m->next;
+        --_fullCount;
+        return m;
+    }
+
+    Magazine* m = takeEmpty();
+    while (m && m->count < _magazineSize)
+    {
+        T* ptr = _pool.allocate(1);
+        if (!ptr)
+        {
+            break;
+        }
+        m->rounds[m->count++] = ptr;
+    }
+    return m;
+}
+
+template<typename T>
+inline
+typename CachingPoolAllocator<T>::Magazine*
+CachingPoolAllocator<T>::takeEmpty()
+{
+    if (_empty)
+    {
+        Magazine* m = _empty;
+        _empty = m->next;
+        return m;
+    }
+    return createMagazine();
+}
+
+template<typename T>
+inline
+void CachingPoolAllocator<T>::giveFull(Magazine* magazine)
+{
+    if (_fullCount < _depotLimit)
+    {
+        magazine->next = _full;
+        _full = magazine;
+        ++_fullCount;
+    }
+    else
+    {
+        drain(magazine);
+        magazine->next = _empty;
+        _empty = magazine;
+    }
+}
+
+template<typename T>
+inline
+void CachingPoolAllocator<T>::drain(Magazine* magazine)
+{
+    while (magazine->count > 0)
+    {
+        _pool.free(magazine->rounds[--magazine->count]);
+    }
+}
+
+template<typename T>
+inline
+T* CachingPoolAllocator<T>::allocateSlow(Cache* c)
+{
+    // both magazines are empty, so trade one for a full one
+    std::lock_guard<std::mutex> guard(_lock);
+    Magazine* m = takeFull();
+    if (!m)
+    {
+        return 0;
+    }
+    if (m->count == 0)
+    {
+        m->next = _empty;
+        _empty = m;
+        return 0;
+    }
+
+    c->previous->next = _empty;
+    _empty = c->previous;
+    c->previous = c->loaded;
+    c->loaded = m;
+    return m->rounds[--m->count];
+}
+
+template<typename T>
+inline
+void CachingPoolAllocator<T>::freeSlow(Cache* c, T* ptr)
+{
+    // both magazines are full, so trade one for an empty one
+    std::lock_guard<std::mutex> guard(_lock);
+    Magazine* m = takeEmpty();
+    if (!m)
+    {
+        _pool.free(ptr);
+        return;
+    }
+    giveFull(c->previous);
+    c->previous = c->loaded;
+    c->loaded = m;
+    c->loaded->rounds[c->loaded->count++] = ptr;
+}
+
+} // End nspc mem
+
+} // End nspc gel
+
+#endif //GEL_CACHING_POOL_ALLOCATOR_H
@@ -0,0 +1,402 @@
+// concurrent_pool_allocator.h
+#ifndef GEL_CONCURRENT_POOL_ALLOCATOR_H
+#define GEL_CONCURRENT_POOL_ALLOCATOR_H
+
+#include <assert.h>
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include "gel/memory/iallocator.h"
+#include "gel/memory/imemory.h"
+#include "gel/memory/heap_memory.h"
+
+namespace gel
+{
+
+namespace mem
+{
+
+/**
+ * @brief Defines a pool allocator that any thread may allocate from and
+ * free to.
+ *
+ * Free slots form a lock-free stack whose head packs the address of the
+ * first slot with a tag that is incremented by every update, so a compare
+ * and swap fails if the head was popped and pushed back in between (the
+ * ABA problem). On 64-bit targets the address takes the low 48 bits and the
+ * tag the high 16; on 32-bit targets each takes half. Slabs are never
+ * returned before the allocator is destroyed, so reading the link of a slot
+ * that another thread has just taken is always safe. Only growing the pool
+ * when the stack is empty takes a lock.
+ *
+ * The allocation policy is that of PoolAllocator: only single instances of
+ * T are served.
+ *
+ * @tparam T The type that is allocated.
+ */
+template<typename T>
+class ConcurrentPoolAllocator: public IAllocator<T>
+{
+  private:
+    /**
+     * Defines the header at the start of every slab.
+     */
+    struct Slab
+    {
+        /**
+         * The previously allocated slab.
+         */
+        Slab* next;
+    };
+
+    /**
+     * Defines a free slot, which holds the next free slot.
+     */
+    struct Slot
+    {
+        /**
+         * The next free slot.
+         */
+        std::atomic<uintptr_t> next;
+    };
+
+    /**
+     * The number of low bits of the head that hold the slot address.
+     */
+    static const unsigned ADDRESS_BITS = sizeof(void*) == 8 ? 48 : 32;
+
+    /**
+     * Selects the slot address of the head.
+     */
+    static const uint64 ADDRESS_MASK = (uint64(1) << ADDRESS_BITS) - 1;
+
+    /**
+     * The memory that slabs are allocated from.
+     */
+    IMemory* _memory;
+
+    /**
+     * The tagged address of the first free slot.
+     */
+    std::atomic<uint64> _head;
+
+    /**
+     * Guards growth and the slab list.
+     */
+    std::mutex _lock;
+
+    /**
+     * The most recently allocated slab.
+     */
+    Slab* _slabs;
+
+    /**
+     * The number of slots in each slab.
+     */
+    Size _slabSlots;
+
+    /**
+     * The number of slots in all slabs.
+     */
+    std::atomic<Size> _capacity;
+
+    // HELPER FUNCTIONS
+    /**
+     * Pops the first free slot.
+     *
+     * @return The slot, or null when there are none.
+     */
+    Slot* pop();
+
+    /**
+     * Pushes a chain of linked slots.
+     *
+     * @param first The first slot.
+     * @param last  The last slot.
+     */
+    void push(Slot* first, Slot* last);
+
+    /**
+     * Allocates a new slab and pushes all but its first slot.
+     *
+     * @return The first slot, or null if the backing memory is exhausted.
+     */
+    Slot* grow();
+
+    // DISABLED
+    ConcurrentPoolAllocator(const ConcurrentPoolAllocator<T>&);
+
+    ConcurrentPoolAllocator<T>& operator=(const ConcurrentPoolAllocator<T>&);
+
+  public:
+    /**
+     * The alignment of every slot.
+     */
+    static const Size ALIGNMENT =
+        alignof(T) > alignof(Slot) ? alignof(T) : alignof(Slot);
+
+    /**
+     * The size of every slot, in bytes.
+     */
+    static const Size SLOT_SIZE =
+        ((sizeof(T) > sizeof(Slot) ? sizeof(T) : sizeof(Slot)) +
+         ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+
+    // CONSTRUCTORS
+    /**
+     * Constructs a new empty pool.
+     *
+     * @param slabSlots The number of slots in each slab.
+     * @param memory    The memory that slabs are allocated from.
+     */
+    explicit ConcurrentPoolAllocator(Size slabSlots = 256,
+                                     IMemory& memory =
+                                         HeapMemory::instance());
+
+    /**
+     * Destructor. This releases every slab, so no thread may use the
+     * allocator while or after it is destroyed.
+     */
+    virtual ~ConcurrentPoolAllocator();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Allocates a block of memory.
+     *
+     * @param count The size of the memory block, in instances of T. This
+     *              must be zero or one.
+     * @return      A pointer to the allocated block, or null for a count of
+     *              zero or if the backing memory is exhausted.
+     */
+    virtual T* allocate(Size count);
+
+    /**
+     * Reallocates a pre-existing block of memory.
+     *
+     * @param ptr   A pointer to the existing memory block, or null.
+     * @param count The new size of the memory block, in instances of T.
+     *              This must be zero or one.
+     * @return      A pointer to the reallocated block, which is ptr when it
+     *              was already allocated, or null when it was freed.
+     */
+    virtual T* reallocate(T* ptr, Size count);
+
+    /**
+     * Releases a block of memory. Any thread may free a block allocated by
+     * another.
+     *
+     * @param ptr A pointer to the allocated memory block, or null.
+     */
+    virtual void free(T* ptr);
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the number of slots in all slabs.
+     *
+     * @return The capacity.
+     */
+    Size capacity() const;
+
+    /**
+     * Gets the number of slots in each slab.
+     *
+     * @return The number of slots.
+     */
+    Size slabSlots() const;
+};
+
+// CONSTRUCTORS
+template<typename T>
+inline
+ConcurrentPoolAllocator<T>::ConcurrentPoolAllocator(Size slabSlots,
+                                                    IMemory& memory)
+    : _memory(&memory), _head(0), _slabs(0), _slabSlots(slabSlots),
+      _capacity(0)
+{
+    assert(slabSlots > 0);
+}
+
+template<typename T>
+inline
+ConcurrentPoolAllocator<T>::~ConcurrentPoolAllocator()
+{
+    while (_slabs)
+    {
+        Slab* next = _slabs->next;
+        _memory->release(_slabs);
+        _slabs = next;
+    }
+}
+
+// MEMBER FUNCTIONS
+template<typename T>
+inline
+T* ConcurrentPoolAllocator<T>::allocate(Size count)
+{
+    assert(count <= 1);
+    if (count != 1)
+    {
+        return 0;
+    }
+
+    Slot* slot = pop();
+    if (!slot)
+    {
+        slot = grow();
+    }
+    return reinterpret_cast<T*>(slot);
+}
+
+template<typename T>
+inline
+T* ConcurrentPoolAllocator<T>::reallocate(T* ptr, Size count)
+{
+    if (!ptr)
+    {
+        return allocate(count);
+    }
+
+    assert(count <= 1);
+    if (count == 0)
+    {
+        free(ptr);
+    }
+    return count == 1 ? ptr : 0;
+}
+
+template<typename T>
+inline
+void ConcurrentPoolAllocator<T>::free(T* ptr)
+{
+    if (ptr)
+    {
+        Slot* slot = new (ptr) Slot;
+        push(slot, slot);
+    }
+}
+
+// ACCESSOR FUNCTIONS
+template<typename T>
+inline
+Size ConcurrentPoolAllocator<T>::capacity() const
+{
+    return _capacity.load(std::memory_order_relaxed);
+}
+
+template<typename T>
+inline
+Size ConcurrentPoolAllocator<T>::slabSlots() const
+{
+    return _slabSlots;
+}
+
+template<typename T>
+const unsigned ConcurrentPoolAllocator<T>::ADDRESS_BITS;
+
+template<typename T>
+const uint64 ConcurrentPoolAllocator<T>::ADDRESS_MASK;
+
+template<typename T>
+const Size ConcurrentPoolAllocator<T>::ALIGNMENT;
+
+template<typename T>
+const Size ConcurrentPoolAllocator<T>::SLOT_SIZE;
+
+// HELPER FUNCTIONS
+template<typename T>
+inline
+typename ConcurrentPoolAllocator<T>::Slot* ConcurrentPoolAllocator<T>::pop()
+{
+    uint64 head = _head.load(std::memory_order_acquire);
+    while (head & ADDRESS_MASK)
+    {
+        // the slot may be popped and reused by another thread before the
+        // exchange, in which case the link read here is stale and the
+        // changed tag makes the exchange fail
+        Slot* slot = reinterpret_cast<Slot*>(
+            static_cast<uintptr_t>(head & ADDRESS_MASK));
+        const uint64 next = slot->next.load(std::memory_order_relaxed);
+        const uint64 tag = (head >> ADDRESS_BITS) + 1;
+        if (_head.compare_exchange_weak(head, tag << ADDRESS_BITS | next,
+                                        std::memory_order_acquire,
+                                        std::memory_order_acquire))
+        {
+            return slot;
+        }
+    }
+    return 0;
+}
+
+template<typename T>
+inline
+void ConcurrentPoolAllocator<T>::push(Slot* first, Slot* last)
+{
+    const uint64 address = reinterpret_cast<uintptr_t>(first);
+    assert((address & ~ADDRESS_MASK) == 0);
+
+    uint64 head = _head.load(std::memory_order_relaxed);
+    uint64 tagged;
+    do
+    {
+        last->next.store(static_cast<uintptr_t>(head & ADDRESS_MASK),
+                         std::memory_order_relaxed);
+        tagged = ((head >> ADDRESS_BITS) + 1) << ADDRESS_BITS | address;
+    }
+    while (!_head.compare_exchange_weak(head, tagged,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed));
+}
+
+template<typename T>
+inline
+typename ConcurrentPoolAllocator<T>::Slot* ConcurrentPoolAllocator<T>::grow()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    // another thread may have grown the pool while this one waited
+    Slot* slot = pop();
+    if (slot)
+    {
+        return slot;
+    }
+
+    // the backing memory only guarantees the alignment of malloc, so over
+    // allocate enough to align the first slot by hand
+    const Size bytes = sizeof(Slab) + ALIGNMENT - 1 + _slabSlots * SLOT_SIZE;
+    Slab* slab = static_cast<Slab*>(_memory->allocate(bytes));
+    if (!slab)
+    {
+        return 0;
+    }
+    slab->next = _slabs;
+    _slabs = slab;
+
+    uintptr_t first = reinterpret_cast<uintptr_t>(slab + 1);
+    first = (first + ALIGNMENT - 1) & ~static_cast<uintptr_t>(ALIGNMENT - 1);
+    char* slots = reinterpret_cast<char*>(first);
+
+    // link the rest of the slab privately, then publish it with one swap
+    if (_slabSlots > 1)
+    {
+        Slot* last = new (slots + SLOT_SIZE) Slot;
+        Slot* head = last;
+        for (Size i = 2; i < _slabSlots; ++i)
+        {
+            Slot* s = new (slots + i * SLOT_SIZE) Slot;
+            s->next.store(reinterpret_cast<uintptr_t>(head),
+                          std::memory_order_relaxed);
+            head = s;
+        }
+        push(head, last);
+    }
+
+    _capacity.fetch_add(_slabSlots, std::memory_order_relaxed);
+    return reinterpret_cast<Slot*>(slots);
+}
+
+} // End nspc mem
+
+} // End nspc gel
+
+#endif //GEL_CONCURRENT_POOL_ALLOCATOR_H
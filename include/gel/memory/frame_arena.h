@@ -0,0 +1,639 @@
+// frame_arena.h
+#ifndef GEL_FRAME_ARENA_H
+#define GEL_FRAME_ARENA_H
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include "gel/core/itickable.h"
+#include "gel/memory/iallocator.h"
+#include "gel/memory/imemory.h"
+#include "gel/memory/heap_memory.h"
+
+namespace gel
+{
+
+namespace mem
+{
+
+/**
+ * @brief Defines a bump-pointer arena whose memory lives for one frame.
+ *
+ * Allocating moves a cursor through a chunk of backing memory and releasing
+ * a block does nothing; all blocks are reclaimed at once when the frame
+ * ends in postick(). An arena that runs out of room chains overflow chunks
+ * and, when the frame ends, replaces them with a single chunk large enough
+ * for the whole frame, so steady state frames never touch the backing
+ * memory.
+ *
+ * A double-buffered arena alternates between two buffers, so blocks
+ * allocated during a frame stay valid until the end of the next one.
+ *
+ * The arena is not thread safe and is meant to be ticked by the thread that
+ * allocates from it.
+ */
+class FrameArena: public IMemory, public core::ITickable
+{
+  private:
+    /**
+     * Defines the header at the start of every chunk.
+     */
+    struct Chunk
+    {
+        /**
+         * The previously allocated chunk of the buffer.
+         */
+        Chunk* next;
+
+        /**
+         * The end of the chunk.
+         */
+        char* end;
+    };
+
+    /**
+     * Defines the chunks that serve a frame.
+     */
+    struct Buffer
+    {
+        /**
+         * The newest chunk.
+         */
+        Chunk* chunks;
+
+        /**
+         * The next free byte of the newest chunk.
+         */
+        char* cursor;
+
+        /**
+         * The number of bytes used in chunks other than the newest.
+         */
+        Size spilled;
+    };
+
+    /**
+     * The memory that chunks are allocated from.
+     */
+    IMemory* _memory;
+
+    /**
+     * The buffers, only the first of which is used when single buffered.
+     */
+    Buffer _buffers[2];
+
+    /**
+     * The index of the buffer of the current frame.
+     */
+    unsigned _current;
+
+    /**
+     * If the arena alternates between both buffers.
+     */
+    bool _doubleBuffered;
+
+    /**
+     * The size of the first chunk of every frame, in bytes.
+     */
+    Size _capacity;
+
+    /**
+     * The most recently allocated block of the current frame.
+     */
+    char* _last;
+
+    // HELPER FUNCTIONS
+    /**
+     * Gets the first usable byte of a chunk.
+     *
+     * @param chunk The chunk.
+     * @return      The first byte.
+     */
+    static char* begin(Chunk* chunk);
+
+    /**
+     * Aligns a pointer.
+     *
+     * @param ptr       The pointer.
+     * @param alignment The alignment, which must be a power of two.
+     * @return          The pointer, rounded up to the alignment.
+     */
+    static char* align(char* ptr, Size alignment);
+
+    /**
+     * Adds a chunk to a buffer.
+     *
+     * @param buffer The buffer.
+     * @param size   The minimum number of usable bytes.
+     * @return       If the backing memory provided the chunk.
+     */
+    bool grow(Buffer& buffer, Size size);
+
+    /**
+     * Reclaims every block of a buffer, merging its chunks if it overflowed.
+     *
+     * @param buffer The buffer.
+     */
+    void reset(Buffer& buffer);
+
+    /**
+     * Releases every chunk of a buffer.
+     *
+     * @param buffer The buffer.
+     */
+    void clear(Buffer& buffer);
+
+    /**
+     * Gets the number of bytes from a block to the end of the used part of
+     * the chunk that holds it.
+     *
+     * @param ptr The block.
+     * @return    The number of bytes, or zero if the arena does not own it.
+     */
+    Size extent(const char* ptr) const;
+
+    // DISABLED
+    FrameArena(const FrameArena&);
+
+    FrameArena& operator=(const FrameArena&);
+
+  public:
+    /**
+     * The alignment of blocks allocated without an explicit alignment.
+     */
+    static const Size ALIGNMENT = 16;
+
+    // CONSTRUCTORS
+    /**
+     * Constructs a new arena.
+     *
+     * @param capacity       The size of the first chunk of every frame, in
+     *                       bytes.
+     * @param doubleBuffered If blocks survive until the end of the next
+     *                       frame.
+     * @param memory         The memory that chunks are allocated from.
+     */
+    explicit FrameArena(Size capacity, bool doubleBuffered = false,
+                        IMemory& memory = HeapMemory::instance());
+
+    /**
+     * Destructor. This releases every chunk.
+     */
+    virtual ~FrameArena();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Allocates a block of memory for the current frame.
+     *
+     * @param size The size of the memory block, in bytes.
+     * @return     A pointer to the block aligned to ALIGNMENT, or null for a
+     *             size of zero or if the backing memory is exhausted.
+     */
+    virtual void* allocate(Size size);
+
+    /**
+     * Allocates an aligned block of memory for the current frame.
+     *
+     * @param size      The size of the memory block, in bytes.
+     * @param alignment The alignment, which must be a power of two.
+     * @return          A pointer to the block, or null for a size of zero or
+     *                  if the backing memory is exhausted.
+     */
+    void* allocate(Size size, Size alignment);
+
+    /**
+     * Reallocates a block of memory. The most recently allocated block is
+     * resized in place when it fits, any other block is copied.
+     *
+     * @param pointer The pointer to the previously allocated block, or null.
+     * @param size    The new size for the memory block, in bytes.
+     * @return        A pointer to the reallocated block, or null if the size
+     *                is zero or the backing memory is exhausted.
+     */
+    virtual void* reallocate(void* pointer, Size size);
+
+    /**
+     * Does nothing, since blocks are reclaimed when their frame ends.
+     *
+     * @param pointer The pointer to the allocated block.
+     */
+    virtual void release(void* pointer);
+
+    /**
+     * Does nothing.
+     *
+     * @param dt The time in milliseconds since the last tick cycle.
+     */
+    virtual void pretick(time::Duration dt);
+
+    /**
+     * Does nothing.
+     *
+     * @param dt The time in milliseconds since the last tick cycle.
+     */
+    virtual void tick(time::Duration dt);
+
+    /**
+     * Ends the frame.
+     *
+     * @param dt The time in milliseconds since the last tick cycle.
+     */
+    virtual void postick(time::Duration dt);
+
+    /**
+     * Ends the frame, reclaiming the blocks of the current frame, or of the
+     * previous frame when double buffered.
+     */
+    void flip();
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the number of bytes allocated during the current frame, including
+     * alignment padding.
+     *
+     * @return The size.
+     */
+    Size size() const;
+
+    /**
+     * Gets the size of the first chunk of every frame.
+     *
+     * @return The capacity, in bytes.
+     */
+    Size capacity() const;
+
+    /**
+     * Gets if blocks survive until the end of the next frame.
+     *
+     * @return If the arena is double buffered.
+     */
+    bool isDoubleBuffered() const;
+};
+
+/**
+ * @brief Defines a typed view of a frame arena.
+ *
+ * Freeing a block does nothing, so containers that use this allocator must
+ * not outlive the frame.
+ *
+ * @tparam T The type that is allocated.
+ */
+template<typename T>
+class FrameAllocator: public IAllocator<T>
+{
+  private:
+    /**
+     * The arena that blocks are allocated from.
+     */
+    FrameArena* _arena;
+
+  public:
+    // CONSTRUCTORS
+    /**
+     * Constructs a new allocator.
+     *
+     * @param arena The arena that blocks are allocated from.
+     */
+    explicit FrameAllocator(FrameArena& arena);
+
+    /**
+     * Destructor.
+     */
+    virtual ~FrameAllocator();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Allocates a block of memory.
+     *
+     * @param count The size of the memory block, in instances of T.
+     * @return      A pointer to the allocated block.
+     */
+    virtual T* allocate(Size count);
+
+    /**
+     * Reallocates a pre-existing block of memory.
+     *
+     * @param ptr   A pointer to the existing memory block.
+     * @param count The new size of the memory block, in instances of T.
+     * @return      A pointer to the reallocated block.
+     */
+    virtual T* reallocate(T* ptr, Size count);
+
+    /**
+     * Does nothing, since blocks are reclaimed when their frame ends.
+     *
+     * @param ptr A pointer to the allocated memory block.
+     */
+    virtual void free(T* ptr);
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the arena that blocks are allocated from.
+     *
+     * @return The arena.
+     */
+    FrameArena& arena() const;
+};
+
+// CONSTRUCTORS
+inline
+FrameArena::FrameArena(Size capacity, bool doubleBuffered, IMemory& memory)
+    : _memory(&memory), _current(0), _doubleBuffered(doubleBuffered),
+      _capacity(capacity), _last(0)
+{
+    assert(capacity > 0);
+    for (unsigned i = 0; i < 2; ++i)
+    {
+        _buffers[i].chunks = 0;
+        _buffers[i].cursor = 0;
+        _buffers[i].spilled = 0;
+    }
+
+    grow(_buffers[0], capacity);
+    if (doubleBuffered)
+    {
+        grow(_buffers[1], capacity);
+    }
+}
+
+inline
+FrameArena::~FrameArena()
+{
+    clear(_buffers[0]);
+    clear(_buffers[1]);
+}
+
+// MEMBER FUNCTIONS
+inline
+void* FrameArena::allocate(Size size)
+{
+    return allocate(size, ALIGNMENT);
+}
+
+inline
+void* FrameArena::allocate(Size size, Size alignment)
+{
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    Buffer& buffer = _buffers[_current];
+    char* ptr = buffer.chunks ? align(buffer.cursor, alignment) : 0;
+    if (!ptr || ptr > buffer.chunks->end ||
+        size > static_cast<Size>(buffer.chunks->end - ptr))
+    {
+        if (!grow(buffer, size + alignment - 1))
+        {
+            return 0;
+        }
+        ptr = align(buffer.cursor, alignment);
+    }
+
+    buffer.cursor = ptr + size;
+    _last = ptr;
+    return ptr;
+}
+
+inline
+void* FrameArena::reallocate(void* pointer, Size size)
+{
+    char* ptr = static_cast<char*>(pointer);
+    if (!ptr)
+    {
+        return allocate(size);
+    }
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    Buffer& buffer = _buffers[_current];
+    if (ptr == _last && size <= static_cast<Size>(buffer.chunks->end - ptr))
+    {
+        buffer.cursor = ptr + size;
+        return ptr;
+    }
+
+    // the old size is unknown, but the block lies within its extent, so
+    // copying up to it preserves the contents
+    const Size bytes = extent(ptr);
+    assert(bytes > 0);
+    void* block = allocate(size);
+    if (block)
+    {
+        ::memcpy(block, ptr, size < bytes ? size : bytes);
+    }
+    return block;
+}
+
+inline
+void FrameArena::release(void*)
+{
+}
+
+inline
+void FrameArena::pretick(time::Duration)
+{
+}
+
+inline
+void FrameArena::tick(time::Duration)
+{
+}
+
+inline
+void FrameArena::postick(time::Duration)
+{
+    flip();
+}
+
+inline
+void FrameArena::flip()
+{
+    if (_doubleBuffered)
+    {
+        _current ^= 1;
+    }
+    reset(_buffers[_current]);
+    _last = 0;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+Size FrameArena::size() const
+{
+    const Buffer& buffer = _buffers[_current];
+    if (!buffer.chunks)
+    {
+        return buffer.spilled;
+    }
+    return buffer.spilled + (buffer.cursor - begin(buffer.chunks));
+}
+
+inline
+Size FrameArena::capacity() const
+{
+    return _capacity;
+}
+
+inline
+bool FrameArena::isDoubleBuffered() const
+{
+    return _doubleBuffered;
+}
+
+// HELPER FUNCTIONS
+inline
+char* FrameArena::begin(Chunk* chunk)
+{
+    return align(reinterpret_cast<char*>(chunk + 1), ALIGNMENT);
+}
+
+inline
+char* FrameArena::align(char* ptr, Size alignment)
+{
+    uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+    const uintptr_t mask = static_cast<uintptr_t>(alignment - 1);
+    address = (address + mask) & ~mask;
+    return reinterpret_cast<char*>(address);
+}
+
+inline
+bool FrameArena::grow(Buffer& buffer, Size size)
+{
+    if (size < _capacity)
+    {
+        size = _capacity;
+    }
+
+    // the backing memory only guarantees the alignment of malloc, so over
+    // allocate enough to align the first block by hand
+    const Size bytes = sizeof(Chunk) + ALIGNMENT - 1 + size;
+    Chunk* chunk = static_cast<Chunk*>(_memory->allocate(bytes));
+    if (!chunk)
+    {
+        return false;
+    }
+
+    if (buffer.chunks)
+    {
+        buffer.spilled += buffer.cursor - begin(buffer.chunks);
+    }
+    chunk->next = buffer.chunks;
+    chunk->end = begin(chunk) + size;
+    buffer.chunks = chunk;
+    buffer.cursor = begin(chunk);
+    return true;
+}
+
+inline
+void FrameArena::reset(Buffer& buffer)
+{
+    if (buffer.chunks && buffer.chunks->next)
+    {
+        // size the next frame for everything this one needed
+        const Size used = buffer.spilled +
+                          (buffer.cursor - begin(buffer.chunks));
+        clear(buffer);
+        if (used > _capacity)
+        {
+            _capacity = used;
+        }
+        grow(buffer, _capacity);
+    }
+    else if (buffer.chunks)
+    {
+        buffer.cursor = begin(buffer.chunks);
+    }
+    else
+    {
+        grow(buffer, _capacity);
+    }
+    buffer.spilled = 0;
+}
+
+inline
+void FrameArena::clear(Buffer& buffer)
+{
+    while (buffer.chunks)
+    {
+        Chunk* next = buffer.chunks->next;
+        _memory->release(buffer.chunks);
+        buffer.chunks = next;
+    }
+    buffer.cursor = 0;
+    buffer.spilled = 0;
+}
+
+inline
+Size FrameArena::extent(const char* ptr) const
+{
+    for (unsigned i = 0; i < 2; ++i)
+    {
+        const Buffer& buffer = _buffers[i];
+        for (Chunk* chunk = buffer.chunks; chunk; chunk = chunk->next)
+        {
+            const char* end = chunk == buffer.chunks ? buffer.cursor
+                                                     : chunk->end;
+            if (ptr >= begin(chunk) && ptr < end)
+            {
+                return end - ptr;
+            }
+        }
+    }
+    return 0;
+}
+
+// CONSTRUCTORS
+template<typename T>
+inline
+FrameAllocator<T>::FrameAllocator(FrameArena& arena)
+    : _arena(&arena)
+{
+}
+
+template<typename T>
+inline
+FrameAllocator<T>::~FrameAllocator()
+{
+}
+
+// MEMBER FUNCTIONS
+template<typename T>
+inline
+T* FrameAllocator<T>::allocate(Size count)
+{
+    const Size alignment = alignof(T) > FrameArena::ALIGNMENT ?
+                           alignof(T) : FrameArena::ALIGNMENT;
+    return static_cast<T*>(_arena->allocate(count * sizeof(T), alignment));
+}
+
+template<typename T>
+inline
+T* FrameAllocator<T>::reallocate(T* ptr, Size count)
+{
+    assert(alignof(T) <= FrameArena::ALIGNMENT);
+    return static_cast<T*>(_arena->reallocate(ptr, count * sizeof(T)));
+}
+
+template<typename T>
+inline
+void FrameAllocator<T>::free(T*)
+{
+}
+
+// ACCESSOR FUNCTIONS
+template<typename T>
+inline
+FrameArena& FrameAllocator<T>::arena() const
+{
+    return *_arena;
+}
+
+} // End nspc mem
+
+} // End nspc gel
+
+#endif //GEL_FRAME_ARENA_H
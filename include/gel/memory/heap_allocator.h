@@ -0,0 +1,104 @@
+// heap_allocator.h
+#ifndef GEL_HEAP_ALLOCATOR_H
+#define GEL_HEAP_ALLOCATOR_H
+
+#include <stdlib.h>
+#include "gel/memory/iallocator.h"
+
+namespace gel
+{
+
+namespace mem
+{
+
+/**
+ * @brief Defines an allocator that wraps the system heap.
+ *
+ * Blocks are aligned to at least 16 bytes on all supported targets. This is
+ * the allocator used by containers when none is provided.
+ *
+ * @tparam T The type that is allocated.
+ */
+template<typename T>
+class HeapAllocator: public IAllocator<T>
+{
+  public:
+    /**
+     * Destructor.
+     */
+    virtual ~HeapAllocator();
+
+    /**
+     * Allocates a block of memory.
+     *
+     * @param count The size of the memory block, in instances of T.
+     * @return      A pointer to the allocated block.
+     */
+    virtual T* allocate(Size count);
+
+    /**
+     * Reallocates a pre-existing block of memory.
+     *
+     * @param ptr   A pointer to the existing memory block.
+     * @param count The new size of the memory block, in instances of T.
+     * @return      A pointer to the reallocated block.
+     */
+    virtual T* reallocate(T* ptr, Size count);
+
+    /**
+     * Releases a block of memory.
+     *
+     * @param ptr A pointer to the allocated memory block.
+     */
+    virtual void free(T* ptr);
+
+    /**
+     * Gets the shared heap allocator instance.
+     *
+     * @return The shared instance.
+     */
+    static HeapAllocator<T>& instance();
+};
+
+template<typename T>
+inline
+HeapAllocator<T>::~HeapAllocator()
+{
+}
+
+template<typename T>
+inline
+T* HeapAllocator<T>::allocate(Size count)
+{
+    return static_cast<T*>(::malloc(count * sizeof(T)));
+}
+
+template<typename T>
+inline
+T* HeapAllocator<T>::reallocate(T* ptr, Size count)
+{
+    // the blocks are raw storage, which the caller constructs into
+    return static_cast<T*>(
+        ::realloc(static_cast<void*>(ptr), count * sizeof(T)));
+}
+
+template<typename T>
+inline
+void HeapAllocator<T>::free(T* ptr)
+{
+    ::free(ptr);
+}
+
+template<typename T>
+inline
+HeapAllocator<T>& HeapAllocator<T>::instance()
+{
+    static HeapAllocator<T> allocator;
+    return allocator;
+}
+
+} // End nspc mem
+
+} // End nspc gel
+
+#endif //GEL_HEAP_ALLOCATOR_H
@@ -0,0 +1,94 @@
+// heap_memory.h
+#ifndef GEL_HEAP_MEMORY_H
+#define GEL_HEAP_MEMORY_H
+
+#include <stdlib.h>
+#include "gel/memory/imemory.h"
+
+namespace gel
+{
+
+namespace mem
+{
+
+/**
+ * @brief Defines a memory pool that wraps the system heap.
+ *
+ * Blocks are aligned to at least 16 bytes on all supported targets. This is
+ * the memory used by allocators when none is provided.
+ */
+class HeapMemory: public IMemory
+{
+  public:
+    /**
+     * Destructor.
+     */
+    virtual ~HeapMemory();
+
+    /**
+     * Allocates a block of memory.
+     *
+     * @param size The size of the memory block, in bytes.
+     * @return     A pointer to the allocated block.
+     */
+    virtual void* allocate(Size size);
+
+    /**
+     * Reallocates a block of memory.
+     *
+     * @param pointer The pointer to the previously allocated block.
+     * @param size    The new size for the memory block, in bytes.
+     * @return        A pointer to the reallocated block.
+     */
+    virtual void* reallocate(void* pointer, Size size);
+
+    /**
+     * Releases a block of memory.
+     *
+     * @param pointer The pointer to the allocated block.
+     */
+    virtual void release(void* pointer);
+
+    /**
+     * Gets the shared heap memory instance.
+     *
+     * @return The shared instance.
+     */
+    static HeapMemory& instance();
+};
+
+inline
+HeapMemory::~HeapMemory()
+{
+}
+
+inline
+void* HeapMemory::allocate(Size size)
+{
+    return ::malloc(size);
+}
+
+inline
+void* HeapMemory::reallocate(void* pointer, Size size)
+{
+    return ::realloc(pointer, size);
+}
+
+inline
+void HeapMemory::release(void* pointer)
+{
+    ::free(pointer);
+}
+
+inline
+HeapMemory& HeapMemory::instance()
+{
+    static HeapMemory memory;
+    return memory;
+}
+
+} // End nspc mem
+
+} // End nspc gel
+
+#endif //GEL_HEAP_MEMORY_H
@@ -2,7 +2,11 @@
 #ifndef GEL_POOL_ALLOCATOR_H
 #define GEL_POOL_ALLOCATOR_H
 
-#include "iallocator.h"
+#include <assert.h>
+#include <stdint.h>
+#include "gel/memory/iallocator.h"
+#include "gel/memory/imemory.h"
+#include "gel/memory/heap_memory.h"
 
 namespace gel
 {
@@ -10,12 +14,343 @@ namespace gel
 namespace mem
 {
 
+/**
+ * @brief Defines an allocator of single objects from fixed-size slots.
+ *
+ * Slots are carved from slabs that are requested from an IMemory as the
+ * pool grows and are only returned to it when the pool is destroyed. Freed
+ * slots form an intrusive free list, so allocating and freeing a single
+ * instance of T are O(1) and never touch the backing memory.
+ *
+ * The pool only serves one instance per block: allocate(1) returns a slot,
+ * allocate(0) returns null and any larger count is a programming error that
+ * asserts and returns null. reallocate() follows the same rules, so it
+ * keeps a block at a count of one, frees it at zero and otherwise fails
+ * and leaves the block untouched.
+ *
+ * @tparam T The type that is allocated.
+ */
 template<typename T>
-class PoolAllocator: IAllocator<T>
+class PoolAllocator: public IAllocator<T>
 {
+  private:
+    /**
+     * Defines the header at the start of every slab.
+     */
+    struct Slab
+    {
+        /**
+         * The previously allocated slab.
+         */
+        Slab* next;
+    };
 
+    /**
+     * Defines a free slot, which holds the next free slot.
+     */
+    struct Slot
+    {
+        /**
+         * The next free slot.
+         */
+        Slot* next;
+    };
+
+    /**
+     * The memory that slabs are allocated from.
+     */
+    IMemory* _memory;
+
+    /**
+     * The most recently allocated slab.
+     */
+    Slab* _slabs;
+
+    /**
+     * The first free slot.
+     */
+    Slot* _free;
+
+    /**
+     * The next never used slot of the newest slab.
+     */
+    char* _cursor;
+
+    /**
+     * The end of the slots of the newest slab.
+     */
+    char* _end;
+
+    /**
+     * The number of slots in each slab.
+     */
+    Size _slabSlots;
+
+    /**
+     * The number of slots in all slabs.
+     */
+    Size _capacity;
+
+    /**
+     * The number of allocated slots.
+     */
+    Size _size;
+
+    // HELPER FUNCTIONS
+    /**
+     * Allocates a new slab.
+     *
+     * @return If the backing memory provided the slab.
+     */
+    bool grow();
+
+    // DISABLED
+    PoolAllocator(const PoolAllocator<T>&);
+
+    PoolAllocator<T>& operator=(const PoolAllocator<T>&);
+
+  public:
+    /**
+     * The alignment of every slot.
+     */
+    static const Size ALIGNMENT =
+        alignof(T) > alignof(Slot) ? alignof(T) : alignof(Slot);
+
+    /**
+     * The size of every slot, in bytes.
+     */
+    static const Size SLOT_SIZE =
+        ((sizeof(T) > sizeof(Slot) ? sizeof(T) : sizeof(Slot)) +
+         ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+
+    // CONSTRUCTORS
+    /**
+     * Constructs a new empty pool.
+     *
+     * @param slabSlots The number of slots in each slab.
+     * @param memory    The memory that slabs are allocated from.
+     */
+    explicit PoolAllocator(Size slabSlots = 64,
+                           IMemory& memory = HeapMemory::instance());
+
+    /**
+     * Destructor. This releases every slab, so every block must already be
+     * freed or abandoned.
+     */
+    virtual ~PoolAllocator();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Allocates a block of memory.
+     *
+     * @param count The size of the memory block, in instances of T. This
+     *              must be zero or one.
+     * @return      A pointer to the allocated block, or null for a count of
+     *              zero or if the backing memory is exhausted.
+     */
+    virtual T* allocate(Size count);
+
+    /**
+     * Reallocates a pre-existing block of memory.
+     *
+     * @param ptr   A pointer to the existing memory block, or null.
+     * @param count The new size of the memory block, in instances of T.
+     *              This must be zero or one.
+     * @return      A pointer to the reallocated block, which is ptr when it
+     *              was already allocated, or null when it was freed.
+     */
+    virtual T* reallocate(T* ptr, Size count);
+
+    /**
+     * Releases a block of memory.
+     *
+     * @param ptr A pointer to the allocated memory block, or null.
+     */
+    virtual void free(T* ptr);
+
+    /**
+     * Allocates slabs until the pool has at least the given capacity.
+     *
+     * @param capacity The number of slots.
+     */
+    void reserve(Size capacity);
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the number of allocated slots.
+     *
+     * @return The size.
+     */
+    Size size() const;
+
+    /**
+     * Gets the number of slots in all slabs.
+     *
+     * @return The capacity.
+     */
+    Size capacity() const;
+
+    /**
+     * Gets the number of slots in each slab.
+     *
+     * @return The number of slots.
+     */
+    Size slabSlots() const;
 };
 
+// CONSTRUCTORS
+template<typename T>
+inline
+PoolAllocator<T>::PoolAllocator(Size slabSlots, IMemory& memory)
+    : _memory(&memory), _slabs(0), _free(0), _cursor(0), _end(0),
+      _slabSlots(slabSlots), _capacity(0), _size(0)
+{
+    assert(slabSlots > 0);
+}
+
+template<typename T>
+inline
+PoolAllocator<T>::~PoolAllocator()
+{
+    while (_slabs)
+    {
+        Slab* next = _slabs->next;
+        _memory->release(_slabs);
+        _slabs = next;
+    }
+}
+
+// MEMBER FUNCTIONS
+template<typename T>
+inline
+T* PoolAllocator<T>::allocate(Size count)
+{
+    assert(count <= 1);
+    if (count != 1)
+    {
+        return 0;
+    }
+
+    if (_free)
+    {
+        Slot* slot = _free;
+        _free = slot->next;
+        ++_size;
+        return reinterpret_cast<T*>(slot);
+    }
+
+    if (_cursor == _end && !grow())
+    {
+        return 0;
+    }
+
+    T* ptr = reinterpret_cast<T*>(_cursor);
+    _cursor += SLOT_SIZE;
+    ++_size;
+    return ptr;
+}
+
+template<typename T>
+inline
+T* PoolAllocator<T>::reallocate(T* ptr, Size count)
+{
+    if (!ptr)
+    {
+        return allocate(count);
+    }
+
+    assert(count <= 1);
+    if (count == 0)
+    {
+        free(ptr);
+    }
+    return count == 1 ? ptr : 0;
+}
+
+template<typename T>
+inline
+void PoolAllocator<T>::free(T* ptr)
+{
+    if (ptr)
+    {
+        assert(_size > 0);
+        Slot* slot = reinterpret_cast<Slot*>(ptr);
+        slot->next = _free;
+        _free = slot;
+        --_size;
+    }
+}
+
+template<typename T>
+inline
+void PoolAllocator<T>::reserve(Size capacity)
+{
+    while (_capacity < capacity && grow())
+    {
+    }
+}
+
+// ACCESSOR FUNCTIONS
+template<typename T>
+inline
+Size PoolAllocator<T>::size() const
+{
+    return _size;
+}
+
+template<typename T>
+inline
+Size PoolAllocator<T>::capacity() const
+{
+    return _capacity;
+}
+
+template<typename T>
+inline
+Size PoolAllocator<T>::slabSlots() const
+{
+    return _slabSlots;
+}
+
+template<typename T>
+const Size PoolAllocator<T>::ALIGNMENT;
+
+template<typename T>
+const Size PoolAllocator<T>::SLOT_SIZE;
+
+// HELPER FUNCTIONS
+template<typename T>
+inline
+bool PoolAllocator<T>::grow()
+{
+    // the backing memory only guarantees the alignment of malloc, so over
+    // allocate enough to align the first slot by hand
+    const Size bytes = sizeof(Slab) + ALIGNMENT - 1 + _slabSlots * SLOT_SIZE;
+    Slab* slab = static_cast<Slab*>(_memory->allocate(bytes));
+    if (!slab)
+    {
+        return false;
+    }
+
+    // chain the unused slots of the previous slab before dropping them
+    for (; _cursor != _end; _cursor += SLOT_SIZE)
+    {
+        Slot* slot = reinterpret_cast<Slot*>(_cursor);
+        slot->next = _free;
+        _free = slot;
+    }
+
+    slab->next = _slabs;
+    _slabs = slab;
+
+    uintptr_t first = reinterpret_cast<uintptr_t>(slab + 1);
+    first = (first + ALIGNMENT - 1) & ~static_cast<uintptr_t>(ALIGNMENT - 1);
+    _cursor = reinterpret_cast<char*>(first);
+    _end = _cursor + _slabSlots * SLOT_SIZE;
+    _capacity += _slabSlots;
+    return true;
+}
+
 } // End nspc mem
 
 } // End nspc gel
@@ -0,0 +1,797 @@
+// stack_allocator.h
+#ifndef GEL_STACK_ALLOCATOR_H
+#define GEL_STACK_ALLOCATOR_H
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include "gel/memory/imemory.h"
+#include "gel/memory/heap_memory.h"
+
+namespace gel
+{
+
+namespace mem
+{
+
+/**
+ * @brief Defines a last-in first-out allocator over one fixed buffer.
+ *
+ * The buffer is requested from an IMemory once, when the stack is
+ * constructed. Allocating bumps a cursor, and memory is returned by
+ * rewinding the cursor to a marker taken earlier, which frees every block
+ * allocated since in O(1). Releasing the most recent block pops it and
+ * releasing any other block does nothing. A full stack fails by returning
+ * null instead of growing.
+ *
+ * The stack is not thread safe.
+ */
+class StackAllocator: public IMemory
+{
+  public:
+    /**
+     * Defines a position in the stack to rewind to.
+     */
+    typedef Size Marker;
+
+  private:
+    /**
+     * The memory that the buffer is allocated from.
+     */
+    IMemory* _memory;
+
+    /**
+     * The buffer, as allocated.
+     */
+    void* _block;
+
+    /**
+     * The first usable byte of the buffer.
+     */
+    char* _begin;
+
+    /**
+     * The end of the buffer.
+     */
+    char* _end;
+
+    /**
+     * The next free byte.
+     */
+    char* _cursor;
+
+    /**
+     * The most recently allocated block.
+     */
+    char* _last;
+
+    // DISABLED
+    StackAllocator(const StackAllocator&);
+
+    StackAllocator& operator=(const StackAllocator&);
+
+  public:
+    /**
+     * The alignment of blocks allocated without an explicit alignment.
+     */
+    static const Size ALIGNMENT = 16;
+
+    // CONSTRUCTORS
+    /**
+     * Constructs a new empty stack.
+     *
+     * @param capacity The size of the buffer, in bytes.
+     * @param memory   The memory that the buffer is allocated from.
+     */
+    explicit StackAllocator(Size capacity,
+                            IMemory& memory = HeapMemory::instance());
+
+    /**
+     * Destructor. This releases the buffer.
+     */
+    virtual ~StackAllocator();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Allocates a block of memory.
+     *
+     * @param size The size of the memory block, in bytes.
+     * @return     A pointer to the block aligned to ALIGNMENT, or null for a
+     *             size of zero or if the stack is full.
+     */
+    virtual void* allocate(Size size);
+
+    /**
+     * Allocates an aligned block of memory.
+     *
+     * @param size      The size of the memory block, in bytes.
+     * @param alignment The alignment, which must be a power of two.
+     * @return          A pointer to the block, or null for a size of zero or
+     *                  if the stack is full.
+     */
+    void* allocate(Size size, Size alignment);
+
+    /**
+     * Reallocates a block of memory. The most recently allocated block is
+     * resized in place, any other block is copied.
+     *
+     * @param pointer The pointer to the previously allocated block, or null.
+     * @param size    The new size for the memory block, in bytes.
+     * @return        A pointer to the reallocated block, or null if the size
+     *                is zero or the stack is full.
+     */
+    virtual void* reallocate(void* pointer, Size size);
+
+    /**
+     * Pops the most recently allocated block and otherwise does nothing.
+     *
+     * @param pointer The pointer to the allocated block.
+     */
+    virtual void release(void* pointer);
+
+    /**
+     * Gets the current position of the stack.
+     *
+     * @return The marker.
+     */
+    Marker mark() const;
+
+    /**
+     * Frees every block allocated since a marker was taken.
+     *
+     * @param marker The marker, which must not be above the current
+     *               position.
+     */
+    void rewind(Marker marker);
+
+    /**
+     * Frees every block.
+     */
+    void clear();
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the number of allocated bytes, including alignment padding.
+     *
+     * @return The size.
+     */
+    Size size() const;
+
+    /**
+     * Gets the size of the buffer.
+     *
+     * @return The capacity, in bytes.
+     */
+    Size capacity() const;
+};
+
+/**
+ * @brief Defines a stack allocator that allocates from both ends of one
+ * buffer.
+ *
+ * The two ends grow towards each other, so data with two lifetimes, such as
+ * persistent data at the bottom and load-time scratch data at the top, share
+ * one buffer without fragmenting it. Each end is marked and rewound
+ * independently.
+ *
+ * The stack is not thread safe.
+ */
+class DoubleEndedStackAllocator: public IMemory
+{
+  public:
+    /**
+     * Defines an end of the stack.
+     */
+    enum End
+    {
+        BOTTOM,
+        TOP
+    };
+
+    /**
+     * Defines a position in one end of the stack to rewind to.
+     */
+    struct Marker
+    {
+        /**
+         * The offset of the position from the start of the buffer.
+         */
+        Size offset;
+
+        /**
+         * The end that was marked.
+         */
+        End end;
+    };
+
+  private:
+    /**
+     * The memory that the buffer is allocated from.
+     */
+    IMemory* _memory;
+
+    /**
+     * The buffer, as allocated.
+     */
+    void* _block;
+
+    /**
+     * The first usable byte of the buffer.
+     */
+    char* _begin;
+
+    /**
+     * The end of the buffer.
+     */
+    char* _end;
+
+    /**
+     * The next free byte at the bottom.
+     */
+    char* _bottom;
+
+    /**
+     * The lowest allocated byte at the top.
+     */
+    char* _top;
+
+    /**
+     * The most recently allocated block at the bottom.
+     */
+    char* _lastBottom;
+
+    /**
+     * The most recently allocated block at the top.
+     */
+    char* _lastTop;
+
+    /**
+     * The position of the top before its most recent block was allocated.
+     */
+    char* _previousTop;
+
+    // DISABLED
+    DoubleEndedStackAllocator(const DoubleEndedStackAllocator&);
+
+    DoubleEndedStackAllocator& operator=(const DoubleEndedStackAllocator&);
+
+  public:
+    /**
+     * The alignment of blocks allocated without an explicit alignment.
+     */
+    static const Size ALIGNMENT = 16;
+
+    // CONSTRUCTORS
+    /**
+     * Constructs a new empty stack.
+     *
+     * @param capacity The size of the buffer, in bytes.
+     * @param memory   The memory that the buffer is allocated from.
+     */
+    explicit DoubleEndedStackAllocator(Size capacity,
+                                       IMemory& memory =
+                                           HeapMemory::instance());
+
+    /**
+     * Destructor. This releases the buffer.
+     */
+    virtual ~DoubleEndedStackAllocator();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Allocates a block of memory from the bottom.
+     *
+     * @param size The size of the memory block, in bytes.
+     * @return     A pointer to the block aligned to ALIGNMENT, or null for a
+     *             size of zero or if the stack is full.
+     */
+    virtual void* allocate(Size size);
+
+    /**
+     * Allocates an aligned block of memory from either end.
+     *
+     * @param size      The size of the memory block, in bytes.
+     * @param end       The end to allocate from.
+     * @param alignment The alignment, which must be a power of two.
+     * @return          A pointer to the block, or null for a size of zero or
+     *                  if the stack is full.
+     */
+    void* allocate(Size size, End end, Size alignment = ALIGNMENT);
+
+    /**
+     * Reallocates a block of memory at the same end. The most recently
+     * allocated bottom block is resized in place, any other block is
+     * copied.
+     *
+     * @param pointer The pointer to the previously allocated block, or null.
+     * @param size    The new size for the memory block, in bytes.
+     * @return        A pointer to the reallocated block, or null if the size
+     *                is zero or the stack is full.
+     */
+    virtual void* reallocate(void* pointer, Size size);
+
+    /**
+     * Pops the most recently allocated block of either end and otherwise
+     * does nothing.
+     *
+     * @param pointer The pointer to the allocated block.
+     */
+    virtual void release(void* pointer);
+
+    /**
+     * Gets the current position of an end of the stack.
+     *
+     * @param end The end.
+     * @return    The marker.
+     */
+    Marker mark(End end = BOTTOM) const;
+
+    /**
+     * Frees every block allocated at the marked end since the marker was
+     * taken.
+     *
+     * @param marker The marker, which must not be past the current position
+     *               of its end.
+     */
+    void rewind(Marker marker);
+
+    /**
+     * Frees every block at one end.
+     *
+     * @param end The end.
+     */
+    void clear(End end);
+
+    /**
+     * Frees every block at both ends.
+     */
+    void clear();
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the number of allocated bytes at one end, including alignment
+     * padding.
+     *
+     * @param end The end.
+     * @return    The size.
+     */
+    Size size(End end) const;
+
+    /**
+     * Gets the size of the buffer.
+     *
+     * @return The capacity, in bytes.
+     */
+    Size capacity() const;
+};
+
+/**
+ * @brief Defines a scope that rewinds a stack allocator when it ends.
+ *
+ * @tparam Stack The type of the stack, either StackAllocator or
+ *               DoubleEndedStackAllocator.
+ */
+template<typename Stack>
+class StackScope
+{
+  private:
+    /**
+     * The stack that is rewound.
+     */
+    Stack* _stack;
+
+    /**
+     * The position that the stack is rewound to.
+     */
+    typename Stack::Marker _marker;
+
+    // DISABLED
+    StackScope(const StackScope<Stack>&);
+
+    StackScope<Stack>& operator=(const StackScope<Stack>&);
+
+  public:
+    // CONSTRUCTORS
+    /**
+     * Constructs a new scope that starts at the current position of the
+     * stack, or of its bottom end.
+     *
+     * @param stack The stack.
+     */
+    explicit StackScope(Stack& stack);
+
+    /**
+     * Constructs a new scope that starts at a marker.
+     *
+     * @param stack  The stack.
+     * @param marker The marker.
+     */
+    StackScope(Stack& stack, typename Stack::Marker marker);
+
+    /**
+     * Destructor. This frees every block allocated since the scope started.
+     */
+    ~StackScope();
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the position that the stack is rewound to.
+     *
+     * @return The marker.
+     */
+    typename Stack::Marker marker() const;
+};
+
+namespace detail
+{
+
+/**
+ * Aligns a pointer up.
+ *
+ * @param ptr       The pointer.
+ * @param alignment The alignment, which must be a power of two.
+ * @return          The pointer, rounded up to the alignment.
+ */
+inline
+char* alignUp(char* ptr, Size alignment)
+{
+    const uintptr_t mask = static_cast<uintptr_t>(alignment - 1);
+    return reinterpret_cast<char*>(
+        (reinterpret_cast<uintptr_t>(ptr) + mask) & ~mask);
+}
+
+/**
+ * Aligns a pointer down.
+ *
+ * @param ptr       The pointer.
+ * @param alignment The alignment, which must be a power of two.
+ * @return          The pointer, rounded down to the alignment.
+ */
+inline
+char* alignDown(char* ptr, Size alignment)
+{
+    const uintptr_t mask = static_cast<uintptr_t>(alignment - 1);
+    return reinterpret_cast<char*>(reinterpret_cast<uintptr_t>(ptr) & ~mask);
+}
+
+} // End nspc detail
+
+// CONSTRUCTORS
+inline
+StackAllocator::StackAllocator(Size capacity, IMemory& memory)
+    : _memory(&memory), _block(memory.allocate(capacity + ALIGNMENT - 1)),
+      _begin(0), _end(0), _cursor(0), _last(0)
+{
+    if (_block)
+    {
+        _begin = detail::alignUp(static_cast<char*>(_block), ALIGNMENT);
+        _end = _begin + capacity;
+    }
+    _cursor = _begin;
+}
+
+inline
+StackAllocator::~StackAllocator()
+{
+    if (_block)
+    {
+        _memory->release(_block);
+    }
+}
+
+// MEMBER FUNCTIONS
+inline
+void* StackAllocator::allocate(Size size)
+{
+    return allocate(size, ALIGNMENT);
+}
+
+inline
+void* StackAllocator::allocate(Size size, Size alignment)
+{
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+    char* ptr = detail::alignUp(_cursor, alignment);
+    if (size == 0 || ptr > _end || size > static_cast<Size>(_end - ptr))
+    {
+        return 0;
+    }
+
+    _cursor = ptr + size;
+    _last = ptr;
+    return ptr;
+}
+
+inline
+void* StackAllocator::reallocate(void* pointer, Size size)
+{
+    char* ptr = static_cast<char*>(pointer);
+    if (!ptr)
+    {
+        return allocate(size);
+    }
+    if (size == 0)
+    {
+        release(ptr);
+        return 0;
+    }
+
+    assert(ptr >= _begin && ptr < _cursor);
+    if (ptr == _last)
+    {
+        if (size > static_cast<Size>(_end - ptr))
+        {
+            return 0;
+        }
+        _cursor = ptr + size;
+        return ptr;
+    }
+
+    // the old size is unknown, but the block ends below the cursor, so
+    // copying up to it preserves the contents
+    const Size bytes = _cursor - ptr;
+    void* block = allocate(size);
+    if (block)
+    {
+        ::memcpy(block, ptr, size < bytes ? size : bytes);
+    }
+    return block;
+}
+
+inline
+void StackAllocator::release(void* pointer)
+{
+    if (pointer && pointer == _last)
+    {
+        _cursor = _last;
+        _last = 0;
+    }
+}
+
+inline
+StackAllocator::Marker StackAllocator::mark() const
+{
+    return _cursor - _begin;
+}
+
+inline
+void StackAllocator::rewind(Marker marker)
+{
+    assert(marker <= static_cast<Size>(_cursor - _begin));
+    _cursor = _begin + marker;
+    _last = 0;
+}
+
+inline
+void StackAllocator::clear()
+{
+    rewind(0);
+}
+
+// ACCESSOR FUNCTIONS
+inline
+Size StackAllocator::size() const
+{
+    return _cursor - _begin;
+}
+
+inline
+Size StackAllocator::capacity() const
+{
+    return _end - _begin;
+}
+
+// CONSTRUCTORS
+inline
+DoubleEndedStackAllocator::DoubleEndedStackAllocator(Size capacity,
+                                                     IMemory& memory)
+    : _memory(&memory), _block(memory.allocate(capacity + ALIGNMENT - 1)),
+      _begin(0), _end(0), _bottom(0), _top(0), _lastBottom(0), _lastTop(0),
+      _previousTop(0)
+{
+    if (_block)
+    {
+        _begin = detail::alignUp(static_cast<char*>(_block), ALIGNMENT);
+        _end = _begin + capacity;
+    }
+    _bottom = _begin;
+    _top = _end;
+}
+
+inline
+DoubleEndedStackAllocator::~DoubleEndedStackAllocator()
+{
+    if (_block)
+    {
+        _memory->release(_block);
+    }
+}
+
+// MEMBER FUNCTIONS
+inline
+void* DoubleEndedStackAllocator::allocate(Size size)
+{
+    return allocate(size, BOTTOM, ALIGNMENT);
+}
+
+inline
+void* DoubleEndedStackAllocator::allocate(Size size, End end,
+                                          Size alignment)
+{
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+    if (size == 0 || size > static_cast<Size>(_top - _bottom))
+    {
+        return 0;
+    }
+
+    if (end == BOTTOM)
+    {
+        char* ptr = detail::alignUp(_bottom, alignment);
+        if (ptr > _top || size > static_cast<Size>(_top - ptr))
+        {
+            return 0;
+        }
+        _bottom = ptr + size;
+        _lastBottom = ptr;
+        return ptr;
+    }
+
+    char* ptr = detail::alignDown(_top - size, alignment);
+    if (ptr < _bottom)
+    {
+        return 0;
+    }
+    _previousTop = _top;
+    _top = ptr;
+    _lastTop = ptr;
+    return ptr;
+}
+
+inline
+void* DoubleEndedStackAllocator::reallocate(void* pointer, Size size)
+{
+    char* ptr = static_cast<char*>(pointer);
+    if (!ptr)
+    {
+        return allocate(size);
+    }
+    if (size == 0)
+    {
+        release(ptr);
+        return 0;
+    }
+
+    if (ptr == _lastBottom)
+    {
+        if (size > static_cast<Size>(_top - ptr))
+        {
+            return 0;
+        }
+        _bottom = ptr + size;
+        return ptr;
+    }
+
+    // the old size is unknown, but the block ends below the cursor of its
+    // end, so copying up to it preserves the contents
+    const bool top = ptr >= _top;
+    assert(top ? ptr < _end : ptr >= _begin && ptr < _bottom);
+    const Size bytes = (top ? _end : _bottom) - ptr;
+    void* block = allocate(size, top ? TOP : BOTTOM, ALIGNMENT);
+    if (block)
+    {
+        ::memcpy(block, ptr, size < bytes ? size : bytes);
+    }
+    return block;
+}
+
+inline
+void DoubleEndedStackAllocator::release(void* pointer)
+{
+    if (!pointer)
+    {
+        return;
+    }
+
+    if (pointer == _lastBottom)
+    {
+        _bottom = _lastBottom;
+        _lastBottom = 0;
+    }
+    else if (pointer == _lastTop)
+    {
+        _top = _previousTop;
+        _lastTop = 0;
+    }
+}
+
+inline
+DoubleEndedStackAllocator::Marker
+DoubleEndedStackAllocator::mark(End end) const
+{
+    Marker marker;
+    marker.offset = (end == BOTTOM ? _bottom : _top) - _begin;
+    marker.end = end;
+    return marker;
+}
+
+inline
+void DoubleEndedStackAllocator::rewind(Marker marker)
+{
+    char* position = _begin + marker.offset;
+    if (marker.end == BOTTOM)
+    {
+        assert(position <= _bottom);
+        _bottom = position;
+        _lastBottom = 0;
+    }
+    else
+    {
+        assert(position >= _top && position <= _end);
+        _top = position;
+        _lastTop = 0;
+    }
+}
+
+inline
+void DoubleEndedStackAllocator::clear(End end)
+{
+    Marker marker;
+    marker.offset = end == BOTTOM ? 0 : _end - _begin;
+    marker.end = end;
+    rewind(marker);
+}
+
+inline
+void DoubleEndedStackAllocator::clear()
+{
+    clear(BOTTOM);
+    clear(TOP);
+}
+
+// ACCESSOR FUNCTIONS
+inline
+Size DoubleEndedStackAllocator::size(End end) const
+{
+    return end == BOTTOM ? _bottom - _begin : _end - _top;
+}
+
+inline
+Size DoubleEndedStackAllocator::capacity() const
+{
+    return _end - _begin;
+}
+
+// CONSTRUCTORS
+template<typename Stack>
+inline
+StackScope<Stack>::StackScope(Stack& stack)
+    : _stack(&stack), _marker(stack.mark())
+{
+}
+
+template<typename Stack>
+inline
+StackScope<Stack>::StackScope(Stack& stack, typename Stack::Marker marker)
+    : _stack(&stack), _marker(marker)
+{
+}
+
+template<typename Stack>
+inline
+StackScope<Stack>::~StackScope()
+{
+    _stack->rewind(_marker);
+}
+
+// ACCESSOR FUNCTIONS
+template<typename Stack>
+inline
+typename Stack::Marker StackScope<Stack>::marker() const
+{
+    return _marker;
+}
+
+} // End nspc mem
+
+} // End nspc gel
+
+#endif //GEL_STACK_ALLOCATOR_H
@@ -0,0 +1,311 @@
+// tlsf_memory.h
+#ifndef GEL_TLSF_MEMORY_H
+#define GEL_TLSF_MEMORY_H
+
+#include "gel/memory/imemory.h"
+#include "gel/memory/heap_memory.h"
+
+namespace gel
+{
+
+namespace mem
+{
+
+/**
+ * @brief Defines a two-level segregated fit memory pool.
+ *
+ * Free blocks are kept in lists segregated by size: the first level splits
+ * sizes by powers of two and the second level splits each power of two into
+ * SL_COUNT linear ranges. A bitmap per level records which lists are not
+ * empty, so finding a free block that is large enough takes two bit scans
+ * and allocate(), reallocate() and release() all run in bounded time,
+ * independent of how many blocks exist. Blocks are split on allocation and
+ * merged with free physical neighbours on release, which keeps
+ * fragmentation low.
+ *
+ * Memory comes in pools requested from an IMemory, one at construction and
+ * more through addPool(). The pool never grows on its own, so running out
+ * of memory returns null instead of taking unbounded time.
+ *
+ * Blocks are aligned to ALIGNMENT. The pool is not thread safe.
+ */
+class TlsfMemory: public IMemory
+{
+  public:
+    /**
+     * The alignment of every block.
+     */
+    static const Size ALIGNMENT = 16;
+
+    /**
+     * The base two logarithm of the number of second level lists.
+     */
+    static const unsigned SL_COUNT_LOG2 = 5;
+
+    /**
+     * The number of second level lists per first level list.
+     */
+    static const unsigned SL_COUNT = 1 << SL_COUNT_LOG2;
+
+    /**
+     * The number of first level lists.
+     */
+    static const unsigned FL_COUNT = 32;
+
+    /**
+     * The largest block that can be allocated, in bytes.
+     */
+    static const Size MAX_SIZE = Size(1) << 38;
+
+  private:
+    /**
+     * Defines the header of a block.
+     */
+    struct Block
+    {
+        union
+        {
+            /**
+             * The block that physically precedes this one, or null.
+             */
+            Block* previous;
+
+            /**
+             * Pads the header to the same size on 32-bit targets.
+             */
+            uint64 padding;
+        };
+
+        /**
+         * The size of the payload, in bytes, with the free flag in the low
+         * bit.
+         */
+        Size size;
+
+        /**
+         * The next free block in the same list, only while free.
+         */
+        Block* nextFree;
+
+        /**
+         * The previous free block in the same list, only while free.
+         */
+        Block* previousFree;
+    };
+
+    /**
+     * Defines the header at the start of every pool.
+     */
+    struct Pool
+    {
+        /**
+         * The previously added pool.
+         */
+        Pool* next;
+    };
+
+    /**
+     * The memory that pools are allocated from.
+     */
+    IMemory* _memory;
+
+    /**
+     * The most recently added pool.
+     */
+    Pool* _pools;
+
+    /**
+     * The bitmap of first level lists that hold free blocks.
+     */
+    uint32 _flBitmap;
+
+    /**
+     * The bitmaps of second level lists that hold free blocks.
+     */
+    uint32 _slBitmaps[FL_COUNT];
+
+    /**
+     * The heads of the free lists.
+     */
+    Block* _blocks[FL_COUNT][SL_COUNT];
+
+    /**
+     * The payload bytes of all pools.
+     */
+    Size _capacity;
+
+    /**
+     * The payload bytes of all allocated blocks.
+     */
+    Size _size;
+
+    /**
+     * The size of the header of a block, which is where its payload starts.
+     */
+    static const Size OVERHEAD;
+
+    // HELPER FUNCTIONS
+    /**
+     * Gets the block that holds a payload.
+     *
+     * @param pointer The payload.
+     * @return        The block.
+     */
+    static Block* header(const void* pointer);
+
+    /**
+     * Gets the payload size of a block.
+     *
+     * @param block The block.
+     * @return      The size, in bytes.
+     */
+    static Size sizeOf(const Block* block);
+
+    /**
+     * Gets the block that physically follows a block.
+     *
+     * @param block The block.
+     * @return      The next block.
+     */
+    static Block* next(Block* block);
+
+    /**
+     * Inserts a block into its free list.
+     *
+     * @param block The block.
+     */
+    void insert(Block* block);
+
+    /**
+     * Removes a block from its free list.
+     *
+     * @param block The block.
+     */
+    void remove(Block* block);
+
+    /**
+     * Finds and removes a free block of at least a size.
+     *
+     * @param size The size, in bytes.
+     * @return     The block, or null if there is none.
+     */
+    Block* find(Size size);
+
+    /**
+     * Splits the tail off a block, leaving it with a size, and frees the
+     * tail if it is large enough to be a block of its own.
+     *
+     * @param block The block, which must be allocated.
+     * @param size  The size to keep, in bytes.
+     */
+    void trim(Block* block, Size size);
+
+    /**
+     * Merges a free block with its free physical neighbours.
+     *
+     * @param block The block, which must not be in a free list.
+     * @return      The merged block.
+     */
+    Block* merge(Block* block);
+
+    // DISABLED
+    TlsfMemory(const TlsfMemory&);
+
+    TlsfMemory& operator=(const TlsfMemory&);
+
+  public:
+    // CONSTRUCTORS
+    /**
+     * Constructs a new pool.
+     *
+     * @param capacity The size of the first pool, in bytes.
+     * @param memory   The memory that pools are allocated from.
+     */
+    explicit TlsfMemory(Size capacity,
+                        IMemory& memory = HeapMemory::instance());
+
+    /**
+     * Destructor. This releases every pool.
+     */
+    virtual ~TlsfMemory();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Allocates a block of memory.
+     *
+     * @param size The size of the memory block, in bytes.
+     * @return     A pointer to the allocated block, or null for a size of
+     *             zero or if no free block is large enough.
+     */
+    virtual void* allocate(Size size);
+
+    /**
+     * Reallocates a block of memory. The block shrinks in place and grows
+     * in place into a free block that follows it, and is otherwise moved.
+     *
+     * @param pointer The pointer to the previously allocated block, or null.
+     * @param size    The new size for the memory block, in bytes.
+     * @return        A pointer to the reallocated block, or null if the size
+     *                is zero or no free block is large enough.
+     */
+    virtual void* reallocate(void* pointer, Size size);
+
+    /**
+     * Releases a block of memory.
+     *
+     * @param pointer The pointer to the allocated block, or null.
+     */
+    virtual void release(void* pointer);
+
+    /**
+     * Adds a pool of memory.
+     *
+     * @param capacity The size of the pool, in bytes.
+     * @return         If the backing memory provided the pool.
+     */
+    bool addPool(Size capacity);
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the payload bytes of all allocated blocks, including rounding.
+     *
+     * @return The size, in bytes.
+     */
+    Size size() const;
+
+    /**
+     * Gets the payload bytes of all pools, which is an upper bound on the
+     * total that can be allocated.
+     *
+     * @return The capacity, in bytes.
+     */
+    Size capacity() const;
+
+    /**
+     * Gets the payload size of an allocated block, which may be larger than
+     * was requested.
+     *
+     * @param pointer The pointer to the allocated block.
+     * @return        The size, in bytes.
+     */
+    static Size blockSize(const void* pointer);
+};
+
+// ACCESSOR FUNCTIONS
+inline
+Size TlsfMemory::size() const
+{
+    return _size;
+}
+
+inline
+Size TlsfMemory::capacity() const
+{
+    return _capacity;
+}
+
+} // End nspc mem
+
+} // End nspc gel
+
+#endif //GEL_TLSF_MEMORY_H
@@ -0,0 +1,864 @@
+// tracking_memory.h
+#ifndef GEL_TRACKING_MEMORY_H
+#define GEL_TRACKING_MEMORY_H
+
+#include <assert.h>
+#include "gel/memory/iallocator.h"
+#include "gel/memory/imemory.h"
+#include "gel/memory/heap_allocator.h"
+#include "gel/memory/heap_memory.h"
+
+namespace gel
+{
+
+namespace mem
+{
+
+/**
+ * @brief Defines the statistics of the allocations made through a tracking
+ * decorator.
+ *
+ * It records the live and peak number of bytes, the number of allocations,
+ * a histogram of the requested sizes by power of two and the live and peak
+ * bytes of every tag. Tags are small integers that a subsystem allocates
+ * under, such as one for audio and one for textures, and can be given names
+ * for dump().
+ *
+ * The statistics are not thread safe.
+ */
+class AllocationStats
+{
+  public:
+    /**
+     * The number of tags. Tag zero is used when no other is set.
+     */
+    static const unsigned MAX_TAGS = 32;
+
+    /**
+     * The number of buckets of the histogram, one per power of two.
+     */
+    static const unsigned BUCKETS = 64;
+
+  private:
+    /**
+     * The number of live bytes.
+     */
+    Size _live;
+
+    /**
+     * The largest number of live bytes.
+     */
+    Size _peak;
+
+    /**
+     * The number of live allocations.
+     */
+    Size _count;
+
+    /**
+     * The number of allocations made.
+     */
+    Size _total;
+
+    /**
+     * The number of allocations made, by size bucket.
+     */
+    Size _histogram[BUCKETS];
+
+    /**
+     * The number of live bytes, by tag.
+     */
+    Size _tagLive[MAX_TAGS];
+
+    /**
+     * The largest number of live bytes, by tag.
+     */
+    Size _tagPeak[MAX_TAGS];
+
+    /**
+     * The number of live allocations, by tag.
+     */
+    Size _tagCount[MAX_TAGS];
+
+    /**
+     * The names of the tags, or null.
+     */
+    const char* _tagNames[MAX_TAGS];
+
+  public:
+    // CONSTRUCTORS
+    /**
+     * Constructs new empty statistics.
+     */
+    AllocationStats();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Records an allocation.
+     *
+     * @param size The size of the allocation, in bytes.
+     * @param tag  The tag of the allocation.
+     */
+    void recordAllocate(Size size, unsigned tag);
+
+    /**
+     * Records a release.
+     *
+     * @param size The size of the released allocation, in bytes.
+     * @param tag  The tag of the released allocation.
+     */
+    void recordRelease(Size size, unsigned tag);
+
+    /**
+     * Lowers the peaks to the current number of live bytes, so a new peak
+     * can be measured, such as for each level of a game.
+     */
+    void resetPeaks();
+
+    /**
+     * Names a tag for dump().
+     *
+     * @param tag  The tag.
+     * @param name The name, which must outlive the statistics.
+     */
+    void setTagName(unsigned tag, const char* name);
+
+    /**
+     * Writes the statistics to the log as debug messages.
+     *
+     * @param name The name of the tracked memory, which is used as the
+     *             logging tag.
+     */
+    void dump(const char* name) const;
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the number of live bytes.
+     *
+     * @return The size, in bytes.
+     */
+    Size liveBytes() const;
+
+    /**
+     * Gets the largest number of live bytes since construction or the last
+     * call to resetPeaks().
+     *
+     * @return The size, in bytes.
+     */
+    Size peakBytes() const;
+
+    /**
+     * Gets the number of live allocations.
+     *
+     * @return The number of allocations.
+     */
+    Size liveCount() const;
+
+    /**
+     * Gets the number of allocations made, including those that were
+     * released and the new sizes of reallocations.
+     *
+     * @return The number of allocations.
+     */
+    Size totalCount() const;
+
+    /**
+     * Gets the number of allocations made with a size in a bucket.
+     *
+     * @param bucket The bucket.
+     * @return       The number of allocations.
+     */
+    Size histogram(unsigned bucket) const;
+
+    /**
+     * Gets the number of live bytes of a tag.
+     *
+     * @param tag The tag.
+     * @return    The size, in bytes.
+     */
+    Size tagBytes(unsigned tag) const;
+
+    /**
+     * Gets the largest number of live bytes of a tag.
+     *
+     * @param tag The tag.
+     * @return    The size, in bytes.
+     */
+    Size tagPeak(unsigned tag) const;
+
+    /**
+     * Gets the number of live allocations of a tag.
+     *
+     * @param tag The tag.
+     * @return    The number of allocations.
+     */
+    Size tagCount(unsigned tag) const;
+
+    /**
+     * Gets the name of a tag.
+     *
+     * @param tag The tag.
+     * @return    The name, or null if it has none.
+     */
+    const char* tagName(unsigned tag) const;
+
+    /**
+     * Gets the histogram bucket of a size. Bucket zero holds the size zero
+     * and bucket b the sizes in [2^(b - 1), 2^b), and the last bucket also
+     * holds all larger sizes.
+     *
+     * @param size The size, in bytes.
+     * @return     The bucket.
+     */
+    static unsigned bucketOf(Size size);
+};
+
+/**
+ * @brief Defines a memory pool that tracks the allocations made through
+ * another.
+ *
+ * Every block carries a HEADER byte header with its size and tag, which are
+ * recorded in the statistics on allocation and release. Allocations are
+ * made under the current tag unless a tag is given, and reallocations keep
+ * the tag of the block.
+ *
+ * Blocks keep the alignment of the wrapped memory up to HEADER bytes. The
+ * decorator is not thread safe.
+ */
+class TrackingMemory: public IMemory
+{
+  public:
+    /**
+     * The size of the header of every block, in bytes.
+     */
+    static const Size HEADER = 16;
+
+  private:
+    /**
+     * The memory that the blocks are allocated from.
+     */
+    IMemory* _memory;
+
+    /**
+     * The statistics.
+     */
+    AllocationStats _stats;
+
+    /**
+     * The current tag.
+     */
+    unsigned _tag;
+
+    // DISABLED
+    TrackingMemory(const TrackingMemory&);
+
+    TrackingMemory& operator=(const TrackingMemory&);
+
+  public:
+    // CONSTRUCTORS
+    /**
+     * Constructs a new decorator.
+     *
+     * @param memory The memory that the blocks are allocated from.
+     */
+    explicit TrackingMemory(IMemory& memory = HeapMemory::instance());
+
+    /**
+     * Destructor.
+     */
+    virtual ~TrackingMemory();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Allocates a block of memory under the current tag.
+     *
+     * @param size The size of the memory block, in bytes.
+     * @return     A pointer to the allocated block, or null.
+     */
+    virtual void* allocate(Size size);
+
+    /**
+     * Allocates a block of memory under a tag.
+     *
+     * @param size The size of the memory block, in bytes.
+     * @param tag  The tag.
+     * @return     A pointer to the allocated block, or null.
+     */
+    void* allocate(Size size, unsigned tag);
+
+    /**
+     * Reallocates a block of memory, keeping its tag.
+     *
+     * @param pointer The pointer to the previously allocated block, or null.
+     * @param size    The new size for the memory block, in bytes.
+     * @return        A pointer to the reallocated block, or null.
+     */
+    virtual void* reallocate(void* pointer, Size size);
+
+    /**
+     * Releases a block of memory.
+     *
+     * @param pointer The pointer to the allocated block, or null.
+     */
+    virtual void release(void* pointer);
+
+    /**
+     * Sets the tag that allocations are made under.
+     *
+     * @param tag The tag, which must be less than AllocationStats::MAX_TAGS.
+     */
+    void setTag(unsigned tag);
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the tag that allocations are made under.
+     *
+     * @return The tag.
+     */
+    unsigned tag() const;
+
+    /**
+     * Gets the statistics.
+     *
+     * @return The statistics.
+     */
+    AllocationStats& stats();
+
+    /**
+     * Gets the statistics.
+     *
+     * @return The statistics.
+     */
+    const AllocationStats& stats() const;
+
+    /**
+     * Gets the requested size of an allocated block.
+     *
+     * @param pointer The pointer to the allocated block.
+     * @return        The size, in bytes.
+     */
+    static Size blockSize(const void* pointer);
+};
+
+namespace detail
+{
+
+/**
+ * Defines the header that a tracking decorator puts before every block.
+ */
+struct TrackingHeader
+{
+    /**
+     * The requested size of the block, in bytes.
+     */
+    Size size;
+
+    /**
+     * The tag of the block.
+     */
+    uint32 tag;
+
+    /**
+     * Pads the header to 16 bytes.
+     */
+    uint32 padding;
+};
+
+/**
+ * Defines what a tracking allocator records about every block.
+ */
+struct TrackingRecord
+{
+    /**
+     * The requested size of the block, in bytes.
+     */
+    Size size;
+
+    /**
+     * The tag of the block.
+     */
+    unsigned tag;
+};
+
+/**
+ * @brief Defines the table that a tracking allocator keeps its records in.
+ *
+ * It is an open addressing table keyed by the address of the block, which
+ * probes linearly and shifts entries back on erase, so it needs no
+ * tombstones. It is kept at most half full and its entries are allocated
+ * from an IMemory.
+ */
+class TrackingTable
+{
+  public:
+    // CONSTANTS
+    /**
+     * The capacity of the first allocation of the entries.
+     */
+    static const Size MIN_CAPACITY = 16;
+
+  private:
+    /**
+     * Defines an entry, which is empty if its key is null.
+     */
+    struct Entry
+    {
+        /**
+         * The address of the block.
+         */
+        const void* key;
+
+        /**
+         * The record of the block.
+         */
+        TrackingRecord record;
+    };
+
+    /**
+     * The memory that the entries are allocated from.
+     */
+    IMemory* _memory;
+
+    /**
+     * The entries.
+     */
+    Entry* _entries;
+
+    /**
+     * The number of entries, which is zero or a power of two.
+     */
+    Size _capacity;
+
+    /**
+     * The number of keys.
+     */
+    Size _size;
+
+    // DISABLED
+    TrackingTable(const TrackingTable&);
+
+    TrackingTable& operator=(const TrackingTable&);
+
+  public:
+    // CONSTRUCTORS
+    /**
+     * Constructs a new empty table.
+     *
+     * @param memory The memory that the entries are allocated from.
+     */
+    explicit TrackingTable(IMemory& memory = HeapMemory::instance());
+
+    /**
+     * Destructor.
+     */
+    ~TrackingTable();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Inserts the record of a block, unless the block is already present.
+     *
+     * @param key    The address of the block, which must not be null.
+     * @param record The record.
+     * @return       If the record was inserted, which fails if the block is
+     *               already present or the memory is exhausted.
+     */
+    bool insert(const void* key, const TrackingRecord& record);
+
+    /**
+     * Erases the record of a block.
+     *
+     * @param key The address of the block.
+     * @return    If the block was present.
+     */
+    bool erase(const void* key);
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the record of a block.
+     *
+     * @param key    The address of the block.
+     * @param record The record, which is only written if the block is
+     *               present.
+     * @return       If the block is present.
+     */
+    bool get(const void* key, TrackingRecord& record) const;
+
+    /**
+     * Gets the number of blocks.
+     *
+     * @return The number of blocks.
+     */
+    Size size() const;
+
+  private:
+    // HELPER FUNCTIONS
+    /**
+     * Gets the entry that a key is probed from.
+     *
+     * @param key The key.
+     * @return    The index of the entry.
+     */
+    Size home(const void* key) const;
+
+    /**
+     * Gets the entry that holds a key.
+     *
+     * @param key The key.
+     * @return    The index of the entry, or the capacity if it is absent.
+     */
+    Size locate(const void* key) const;
+
+    /**
+     * Doubles the capacity and reinserts every key.
+     *
+     * @return If the capacity grew, which fails if the memory is exhausted.
+     */
+    bool grow();
+};
+
+} // End nspc detail
+
+/**
+ * @brief Defines an allocator that tracks the allocations made through
+ * another.
+ *
+ * This is the typed counterpart of TrackingMemory. The size and tag of
+ * every block are kept in a table beside the blocks rather than in a
+ * header, so the wrapped allocator is asked for exactly the blocks the
+ * caller asks for. That lets it wrap any allocator, including the pools
+ * that only serve single instances of T. Blocks that were not allocated
+ * through the decorator are passed on to the wrapped allocator without
+ * touching the statistics.
+ *
+ * @tparam T The type that is allocated.
+ */
+template<typename T>
+class TrackingAllocator: public IAllocator<T>
+{
+  private:
+    /**
+     * The allocator that the blocks are allocated from.
+     */
+    IAllocator<T>* _allocator;
+
+    /**
+     * The size and tag of every allocated block.
+     */
+    detail::TrackingTable _blocks;
+
+    /**
+     * The statistics.
+     */
+    AllocationStats _stats;
+
+    /**
+     * The current tag.
+     */
+    unsigned _tag;
+
+    // DISABLED
+    TrackingAllocator(const TrackingAllocator&);
+
+    TrackingAllocator& operator=(const TrackingAllocator&);
+
+  public:
+    // CONSTRUCTORS
+    /**
+     * Constructs a new decorator.
+     *
+     * @param allocator The allocator that the blocks are allocated from.
+     */
+    explicit TrackingAllocator(
+        IAllocator<T>& allocator = HeapAllocator<T>::instance());
+
+    /**
+     * Destructor.
+     */
+    virtual ~TrackingAllocator();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Allocates a block of memory under the current tag.
+     *
+     * @param count The size of the memory block, in instances of T.
+     * @return      A pointer to the allocated block, or null.
+     */
+    virtual T* allocate(Size count);
+
+    /**
+     * Allocates a block of memory under a tag.
+     *
+     * @param count The size of the memory block, in instances of T.
+     * @param tag   The tag.
+     * @return      A pointer to the allocated block, or null.
+     */
+    T* allocate(Size count, unsigned tag);
+
+    /**
+     * Reallocates a pre-existing block of memory, keeping its tag.
+     *
+     * @param ptr   A pointer to the existing memory block, or null.
+     * @param count The new size of the memory block, in instances of T.
+     * @return      A pointer to the reallocated block, or null.
+     */
+    virtual T* reallocate(T* ptr, Size count);
+
+    /**
+     * Releases a block of memory.
+     *
+     * @param ptr A pointer to the allocated memory block, or null.
+     */
+    virtual void free(T* ptr);
+
+    /**
+     * Sets the tag that allocations are made under.
+     *
+     * @param tag The tag, which must be less than AllocationStats::MAX_TAGS.
+     */
+    void setTag(unsigned tag);
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the tag that allocations are made under.
+     *
+     * @return The tag.
+     */
+    unsigned tag() const;
+
+    /**
+     * Gets the statistics, which are kept in bytes.
+     *
+     * @return The statistics.
+     */
+    AllocationStats& stats();
+
+    /**
+     * Gets the statistics, which are kept in bytes.
+     *
+     * @return The statistics.
+     */
+    const AllocationStats& stats() const;
+};
+
+// ACCESSOR FUNCTIONS
+inline
+Size AllocationStats::liveBytes() const
+{
+    return _live;
+}
+
+inline
+Size AllocationStats::peakBytes() const
+{
+    return _peak;
+}
+
+inline
+Size AllocationStats::liveCount() const
+{
+    return _count;
+}
+
+inline
+Size AllocationStats::totalCount() const
+{
+    return _total;
+}
+
+inline
+Size AllocationStats::histogram(unsigned bucket) const
+{
+    return bucket < BUCKETS ? _histogram[bucket] : 0;
+}
+
+inline
+Size AllocationStats::tagBytes(unsigned tag) const
+{
+    return tag < MAX_TAGS ? _tagLive[tag] : 0;
+}
+
+inline
+Size AllocationStats::tagPeak(unsigned tag) const
+{
+    return tag < MAX_TAGS ? _tagPeak[tag] : 0;
+}
+
+inline
+Size AllocationStats::tagCount(unsigned tag) const
+{
+    return tag < MAX_TAGS ? _tagCount[tag] : 0;
+}
+
+inline
+const char* AllocationStats::tagName(unsigned tag) const
+{
+    return tag < MAX_TAGS ? _tagNames[tag] : 0;
+}
+
+// MEMBER FUNCTIONS
+inline
+void TrackingMemory::setTag(unsigned tag)
+{
+    _tag = tag;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned TrackingMemory::tag() const
+{
+    return _tag;
+}
+
+inline
+AllocationStats& TrackingMemory::stats()
+{
+    return _stats;
+}
+
+inline
+const AllocationStats& TrackingMemory::stats() const
+{
+    return _stats;
+}
+
+namespace detail
+{
+
+// ACCESSOR FUNCTIONS
+inline
+Size TrackingTable::size() const
+{
+    return _size;
+}
+
+} // End nspc detail
+
+// CONSTRUCTORS
+template<typename T>
+inline
+TrackingAllocator<T>::TrackingAllocator(IAllocator<T>& allocator)
+    : _allocator(&allocator), _tag(0)
+{
+}
+
+template<typename T>
+inline
+TrackingAllocator<T>::~TrackingAllocator()
+{
+}
+
+// MEMBER FUNCTIONS
+template<typename T>
+inline
+T* TrackingAllocator<T>::allocate(Size count)
+{
+    return allocate(count, _tag);
+}
+
+template<typename T>
+inline
+T* TrackingAllocator<T>::allocate(Size count, unsigned tag)
+{
+    T* block = _allocator->allocate(count);
+    if (!block)
+    {
+        return 0;
+    }
+
+    const detail::TrackingRecord record = { count * sizeof(T), tag };
+    if (!_blocks.insert(block, record))
+    {
+        _allocator->free(block);
+        return 0;
+    }
+    _stats.recordAllocate(record.size, tag);
+    return block;
+}
+
+template<typename T>
+inline
+T* TrackingAllocator<T>::reallocate(T* ptr, Size count)
+{
+    if (!ptr)
+    {
+        return allocate(count);
+    }
+    if (count == 0)
+    {
+        free(ptr);
+        return 0;
+    }
+
+    detail::TrackingRecord record = detail::TrackingRecord();
+    if (!_blocks.get(ptr, record))
+    {
+        return _allocator->reallocate(ptr, count);
+    }
+    T* block = _allocator->reallocate(ptr, count);
+    if (!block)
+    {
+        return 0;
+    }
+
+    // the entry of the old block is erased first, so the table does not
+    // grow and re-inserting cannot fail
+    _stats.recordRelease(record.size, record.tag);
+    record.size = count * sizeof(T);
+    _blocks.erase(ptr);
+    _blocks.insert(block, record);
+    _stats.recordAllocate(record.size, record.tag);
+    return block;
+}
+
+template<typename T>
+inline
+void TrackingAllocator<T>::free(T* ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    detail::TrackingRecord record = detail::TrackingRecord();
+    if (_blocks.get(ptr, record))
+    {
+        _blocks.erase(ptr);
+        _stats.recordRelease(record.size, record.tag);
+    }
+    _allocator->free(ptr);
+}
+
+template<typename T>
+inline
+void TrackingAllocator<T>::setTag(unsigned tag)
+{
+    _tag = tag;
+}
+
+// ACCESSOR FUNCTIONS
+template<typename T>
+inline
+unsigned TrackingAllocator<T>::tag() const
+{
+    return _tag;
+}
+
+template<typename T>
+inline
+AllocationStats& TrackingAllocator<T>::stats()
+{
+    return _stats;
+}
+
+template<typename T>
+inline
+const AllocationStats& TrackingAllocator<T>::stats() const
+{
+    return _stats;
+}
+
+} // End nspc mem
+
+} // End nspc gel
+
+#endif //GEL_TRACKING_MEMORY_H
@@ -0,0 +1,268 @@
+// virtual_memory.h
+#ifndef GEL_VIRTUAL_MEMORY_H
+#define GEL_VIRTUAL_MEMORY_H
+
+#include "gel/memory/imemory.h"
+
+namespace gel
+{
+
+namespace mem
+{
+
+/**
+ * @brief Defines a memory pool over one reserved range of address space.
+ *
+ * The range is reserved up front without backing it, so it costs no
+ * physical memory until pages are committed. Blocks are whole runs of pages
+ * that are committed when they are allocated and decommitted when they are
+ * released, which hands their physical memory back to the system while
+ * keeping the addresses reserved. Released runs are kept in an address
+ * ordered free list and merged with their neighbours.
+ *
+ * Pages can be backed by transparent huge pages, which the kernel may use
+ * for aligned runs, or by explicit huge pages, which must be configured on
+ * the system. When explicit huge pages are unavailable the pool falls back
+ * to transparent huge pages, and page() reports what it got.
+ *
+ * Every block starts HEADER bytes into its first page, so blocks are
+ * aligned to HEADER. The pool is not thread safe.
+ */
+class VirtualMemory: public IMemory
+{
+  public:
+    /**
+     * Defines the pages that back the range.
+     */
+    enum PageMode
+    {
+        SMALL_PAGES,
+        TRANSPARENT_HUGE_PAGES,
+        HUGE_PAGES
+    };
+
+  private:
+    /**
+     * Defines the header at the start of every run of pages.
+     */
+    struct Run
+    {
+        /**
+         * The number of pages in the run.
+         */
+        Size pages;
+
+        /**
+         * The next free run, by address.
+         */
+        Run* next;
+    };
+
+    /**
+     * The start of the reserved range.
+     */
+    char* _base;
+
+    /**
+     * The size of the reserved range, in bytes.
+     */
+    Size _reserved;
+
+    /**
+     * The end of the highest allocated run.
+     */
+    char* _top;
+
+    /**
+     * The lowest free run below the top.
+     */
+    Run* _free;
+
+    /**
+     * The number of committed bytes.
+     */
+    Size _committed;
+
+    /**
+     * The size of a page, in bytes.
+     */
+    Size _pageSize;
+
+    /**
+     * The pages that back the range.
+     */
+    PageMode _mode;
+
+    // HELPER FUNCTIONS
+    /**
+     * Allocates a run of pages.
+     *
+     * @param pages The number of pages.
+     * @return      The run, or null if the range is exhausted.
+     */
+    Run* take(Size pages);
+
+    /**
+     * Returns a run of pages to the free list.
+     *
+     * @param run The run.
+     */
+    void give(Run* run);
+
+    // DISABLED
+    VirtualMemory(const VirtualMemory&);
+
+    VirtualMemory& operator=(const VirtualMemory&);
+
+  public:
+    /**
+     * The offset of every block from the start of its run, in bytes.
+     */
+    static const Size HEADER = 64;
+
+    /**
+     * The size of a huge page, in bytes.
+     */
+    static const Size HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    // CONSTRUCTORS
+    /**
+     * Constructs a new pool and reserves its range.
+     *
+     * @param reserve The size of the range, in bytes, which is rounded up to
+     *                whole pages.
+     * @param mode    The pages that back the range.
+     */
+    explicit VirtualMemory(Size reserve, PageMode mode = SMALL_PAGES);
+
+    /**
+     * Destructor. This returns the whole range to the system.
+     */
+    virtual ~VirtualMemory();
+
+    // MEMBER FUNCTIONS
+    /**
+     * Allocates and commits a block of memory.
+     *
+     * @param size The size of the memory block, in bytes.
+     * @return     A pointer to the allocated block, or null for a size of
+     *             zero or if the range is exhausted.
+     */
+    virtual void* allocate(Size size);
+
+    /**
+     * Reallocates a block of memory. The block grows in place when it is
+     * the highest one and shrinks in place by decommitting its tail.
+     *
+     * @param pointer The pointer to the previously allocated block, or null.
+     * @param size    The new size for the memory block, in bytes.
+     * @return        A pointer to the reallocated block, or null if the size
+     *                is zero or the range is exhausted.
+     */
+    virtual void* reallocate(void* pointer, Size size);
+
+    /**
+     * Decommits a block of memory and returns its pages to the pool.
+     *
+     * @param pointer The pointer to the allocated block, or null.
+     */
+    virtual void release(void* pointer);
+
+    /**
+     * Commits pages of the range, making them readable and writable.
+     *
+     * @param pointer The start of the pages, which must be page aligned.
+     * @param size    The size of the pages, in bytes.
+     * @return        If the pages were committed.
+     */
+    bool commit(void* pointer, Size size);
+
+    /**
+     * Decommits pages of the range, returning their physical memory to the
+     * system. The contents are lost.
+     *
+     * @param pointer The start of the pages, which must be page aligned.
+     * @param size    The size of the pages, in bytes.
+     */
+    void decommit(void* pointer, Size size);
+
+    // ACCESSOR FUNCTIONS
+    /**
+     * Gets the start of the reserved range.
+     *
+     * @return The start, or null if the range could not be reserved.
+     */
+    void* base() const;
+
+    /**
+     * Gets the size of the reserved range.
+     *
+     * @return The size, in bytes.
+     */
+    Size reserved() const;
+
+    /**
+     * Gets the number of committed bytes.
+     *
+     * @return The size, in bytes.
+     */
+    Size committed() const;
+
+    /**
+     * Gets the size of the pages that runs are made of.
+     *
+     * @return The size, in bytes.
+     */
+    Size pageSize() const;
+
+    /**
+     * Gets the pages that back the range, after any fallback.
+     *
+     * @return The page mode.
+     */
+    PageMode mode() const;
+
+    /**
+     * Gets the size of the pages of the system.
+     *
+     * @return The size, in bytes.
+     */
+    static Size systemPageSize();
+};
+
+// ACCESSOR FUNCTIONS
+inline
+void* VirtualMemory::base() const
+{
+    return _base;
+}
+
+inline
+Size VirtualMemory::reserved() const
+{
+    return _reserved;
+}
+
+inline
+Size VirtualMemory::committed() const
+{
+    return _committed;
+}
+
+inline
+Size VirtualMemory::pageSize() const
+{
+    return _pageSize;
+}
+
+inline
+VirtualMemory::PageMode VirtualMemory::mode() const
+{
+    return _mode;
+}
+
+} // End nspc mem
+
+} // End nspc gel
+
+#endif //GEL_VIRTUAL_MEMORY_H
@@ -70,6 +70,7 @@ struct TimeUnits
     static TimePoint convert(TimePoint time, Unit in, Unit out);
 };
 
+inline
 float TimeUnits::getUnitMultiplier(Unit unit)
 {
     float mult;
@@ -0,0 +1,2 @@
+// concurrent_map.cpp
+#include "gel/containers/concurrent_map.h"
@@ -0,0 +1,21 @@
+// control_group.cpp
+#include "gel/containers/control_group.h"
+
+namespace gel
+{
+
+namespace cntr
+{
+
+namespace detail
+{
+
+const Size ControlGroup::WIDTH;
+
+const uint8 ControlGroup::EMPTY;
+
+} // End nspc detail
+
+} // End nspc cntr
+
+} // End nspc gel
@@ -0,0 +1,2 @@
+// flat_map.cpp
+#include "gel/containers/flat_map.h"
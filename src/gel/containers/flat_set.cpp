@@ -0,0 +1,2 @@
+// flat_set.cpp
+#include "gel/containers/flat_set.h"
@@ -0,0 +1,2 @@
+// handle_pool.cpp
+#include "gel/containers/handle_pool.h"
@@ -0,0 +1,2 @@
+// hash.cpp
+#include "gel/containers/hash.h"
@@ -0,0 +1,2 @@
+// hash_map.cpp
+#include "gel/containers/hash_map.h"
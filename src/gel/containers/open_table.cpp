@@ -0,0 +1,2 @@
+// open_table.cpp
+#include "gel/containers/open_table.h"
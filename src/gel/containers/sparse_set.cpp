@@ -0,0 +1,2 @@
+// sparse_set.cpp
+#include "gel/containers/sparse_set.h"
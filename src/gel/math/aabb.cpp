@@ -0,0 +1,2 @@
+// aabb.cpp
+#include "gel/math/aabb.h"
@@ -0,0 +1,294 @@
+// batch_kernels.inl
+// Included once per SIMD level by dispatch.cpp, inside a namespace that
+// defines GEL_KERNEL, LEVEL, WIDTH, the Pack type and its v* operations.
+// vnonneg() gives a bit per lane that is not negative and vcompact() writes
+// the indices of the set bits of such a mask and returns how many it wrote.
+
+// KERNELS
+GEL_KERNEL
+void add( float* out, const float* a, const float* b, Size n )
+{
+    Size i = 0;
+    for ( ; i + WIDTH <= n; i += WIDTH )
+    {
+        vstore( out + i, vadd( vload( a + i ), vload( b + i ) ) );
+    }
+    for ( ; i < n; ++i )
+    {
+        out[i] = a[i] + b[i];
+    }
+}
+
+GEL_KERNEL
+void mul( float* out, const float* a, const float* b, Size n )
+{
+    Size i = 0;
+    for ( ; i + WIDTH <= n; i += WIDTH )
+    {
+        vstore( out + i, vmul( vload( a + i ), vload( b + i ) ) );
+    }
+    for ( ; i < n; ++i )
+    {
+        out[i] = a[i] * b[i];
+    }
+}
+
+GEL_KERNEL
+void madd( float* out, const float* a, const float* b, const float* c,
+           Size n )
+{
+    Size i = 0;
+    for ( ; i + WIDTH <= n; i += WIDTH )
+    {
+        vstore( out + i,
+                vmadd( vload( a + i ), vload( b + i ), vload( c + i ) ) );
+    }
+    for ( ; i < n; ++i )
+    {
+        out[i] = a[i] * b[i] + c[i];
+    }
+}
+
+GEL_KERNEL
+void scale( float* out, const float* a, float s, Size n )
+{
+    const Pack p = vset1( s );
+    Size i = 0;
+    for ( ; i + WIDTH <= n; i += WIDTH )
+    {
+        vstore( out + i, vmul( vload( a + i ), p ) );
+    }
+    for ( ; i < n; ++i )
+    {
+        out[i] = a[i] * s;
+    }
+}
+
+GEL_KERNEL
+void lerp( float* out, const float* a, const float* b, float t, Size n )
+{
+    const Pack p = vset1( t );
+    Size i = 0;
+    for ( ; i + WIDTH <= n; i += WIDTH )
+    {
+        const Pack x = vload( a + i );
+        vstore( out + i, vmadd( vsub( vload( b + i ), x ), p, x ) );
+    }
+    for ( ; i < n; ++i )
+    {
+        out[i] = a[i] + ( b[i] - a[i] ) * t;
+    }
+}
+
+GEL_KERNEL
+void dot( float* out, const float* const* u, const float* const* v,
+          Size dim, Size n )
+{
+    Size i = 0;
+    for ( ; i + WIDTH <= n; i += WIDTH )
+    {
+        Pack s = vmul( vload( u[0] + i ), vload( v[0] + i ) );
+        for ( Size c = 1; c < dim; ++c )
+        {
+            s = vmadd( vload( u[c] + i ), vload( v[c] + i ), s );
+        }
+        vstore( out + i, s );
+    }
+    for ( ; i < n; ++i )
+    {
+        float s = u[0][i] * v[0][i];
+        for ( Size c = 1; c < dim; ++c )
+        {
+            s += u[c][i] * v[c][i];
+        }
+        out[i] = s;
+    }
+}
+
+GEL_KERNEL
+void normalize( float* const* out, const float* const* v, Size dim, Size n )
+{
+    Size i = 0;
+    for ( ; i + WIDTH <= n; i += WIDTH )
+    {
+        Pack s = vmul( vload( v[0] + i ), vload( v[0] + i ) );
+        for ( Size c = 1; c < dim; ++c )
+        {
+            s = vmadd( vload( v[c] + i ), vload( v[c] + i ), s );
+        }
+
+        const Pack len = vsqrt( s );
+        for ( Size c = 0; c < dim; ++c )
+        {
+            vstore( out[c] + i, vdiv( vload( v[c] + i ), len ) );
+        }
+    }
+    for ( ; i < n; ++i )
+    {
+        float s = v[0][i] * v[0][i];
+        for ( Size c = 1; c < dim; ++c )
+        {
+            s += v[c][i] * v[c][i];
+        }
+
+        const float len = sqrtf( s );
+        for ( Size c = 0; c < dim; ++c )
+        {
+            out[c][i] = v[c][i] / len;
+        }
+    }
+}
+
+GEL_KERNEL
+void transformPoints( const float* m, float* const* out,
+                      const float* const* in, Size n )
+{
+    const Pack m00 = vset1( m[0] ), m01 = vset1( m[1] ), m02 = vset1( m[2] );
+    const Pack m10 = vset1( m[4] ), m11 = vset1( m[5] ), m12 = vset1( m[6] );
+    const Pack m20 = vset1( m[8] ), m21 = vset1( m[9] ), m22 = vset1( m[10] );
+    const Pack m30 = vset1( m[12] ), m31 = vset1( m[13] );
+    const Pack m32 = vset1( m[14] );
+    Size i = 0;
+    for ( ; i + WIDTH <= n; i += WIDTH )
+    {
+        const Pack x = vload( in[0] + i );
+        const Pack y = vload( in[1] + i );
+        const Pack z = vload( in[2] + i );
+        vstore( out[0] + i,
+                vadd( vmadd( m20, z, vmadd( m10, y, vmul( m00, x ) ) ), m30 ) );
+        vstore( out[1] + i,
+                vadd( vmadd( m21, z, vmadd( m11, y, vmul( m01, x ) ) ), m31 ) );
+        vstore( out[2] + i,
+                vadd( vmadd( m22, z, vmadd( m12, y, vmul( m02, x ) ) ), m32 ) );
+    }
+    for ( ; i < n; ++i )
+    {
+        const float x = in[0][i];
+        const float y = in[1][i];
+        const float z = in[2][i];
+        out[0][i] = m[0] * x + m[4] * y + m[8] * z + m[12];
+        out[1][i] = m[1] * x + m[5] * y + m[9] * z + m[13];
+        out[2][i] = m[2] * x + m[6] * y + m[10] * z + m[14];
+    }
+}
+
+GEL_KERNEL
+Size cullBoxes( uint32* visible, const float* planes,
+                const float* const* centers, const float* const* extents,
+                Size n )
+{
+    Pack normals[6][4];
+    Pack spans[6][3];
+    for ( Size p = 0; p < 6; ++p )
+    {
+        for ( Size c = 0; c < 4; ++c )
+        {
+            const float a = planes[p * 4 + c];
+            normals[p][c] = vset1( a );
+            if ( c < 3 )
+            {
+                spans[p][c] = vset1( a < 0 ? -a : a );
+            }
+        }
+    }
+
+    // the indices of a pack are stored unconditionally and the count only
+    // advances past the visible ones, which compacts without branching
+    Size count = 0;
+    Size i = 0;
+    for ( ; i + WIDTH <= n; i += WIDTH )
+    {
+        const Pack cx = vload( centers[0] + i );
+        const Pack cy = vload( centers[1] + i );
+        const Pack cz = vload( centers[2] + i );
+        const Pack ex = vload( extents[0] + i );
+        const Pack ey = vload( extents[1] + i );
+        const Pack ez = vload( extents[2] + i );
+
+        uint32 mask = ( 1u << WIDTH ) - 1;
+        for ( Size p = 0; p < 6 && mask; ++p )
+        {
+            const Pack* np = normals[p];
+            const Pack* sp = spans[p];
+            const Pack d = vmadd( np[2], cz,
+                                  vmadd( np[1], cy,
+                                         vmadd( np[0], cx, np[3] ) ) );
+            const Pack r = vmadd( sp[2], ez,
+                                  vmadd( sp[1], ey, vmul( sp[0], ex ) ) );
+            mask &= vnonneg( vadd( d, r ) );
+        }
+
+        count += vcompact( visible + count, static_cast<uint32>( i ), mask );
+    }
+    for ( ; i < n; ++i )
+    {
+        bool inside = true;
+        for ( Size p = 0; p < 6 && inside; ++p )
+        {
+            const float* a = planes + p * 4;
+            const float d = a[0] * centers[0][i] + a[1] * centers[1][i] +
+                            a[2] * centers[2][i] + a[3];
+            const float r = ( a[0] < 0 ? -a[0] : a[0] ) * extents[0][i] +
+                            ( a[1] < 0 ? -a[1] : a[1] ) * extents[1][i] +
+                            ( a[2] < 0 ? -a[2] : a[2] ) * extents[2][i];
+            inside = d + r >= 0;
+        }
+        visible[count] = static_cast<uint32>( i );
+        count += inside;
+    }
+    return count;
+}
+
+GEL_KERNEL
+Size cullSpheres( uint32* visible, const float* planes,
+                  const float* const* centers, const float* radii, Size n )
+{
+    Pack normals[6][4];
+    for ( Size p = 0; p < 6; ++p )
+    {
+        for ( Size c = 0; c < 4; ++c )
+        {
+            normals[p][c] = vset1( planes[p * 4 + c] );
+        }
+    }
+
+    Size count = 0;
+    Size i = 0;
+    for ( ; i + WIDTH <= n; i += WIDTH )
+    {
+        const Pack cx = vload( centers[0] + i );
+        const Pack cy = vload( centers[1] + i );
+        const Pack cz = vload( centers[2] + i );
+        const Pack r = vload( radii + i );
+
+        uint32 mask = ( 1u << WIDTH ) - 1;
+        for ( Size p = 0; p < 6 && mask; ++p )
+        {
+            const Pack* np = normals[p];
+            const Pack d = vmadd( np[2], cz,
+                                  vmadd( np[1], cy,
+                                         vmadd( np[0], cx, np[3] ) ) );
+            mask &= vnonneg( vadd( d, r ) );
+        }
+
+        count += vcompact( visible + count, static_cast<uint32>( i ), mask );
+    }
+    for ( ; i < n; ++i )
+    {
+        bool inside = true;
+        for ( Size p = 0; p < 6 && inside; ++p )
+        {
+            const float* a = planes + p * 4;
+            inside = a[0] * centers[0][i] + a[1] * centers[1][i] +
+                     a[2] * centers[2][i] + a[3] + radii[i] >= 0;
+        }
+        visible[count] = static_cast<uint32>( i );
+        count += inside;
+    }
+    return count;
+}
+
+const BatchKernels KERNELS = {
+    LEVEL, &add, &mul, &madd, &scale, &lerp, &dot, &normalize,
+    &transformPoints, &cullBoxes, &cullSpheres
+};
@@ -0,0 +1,463 @@
+// dispatch.cpp
+#include "gel/math/dispatch.h"
+#include <assert.h>
+#include <math.h>
+#include "gel/config.g.h"
+
+#if !defined( GEL_NO_SIMD ) && \
+    ( defined( __x86_64__ ) || defined( __i386__ ) || \
+      defined( _M_X64 ) || defined( _M_IX86 ) )
+#define GEL_DISPATCH_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#else
+#define GEL_DISPATCH_X86 0
+#endif
+
+// Compilers that need it are told which instruction set each kernel table
+// may use, so every table is built in this one translation unit.
+#if defined( __GNUC__ ) || defined( __clang__ )
+#define GEL_TARGET( isa ) __attribute__(( target( isa ) ))
+#else
+#define GEL_TARGET( isa )
+#endif
+
+namespace gel
+{
+
+namespace math
+{
+
+namespace
+{
+
+// HELPER FUNCTIONS
+/**
+ * Writes base + j for each set bit j of a lane mask without branching and
+ * returns how many were written.
+ */
+inline Size compact( uint32* out, uint32 base, uint32 mask, Size width )
+{
+    Size count = 0;
+    for ( Size j = 0; j < width; ++j )
+    {
+        out[count] = base + static_cast<uint32>( j );
+        count += ( mask >> j ) & 1;
+    }
+    return count;
+}
+
+// SCALAR KERNELS
+namespace scalar
+{
+
+#define GEL_KERNEL
+
+typedef float Pack;
+
+const Precision LEVEL = SIMD_SCALAR;
+
+const Size WIDTH = 1;
+
+inline Pack vload( const float* p ) { return *p; }
+
+inline void vstore( float* p, Pack a ) { *p = a; }
+
+inline Pack vset1( float s ) { return s; }
+
+inline Pack vadd( Pack a, Pack b ) { return a + b; }
+
+inline Pack vsub( Pack a, Pack b ) { return a - b; }
+
+inline Pack vmul( Pack a, Pack b ) { return a * b; }
+
+inline Pack vdiv( Pack a, Pack b ) { return a / b; }
+
+inline Pack vmadd( Pack a, Pack b, Pack c ) { return a * b + c; }
+
+inline Pack vsqrt( Pack a ) { return sqrtf( a ); }
+
+inline uint32 vnonneg( Pack a ) { return a >= 0; }
+
+inline Size vcompact( uint32* out, uint32 base, uint32 mask )
+{
+    return compact( out, base, mask, WIDTH );
+}
+
+#include "gel/math/batch_kernels.inl"
+
+#undef GEL_KERNEL
+
+} // End nspc scalar
+
+#if GEL_DISPATCH_X86
+// SSE2 KERNELS
+namespace sse2
+{
+
+#define GEL_KERNEL GEL_TARGET( "sse2" )
+
+typedef __m128 Pack;
+
+const Precision LEVEL = SIMD_SSE2;
+
+const Size WIDTH = 4;
+
+GEL_KERNEL inline Pack vload( const float* p ) { return _mm_loadu_ps( p ); }
+
+GEL_KERNEL inline void vstore( float* p, Pack a ) { _mm_storeu_ps( p, a ); }
+
+GEL_KERNEL inline Pack vset1( float s ) { return _mm_set1_ps( s ); }
+
+GEL_KERNEL inline Pack vadd( Pack a, Pack b ) { return _mm_add_ps( a, b ); }
+
+GEL_KERNEL inline Pack vsub( Pack a, Pack b ) { return _mm_sub_ps( a, b ); }
+
+GEL_KERNEL inline Pack vmul( Pack a, Pack b ) { return _mm_mul_ps( a, b ); }
+
+GEL_KERNEL inline Pack vdiv( Pack a, Pack b ) { return _mm_div_ps( a, b ); }
+
+GEL_KERNEL inline Pack vmadd( Pack a, Pack b, Pack c )
+{
+    return _mm_add_ps( _mm_mul_ps( a, b ), c );
+}
+
+GEL_KERNEL inline Pack vsqrt( Pack a ) { return _mm_sqrt_ps( a ); }
+
+GEL_KERNEL inline uint32 vnonneg( Pack a )
+{
+    return _mm_movemask_ps( _mm_cmpge_ps( a, _mm_setzero_ps() ) );
+}
+
+GEL_KERNEL inline Size vcompact( uint32* out, uint32 base, uint32 mask )
+{
+    return compact( out, base, mask, WIDTH );
+}
+
+#include "gel/math/batch_kernels.inl"
+
+#undef GEL_KERNEL
+
+} // End nspc sse2
+
+// SSE4.1 KERNELS
+namespace sse41
+{
+
+#define GEL_KERNEL GEL_TARGET( "sse4.1" )
+
+typedef __m128 Pack;
+
+const Precision LEVEL = SIMD_SSE41;
+
+const Size WIDTH = 4;
+
+GEL_KERNEL inline Pack vload( const float* p ) { return _mm_loadu_ps( p ); }
+
+GEL_KERNEL inline void vstore( float* p, Pack a ) { _mm_storeu_ps( p, a ); }
+
+GEL_KERNEL inline Pack vset1( float s ) { return _mm_set1_ps( s ); }
+
+GEL_KERNEL inline Pack vadd( Pack a, Pack b ) { return _mm_add_ps( a, b ); }
+
+GEL_KERNEL inline Pack vsub( Pack a, Pack b ) { return _mm_sub_ps( a, b ); }
+
+GEL_KERNEL inline Pack vmul( Pack a, Pack b ) { return _mm_mul_ps( a, b ); }
+
+GEL_KERNEL inline Pack vdiv( Pack a, Pack b ) { return _mm_div_ps( a, b ); }
+
+GEL_KERNEL inline Pack vmadd( Pack a, Pack b, Pack c )
+{
+    return _mm_add_ps( _mm_mul_ps( a, b ), c );
+}
+
+GEL_KERNEL inline Pack vsqrt( Pack a ) { return _mm_sqrt_ps( a ); }
+
+GEL_KERNEL inline uint32 vnonneg( Pack a )
+{
+    return _mm_movemask_ps( _mm_cmpge_ps( a, _mm_setzero_ps() ) );
+}
+
+GEL_KERNEL inline Size vcompact( uint32* out, uint32 base, uint32 mask )
+{
+    return compact( out, base, mask, WIDTH );
+}
+
+#include "gel/math/batch_kernels.inl"
+
+#undef GEL_KERNEL
+
+} // End nspc sse41
+
+// AVX2 KERNELS
+namespace avx2
+{
+
+#define GEL_KERNEL GEL_TARGET( "avx2,fma" )
+
+typedef __m256 Pack;
+
+const Precision LEVEL = SIMD_AVX2;
+
+const Size WIDTH = 8;
+
+GEL_KERNEL inline Pack vload( const float* p )
+{
+    return _mm256_loadu_ps( p );
+}
+
+GEL_KERNEL inline void vstore( float* p, Pack a )
+{
+    _mm256_storeu_ps( p, a );
+}
+
+GEL_KERNEL inline Pack vset1( float s ) { return _mm256_set1_ps( s ); }
+
+GEL_KERNEL inline Pack vadd( Pack a, Pack b ) { return _mm256_add_ps( a, b ); }
+
+GEL_KERNEL inline Pack vsub( Pack a, Pack b ) { return _mm256_sub_ps( a, b ); }
+
+GEL_KERNEL inline Pack vmul( Pack a, Pack b ) { return _mm256_mul_ps( a, b ); }
+
+GEL_KERNEL inline Pack vdiv( Pack a, Pack b ) { return _mm256_div_ps( a, b ); }
+
+GEL_KERNEL inline Pack vmadd( Pack a, Pack b, Pack c )
+{
+    return _mm256_fmadd_ps( a, b, c );
+}
+
+GEL_KERNEL inline Pack vsqrt( Pack a ) { return _mm256_sqrt_ps( a ); }
+
+GEL_KERNEL inline uint32 vnonneg( Pack a )
+{
+    return _mm256_movemask_ps(
+        _mm256_cmp_ps( a, _mm256_setzero_ps(), _CMP_GE_OQ ) );
+}
+
+GEL_KERNEL inline Size vcompact( uint32* out, uint32 base, uint32 mask )
+{
+    return compact( out, base, mask, WIDTH );
+}
+
+#include "gel/math/batch_kernels.inl"
+
+#undef GEL_KERNEL
+
+} // End nspc avx2
+
+// AVX-512 KERNELS
+namespace avx512
+{
+
+#define GEL_KERNEL GEL_TARGET( "avx512f" )
+
+typedef __m512 Pack;
+
+const Precision LEVEL = SIMD_AVX512;
+
+const Size WIDTH = 16;
+
+GEL_KERNEL inline Pack vload( const float* p )
+{
+    return _mm512_loadu_ps( p );
+}
+
+GEL_KERNEL inline void vstore( float* p, Pack a )
+{
+    _mm512_storeu_ps( p, a );
+}
+
+GEL_KERNEL inline Pack vset1( float s ) { return _mm512_set1_ps( s ); }
+
+GEL_KERNEL inline Pack vadd( Pack a, Pack b ) { return _mm512_add_ps( a, b ); }
+
+GEL_KERNEL inline Pack vsub( Pack a, Pack b ) { return _mm512_sub_ps( a, b ); }
+
+GEL_KERNEL inline Pack vmul( Pack a, Pack b ) { return _mm512_mul_ps( a, b ); }
+
+GEL_KERNEL inline Pack vdiv( Pack a, Pack b ) { return _mm512_div_ps( a, b ); }
+
+GEL_KERNEL inline Pack vmadd( Pack a, Pack b, Pack c )
+{
+    return _mm512_fmadd_ps( a, b, c );
+}
+
+GEL_KERNEL inline Pack vsqrt( Pack a )
+{
+    // GCC 12 warns that the unmasked form reads an undefined register
+    return _mm512_maskz_sqrt_ps( 0xFFFF, a );
+}
+
+GEL_KERNEL inline uint32 vnonneg( Pack a )
+{
+    return _mm512_cmp_ps_mask( a, _mm512_setzero_ps(), _CMP_GE_OQ );
+}
+
+GEL_KERNEL inline Size vcompact( uint32* out, uint32 base, uint32 mask )
+{
+    const __m512i lanes = _mm512_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+                                             10, 11, 12, 13, 14, 15 );
+    _mm512_mask_compressstoreu_epi32(
+        out, static_cast<__mmask16>( mask ),
+        _mm512_add_epi32( _mm512_set1_epi32( base ), lanes ) );
+
+    // count the set bits in parallel
+    mask = mask - ( ( mask >> 1 ) & 0x5555 );
+    mask = ( mask & 0x3333 ) + ( ( mask >> 2 ) & 0x3333 );
+    mask = ( mask + ( mask >> 4 ) ) & 0x0F0F;
+    return ( mask + ( mask >> 8 ) ) & 0x1F;
+}
+
+#include "gel/math/batch_kernels.inl"
+
+#undef GEL_KERNEL
+
+} // End nspc avx512
+
+// CPU DETECTION
+/**
+ * Runs cpuid for a leaf and subleaf.
+ */
+void cpuid( uint32 leaf, uint32 subleaf, uint32 regs[4] )
+{
+#ifdef _MSC_VER
+    int r[4];
+    __cpuidex( r, leaf, subleaf );
+    for ( int i = 0; i < 4; ++i )
+    {
+        regs[i] = static_cast<uint32>( r[i] );
+    }
+#else
+    __cpuid_count( leaf, subleaf, regs[0], regs[1], regs[2], regs[3] );
+#endif
+}
+
+/**
+ * Reads the register state the operating system saves on context switches.
+ */
+uint64 xgetbv()
+{
+#ifdef _MSC_VER
+    return _xgetbv( 0 );
+#else
+    uint32 lo;
+    uint32 hi;
+    __asm__ __volatile__( "xgetbv" : "=a"( lo ), "=d"( hi ) : "c"( 0 ) );
+    return ( static_cast<uint64>( hi ) << 32 ) | lo;
+#endif
+}
+#endif
+
+// DISPATCH
+/**
+ * Gets the kernels compiled for a supported level.
+ */
+const BatchKernels& table( Precision level )
+{
+    switch ( level )
+    {
+#if GEL_DISPATCH_X86
+      case SIMD_AVX512:
+        return avx512::KERNELS;
+      case SIMD_AVX2:
+        return avx2::KERNELS;
+      case SIMD_SSE41:
+        return sse41::KERNELS;
+      case SIMD_SSE2:
+        return sse2::KERNELS;
+#endif
+      default:
+        return scalar::KERNELS;
+    }
+}
+
+/**
+ * Caps a requested level at what the CPU supports.
+ */
+Precision cap( Precision level )
+{
+    static const Precision SUPPORTED = detectSimd();
+
+    assert( level >= SIMD_SCALAR && level <= SIMD_BEST );
+    return level < SUPPORTED ? level : SUPPORTED;
+}
+
+/**
+ * Gets the kernels returned for SIMD_BEST, chosen on first use.
+ */
+const BatchKernels*& active()
+{
+    static const BatchKernels* kernels = &table( cap( GEL_SIMD_DISPATCH ) );
+    return kernels;
+}
+
+} // End nspc anonymous
+
+Precision detectSimd()
+{
+#if GEL_DISPATCH_X86
+    uint32 regs[4];
+    cpuid( 0, 0, regs );
+    const uint32 maxLeaf = regs[0];
+
+    cpuid( 1, 0, regs );
+    const uint32 ecx = regs[2];
+    const uint32 edx = regs[3];
+    if ( !( edx & ( 1u << 26 ) ) )
+    {
+        return SIMD_SCALAR;
+    }
+    if ( !( ecx & ( 1u << 19 ) ) )
+    {
+        return SIMD_SSE2;
+    }
+
+    // AVX state must be enabled by the operating system through XSAVE
+    const bool osxsave = ( ecx & ( 1u << 27 ) ) != 0;
+    const bool avx = ( ecx & ( 1u << 28 ) ) != 0;
+    const bool fma = ( ecx & ( 1u << 12 ) ) != 0;
+    if ( maxLeaf < 7 || !osxsave || !avx || !fma )
+    {
+        return SIMD_SSE41;
+    }
+
+    const uint64 xcr0 = xgetbv();
+    if ( ( xcr0 & 0x6 ) != 0x6 )
+    {
+        return SIMD_SSE41;
+    }
+
+    cpuid( 7, 0, regs );
+    const uint32 ebx = regs[1];
+    if ( !( ebx & ( 1u << 5 ) ) )
+    {
+        return SIMD_SSE41;
+    }
+    if ( !( ebx & ( 1u << 16 ) ) || ( xcr0 & 0xE6 ) != 0xE6 )
+    {
+        return SIMD_AVX2;
+    }
+    return SIMD_AVX512;
+#else
+    return SIMD_SCALAR;
+#endif
+}
+
+Precision selectSimd( Precision level )
+{
+    active() = &table( cap( level == SIMD_BEST ? GEL_SIMD_DISPATCH : level ) );
+    return active()->level;
+}
+
+const BatchKernels& batchKernels( Precision level )
+{
+    return level == SIMD_BEST ? *active() : table( cap( level ) );
+}
+
+} // End nspc math
+
+} // End nspc gel
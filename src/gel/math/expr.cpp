@@ -0,0 +1,2 @@
+// expr.cpp
+#include "gel/math/expr.h"
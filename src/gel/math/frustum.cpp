@@ -0,0 +1,2 @@
+// frustum.cpp
+#include "gel/math/frustum.h"
@@ -0,0 +1,2 @@
+// geometric.cpp
+#include "gel/math/geometric.h"
@@ -0,0 +1,2 @@
+// mat.cpp
+#include "gel/math/mat.h"
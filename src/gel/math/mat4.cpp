@@ -0,0 +1,2 @@
+// mat4.cpp
+#include "gel/math/mat4.h"
@@ -0,0 +1,2 @@
+// quat.cpp
+#include "gel/math/quat.h"
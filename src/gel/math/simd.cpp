@@ -0,0 +1,2 @@
+// simd.cpp
+#include "gel/math/simd.h"
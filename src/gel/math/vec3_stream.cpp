@@ -0,0 +1,2 @@
+// vec3_stream.cpp
+#include "gel/math/vec3_stream.h"
@@ -0,0 +1,2 @@
+// vec4_simd.cpp
+#include "gel/math/vec4_simd.h"
@@ -0,0 +1,2 @@
+// vec4_stream.cpp
+#include "gel/math/vec4_stream.h"
@@ -0,0 +1,362 @@
+// buddy_memory.cpp
+#include "gel/memory/buddy_memory.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace gel
+{
+
+namespace mem
+{
+
+namespace
+{
+
+/**
+ * Tests a bit.
+ *
+ * @param bits  The bitmap.
+ * @param index The index of the bit.
+ * @return      If the bit is set.
+ */
+inline
+bool test(const uint64* bits, Size index)
+{
+    return (bits[index >> 6] >> (index & 63)) & 1;
+}
+
+/**
+ * Flips a bit.
+ *
+ * @param bits  The bitmap.
+ * @param index The index of the bit.
+ * @return      If the bit is set afterwards.
+ */
+inline
+bool flip(uint64* bits, Size index)
+{
+    bits[index >> 6] ^= uint64(1) << (index & 63);
+    return test(bits, index);
+}
+
+/**
+ * Sets or clears a bit.
+ *
+ * @param bits  The bitmap.
+ * @param index The index of the bit.
+ * @param value The value of the bit.
+ */
+inline
+void assign(uint64* bits, Size index, bool value)
+{
+    const uint64 mask = uint64(1) << (index & 63);
+    bits[index >> 6] = value ? bits[index >> 6] | mask
+                             : bits[index >> 6] & ~mask;
+}
+
+/**
+ * Gets the parent of a node.
+ *
+ * @param node The node, which must not be the root.
+ * @return     The parent.
+ */
+inline
+Size parent(Size node)
+{
+    return (node - 1) >> 1;
+}
+
+} // End nspc anonymous
+
+const unsigned BuddyMemory::MAX_LEVELS;
+
+// CONSTRUCTORS
+BuddyMemory::BuddyMemory(Size capacity, Size minBlock, IMemory& memory)
+    : _memory(&memory), _region(0), _base(0), _bits(0), _split(0),
+      _pairs(0), _log2(0), _levels(0), _capacity(0), _size(0)
+{
+    assert(minBlock >= sizeof(Block) && (minBlock & (minBlock - 1)) == 0);
+    memset(_free, 0, sizeof(_free));
+    memset(_freeCounts, 0, sizeof(_freeCounts));
+
+    unsigned minLog2 = 0;
+    while ((Size(1) << minLog2) < minBlock)
+    {
+        ++minLog2;
+    }
+    unsigned levels = 0;
+    while (levels < MAX_LEVELS && (minBlock << levels) <= capacity)
+    {
+        ++levels;
+    }
+    if (levels == 0)
+    {
+        return;
+    }
+
+    // both bitmaps have a bit for every block that has children
+    const Size nodes = Size(1) << (levels - 1);
+    const Size words = (nodes + 63) / 64;
+    _bits = static_cast<uint64*>(memory.allocate(2 * words * sizeof(uint64)));
+    _region = memory.allocate((minBlock << (levels - 1)) + minBlock - 1);
+    if (!_bits || !_region)
+    {
+        return;
+    }
+    memset(_bits, 0, 2 * words * sizeof(uint64));
+    _split = _bits;
+    _pairs = _bits + words;
+
+    uintptr_t base = reinterpret_cast<uintptr_t>(_region);
+    base = (base + minBlock - 1) & ~static_cast<uintptr_t>(minBlock - 1);
+    _base = reinterpret_cast<char*>(base);
+    _levels = levels;
+    _log2 = minLog2 + levels - 1;
+    _capacity = Size(1) << _log2;
+    push(0, _base);
+}
+
+BuddyMemory::~BuddyMemory()
+{
+    if (_region)
+    {
+        _memory->release(_region);
+    }
+    if (_bits)
+    {
+        _memory->release(_bits);
+    }
+}
+
+// MEMBER FUNCTIONS
+void* BuddyMemory::allocate(Size size)
+{
+    if (size == 0 || size > _capacity)
+    {
+        return 0;
+    }
+
+    const unsigned target = levelFor(size);
+    unsigned level = target;
+    while (!_free[level])
+    {
+        if (level == 0)
+        {
+            return 0;
+        }
+        --level;
+    }
+
+    char* block = reinterpret_cast<char*>(_free[level]);
+    unlink(level, block);
+    Size node = nodeOf(block, level);
+    if (node)
+    {
+        flip(_pairs, parent(node));
+    }
+    split(node, level, target);
+    _size += _capacity >> level;
+    return block;
+}
+
+void* BuddyMemory::reallocate(void* pointer, Size size)
+{
+    if (!pointer)
+    {
+        return allocate(size);
+    }
+    if (size == 0)
+    {
+        release(pointer);
+        return 0;
+    }
+    if (size > _capacity)
+    {
+        return 0;
+    }
+
+    char* block = static_cast<char*>(pointer);
+    Size node;
+    unsigned level;
+    locate(block, node, level);
+    const unsigned target = levelFor(size);
+    const Size current = _capacity >> level;
+    if (target >= level)
+    {
+        split(node, level, target);
+        _size -= current - (_capacity >> level);
+        return pointer;
+    }
+
+    // the block can grow while it is the lower half of its parent and the
+    // upper half is free, which the pair bit says as the block is in use
+    bool growable = true;
+    Size n = node;
+    for (unsigned l = level; l > target && growable; --l, n = parent(n))
+    {
+        growable = (n & 1) && test(_pairs, parent(n));
+    }
+
+    if (growable)
+    {
+        for (; level > target; --level)
+        {
+            unlink(level, blockOf(node + 1, level));
+            flip(_pairs, parent(node));
+            node = parent(node);
+            assign(_split, node, false);
+        }
+        _size += (_capacity >> level) - current;
+        return pointer;
+    }
+
+    void* moved = allocate(size);
+    if (moved)
+    {
+        memcpy(moved, pointer, current);
+        release(pointer);
+    }
+    return moved;
+}
+
+void BuddyMemory::release(void* pointer)
+{
+    if (!pointer)
+    {
+        return;
+    }
+
+    Size node;
+    unsigned level;
+    locate(static_cast<char*>(pointer), node, level);
+    _size -= _capacity >> level;
+
+    // merge upwards while the buddy is free, which is when the pair bit
+    // clears as this block stops being in use
+    while (node && !flip(_pairs, parent(node)))
+    {
+        const Size buddy = node & 1 ? node + 1 : node - 1;
+        unlink(level, blockOf(buddy, level));
+        node = parent(node);
+        --level;
+        assign(_split, node, false);
+    }
+    push(level, blockOf(node, level));
+}
+
+// ACCESSOR FUNCTIONS
+Size BuddyMemory::blockSize(const void* pointer) const
+{
+    Size node;
+    unsigned level;
+    locate(static_cast<const char*>(pointer), node, level);
+    return _capacity >> level;
+}
+
+Size BuddyMemory::largestFree() const
+{
+    for (unsigned level = 0; level < _levels; ++level)
+    {
+        if (_free[level])
+        {
+            return _capacity >> level;
+        }
+    }
+    return 0;
+}
+
+float BuddyMemory::fragmentation() const
+{
+    const Size free = _capacity - _size;
+    if (free == 0)
+    {
+        return 0.0f;
+    }
+    return 1.0f - static_cast<float>(largestFree()) / free;
+}
+
+// HELPER FUNCTIONS
+unsigned BuddyMemory::levelFor(Size size) const
+{
+    unsigned level = _levels - 1;
+    while (level > 0 && (_capacity >> level) < size)
+    {
+        --level;
+    }
+    return level;
+}
+
+Size BuddyMemory::nodeOf(const char* ptr, unsigned level) const
+{
+    const Size offset = ptr - _base;
+    return (Size(1) << level) - 1 + (offset >> (_log2 - level));
+}
+
+char* BuddyMemory::blockOf(Size node, unsigned level) const
+{
+    const Size index = node - ((Size(1) << level) - 1);
+    return _base + (index << (_log2 - level));
+}
+
+void BuddyMemory::locate(const char* ptr, Size& node, unsigned& level) const
+{
+    assert(ptr >= _base && ptr < _base + _capacity);
+    node = 0;
+    level = 0;
+    while (level + 1 < _levels && test(_split, node))
+    {
+        ++level;
+        node = nodeOf(ptr, level);
+    }
+    assert(blockOf(node, level) == ptr);
+}
+
+void BuddyMemory::split(Size& node, unsigned& level, unsigned target)
+{
+    // the lower half stays in use and the upper half is freed, which sets
+    // the pair bit of the new children
+    for (; level < target; ++level)
+    {
+        assign(_split, node, true);
+        node = 2 * node + 1;
+        push(level + 1, blockOf(node + 1, level + 1));
+        flip(_pairs, parent(node));
+    }
+}
+
+void BuddyMemory::push(unsigned level, char* ptr)
+{
+    Block* block = reinterpret_cast<Block*>(ptr);
+    block->next = _free[level];
+    block->previous = 0;
+    if (block->next)
+    {
+        block->next->previous = block;
+    }
+    _free[level] = block;
+    ++_freeCounts[level];
+}
+
+void BuddyMemory::unlink(unsigned level, char* ptr)
+{
+    Block* block = reinterpret_cast<Block*>(ptr);
+    if (block->next)
+    {
+        block->next->previous = block->previous;
+    }
+    if (block->previous)
+    {
+        block->previous->next = block->next;
+    }
+    else
+    {
+        _free[level] = block->next;
+    }
+    --_freeCounts[level];
+}
+
+} // End nspc mem
+
+} // End nspc gel
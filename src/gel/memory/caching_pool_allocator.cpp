@@ -0,0 +1,2 @@
+// caching_pool_allocator.cpp
+#include "gel/memory/caching_pool_allocator.h"
@@ -0,0 +1,2 @@
+// concurrent_pool_allocator.cpp
+#include "gel/memory/concurrent_pool_allocator.h"
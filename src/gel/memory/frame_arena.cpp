@@ -0,0 +1,14 @@
+// frame_arena.cpp
+#include "gel/memory/frame_arena.h"
+
+namespace gel
+{
+
+namespace mem
+{
+
+const Size FrameArena::ALIGNMENT;
+
+} // End nspc mem
+
+} // End nspc gel
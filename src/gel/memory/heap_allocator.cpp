@@ -0,0 +1,2 @@
+// heap_allocator.cpp
+#include "gel/memory/heap_allocator.h"
@@ -0,0 +1,2 @@
+// heap_memory.cpp
+#include "gel/memory/heap_memory.h"
@@ -0,0 +1,16 @@
+// stack_allocator.cpp
+#include "gel/memory/stack_allocator.h"
+
+namespace gel
+{
+
+namespace mem
+{
+
+const Size StackAllocator::ALIGNMENT;
+
+const Size DoubleEndedStackAllocator::ALIGNMENT;
+
+} // End nspc mem
+
+} // End nspc gel
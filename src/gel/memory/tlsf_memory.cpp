@@ -0,0 +1,410 @@
+// tlsf_memory.cpp
+#include "gel/memory/tlsf_memory.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace gel
+{
+
+namespace mem
+{
+
+namespace
+{
+
+/**
+ * The base two logarithm of the alignment.
+ */
+const unsigned ALIGNMENT_LOG2 = 4;
+
+/**
+ * The first level of the smallest size that is not split linearly.
+ */
+const unsigned FL_SHIFT = TlsfMemory::SL_COUNT_LOG2 + ALIGNMENT_LOG2;
+
+/**
+ * The sizes below this are split linearly across the first level list.
+ */
+const Size SMALL_SIZE = Size(1) << FL_SHIFT;
+
+/**
+ * The free flag of a block size.
+ */
+const Size FREE = 1;
+
+/**
+ * Gets the index of the lowest set bit.
+ *
+ * @param bits The bits, which must not be zero.
+ * @return     The index.
+ */
+inline
+unsigned lowestBit(uint32 bits)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, bits);
+    return index;
+#else
+    return __builtin_ctz(bits);
+#endif
+}
+
+/**
+ * Gets the index of the highest set bit.
+ *
+ * @param bits The bits, which must not be zero.
+ * @return     The index.
+ */
+inline
+unsigned highestBit(uint64 bits)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanReverse64(&index, bits);
+    return index;
+#else
+    return 63 - __builtin_clzll(bits);
+#endif
+}
+
+/**
+ * Gets the lists that hold blocks of a size.
+ *
+ * @param size The size, in bytes.
+ * @param fl   The first level index.
+ * @param sl   The second level index.
+ */
+inline
+void mapping(Size size, unsigned& fl, unsigned& sl)
+{
+    if (size < SMALL_SIZE)
+    {
+        fl = 0;
+        sl = static_cast<unsigned>(size >> ALIGNMENT_LOG2);
+    }
+    else
+    {
+        const unsigned bit = highestBit(size);
+        const unsigned shift = bit - TlsfMemory::SL_COUNT_LOG2;
+        sl = static_cast<unsigned>(size >> shift) ^ TlsfMemory::SL_COUNT;
+        fl = bit - (FL_SHIFT - 1);
+    }
+    assert(fl < TlsfMemory::FL_COUNT);
+}
+
+/**
+ * Rounds a size up to the alignment.
+ *
+ * @param size The size, in bytes.
+ * @return     The rounded size.
+ */
+inline
+Size align(Size size)
+{
+    const Size mask = TlsfMemory::ALIGNMENT - 1;
+    return (size + mask) & ~mask;
+}
+
+} // End nspc anonymous
+
+const Size TlsfMemory::ALIGNMENT;
+
+const unsigned TlsfMemory::SL_COUNT_LOG2;
+
+const unsigned TlsfMemory::SL_COUNT;
+
+const unsigned TlsfMemory::FL_COUNT;
+
+const Size TlsfMemory::MAX_SIZE;
+
+const Size TlsfMemory::OVERHEAD = offsetof(TlsfMemory::Block, nextFree);
+
+// CONSTRUCTORS
+TlsfMemory::TlsfMemory(Size capacity, IMemory& memory)
+    : _memory(&memory), _pools(0), _flBitmap(0), _capacity(0), _size(0)
+{
+    assert(OVERHEAD % ALIGNMENT == 0);
+    memset(_slBitmaps, 0, sizeof(_slBitmaps));
+    memset(_blocks, 0, sizeof(_blocks));
+    addPool(capacity);
+}
+
+TlsfMemory::~TlsfMemory()
+{
+    while (_pools)
+    {
+        Pool* next = _pools->next;
+        _memory->release(_pools);
+        _pools = next;
+    }
+}
+
+// MEMBER FUNCTIONS
+void* TlsfMemory::allocate(Size size)
+{
+    if (size == 0 || size > MAX_SIZE)
+    {
+        return 0;
+    }
+
+    const Size adjusted = align(size);
+    Block* block = find(adjusted);
+    if (!block)
+    {
+        return 0;
+    }
+
+    block->size &= ~FREE;
+    trim(block, adjusted);
+    _size += sizeOf(block);
+    return reinterpret_cast<char*>(block) + OVERHEAD;
+}
+
+void* TlsfMemory::reallocate(void* pointer, Size size)
+{
+    if (!pointer)
+    {
+        return allocate(size);
+    }
+    if (size == 0)
+    {
+        release(pointer);
+        return 0;
+    }
+    if (size > MAX_SIZE)
+    {
+        return 0;
+    }
+
+    Block* block = header(pointer);
+    assert(!(block->size & FREE));
+    const Size current = sizeOf(block);
+    const Size adjusted = align(size);
+    if (adjusted > current)
+    {
+        Block* following = next(block);
+        if (!(following->size & FREE) ||
+            current + OVERHEAD + sizeOf(following) < adjusted)
+        {
+            void* moved = allocate(size);
+            if (moved)
+            {
+                memcpy(moved, pointer, current);
+                release(pointer);
+            }
+            return moved;
+        }
+
+        // absorb the free block that follows
+        remove(following);
+        block->size = current + OVERHEAD + sizeOf(following);
+        next(block)->previous = block;
+    }
+
+    _size -= current;
+    trim(block, adjusted);
+    _size += sizeOf(block);
+    return pointer;
+}
+
+void TlsfMemory::release(void* pointer)
+{
+    if (!pointer)
+    {
+        return;
+    }
+
+    Block* block = header(pointer);
+    assert(!(block->size & FREE));
+    _size -= sizeOf(block);
+    block->size |= FREE;
+    insert(merge(block));
+}
+
+bool TlsfMemory::addPool(Size capacity)
+{
+    // a pool holds one free block and an allocated sentinel of size zero
+    // that stops merging at its end
+    const Size usable = capacity & ~(ALIGNMENT - 1);
+    if (usable < 3 * OVERHEAD || usable - 2 * OVERHEAD > 2 * MAX_SIZE)
+    {
+        return false;
+    }
+
+    Pool* pool = static_cast<Pool*>(
+        _memory->allocate(sizeof(Pool) + ALIGNMENT - 1 + usable));
+    if (!pool)
+    {
+        return false;
+    }
+    pool->next = _pools;
+    _pools = pool;
+
+    uintptr_t start = reinterpret_cast<uintptr_t>(pool + 1);
+    start = (start + ALIGNMENT - 1) & ~static_cast<uintptr_t>(ALIGNMENT - 1);
+
+    Block* block = reinterpret_cast<Block*>(start);
+    block->previous = 0;
+    block->size = (usable - 2 * OVERHEAD) | FREE;
+
+    Block* sentinel = next(block);
+    sentinel->previous = block;
+    sentinel->size = 0;
+
+    _capacity += sizeOf(block);
+    insert(block);
+    return true;
+}
+
+// ACCESSOR FUNCTIONS
+Size TlsfMemory::blockSize(const void* pointer)
+{
+    return sizeOf(header(pointer));
+}
+
+// HELPER FUNCTIONS
+TlsfMemory::Block* TlsfMemory::header(const void* pointer)
+{
+    return reinterpret_cast<Block*>(
+        const_cast<char*>(static_cast<const char*>(pointer)) - OVERHEAD);
+}
+
+Size TlsfMemory::sizeOf(const Block* block)
+{
+    return block->size & ~FREE;
+}
+
+TlsfMemory::Block* TlsfMemory::next(Block* block)
+{
+    return reinterpret_cast<Block*>(
+        reinterpret_cast<char*>(block) + OVERHEAD + sizeOf(block));
+}
+
+void TlsfMemory::insert(Block* block)
+{
+    unsigned fl;
+    unsigned sl;
+    mapping(sizeOf(block), fl, sl);
+
+    Block* head = _blocks[fl][sl];
+    block->nextFree = head;
+    block->previousFree = 0;
+    if (head)
+    {
+        head->previousFree = block;
+    }
+    _blocks[fl][sl] = block;
+    _flBitmap |= 1u << fl;
+    _slBitmaps[fl] |= 1u << sl;
+}
+
+void TlsfMemory::remove(Block* block)
+{
+    unsigned fl;
+    unsigned sl;
+    mapping(sizeOf(block), fl, sl);
+
+    if (block->nextFree)
+    {
+        block->nextFree->previousFree = block->previousFree;
+    }
+    if (block->previousFree)
+    {
+        block->previousFree->nextFree = block->nextFree;
+    }
+    else
+    {
+        _blocks[fl][sl] = block->nextFree;
+        if (!block->nextFree)
+        {
+            _slBitmaps[fl] &= ~(1u << sl);
+            if (!_slBitmaps[fl])
+            {
+                _flBitmap &= ~(1u << fl);
+            }
+        }
+    }
+}
+
+TlsfMemory::Block* TlsfMemory::find(Size size)
+{
+    // round up to the next list, so that any block in the list that is
+    // found is large enough
+    if (size >= SMALL_SIZE)
+    {
+        size += (Size(1) << (highestBit(size) - SL_COUNT_LOG2)) - 1;
+    }
+
+    unsigned fl;
+    unsigned sl;
+    mapping(size, fl, sl);
+
+    uint32 slMap = _slBitmaps[fl] & (~0u << sl);
+    if (!slMap)
+    {
+        const uint32 flMap = fl + 1 < FL_COUNT ?
+                             _flBitmap & (~0u << (fl + 1)) : 0;
+        if (!flMap)
+        {
+            return 0;
+        }
+        fl = lowestBit(flMap);
+        slMap = _slBitmaps[fl];
+    }
+    sl = lowestBit(slMap);
+
+    Block* block = _blocks[fl][sl];
+    remove(block);
+    return block;
+}
+
+void TlsfMemory::trim(Block* block, Size size)
+{
+    const Size current = sizeOf(block);
+    if (current < size + 2 * OVERHEAD)
+    {
+        return;
+    }
+
+    Block* rest = reinterpret_cast<Block*>(
+        reinterpret_cast<char*>(block) + OVERHEAD + size);
+    rest->previous = block;
+    rest->size = (current - size - OVERHEAD) | FREE;
+    block->size = size;
+    next(rest)->previous = rest;
+    insert(merge(rest));
+}
+
+TlsfMemory::Block* TlsfMemory::merge(Block* block)
+{
+    Block* previous = block->previous;
+    if (previous && (previous->size & FREE))
+    {
+        remove(previous);
+        previous->size = (sizeOf(previous) + OVERHEAD +
+                          sizeOf(block)) | FREE;
+        block = previous;
+        next(block)->previous = block;
+    }
+
+    Block* following = next(block);
+    if (following->size & FREE)
+    {
+        remove(following);
+        block->size = (sizeOf(block) + OVERHEAD + sizeOf(following)) | FREE;
+        next(block)->previous = block;
+    }
+    return block;
+}
+
+} // End nspc mem
+
+} // End nspc gel
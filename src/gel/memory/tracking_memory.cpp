@@ -0,0 +1,376 @@
+// tracking_memory.cpp
+#include "gel/memory/tracking_memory.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "gel/log.h"
+
+namespace gel
+{
+
+namespace mem
+{
+
+namespace
+{
+
+/**
+ * The size of a message of dump().
+ */
+const Size MESSAGE_SIZE = 256;
+
+/**
+ * Gets the header of a block.
+ *
+ * @param pointer The pointer to the block.
+ * @return        The header.
+ */
+inline
+detail::TrackingHeader* header(const void* pointer)
+{
+    return reinterpret_cast<detail::TrackingHeader*>(
+        const_cast<char*>(static_cast<const char*>(pointer)) -
+        TrackingMemory::HEADER);
+}
+
+} // End nspc anonymous
+
+const unsigned AllocationStats::MAX_TAGS;
+
+const unsigned AllocationStats::BUCKETS;
+
+const Size TrackingMemory::HEADER;
+
+const Size detail::TrackingTable::MIN_CAPACITY;
+
+// CONSTRUCTORS
+AllocationStats::AllocationStats()
+    : _live(0), _peak(0), _count(0), _total(0)
+{
+    memset(_histogram, 0, sizeof(_histogram));
+    memset(_tagLive, 0, sizeof(_tagLive));
+    memset(_tagPeak, 0, sizeof(_tagPeak));
+    memset(_tagCount, 0, sizeof(_tagCount));
+    memset(_tagNames, 0, sizeof(_tagNames));
+}
+
+// MEMBER FUNCTIONS
+void AllocationStats::recordAllocate(Size size, unsigned tag)
+{
+    assert(tag < MAX_TAGS);
+    _live += size;
+    _peak = _live > _peak ? _live : _peak;
+    ++_count;
+    ++_total;
+    ++_histogram[bucketOf(size)];
+
+    _tagLive[tag] += size;
+    _tagPeak[tag] = _tagLive[tag] > _tagPeak[tag] ? _tagLive[tag]
+                                                  : _tagPeak[tag];
+    ++_tagCount[tag];
+}
+
+void AllocationStats::recordRelease(Size size, unsigned tag)
+{
+    assert(tag < MAX_TAGS);
+    assert(size <= _live && size <= _tagLive[tag] && _tagCount[tag]);
+    _live -= size;
+    --_count;
+    _tagLive[tag] -= size;
+    --_tagCount[tag];
+}
+
+void AllocationStats::resetPeaks()
+{
+    _peak = _live;
+    memcpy(_tagPeak, _tagLive, sizeof(_tagPeak));
+}
+
+void AllocationStats::setTagName(unsigned tag, const char* name)
+{
+    assert(tag < MAX_TAGS);
+    _tagNames[tag] = name;
+}
+
+void AllocationStats::dump(const char* name) const
+{
+    char message[MESSAGE_SIZE];
+    snprintf(message, sizeof(message),
+             "live %llu bytes in %llu allocations, peak %llu bytes, "
+             "%llu allocations made",
+             static_cast<unsigned long long>(_live),
+             static_cast<unsigned long long>(_count),
+             static_cast<unsigned long long>(_peak),
+             static_cast<unsigned long long>(_total));
+    logd(name, message);
+
+    for (unsigned tag = 0; tag < MAX_TAGS; ++tag)
+    {
+        if (!_tagPeak[tag])
+        {
+            continue;
+        }
+        char unnamed[16];
+        snprintf(unnamed, sizeof(unnamed), "tag %u", tag);
+        snprintf(message, sizeof(message),
+                 "%s: live %llu bytes in %llu allocations, peak %llu bytes",
+                 _tagNames[tag] ? _tagNames[tag] : unnamed,
+                 static_cast<unsigned long long>(_tagLive[tag]),
+                 static_cast<unsigned long long>(_tagCount[tag]),
+                 static_cast<unsigned long long>(_tagPeak[tag]));
+        logd(name, message);
+    }
+
+    for (unsigned bucket = 0; bucket < BUCKETS; ++bucket)
+    {
+        if (!_histogram[bucket])
+        {
+            continue;
+        }
+        snprintf(message, sizeof(message),
+                 "sizes below %llu: %llu allocations",
+                 1ull << bucket,
+                 static_cast<unsigned long long>(_histogram[bucket]));
+        logd(name, message);
+    }
+}
+
+// ACCESSOR FUNCTIONS
+unsigned AllocationStats::bucketOf(Size size)
+{
+    unsigned bucket = 0;
+    while (size && bucket + 1 < BUCKETS)
+    {
+        size >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+// CONSTRUCTORS
+TrackingMemory::TrackingMemory(IMemory& memory)
+    : _memory(&memory), _tag(0)
+{
+    assert(sizeof(detail::TrackingHeader) == HEADER);
+}
+
+TrackingMemory::~TrackingMemory()
+{
+}
+
+// MEMBER FUNCTIONS
+void* TrackingMemory::allocate(Size size)
+{
+    return allocate(size, _tag);
+}
+
+void* TrackingMemory::allocate(Size size, unsigned tag)
+{
+    char* block = static_cast<char*>(_memory->allocate(HEADER + size));
+    if (!block)
+    {
+        return 0;
+    }
+
+    detail::TrackingHeader* head =
+        reinterpret_cast<detail::TrackingHeader*>(block);
+    head->size = size;
+    head->tag = tag;
+    _stats.recordAllocate(size, tag);
+    return block + HEADER;
+}
+
+void* TrackingMemory::reallocate(void* pointer, Size size)
+{
+    if (!pointer)
+    {
+        return allocate(size);
+    }
+    if (size == 0)
+    {
+        release(pointer);
+        return 0;
+    }
+
+    const detail::TrackingHeader previous = *header(pointer);
+    char* block = static_cast<char*>(
+        _memory->reallocate(header(pointer), HEADER + size));
+    if (!block)
+    {
+        return 0;
+    }
+
+    _stats.recordRelease(previous.size, previous.tag);
+    reinterpret_cast<detail::TrackingHeader*>(block)->size = size;
+    _stats.recordAllocate(size, previous.tag);
+    return block + HEADER;
+}
+
+void TrackingMemory::release(void* pointer)
+{
+    if (!pointer)
+    {
+        return;
+    }
+
+    const detail::TrackingHeader* head = header(pointer);
+    _stats.recordRelease(head->size, head->tag);
+    _memory->release(const_cast<detail::TrackingHeader*>(head));
+}
+
+// ACCESSOR FUNCTIONS
+Size TrackingMemory::blockSize(const void* pointer)
+{
+    return header(pointer)->size;
+}
+
+namespace detail
+{
+
+// CONSTRUCTORS
+TrackingTable::TrackingTable(IMemory& memory)
+    : _memory(&memory), _entries(0), _capacity(0), _size(0)
+{
+}
+
+TrackingTable::~TrackingTable()
+{
+    if (_entries)
+    {
+        _memory->release(_entries);
+    }
+}
+
+// MEMBER FUNCTIONS
+bool TrackingTable::insert(const void* key, const TrackingRecord& record)
+{
+    assert(key);
+    if ((_size + 1) * 2 > _capacity && !grow())
+    {
+        return false;
+    }
+
+    const Size mask = _capacity - 1;
+    Size slot = home(key);
+    for (; _entries[slot].key; slot = (slot + 1) & mask)
+    {
+        if (_entries[slot].key == key)
+        {
+            return false;
+        }
+    }
+    _entries[slot].key = key;
+    _entries[slot].record = record;
+    ++_size;
+    return true;
+}
+
+bool TrackingTable::erase(const void* key)
+{
+    Size hole = locate(key);
+    if (hole == _capacity)
+    {
+        return false;
+    }
+
+    // every later entry of the run that may live in the hole is shifted
+    // back into it, which keeps each key reachable from its home entry
+    const Size mask = _capacity - 1;
+    for (Size slot = (hole + 1) & mask; _entries[slot].key;
+         slot = (slot + 1) & mask)
+    {
+        const Size start = home(_entries[slot].key);
+        if (((slot - start) & mask) >= ((slot - hole) & mask))
+        {
+            _entries[hole] = _entries[slot];
+            hole = slot;
+        }
+    }
+    _entries[hole].key = 0;
+    --_size;
+    return true;
+}
+
+// ACCESSOR FUNCTIONS
+bool TrackingTable::get(const void* key, TrackingRecord& record) const
+{
+    const Size slot = locate(key);
+    if (slot == _capacity)
+    {
+        return false;
+    }
+    record = _entries[slot].record;
+    return true;
+}
+
+// HELPER FUNCTIONS
+Size TrackingTable::home(const void* key) const
+{
+    // blocks are aligned, so the low bits of the address are mixed into
+    // the high ones before they are masked
+    uint64 bits = static_cast<uint64>(reinterpret_cast<uintptr_t>(key));
+    bits *= 0x9e3779b97f4a7c15ull;
+    return static_cast<Size>(bits ^ (bits >> 32)) & (_capacity - 1);
+}
+
+Size TrackingTable::locate(const void* key) const
+{
+    if (!_capacity || !key)
+    {
+        return _capacity;
+    }
+
+    const Size mask = _capacity - 1;
+    for (Size slot = home(key); _entries[slot].key; slot = (slot + 1) & mask)
+    {
+        if (_entries[slot].key == key)
+        {
+            return slot;
+        }
+    }
+    return _capacity;
+}
+
+bool TrackingTable::grow()
+{
+    const Size capacity = _capacity ? _capacity * 2 : MIN_CAPACITY;
+    Entry* entries =
+        static_cast<Entry*>(_memory->allocate(capacity * sizeof(Entry)));
+    if (!entries)
+    {
+        return false;
+    }
+    memset(entries, 0, capacity * sizeof(Entry));
+
+    Entry* previous = _entries;
+    const Size count = _capacity;
+    _entries = entries;
+    _capacity = capacity;
+    const Size mask = capacity - 1;
+    for (Size i = 0; i < count; ++i)
+    {
+        if (!previous[i].key)
+        {
+            continue;
+        }
+        Size slot = home(previous[i].key);
+        while (_entries[slot].key)
+        {
+            slot = (slot + 1) & mask;
+        }
+        _entries[slot] = previous[i];
+    }
+    if (previous)
+    {
+        _memory->release(previous);
+    }
+    return true;
+}
+
+} // End nspc detail
+
+} // End nspc mem
+
+} // End nspc gel
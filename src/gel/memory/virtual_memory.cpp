@@ -0,0 +1,403 @@
+// virtual_memory.cpp
+#include "gel/memory/virtual_memory.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace gel
+{
+
+namespace mem
+{
+
+namespace
+{
+
+/**
+ * Reserves a range of address space without backing it.
+ *
+ * @param size The size of the range, in bytes.
+ * @param mode The pages that back the range, which is lowered to the mode
+ *             that could be reserved.
+ * @return     The start of the range, or null if it could not be reserved.
+ */
+char* reserveRange(Size size, VirtualMemory::PageMode& mode)
+{
+#ifdef _WIN32
+    // large pages must be committed when they are reserved and need a
+    // privilege, so windows always uses small pages
+    mode = VirtualMemory::SMALL_PAGES;
+    return static_cast<char*>(
+        ::VirtualAlloc(0, size, MEM_RESERVE, PAGE_NOACCESS));
+#else
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;
+#endif
+
+#ifdef MAP_HUGETLB
+    if (mode == VirtualMemory::HUGE_PAGES)
+    {
+        // explicit huge pages come from a preallocated pool, so the range
+        // claims its pages now rather than failing when they are touched
+        void* ptr = ::mmap(0, size, PROT_NONE,
+                           (flags & ~MAP_NORESERVE) | MAP_HUGETLB, -1, 0);
+        if (ptr != MAP_FAILED)
+        {
+            return static_cast<char*>(ptr);
+        }
+    }
+#endif
+    if (mode == VirtualMemory::HUGE_PAGES)
+    {
+        mode = VirtualMemory::TRANSPARENT_HUGE_PAGES;
+    }
+
+    if (mode == VirtualMemory::SMALL_PAGES)
+    {
+        void* ptr = ::mmap(0, size, PROT_NONE, flags, -1, 0);
+        return ptr == MAP_FAILED ? 0 : static_cast<char*>(ptr);
+    }
+
+    // transparent huge pages only back aligned huge pages, so over reserve
+    // and trim the range to a huge page boundary
+    const Size align = VirtualMemory::HUGE_PAGE_SIZE;
+    void* ptr = ::mmap(0, size + align, PROT_NONE, flags, -1, 0);
+    if (ptr == MAP_FAILED)
+    {
+        return 0;
+    }
+
+    char* raw = static_cast<char*>(ptr);
+    const uintptr_t address = reinterpret_cast<uintptr_t>(raw);
+    char* base = raw + ((align - address % align) % align);
+    if (base > raw)
+    {
+        ::munmap(raw, base - raw);
+    }
+    ::munmap(base + size, raw + size + align - (base + size));
+#ifdef MADV_HUGEPAGE
+    ::madvise(base, size, MADV_HUGEPAGE);
+#endif
+    return base;
+#endif
+}
+
+/**
+ * Returns a range of address space to the system.
+ *
+ * @param base The start of the range.
+ * @param size The size of the range, in bytes.
+ */
+void releaseRange(char* base, Size size)
+{
+#ifdef _WIN32
+    (void) size;
+    ::VirtualFree(base, 0, MEM_RELEASE);
+#else
+    ::munmap(base, size);
+#endif
+}
+
+/**
+ * Rounds a size up to a multiple of another.
+ *
+ * @param size     The size.
+ * @param multiple The multiple.
+ * @return         The rounded size.
+ */
+Size roundUp(Size size, Size multiple)
+{
+    return (size + multiple - 1) / multiple * multiple;
+}
+
+} // End nspc anonymous
+
+const Size VirtualMemory::HEADER;
+
+const Size VirtualMemory::HUGE_PAGE_SIZE;
+
+// CONSTRUCTORS
+VirtualMemory::VirtualMemory(Size reserve, PageMode mode)
+    : _base(0), _reserved(0), _top(0), _free(0), _committed(0),
+      _pageSize(systemPageSize()), _mode(mode)
+{
+    // huge pages need the whole range and every run to be aligned to them
+    const Size align = mode == SMALL_PAGES ? _pageSize : HUGE_PAGE_SIZE;
+    const Size size = roundUp(reserve > 0 ? reserve : 1, align);
+    _base = reserveRange(size, _mode);
+    if (_base)
+    {
+        _reserved = size;
+        _pageSize = _mode == SMALL_PAGES ? _pageSize : HUGE_PAGE_SIZE;
+    }
+    _top = _base;
+}
+
+VirtualMemory::~VirtualMemory()
+{
+    if (_base)
+    {
+        releaseRange(_base, _reserved);
+    }
+}
+
+// MEMBER FUNCTIONS
+void* VirtualMemory::allocate(Size size)
+{
+    if (size == 0 || size > _reserved)
+    {
+        return 0;
+    }
+
+    Run* run = take(roundUp(size + HEADER, _pageSize) / _pageSize);
+    return run ? reinterpret_cast<char*>(run) + HEADER : 0;
+}
+
+void* VirtualMemory::reallocate(void* pointer, Size size)
+{
+    if (!pointer)
+    {
+        return allocate(size);
+    }
+    if (size == 0)
+    {
+        release(pointer);
+        return 0;
+    }
+    if (size > _reserved)
+    {
+        return 0;
+    }
+
+    Run* run = reinterpret_cast<Run*>(static_cast<char*>(pointer) - HEADER);
+    char* start = reinterpret_cast<char*>(run);
+    const Size pages = roundUp(size + HEADER, _pageSize) / _pageSize;
+    if (pages < run->pages)
+    {
+        // split the tail off as a run of its own and release it
+        Run* tail = reinterpret_cast<Run*>(start + pages * _pageSize);
+        tail->pages = run->pages - pages;
+        run->pages = pages;
+        give(tail);
+        return pointer;
+    }
+
+    if (pages == run->pages)
+    {
+        return pointer;
+    }
+
+    // the highest run grows into the rest of the range
+    char* end = start + run->pages * _pageSize;
+    const Size extra = (pages - run->pages) * _pageSize;
+    if (end == _top && extra <= static_cast<Size>(_base + _reserved - end) &&
+        commit(end, extra))
+    {
+        _top += extra;
+        _committed += extra;
+        run->pages = pages;
+        return pointer;
+    }
+
+    void* block = allocate(size);
+    if (block)
+    {
+        ::memcpy(block, pointer, run->pages * _pageSize - HEADER);
+        release(pointer);
+    }
+    return block;
+}
+
+void VirtualMemory::release(void* pointer)
+{
+    if (pointer)
+    {
+        give(reinterpret_cast<Run*>(static_cast<char*>(pointer) - HEADER));
+    }
+}
+
+bool VirtualMemory::commit(void* pointer, Size size)
+{
+    assert(reinterpret_cast<uintptr_t>(pointer) % _pageSize == 0);
+#ifdef _WIN32
+    return ::VirtualAlloc(pointer, size, MEM_COMMIT, PAGE_READWRITE) != 0;
+#else
+    return ::mprotect(pointer, size, PROT_READ | PROT_WRITE) == 0;
+#endif
+}
+
+void VirtualMemory::decommit(void* pointer, Size size)
+{
+    assert(reinterpret_cast<uintptr_t>(pointer) % _pageSize == 0);
+#ifdef _WIN32
+    ::VirtualFree(pointer, size, MEM_DECOMMIT);
+#else
+    ::madvise(pointer, size, MADV_DONTNEED);
+    ::mprotect(pointer, size, PROT_NONE);
+#endif
+}
+
+// ACCESSOR FUNCTIONS
+Size VirtualMemory::systemPageSize()
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    ::GetSystemInfo(&info);
+    return info.dwPageSize;
+#else
+    return static_cast<Size>(::sysconf(_SC_PAGESIZE));
+#endif
+}
+
+// HELPER FUNCTIONS
+VirtualMemory::Run* VirtualMemory::take(Size pages)
+{
+    // the first page of a free run stays committed to hold its header
+    Run** link = &_free;
+    for (Run* run = _free; run; link = &run->next, run = run->next)
+    {
+        if (run->pages < pages)
+        {
+            continue;
+        }
+
+        // both commits are made before the run is changed, so a failure
+        // leaves the pool as it was
+        char* start = reinterpret_cast<char*>(run);
+        Run* rest = 0;
+        if (run->pages > pages)
+        {
+            rest = reinterpret_cast<Run*>(start + pages * _pageSize);
+            if (!commit(rest, _pageSize))
+            {
+                return 0;
+            }
+        }
+
+        if (pages > 1 && !commit(start + _pageSize, (pages - 1) * _pageSize))
+        {
+            if (rest)
+            {
+                decommit(rest, _pageSize);
+            }
+            return 0;
+        }
+
+        Run* next = run->next;
+        if (rest)
+        {
+            rest->pages = run->pages - pages;
+            rest->next = next;
+            next = rest;
+            _committed += _pageSize;
+        }
+        _committed += (pages - 1) * _pageSize;
+        *link = next;
+        run->pages = pages;
+        return run;
+    }
+
+    const Size size = pages * _pageSize;
+    if (size > static_cast<Size>(_base + _reserved - _top) ||
+        !commit(_top, size))
+    {
+        return 0;
+    }
+
+    Run* run = reinterpret_cast<Run*>(_top);
+    run->pages = pages;
+    _top += size;
+    _committed += size;
+    return run;
+}
+
+void VirtualMemory::give(Run* run)
+{
+    char* start = reinterpret_cast<char*>(run);
+    if (run->pages > 1)
+    {
+        decommit(start + _pageSize, (run->pages - 1) * _pageSize);
+        _committed -= (run->pages - 1) * _pageSize;
+    }
+
+    // find the free runs around this one, by address
+    Run* before = 0;
+    Run* previous = 0;
+    Run* next = _free;
+    while (next && next < run)
+    {
+        before = previous;
+        previous = next;
+        next = next->next;
+    }
+
+    if (start + run->pages * _pageSize == _top)
+    {
+        // the highest run goes back to the top entirely, along with a free
+        // run just below it
+        decommit(start, _pageSize);
+        _committed -= _pageSize;
+        _top = start;
+        if (previous && reinterpret_cast<char*>(previous) +
+                        previous->pages * _pageSize == _top)
+        {
+            _top = reinterpret_cast<char*>(previous);
+            decommit(previous, _pageSize);
+            _committed -= _pageSize;
+            previous = before;
+        }
+
+        if (previous)
+        {
+            previous->next = 0;
+        }
+        else
+        {
+            _free = 0;
+        }
+        return;
+    }
+
+    if (start + run->pages * _pageSize == reinterpret_cast<char*>(next))
+    {
+        run->pages += next->pages;
+        Run* after = next->next;
+        decommit(next, _pageSize);
+        _committed -= _pageSize;
+        next = after;
+    }
+
+    if (previous && reinterpret_cast<char*>(previous) +
+                    previous->pages * _pageSize == start)
+    {
+        previous->pages += run->pages;
+        previous->next = next;
+        decommit(start, _pageSize);
+        _committed -= _pageSize;
+    }
+    else
+    {
+        run->next = next;
+        if (previous)
+        {
+            previous->next = run;
+        }
+        else
+        {
+            _free = run;
+        }
+    }
+}
+
+} // End nspc mem
+
+} // End nspc gel
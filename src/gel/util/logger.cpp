@@ -1,2 +1,29 @@
 // logger.cpp
 #include "logger.h"
+
+#include <stdio.h>
+
+namespace
+{
+
+/**
+ * The names of the verbosity levels.
+ */
+const char* const LEVELS[] = { "V", "D", "W", "E", "F" };
+
+} // End nspc anonymous
+
+void gel_log(const char* file, int verbosity, const char* tag,
+             const char* message)
+{
+    FILE* stream = fopen(file, "a");
+    if (!stream)
+    {
+        return;
+    }
+
+    const bool known = verbosity >= 0 && verbosity < 5;
+    fprintf(stream, "%s/%s: %s\n", known ? LEVELS[verbosity] : "?", tag,
+            message);
+    fclose(stream);
+}
@@ -2,4 +2,16 @@
 #ifndef GEL_LOGGER_H
 #define GEL_LOGGER_H
 
+/**
+ * Appends a message to a log file. This is the default logger behind the
+ * macros of log.h, which a configured logger override replaces.
+ *
+ * @param file      The path of the log file.
+ * @param verbosity The verbosity, one of the GEL_LOG_* levels.
+ * @param tag       The tag that identifies the source of the message.
+ * @param message   The message.
+ */
+void gel_log(const char* file, int verbosity, const char* tag,
+             const char* message);
+
 #endif //GEL_LOGGER_H
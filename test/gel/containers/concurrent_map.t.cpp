@@ -0,0 +1,167 @@
+// concurrent_map.t.cpp
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <gel/containers/concurrent_map.h>
+#include <gel/memory/tracking_memory.h>
+#include <gtest/gtest.h>
+
+TEST( ConcurrentMap, InsertErase )
+{
+    using namespace gel::cntr;
+
+    ConcurrentMap<gel::ID, int> map;
+    IMap<gel::ID, int>& imap = map;
+    EXPECT_EQ( 0u, map.size() );
+    EXPECT_EQ( ( ConcurrentMap<gel::ID, int>::MIN_CAPACITY ),
+               map.capacity() );
+    EXPECT_FALSE( map.contains( 1 ) );
+
+    EXPECT_TRUE( imap.insert( 1, 10 ) );
+    EXPECT_TRUE( imap.insert( 2, 20 ) );
+    EXPECT_FALSE( imap.insert( 1, 11 ) );
+    EXPECT_EQ( 2u, imap.size() );
+
+    int value = 0;
+    EXPECT_TRUE( imap.get( 1, value ) );
+    EXPECT_EQ( 10, value );
+    EXPECT_FALSE( imap.get( 3, value ) );
+    EXPECT_EQ( 10, value );
+
+    EXPECT_TRUE( imap.erase( 1 ) );
+    EXPECT_FALSE( imap.erase( 1 ) );
+    EXPECT_FALSE( imap.contains( 1 ) );
+    EXPECT_TRUE( imap.contains( 2 ) );
+
+    imap.clear();
+    EXPECT_EQ( 0u, map.size() );
+    EXPECT_FALSE( map.contains( 2 ) );
+    EXPECT_TRUE( map.insert( 2, 22 ) );
+    EXPECT_TRUE( map.get( 2, value ) );
+    EXPECT_EQ( 22, value );
+}
+
+TEST( ConcurrentMap, Growth )
+{
+    using namespace gel::cntr;
+
+    // every key stays reachable while buckets move a few at a time
+    ConcurrentMap<int, int> map;
+    for ( int i = 0; i < 5000; ++i )
+    {
+        ASSERT_TRUE( map.insert( i, i * 3 ) );
+        for ( int j = i; j >= 0 && j > i - 20; --j )
+        {
+            int value = -1;
+            ASSERT_TRUE( map.get( j, value ) );
+            ASSERT_EQ( j * 3, value );
+        }
+    }
+    EXPECT_EQ( 5000u, map.size() );
+    EXPECT_LE( 5000u, map.capacity() );
+
+    for ( int i = 0; i < 5000; i += 2 )
+    {
+        ASSERT_TRUE( map.erase( i ) );
+    }
+    for ( int i = 0; i < 5000; ++i )
+    {
+        ASSERT_EQ( i % 2 == 1, map.contains( i ) );
+    }
+    EXPECT_EQ( 2500u, map.size() );
+}
+
+TEST( ConcurrentMap, Reclamation )
+{
+    using namespace gel::cntr;
+
+    gel::mem::TrackingMemory memory;
+    {
+        ConcurrentMap<int, int> map( 16, memory );
+        for ( int i = 0; i < 100; ++i )
+        {
+            ASSERT_TRUE( map.insert( i, i ) );
+        }
+        const gel::Size grown = memory.stats().liveCount();
+
+        // erased nodes and replaced tables are freed once no reader is left
+        for ( int i = 0; i < 100; ++i )
+        {
+            ASSERT_TRUE( map.erase( i ) );
+        }
+        map.reclaim();
+        EXPECT_GT( grown, memory.stats().liveCount() );
+        EXPECT_LE( memory.stats().liveCount(), 2u );
+
+        for ( int i = 0; i < 100; ++i )
+        {
+            ASSERT_TRUE( map.insert( i, i ) );
+        }
+        map.clear();
+        map.reclaim();
+        EXPECT_LE( memory.stats().liveCount(), 2u );
+        EXPECT_TRUE( map.insert( 1, 1 ) );
+    }
+    EXPECT_EQ( 0u, memory.stats().liveBytes() );
+}
+
+TEST( ConcurrentMap, Readers )
+{
+    using namespace gel::cntr;
+
+    // readers check keys that are always present while a writer churns
+    // other keys through several resizes
+    const int stable = 256;
+    const int readers = 4;
+    ConcurrentMap<int, int> map;
+    for ( int i = 0; i < stable; ++i )
+    {
+        map.insert( i, i * 7 );
+    }
+
+    std::atomic<bool> done( false );
+    std::atomic<int> failures( 0 );
+    std::vector<std::thread> workers;
+    for ( int t = 0; t < readers; ++t )
+    {
+        workers.push_back( std::thread( [&map, &done, &failures, t]() {
+            int key = t;
+            while ( !done.load() )
+            {
+                int value = -1;
+                if ( !map.get( key, value ) || value != key * 7 )
+                {
+                    ++failures;
+                }
+                map.contains( stable + key * 13 );
+                key = ( key + 1 ) % stable;
+            }
+        } ) );
+    }
+
+    for ( int round = 0; round < 4; ++round )
+    {
+        for ( int i = stable; i < stable + 4000; ++i )
+        {
+            map.insert( i, i * 7 );
+        }
+        for ( int i = stable; i < stable + 4000; ++i )
+        {
+            map.erase( i );
+        }
+    }
+    done.store( true );
+    for ( int t = 0; t < readers; ++t )
+    {
+        workers[t].join();
+    }
+
+    EXPECT_EQ( 0, failures.load() );
+    EXPECT_EQ( gel::Size( stable ), map.size() );
+    for ( int i = 0; i < stable; ++i )
+    {
+        int value = -1;
+        ASSERT_TRUE( map.get( i, value ) );
+        EXPECT_EQ( i * 7, value );
+    }
+}
@@ -0,0 +1,206 @@
+// flat_map.t.cpp
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <vector>
+#include <gel/containers/flat_map.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ * Orders C strings by their characters.
+ */
+struct StringLess
+{
+    bool operator()( const char* string, const char* other ) const
+    {
+        return strcmp( string, other ) < 0;
+    }
+};
+
+/**
+ * Collects the keys that forEach() visits.
+ */
+struct Collector
+{
+    std::vector<int>* keys;
+
+    void operator()( int key, int value ) const
+    {
+        EXPECT_EQ( key * 2, value );
+        keys->push_back( key );
+    }
+};
+
+} // End nspc anonymous
+
+TEST( FlatMap, InsertErase )
+{
+    using namespace gel::cntr;
+
+    FlatMap<int, int> map;
+    IMap<int, int>& imap = map;
+    EXPECT_EQ( 0u, map.size() );
+    EXPECT_FALSE( map.contains( 1 ) );
+    EXPECT_EQ( 0, map.find( 1 ) );
+
+    EXPECT_TRUE( imap.insert( 5, 50 ) );
+    EXPECT_TRUE( imap.insert( 1, 10 ) );
+    EXPECT_TRUE( imap.insert( 3, 30 ) );
+    EXPECT_FALSE( imap.insert( 3, 31 ) );
+    EXPECT_EQ( 3u, imap.size() );
+
+    int value = 0;
+    EXPECT_TRUE( imap.get( 3, value ) );
+    EXPECT_EQ( 30, value );
+    EXPECT_FALSE( imap.get( 4, value ) );
+    *map.find( 1 ) = 11;
+    EXPECT_EQ( 11, *map.find( 1 ) );
+
+    EXPECT_TRUE( imap.erase( 3 ) );
+    EXPECT_FALSE( imap.erase( 3 ) );
+    EXPECT_TRUE( imap.contains( 5 ) );
+    EXPECT_FALSE( imap.contains( 3 ) );
+
+    // a frozen map rejects changes until it is thawed
+    EXPECT_TRUE( map.freeze() );
+    EXPECT_TRUE( map.isFrozen() );
+    EXPECT_EQ( ( FlatMap<int, int>::EYTZINGER ), map.layout() );
+    EXPECT_EQ( 2u, map.capacity() );
+    EXPECT_FALSE( map.insert( 7, 70 ) );
+    EXPECT_FALSE( map.erase( 5 ) );
+    EXPECT_EQ( 11, *map.find( 1 ) );
+    EXPECT_EQ( 50, *map.find( 5 ) );
+
+    EXPECT_TRUE( map.thaw() );
+    EXPECT_FALSE( map.isFrozen() );
+    EXPECT_EQ( ( FlatMap<int, int>::SORTED ), map.layout() );
+    EXPECT_TRUE( map.insert( 7, 70 ) );
+    EXPECT_TRUE( map.contains( 7 ) );
+
+    imap.clear();
+    EXPECT_EQ( 0u, map.size() );
+    EXPECT_FALSE( map.contains( 5 ) );
+}
+
+TEST( FlatMap, Build )
+{
+    using namespace gel::cntr;
+
+    // the first of equal keys is kept
+    const char* keys[] = { "pear", "apple", "kiwi", "apple", "fig" };
+    const int values[] = { 1, 2, 3, 4, 5 };
+    FlatMap<const char*, int, StringLess> map;
+    ASSERT_TRUE( map.build( keys, values, 5 ) );
+    EXPECT_EQ( 4u, map.size() );
+    EXPECT_FALSE( map.isFrozen() );
+
+    char apple[] = "apple";
+    ASSERT_TRUE( map.find( apple ) );
+    EXPECT_EQ( 2, *map.find( apple ) );
+    EXPECT_EQ( 5, *map.find( "fig" ) );
+    EXPECT_EQ( 0, map.find( "plum" ) );
+
+    ASSERT_TRUE( map.freeze( FlatMap<const char*, int,
+                             StringLess>::SORTED ) );
+    EXPECT_EQ( 4u, map.capacity() );
+    EXPECT_EQ( 1, *map.find( "pear" ) );
+    EXPECT_EQ( 3, *map.find( "kiwi" ) );
+    EXPECT_EQ( 0, map.find( "banana" ) );
+
+    // building again replaces the contents
+    ASSERT_TRUE( map.build( keys + 2, values + 2, 1 ) );
+    EXPECT_EQ( 1u, map.size() );
+    EXPECT_EQ( 3, *map.find( "kiwi" ) );
+    EXPECT_FALSE( map.contains( "pear" ) );
+}
+
+TEST( FlatMap, Layouts )
+{
+    using namespace gel::cntr;
+
+    // every size up to a few levels exercises incomplete last levels
+    for ( int count = 0; count < 70; ++count )
+    {
+        std::vector<int> keys;
+        std::vector<int> values;
+        for ( int i = 0; i < count; ++i )
+        {
+            keys.push_back( ( i * 71 ) % count * 2 );
+            values.push_back( keys.back() * 2 );
+        }
+
+        FlatMap<int, int> map;
+        ASSERT_TRUE( map.build( keys.data(), values.data(), count ) );
+        ASSERT_TRUE( map.freeze() );
+        ASSERT_EQ( gel::Size( count ), map.size() );
+        for ( int key = -1; key <= 2 * count; ++key )
+        {
+            const int* value = map.find( key );
+            ASSERT_EQ( key >= 0 && key % 2 == 0 && key < 2 * count,
+                       value != 0 ) << count << " " << key;
+            if ( value )
+            {
+                ASSERT_EQ( key * 2, *value );
+            }
+        }
+
+        std::vector<int> visited;
+        Collector collector = { &visited };
+        map.forEach( collector );
+        ASSERT_EQ( gel::Size( count ), visited.size() );
+        for ( int i = 0; i < count; ++i )
+        {
+            ASSERT_EQ( i * 2, visited[i] );
+        }
+
+        ASSERT_TRUE( map.thaw() );
+        visited.clear();
+        map.forEach( collector );
+        ASSERT_EQ( gel::Size( count ), visited.size() );
+        for ( int i = 0; i < count; ++i )
+        {
+            ASSERT_EQ( i * 2, visited[i] );
+            ASSERT_TRUE( map.contains( i * 2 ) );
+        }
+    }
+}
+
+TEST( FlatMap, Stress )
+{
+    using namespace gel::cntr;
+
+    FlatMap<gel::ID, gel::uint64> map;
+    std::map<gel::ID, gel::uint64> expected;
+    srand( 13 );
+    for ( int i = 0; i < 20000; ++i )
+    {
+        const gel::ID key = rand() % 1024;
+        if ( rand() % 3 )
+        {
+            const bool inserted = expected.insert(
+                std::make_pair( key, gel::uint64( i ) ) ).second;
+            ASSERT_EQ( inserted, map.insert( key, i ) );
+        }
+        else
+        {
+            ASSERT_EQ( expected.erase( key ) == 1, map.erase( key ) );
+        }
+    }
+
+    ASSERT_TRUE( map.freeze() );
+    ASSERT_EQ( expected.size(), map.size() );
+    for ( gel::ID key = 0; key < 1024; ++key )
+    {
+        std::map<gel::ID, gel::uint64>::const_iterator it =
+            expected.find( key );
+        const gel::uint64* value = map.find( key );
+        ASSERT_EQ( it != expected.end(), value != 0 );
+        if ( value )
+        {
+            ASSERT_EQ( it->second, *value );
+        }
+    }
+}
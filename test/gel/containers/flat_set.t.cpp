@@ -0,0 +1,122 @@
+// flat_set.t.cpp
+#include <stdlib.h>
+#include <set>
+#include <vector>
+#include <gel/containers/flat_set.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ * Sums the keys that a set visits.
+ */
+struct Sum
+{
+    gel::ID* total;
+
+    void operator()( const gel::ID& key ) const
+    {
+        *total += key;
+    }
+};
+
+} // End nspc anonymous
+
+TEST( FlatSet, InsertErase )
+{
+    using namespace gel::cntr;
+
+    FlatSet<gel::ID> set;
+    ISet<gel::ID>& iset = set;
+    EXPECT_FALSE( iset.contains( 1 ) );
+    EXPECT_TRUE( iset.insert( 1 ) );
+    EXPECT_TRUE( iset.insert( 2 ) );
+    EXPECT_FALSE( iset.insert( 2 ) );
+    EXPECT_EQ( 2u, iset.size() );
+    EXPECT_TRUE( iset.contains( 2 ) );
+    ASSERT_TRUE( set.find( gel::uint64( 2 ) ) );
+    EXPECT_EQ( 2u, *set.find( gel::uint64( 2 ) ) );
+
+    gel::ID total = 0;
+    Sum sum = { &total };
+    set.forEach( sum );
+    EXPECT_EQ( 3u, total );
+
+    EXPECT_TRUE( iset.erase( 1 ) );
+    EXPECT_FALSE( iset.erase( 1 ) );
+    EXPECT_FALSE( iset.contains( 1 ) );
+    iset.clear();
+    EXPECT_EQ( 0u, iset.size() );
+    EXPECT_FALSE( iset.contains( 2 ) );
+}
+
+TEST( FlatSet, Bulk )
+{
+    using namespace gel::cntr;
+
+    std::vector<gel::ID> keys;
+    for ( gel::ID i = 0; i < 1000; ++i )
+    {
+        keys.push_back( i * 3 );
+    }
+
+    FlatSet<gel::ID> set;
+    EXPECT_EQ( 1000u, set.insertAll( &keys[0], keys.size() ) );
+    const gel::Size capacity = set.capacity();
+    EXPECT_EQ( 0u, set.insertAll( &keys[0], keys.size() ) );
+    EXPECT_EQ( capacity, set.capacity() );
+
+    // every third probe is present
+    std::vector<gel::ID> probes;
+    for ( gel::ID i = 0; i < 3001; ++i )
+    {
+        probes.push_back( i );
+    }
+    std::vector<gel::uint8> result( probes.size(), 7 );
+    EXPECT_EQ( 1000u,
+               set.containsAll( &probes[0], probes.size(), &result[0] ) );
+    for ( gel::Size i = 0; i < probes.size(); ++i )
+    {
+        ASSERT_EQ( i % 3 == 0 && i < 3000, result[i] == 1 );
+        ASSERT_TRUE( result[i] <= 1 );
+    }
+
+    FlatSet<gel::ID> empty;
+    EXPECT_EQ( 0u, empty.containsAll( &probes[0], 5, &result[0] ) );
+    EXPECT_EQ( 0, result[0] );
+}
+
+TEST( FlatSet, Stress )
+{
+    using namespace gel::cntr;
+
+    FlatSet<gel::uint64> set;
+    std::set<gel::uint64> expected;
+    srand( 5 );
+    for ( int i = 0; i < 50000; ++i )
+    {
+        const gel::uint64 key = rand() % 2048;
+        if ( rand() % 2 )
+        {
+            ASSERT_EQ( expected.insert( key ).second, set.insert( key ) );
+        }
+        else
+        {
+            ASSERT_EQ( expected.erase( key ) == 1, set.erase( key ) );
+        }
+    }
+
+    std::vector<gel::uint64> probes;
+    for ( gel::uint64 key = 0; key < 2048; ++key )
+    {
+        probes.push_back( key );
+    }
+    std::vector<gel::uint8> result( probes.size() );
+    EXPECT_EQ( expected.size(),
+               set.containsAll( &probes[0], probes.size(), &result[0] ) );
+    for ( gel::Size i = 0; i < probes.size(); ++i )
+    {
+        ASSERT_EQ( expected.count( probes[i] ), result[i] );
+    }
+}
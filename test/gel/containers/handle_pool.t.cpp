@@ -0,0 +1,186 @@
+// handle_pool.t.cpp
+#include <stdlib.h>
+#include <vector>
+#include <gel/containers/handle_pool.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ * Counts the live instances, to check that growing, erasing and clearing
+ * the pool destroy every object it constructs.
+ */
+struct Counted
+{
+    static int live;
+
+    int value;
+
+    Counted( int value ) : value( value ) { ++live; }
+
+    Counted( const Counted& other ) : value( other.value ) { ++live; }
+
+    Counted& operator=( const Counted& other )
+    {
+        value = other.value;
+        return *this;
+    }
+
+    ~Counted() { --live; }
+};
+
+int Counted::live = 0;
+
+} // End nspc anonymous
+
+TEST( HandlePool, InsertErase )
+{
+    using namespace gel::cntr;
+
+    HandlePool<int> pool;
+    EXPECT_EQ( 0u, pool.size() );
+    EXPECT_EQ( 0, pool.get( HandlePool<int>::NONE ) );
+
+    const gel::ID a = pool.insert( 10 );
+    const gel::ID b = pool.insert( 20 );
+    const gel::ID c = pool.insert( 30 );
+    EXPECT_NE( HandlePool<int>::NONE, a );
+    ASSERT_TRUE( pool.get( b ) );
+    EXPECT_EQ( 20, *pool.get( b ) );
+    EXPECT_EQ( 3u, pool.size() );
+
+    // erasing moves the last object into the hole
+    EXPECT_TRUE( pool.erase( a ) );
+    EXPECT_FALSE( pool.erase( a ) );
+    EXPECT_FALSE( pool.contains( a ) );
+    EXPECT_EQ( 0, pool.get( a ) );
+    EXPECT_EQ( 2u, pool.size() );
+    EXPECT_EQ( 30, pool.data()[0] );
+    EXPECT_EQ( c, pool.handleAt( 0 ) );
+    EXPECT_EQ( 30, *pool.get( c ) );
+    EXPECT_EQ( 20, *pool.get( b ) );
+
+    // the reused slot gets a new generation, so the old handle stays stale
+    const gel::ID d = pool.insert( 40 );
+    EXPECT_EQ( a & 0xFFFFF, d & 0xFFFFF );
+    EXPECT_NE( a, d );
+    EXPECT_EQ( 0, pool.get( a ) );
+    EXPECT_EQ( 40, *pool.get( d ) );
+
+    int sum = 0;
+    for ( int* i = pool.begin(); i != pool.end(); ++i )
+    {
+        sum += *i;
+    }
+    EXPECT_EQ( 90, sum );
+
+    pool.clear();
+    EXPECT_EQ( 0u, pool.size() );
+    EXPECT_FALSE( pool.contains( b ) );
+}
+
+TEST( HandlePool, Lifetime )
+{
+    using namespace gel::cntr;
+
+    {
+        HandlePool<Counted> pool;
+        EXPECT_TRUE( pool.reserve( 4 ) );
+        EXPECT_EQ( 4u, pool.capacity() );
+
+        gel::ID first = pool.insert( Counted( 0 ) );
+        int copies = 1;
+        for ( int i = 1; i < 100; ++i )
+        {
+            // inserting an object of the pool survives the pool growing
+            if ( pool.size() == pool.capacity() )
+            {
+                pool.insert( pool.data()[0] );
+                ++copies;
+            }
+            else
+            {
+                pool.insert( Counted( i ) );
+            }
+        }
+        int zeros = 0;
+        for ( Counted* c = pool.begin(); c != pool.end(); ++c )
+        {
+            zeros += c->value == 0;
+        }
+        EXPECT_EQ( 6, copies );
+        EXPECT_EQ( copies, zeros );
+        EXPECT_EQ( 100, Counted::live );
+        pool.erase( first );
+        EXPECT_EQ( 99, Counted::live );
+    }
+    EXPECT_EQ( 0, Counted::live );
+}
+
+TEST( HandlePool, GenerationWrap )
+{
+    using namespace gel::cntr;
+
+    // the generation of a free slot passes through that of every stale
+    // handle to it, which must still not resolve
+    HandlePool<int> pool;
+    const gel::ID stale = pool.insert( 1 );
+    const gel::ID other = pool.insert( 2 );
+    ASSERT_TRUE( pool.erase( stale ) );
+    for ( int cycle = 0; cycle < 4100; ++cycle )
+    {
+        ASSERT_FALSE( pool.contains( stale ) );
+        ASSERT_EQ( 0, pool.get( stale ) );
+        const gel::ID handle = pool.insert( 3 );
+        ASSERT_EQ( stale & 0xFFFFF, handle & 0xFFFFF );
+        ASSERT_TRUE( pool.erase( handle ) );
+    }
+    EXPECT_FALSE( pool.erase( stale ) );
+    EXPECT_EQ( 1u, pool.size() );
+    EXPECT_EQ( 2, *pool.get( other ) );
+}
+
+TEST( HandlePool, Stress )
+{
+    using namespace gel::cntr;
+
+    HandlePool<int> pool;
+    std::vector<gel::ID> handles;
+    std::vector<int> values;
+    std::vector<gel::ID> stale;
+    srand( 3 );
+    for ( int i = 0; i < 20000; ++i )
+    {
+        if ( handles.empty() || rand() % 3 )
+        {
+            handles.push_back( pool.insert( i ) );
+            values.push_back( i );
+        }
+        else
+        {
+            const gel::Size j = rand() % handles.size();
+            ASSERT_TRUE( pool.erase( handles[j] ) );
+            stale.push_back( handles[j] );
+            handles[j] = handles.back();
+            values[j] = values.back();
+            handles.pop_back();
+            values.pop_back();
+        }
+    }
+
+    ASSERT_EQ( handles.size(), pool.size() );
+    for ( gel::Size j = 0; j < handles.size(); ++j )
+    {
+        ASSERT_TRUE( pool.get( handles[j] ) );
+        ASSERT_EQ( values[j], *pool.get( handles[j] ) );
+    }
+    for ( gel::Size j = 0; j < stale.size(); ++j )
+    {
+        ASSERT_FALSE( pool.contains( stale[j] ) );
+    }
+    for ( gel::Size i = 0; i < pool.size(); ++i )
+    {
+        ASSERT_EQ( pool.data() + i, pool.get( pool.handleAt( i ) ) );
+    }
+}
@@ -0,0 +1,203 @@
+// hash_map.t.cpp
+#include <stdlib.h>
+#include <map>
+#include <gel/containers/hash_map.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ * A name key that can be looked up by its length and first letter
+ * without building one.
+ */
+struct Name
+{
+    const char* text;
+};
+
+struct NameView
+{
+    gel::Size length;
+
+    char first;
+};
+
+bool operator==( const Name& name, const Name& other )
+{
+    return strcmp( name.text, other.text ) == 0;
+}
+
+bool operator==( const Name& name, const NameView& view )
+{
+    return strlen( name.text ) == view.length && name.text[0] == view.first;
+}
+
+struct NameHash
+{
+    gel::uint64 operator()( const Name& name ) const
+    {
+        NameView view = { strlen( name.text ), name.text[0] };
+        return ( *this )( view );
+    }
+
+    gel::uint64 operator()( const NameView& view ) const
+    {
+        return gel::cntr::mix( view.length * 256 + view.first );
+    }
+};
+
+/**
+ * Puts every key in the same run, to exercise wrapping and shifting.
+ */
+struct CollidingHash
+{
+    gel::uint64 operator()( int key ) const
+    {
+        return ( 15 << 7 ) | ( key & 1 );
+    }
+};
+
+} // End nspc anonymous
+
+TEST( HashMap, InsertErase )
+{
+    using namespace gel::cntr;
+
+    HashMap<gel::ID, int> map;
+    IMap<gel::ID, int>& imap = map;
+    EXPECT_EQ( 0u, map.size() );
+    EXPECT_EQ( 0u, map.capacity() );
+    EXPECT_FALSE( map.contains( 1 ) );
+    EXPECT_EQ( 0, map.find( 1u ) );
+
+    EXPECT_TRUE( imap.insert( 1, 10 ) );
+    EXPECT_TRUE( imap.insert( 2, 20 ) );
+    EXPECT_FALSE( imap.insert( 1, 11 ) );
+    EXPECT_EQ( 2u, imap.size() );
+    EXPECT_EQ( ( HashMap<gel::ID, int>::MIN_CAPACITY ), map.capacity() );
+
+    int value = 0;
+    EXPECT_TRUE( imap.get( 1, value ) );
+    EXPECT_EQ( 10, value );
+    EXPECT_FALSE( imap.get( 3, value ) );
+
+    // an ID can be found by any integer type
+    ASSERT_TRUE( map.find( gel::uint64( 2 ) ) );
+    EXPECT_EQ( 20, *map.find( gel::uint64( 2 ) ) );
+    *map.find( 2u ) = 21;
+    EXPECT_EQ( 21, *map.find( gel::uint8( 2 ) ) );
+
+    EXPECT_TRUE( imap.erase( 1 ) );
+    EXPECT_FALSE( imap.erase( 1 ) );
+    EXPECT_FALSE( imap.contains( 1 ) );
+    EXPECT_TRUE( imap.contains( 2 ) );
+
+    imap.clear();
+    EXPECT_EQ( 0u, map.size() );
+    EXPECT_FALSE( map.contains( 2 ) );
+    EXPECT_TRUE( map.insert( 2, 22 ) );
+}
+
+TEST( HashMap, Heterogeneous )
+{
+    using namespace gel::cntr;
+
+    HashMap<Name, int, NameHash> map;
+    Name apple = { "apple" };
+    Name kiwi = { "kiwi" };
+    EXPECT_TRUE( map.insert( apple, 1 ) );
+    EXPECT_TRUE( map.insert( kiwi, 2 ) );
+
+    NameView view = { 4, 'k' };
+    ASSERT_TRUE( map.find( view ) );
+    EXPECT_EQ( 2, *map.find( view ) );
+    view.first = 'x';
+    EXPECT_EQ( 0, map.find( view ) );
+}
+
+TEST( HashMap, Reserve )
+{
+    using namespace gel::cntr;
+
+    HashMap<int, int> map;
+    EXPECT_TRUE( map.reserve( 1000 ) );
+    const gel::Size capacity = map.capacity();
+    EXPECT_LE( 1000u, capacity - capacity / 8 );
+
+    map.insert( 0, 0 );
+    const int* first = map.find( 0 );
+    for ( int i = 1; i < 1000; ++i )
+    {
+        ASSERT_TRUE( map.insert( i, i ) );
+    }
+    EXPECT_EQ( capacity, map.capacity() );
+    EXPECT_EQ( first, map.find( 0 ) );
+    EXPECT_TRUE( map.reserve( 10 ) );
+    EXPECT_EQ( capacity, map.capacity() );
+}
+
+TEST( HashMap, Collisions )
+{
+    using namespace gel::cntr;
+
+    // every key starts at the last slot and the run wraps around
+    HashMap<int, int, CollidingHash> map;
+    for ( int i = 0; i < 12; ++i )
+    {
+        ASSERT_TRUE( map.insert( i, i * 10 ) );
+    }
+    EXPECT_EQ( 16u, map.capacity() );
+    for ( int i = 0; i < 12; i += 3 )
+    {
+        ASSERT_TRUE( map.erase( i ) );
+    }
+    for ( int i = 0; i < 12; ++i )
+    {
+        if ( i % 3 )
+        {
+            ASSERT_TRUE( map.find( i ) );
+            EXPECT_EQ( i * 10, *map.find( i ) );
+        }
+        else
+        {
+            EXPECT_FALSE( map.contains( i ) );
+        }
+    }
+}
+
+TEST( HashMap, Stress )
+{
+    using namespace gel::cntr;
+
+    HashMap<gel::ID, gel::uint64> map;
+    std::map<gel::ID, gel::uint64> expected;
+    srand( 11 );
+    for ( int i = 0; i < 50000; ++i )
+    {
+        const gel::ID key = rand() % 4096;
+        if ( rand() % 3 )
+        {
+            const bool inserted = expected.insert(
+                std::make_pair( key, gel::uint64( i ) ) ).second;
+            ASSERT_EQ( inserted, map.insert( key, i ) );
+        }
+        else
+        {
+            ASSERT_EQ( expected.erase( key ) == 1, map.erase( key ) );
+        }
+    }
+
+    ASSERT_EQ( expected.size(), map.size() );
+    for ( gel::ID key = 0; key < 4096; ++key )
+    {
+        std::map<gel::ID, gel::uint64>::const_iterator it =
+            expected.find( key );
+        const gel::uint64* value = map.find( key );
+        ASSERT_EQ( it != expected.end(), value != 0 );
+        if ( value )
+        {
+            ASSERT_EQ( it->second, *value );
+        }
+    }
+}
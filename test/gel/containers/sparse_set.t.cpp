@@ -0,0 +1,208 @@
+// sparse_set.t.cpp
+#include <stdlib.h>
+#include <map>
+#include <gel/containers/sparse_set.h>
+#include <gel/memory/tracking_memory.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ * Stands in for component data. It counts live instances and assignments,
+ * so a test can see that erasing fills the hole with a single move of the
+ * last component and that the set destroys what it constructs.
+ */
+struct Component
+{
+    static int live;
+
+    static int assignments;
+
+    int value;
+
+    Component( int value ) : value( value ) { ++live; }
+
+    Component( const Component& other ) : value( other.value ) { ++live; }
+
+    Component& operator=( const Component& other )
+    {
+        value = other.value;
+        ++assignments;
+        return *this;
+    }
+
+    ~Component() { --live; }
+};
+
+int Component::live = 0;
+
+int Component::assignments = 0;
+
+} // End nspc anonymous
+
+TEST( SparseSet, InsertErase )
+{
+    using namespace gel::cntr;
+
+    SparseSet<int> set;
+    EXPECT_EQ( 0u, set.size() );
+    EXPECT_EQ( 0u, set.pages() );
+    EXPECT_EQ( 0, set.get( 7 ) );
+
+    ASSERT_TRUE( set.insert( 7, 70 ) );
+    ASSERT_TRUE( set.insert( 3, 30 ) );
+    ASSERT_TRUE( set.insert( 5000, 50 ) );
+    EXPECT_EQ( 0, set.insert( 3, 31 ) );
+    EXPECT_EQ( 3u, set.size() );
+    EXPECT_EQ( 30, *set.get( 3 ) );
+    EXPECT_EQ( 2u, set.pages() );
+
+    // erasing moves the last object into the hole
+    EXPECT_TRUE( set.erase( 7 ) );
+    EXPECT_FALSE( set.erase( 7 ) );
+    EXPECT_FALSE( set.contains( 7 ) );
+    EXPECT_EQ( 2u, set.size() );
+    EXPECT_EQ( 50, set.data()[0] );
+    EXPECT_EQ( 5000u, set.idAt( 0 ) );
+    EXPECT_EQ( 3u, set.ids()[1] );
+    EXPECT_EQ( 50, *set.get( 5000 ) );
+    EXPECT_EQ( 30, *set.get( 3 ) );
+
+    int sum = 0;
+    for ( const int* i = set.begin(); i != set.end(); ++i )
+    {
+        sum += *i;
+    }
+    EXPECT_EQ( 80, sum );
+
+    // a page is freed with the last ID of its block
+    EXPECT_TRUE( set.erase( 5000 ) );
+    EXPECT_EQ( 1u, set.pages() );
+
+    set.clear();
+    EXPECT_EQ( 0u, set.size() );
+    EXPECT_EQ( 0u, set.pages() );
+    EXPECT_FALSE( set.contains( 3 ) );
+    ASSERT_TRUE( set.insert( 3, 33 ) );
+    EXPECT_EQ( 33, *set.get( 3 ) );
+}
+
+TEST( SparseSet, Lifetime )
+{
+    using namespace gel::cntr;
+
+    {
+        SparseSet<Component> set;
+        EXPECT_TRUE( set.reserve( 4 ) );
+        EXPECT_EQ( 4u, set.capacity() );
+        for ( gel::ID id = 0; id < 100; ++id )
+        {
+            ASSERT_TRUE( set.insert( id * 1000, Component( id ) ) );
+        }
+        EXPECT_EQ( 100, Component::live );
+
+        // inserting a component of the set survives the set growing
+        SparseSet<Component> copies;
+        ASSERT_TRUE( copies.insert( 1, Component( 5 ) ) );
+        for ( gel::ID id = 2; id < 40; ++id )
+        {
+            ASSERT_TRUE( copies.insert( id, copies.data()[0] ) );
+        }
+        EXPECT_EQ( 5, copies.get( 39 )->value );
+
+        // erasing the last component moves nothing, any other moves one
+        Component::assignments = 0;
+        ASSERT_TRUE( set.erase( 99000 ) );
+        EXPECT_EQ( 0, Component::assignments );
+        ASSERT_TRUE( set.erase( 0 ) );
+        EXPECT_EQ( 1, Component::assignments );
+        EXPECT_EQ( 98, set.data()[0].value );
+
+        for ( gel::ID id = 2; id < 99; id += 2 )
+        {
+            ASSERT_TRUE( set.erase( id * 1000 ) );
+        }
+        EXPECT_EQ( 49u, set.size() );
+        EXPECT_EQ( 49 + 39, Component::live );
+        for ( gel::ID id = 1; id < 99; id += 2 )
+        {
+            ASSERT_TRUE( set.get( id * 1000 ) );
+            EXPECT_EQ( int( id ), set.get( id * 1000 )->value );
+        }
+    }
+    EXPECT_EQ( 0, Component::live );
+}
+
+TEST( SparseSet, PageTable )
+{
+    using namespace gel::cntr;
+    using namespace gel::mem;
+
+    // the page table follows the highest page in use up and down
+    TrackingAllocator<gel::uint32*> tables;
+    const AllocationStats& stats = tables.stats();
+    const gel::Size entry = sizeof( gel::uint32* );
+    const gel::ID page = SparseSet<int>::PAGE_SIZE;
+    {
+        SparseSet<int> set( HeapAllocator<int>::instance(),
+                            HeapAllocator<gel::uint32>::instance(), tables );
+        ASSERT_TRUE( set.insert( 5, 5 ) );
+        EXPECT_EQ( entry, stats.liveBytes() );
+        ASSERT_TRUE( set.insert( 3 * page + 1, 1 ) );
+        ASSERT_TRUE( set.insert( 3 * page + 2, 2 ) );
+        ASSERT_TRUE( set.insert( 100 * page, 100 ) );
+        EXPECT_EQ( 101 * entry, stats.liveBytes() );
+        EXPECT_EQ( 3u, set.pages() );
+
+        ASSERT_TRUE( set.erase( 100 * page ) );
+        EXPECT_EQ( 4 * entry, stats.liveBytes() );
+        ASSERT_TRUE( set.erase( 3 * page + 1 ) );
+        EXPECT_EQ( 4 * entry, stats.liveBytes() );
+        ASSERT_TRUE( set.erase( 3 * page + 2 ) );
+        EXPECT_EQ( entry, stats.liveBytes() );
+        EXPECT_EQ( 5, *set.get( 5 ) );
+        EXPECT_FALSE( set.contains( 100 * page ) );
+
+        set.clear();
+        EXPECT_EQ( 0u, stats.liveBytes() );
+        ASSERT_TRUE( set.insert( 2 * page, 2 ) );
+        EXPECT_EQ( 3 * entry, stats.liveBytes() );
+    }
+    EXPECT_EQ( 0u, stats.liveBytes() );
+}
+
+TEST( SparseSet, Stress )
+{
+    using namespace gel::cntr;
+
+    SparseSet<gel::uint64> set;
+    std::map<gel::ID, gel::uint64> expected;
+    srand( 17 );
+    for ( int i = 0; i < 50000; ++i )
+    {
+        // a few clustered blocks far apart, as entity IDs tend to be
+        const gel::ID id = ( rand() % 4 ) * 1000000 + rand() % 3000;
+        if ( rand() % 3 )
+        {
+            const bool inserted = expected.insert(
+                std::make_pair( id, gel::uint64( i ) ) ).second;
+            ASSERT_EQ( inserted, set.insert( id, i ) != 0 );
+        }
+        else
+        {
+            ASSERT_EQ( expected.erase( id ) == 1, set.erase( id ) );
+        }
+    }
+
+    ASSERT_EQ( expected.size(), set.size() );
+    EXPECT_GE( 16u, set.pages() );
+    for ( gel::Size i = 0; i < set.size(); ++i )
+    {
+        std::map<gel::ID, gel::uint64>::const_iterator it =
+            expected.find( set.idAt( i ) );
+        ASSERT_TRUE( it != expected.end() );
+        ASSERT_EQ( it->second, set.data()[i] );
+        ASSERT_EQ( set.data() + i, set.get( set.idAt( i ) ) );
+    }
+}
@@ -0,0 +1,45 @@
+// aabb.t.cpp
+#include <gel/math/aabb.h>
+#include <gel/math/mat.h>
+#include <gel/math/vec.h>
+#include <gtest/gtest.h>
+
+TEST( TAabb, Construction )
+{
+    using namespace gel::math;
+
+    Aabb e;
+    EXPECT_TRUE( e.isEmpty() );
+    e.expand( Vec3( 1, 2, 3 ) );
+    EXPECT_FALSE( e.isEmpty() );
+    EXPECT_EQ( Aabb( Vec3( 1, 2, 3 ), Vec3( 1, 2, 3 ) ), e );
+
+    e.expand( Vec3( -1, 4, 0 ) );
+    EXPECT_EQ( Vec3( -1, 2, 0 ), e.min() );
+    EXPECT_EQ( Vec3( 1, 4, 3 ), e.max() );
+    EXPECT_EQ( Vec3( 0, 3, 1.5f ), e.center() );
+    EXPECT_EQ( Vec3( 1, 1, 1.5f ), e.extents() );
+    EXPECT_EQ( e, aabbFromCenter( e.center(), e.extents() ) );
+
+    EXPECT_TRUE( e.contains( Vec3( 0, 3, 3 ) ) );
+    EXPECT_FALSE( e.contains( Vec3( 0, 5, 1 ) ) );
+}
+
+TEST( TAabb, Functions )
+{
+    using namespace gel::math;
+
+    Aabb a( Vec3( 0, 0, 0 ), Vec3( 2, 2, 2 ) );
+    Aabb b( Vec3( 2, 1, 1 ), Vec3( 3, 3, 3 ) );
+    Aabb c( Vec3( 2.5f, 0, 0 ), Vec3( 3, 1, 1 ) );
+    EXPECT_TRUE( intersects( a, b ) );
+    EXPECT_FALSE( intersects( a, c ) );
+    EXPECT_EQ( Aabb( Vec3( 0, 0, 0 ), Vec3( 3, 3, 3 ) ), merge( a, b ) );
+    EXPECT_EQ( merge( a, b ), Aabb( a ).expand( b ) );
+
+    // a quarter turn about z with a translation
+    Mat4 m( Vec4( 0, 1, 0, 0 ), Vec4( -1, 0, 0, 0 ), Vec4( 0, 0, 1, 0 ),
+            Vec4( 10, 0, 0, 1 ) );
+    EXPECT_EQ( Aabb( Vec3( 7, 2, 1 ), Vec3( 9, 3, 3 ) ),
+               transform( m, Aabb( Vec3( 2, 1, 1 ), Vec3( 3, 3, 3 ) ) ) );
+}
@@ -0,0 +1,66 @@
+// constexpr.t.cpp
+#include <gel/math/geometric.h>
+#include <gel/math/mat.h>
+#include <gel/math/quat.h>
+#include <gel/math/vec.h>
+#include <gtest/gtest.h>
+
+#if GEL_HAS_CONSTEXPR
+namespace
+{
+
+using namespace gel::math;
+
+constexpr Vec3 DIRECTIONS[] = {
+    normalize( Vec3( 1, 1, 1 ) ),
+    normalize( Vec3( -1, 2, 2 ) ),
+    normalize<HIGHP>( Vec3( 0, 0, -4 ) )
+};
+
+constexpr Vec2 OFFSETS[] = {
+    Vec2( -1, -1 ) * 0.5f, Vec2( 1, -1 ) * 0.5f,
+    Vec2( -1, 1 ) * 0.5f, Vec2( 1, 1 ) * 0.5f
+};
+
+constexpr Vec4 PALETTE[] = {
+    Vec4( 1, 0, 0, 1 ),
+    Vec4( 0, 1, 0, 1 ),
+    ( Vec4( 1, 0, 0, 1 ) + Vec4( 0, 1, 0, 1 ) ) * 0.5f
+};
+
+constexpr Mat4 SCALE = Mat4( 2.0f ) * transpose( Mat4() );
+
+constexpr Quat TURN = Quat( 0, 0, 0.70710678f, 0.70710678f ) *
+                      Quat( 0, 0, 0.70710678f, 0.70710678f );
+
+static_assert( OFFSETS[3] == Vec2( 0.5f, 0.5f ), "offsets" );
+static_assert( PALETTE[2].x == 0.5f && PALETTE[2][1] == 0.5f, "palette" );
+static_assert( PALETTE[1].swizzle<W, Y, X, Z>() == Vec4( 1, 1, 0, 0 ),
+               "swizzle" );
+static_assert( DIRECTIONS[1] == Vec3( -1.0f / 3, 2.0f / 3, 2.0f / 3 ),
+               "directions" );
+static_assert( DIRECTIONS[2] == Vec3( 0, 0, -1 ), "directions" );
+static_assert( SCALE * Vec4( 1, 2, 3, 1 ) == Vec4( 2, 4, 6, 2 ), "scale" );
+static_assert( inverse( SCALE ) == Mat4( 0.5f ), "inverse" );
+static_assert( dot( Vec4( 1, 2, 3, 4 ), Vec4( 1, 1, 1, 1 ) ) == 10, "dot" );
+static_assert( cross( DVec3( 1, 0, 0 ), DVec3( 0, 1, 0 ) ) ==
+               DVec3( 0, 0, 1 ), "cross" );
+static_assert( squareRoot( 2.0 ) * squareRoot( 2.0 ) - 2.0 < 1e-15,
+               "squareRoot" );
+
+} // End nspc anonymous
+#endif
+
+TEST( Constexpr, Tables )
+{
+#if GEL_HAS_CONSTEXPR
+    using namespace gel::math;
+
+    // the tables are usable at run time like any other vector
+    EXPECT_NEAR( 1.0f, length( DIRECTIONS[0] ), 1e-6f );
+    EXPECT_EQ( Vec3( 1, 0, 0 ), PALETTE[0].rgb() );
+    EXPECT_NEAR( 1.0f, TURN.z, 1e-6f );
+    EXPECT_NEAR( 0.0f, TURN.w, 1e-6f );
+    EXPECT_EQ( Vec4( 0, 0, 2, 0 ), SCALE[2] );
+#endif
+}
@@ -0,0 +1,131 @@
+// dispatch.t.cpp
+#include <gel/math/dispatch.h>
+#include <gel/math/mat.h>
+#include <gel/math/vec.h>
+#include <gtest/gtest.h>
+
+TEST( Dispatch, Selection )
+{
+    using namespace gel::math;
+
+    const Precision best = detectSimd();
+    EXPECT_GE( best, SIMD_SCALAR );
+    EXPECT_LE( best, SIMD_AVX512 );
+
+    EXPECT_EQ( SIMD_SCALAR, batchKernels( SIMD_SCALAR ).level );
+    EXPECT_EQ( best, batchKernels( SIMD_AVX512 ).level );
+
+    // The configured default never exceeds what the CPU supports
+    const Precision selected = batchKernels().level;
+    EXPECT_LE( selected, best );
+
+    EXPECT_EQ( SIMD_SCALAR, selectSimd( SIMD_SCALAR ) );
+    EXPECT_EQ( SIMD_SCALAR, batchKernels().level );
+    EXPECT_EQ( selected, selectSimd( SIMD_BEST ) );
+    EXPECT_EQ( selected, batchKernels().level );
+}
+
+TEST( Dispatch, Kernels )
+{
+    using namespace gel::math;
+
+    // An odd size exercises the scalar tail of every width
+    const gel::Size n = 37;
+    float a[n];
+    float b[n];
+    float c[n];
+    for ( gel::Size i = 0; i < n; ++i )
+    {
+        a[i] = static_cast<float>( i ) - 10.0f;
+        b[i] = 0.25f * static_cast<float>( i ) + 1.0f;
+        c[i] = 3.0f - static_cast<float>( i );
+    }
+    const float* u[] = { a, b, c };
+    const float* v[] = { b, c, a };
+    const float m[] = { 1, 2, 3, 0, 4, 5, 6, 0, 7, 8, 9, 0, 10, 11, 12, 1 };
+
+    const BatchKernels& scalar = batchKernels( SIMD_SCALAR );
+    for ( int level = SIMD_SCALAR; level <= SIMD_AVX512; ++level )
+    {
+        const BatchKernels& k = batchKernels( Precision( level ) );
+        float expected[3][n];
+        float actual[3][n];
+        float* e[] = { expected[0], expected[1], expected[2] };
+        float* r[] = { actual[0], actual[1], actual[2] };
+
+        scalar.add( e[0], a, b, n );
+        k.add( r[0], a, b, n );
+        scalar.mul( e[1], a, b, n );
+        k.mul( r[1], a, b, n );
+        scalar.scale( e[2], a, 3.0f, n );
+        k.scale( r[2], a, 3.0f, n );
+        for ( gel::Size i = 0; i < n; ++i )
+        {
+            EXPECT_EQ( expected[0][i], actual[0][i] );
+            EXPECT_EQ( expected[1][i], actual[1][i] );
+            EXPECT_EQ( expected[2][i], actual[2][i] );
+        }
+
+        // Levels with fused multiply-add round once less
+        scalar.madd( e[0], a, b, c, n );
+        k.madd( r[0], a, b, c, n );
+        scalar.lerp( e[1], a, b, 0.3f, n );
+        k.lerp( r[1], a, b, 0.3f, n );
+        scalar.dot( e[2], u, v, 3, n );
+        k.dot( r[2], u, v, 3, n );
+        for ( gel::Size i = 0; i < n; ++i )
+        {
+            EXPECT_FLOAT_EQ( expected[0][i], actual[0][i] );
+            EXPECT_NEAR( expected[1][i], actual[1][i], 1e-5f );
+            EXPECT_FLOAT_EQ( expected[2][i], actual[2][i] );
+        }
+
+        scalar.normalize( e, u, 3, n );
+        k.normalize( r, u, 3, n );
+        for ( gel::Size i = 0; i < n; ++i )
+        {
+            for ( int j = 0; j < 3; ++j )
+            {
+                EXPECT_NEAR( expected[j][i], actual[j][i], 1e-6f );
+            }
+        }
+
+        scalar.transformPoints( m, e, u, n );
+        k.transformPoints( m, r, u, n );
+        for ( gel::Size i = 0; i < n; ++i )
+        {
+            for ( int j = 0; j < 3; ++j )
+            {
+                EXPECT_FLOAT_EQ( expected[j][i], actual[j][i] );
+            }
+        }
+    }
+}
+
+TEST( Dispatch, Streams )
+{
+    using namespace gel::math;
+
+    Vec3Stream in;
+    for ( int i = 0; i < 21; ++i )
+    {
+        in.push( Vec3( i, 1, -i ) );
+    }
+
+    // Every selectable level gives the stream kernels the same results
+    const Mat4 m = Mat4( Vec4( 0, 1, 0, 0 ), Vec4( -1, 0, 0, 0 ),
+                         Vec4( 0, 0, 1, 0 ), Vec4( 5, 6, 7, 1 ) );
+    for ( int level = SIMD_SCALAR; level <= SIMD_BEST; ++level )
+    {
+        selectSimd( Precision( level ) );
+        Vec3Stream out;
+        transformPoints( m, in, out );
+        mul( out, out, in );
+        for ( int i = 0; i < 21; ++i )
+        {
+            EXPECT_EQ( Vec3( 4 * i, 6 + i, i * i - 7 * i ),
+                       out.get( i ) );
+        }
+    }
+    selectSimd( SIMD_BEST );
+}
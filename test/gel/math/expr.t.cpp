@@ -0,0 +1,89 @@
+// expr.t.cpp
+#include <gel/math/expr.h>
+#include <gel/math/vec.h>
+#include <gtest/gtest.h>
+
+TEST( Expr, Vectors )
+{
+    using namespace gel::math;
+
+    DVec4 a( 1, 2, 3, 4 );
+    DVec4 b( 2, 2, 2, 2 );
+    DVec4 c( 1, 0, 1, 0 );
+    DVec4 d( 3, 3, 3, 3 );
+    DVec4 e( 1, 1, 1, 1 );
+
+    DVec4 r = expr( a ) * b + c * d - e;
+    EXPECT_EQ( a * b + c * d - e, r );
+
+    Vec3 u( 1, 2, 3 );
+    Vec3 v( 4, 5, 6 );
+    Vec3 s = ( expr( u ) + v ) / 2.0f;
+    EXPECT_EQ( Vec3( 2.5f, 3.5f, 4.5f ), s );
+    EXPECT_EQ( Vec3( -1, -2, -3 ), eval( -expr( u ) ) );
+
+    Vec2 p( 1, 2 );
+    Vec2 q = 3.0f * expr( p ) - 1.0f;
+    EXPECT_EQ( Vec2( 2, 5 ), q );
+
+    // The untouched value-semantics API still works
+    EXPECT_EQ( Vec3( 5, 7, 9 ), u + v );
+}
+
+TEST( Expr, Fma )
+{
+    using namespace gel::math;
+
+    EXPECT_EQ( 7.0f, fmadd( 2.0f, 3.0f, 1.0f ) );
+    EXPECT_EQ( 7, fmadd( 2, 3, 1 ) );
+
+    Vec4 a( 1, 2, 3, 4 );
+    Vec4 b( 5, 6, 7, 8 );
+    Vec4 r = b + expr( a ) * a;
+    EXPECT_EQ( Vec4( 6, 10, 16, 24 ), r );
+
+    r = expr( a ) * a - b;
+    EXPECT_EQ( Vec4( -4, -2, 2, 8 ), r );
+
+    r = expr( a ) * b + expr( b ) * a;
+    EXPECT_EQ( Vec4( 10, 24, 42, 64 ), r );
+}
+
+TEST( Expr, Streams )
+{
+    using namespace gel::math;
+
+    const gel::Size n = 37;
+    Vec4Stream u( n );
+    Vec4Stream v( n );
+    for ( gel::Size i = 0; i < n; ++i )
+    {
+        float f = static_cast<float>( i );
+        u.set( i, Vec4( f, f + 1, f + 2, f + 3 ) );
+        v.set( i, Vec4( 1, 2, 3, 4 ) );
+    }
+
+    Vec4Stream out;
+    assign( out, expr( u ) * 2.0f + v - Vec4( 1, 1, 1, 1 ) );
+    ASSERT_EQ( n, out.size() );
+    for ( gel::Size i = 0; i < n; ++i )
+    {
+        EXPECT_EQ( u.get( i ) * 2.0f + v.get( i ) - Vec4( 1, 1, 1, 1 ),
+                   out.get( i ) );
+    }
+
+    // The destination may alias an operand
+    assign( u, expr( u ) - u );
+    for ( gel::Size i = 0; i < n; ++i )
+    {
+        EXPECT_EQ( Vec4( 0, 0, 0, 0 ), u.get( i ) );
+    }
+
+    // Expressions without streams are broadcast
+    Vec3Stream w( 5 );
+    assign( w, expr( Vec3( 1, 2, 3 ) ) * 2.0f );
+    for ( gel::Size i = 0; i < w.size(); ++i )
+    {
+        EXPECT_EQ( Vec3( 2, 4, 6 ), w.get( i ) );
+    }
+}
@@ -0,0 +1,92 @@
+// frustum.t.cpp
+#include <gel/math/dispatch.h>
+#include <gel/math/frustum.h>
+#include <gel/math/mat.h>
+#include <gel/math/vec.h>
+#include <gtest/gtest.h>
+
+TEST( TFrustum, Planes )
+{
+    using namespace gel::math;
+
+    // the identity clips to the cube from -1 to 1
+    Frustum f( ( Mat4() ) );
+    EXPECT_EQ( Vec4( 1, 0, 0, 1 ), f.plane( 0 ) );
+    EXPECT_EQ( Vec4( 0, 0, -1, 1 ), f.plane( 5 ) );
+    EXPECT_TRUE( f.contains( Vec3( 0.5f, -1, 0 ) ) );
+    EXPECT_FALSE( f.contains( Vec3( 0, 0, 1.5f ) ) );
+
+    EXPECT_TRUE( f.intersects( Aabb( Vec3( 0.5f ), Vec3( 3 ) ) ) );
+    EXPECT_FALSE( f.intersects( Aabb( Vec3( 1.5f ), Vec3( 3 ) ) ) );
+    EXPECT_TRUE( f.intersects( Vec3( 0, 2, 0 ), 1.0f ) );
+    EXPECT_FALSE( f.intersects( Vec3( 0, 2.5f, 0 ), 1.0f ) );
+
+    // planes are normalized, so sphere tests use true distances
+    Frustum g( Mat4( 2.0f ) * Mat4( Vec4( 1, 0, 0, 0 ), Vec4( 0, 1, 0, 0 ),
+                                    Vec4( 0, 0, 1, 0 ), Vec4( 0, 0, 0, 2 ) ) );
+    EXPECT_FLOAT_EQ( 1.0f, length( Vec3( g.plane( 2 ).x, g.plane( 2 ).y,
+                                         g.plane( 2 ).z ) ) );
+    EXPECT_TRUE( g.intersects( Vec3( 0, 0, 2.9f ), 1.0f ) );
+    EXPECT_FALSE( g.intersects( Vec3( 0, 0, 3.1f ), 1.0f ) );
+
+    Frustum all;
+    EXPECT_TRUE( all.contains( Vec3( 1e6f, -1e6f, 1e6f ) ) );
+}
+
+TEST( TFrustum, Cull )
+{
+    using namespace gel::math;
+
+    // boxes and spheres on a line along x, half of them outside
+    const gel::Size n = 101;
+    Vec3Stream centers;
+    Vec3Stream extents;
+    TVec3Stream<double> dcenters;
+    TVec3Stream<double> dextents;
+    float radii[n];
+    double dradii[n];
+    for ( gel::Size i = 0; i < n; ++i )
+    {
+        // offset so that no box or sphere touches a plane
+        const float x = static_cast<float>( i ) * 0.1f - 4.987f;
+        centers.push( Vec3( x, 0.5f * ( i % 3 ), 0 ) );
+        extents.push( Vec3( 0.05f, 0.5f, 0.5f ) );
+        dcenters.push( DVec3( x, 0.5f * ( i % 3 ), 0 ) );
+        dextents.push( DVec3( 0.05f, 0.5f, 0.5f ) );
+        radii[i] = 0.25f;
+        dradii[i] = 0.25f;
+    }
+
+    Mat4 m( Vec4( 0.5f, 0, 0, 0 ), Vec4( 0, 1, 0, 0 ), Vec4( 0, 0, 1, 0 ),
+            Vec4( 0, 0, 0, 1 ) );
+    Frustum f( m );
+    DFrustum df( ( DMat4( DVec4( 0.5, 0, 0, 0 ), DVec4( 0, 1, 0, 0 ),
+                          DVec4( 0, 0, 1, 0 ), DVec4( 0, 0, 0, 1 ) ) ) );
+
+    gel::uint32 expected[n];
+    const gel::Size boxes = cull( expected, df, dcenters, dextents );
+    gel::uint32 expectedSpheres[n];
+    const gel::Size spheres = cull( expectedSpheres, df, dcenters, dradii );
+    EXPECT_LT( 0u, boxes );
+    EXPECT_GT( n, boxes );
+    EXPECT_GT( spheres, boxes );
+
+    for ( int level = SIMD_SCALAR; level <= SIMD_BEST; ++level )
+    {
+        selectSimd( Precision( level ) );
+
+        gel::uint32 visible[n];
+        ASSERT_EQ( boxes, cull( visible, f, centers, extents ) );
+        for ( gel::Size i = 0; i < boxes; ++i )
+        {
+            EXPECT_EQ( expected[i], visible[i] );
+        }
+
+        ASSERT_EQ( spheres, cull( visible, f, centers, radii ) );
+        for ( gel::Size i = 0; i < spheres; ++i )
+        {
+            EXPECT_EQ( expectedSpheres[i], visible[i] );
+        }
+    }
+    selectSimd( SIMD_BEST );
+}
@@ -0,0 +1,89 @@
+// geometric.t.cpp
+#include <math.h>
+#include <gel/math/geometric.h>
+#include <gel/math/quat.h>
+#include <gel/math/vec.h>
+#include <gtest/gtest.h>
+
+TEST( Geometric, DotCrossLength )
+{
+    using namespace gel::math;
+
+    EXPECT_EQ( 11, dot( Vec2( 1, 2 ), Vec2( 3, 4 ) ) );
+    EXPECT_EQ( 32, dot( Vec3( 1, 2, 3 ), Vec3( 4, 5, 6 ) ) );
+    EXPECT_EQ( 70, dot( Vec4( 1, 2, 3, 4 ), Vec4( 5, 6, 7, 8 ) ) );
+    EXPECT_EQ( 70, dot( DVec4( 1, 2, 3, 4 ), DVec4( 5, 6, 7, 8 ) ) );
+
+    EXPECT_EQ( Vec3( 0, 0, 1 ), cross( Vec3( 1, 0, 0 ), Vec3( 0, 1, 0 ) ) );
+    EXPECT_EQ( Vec3( -3, 6, -3 ),
+               cross( Vec3( 1, 2, 3 ), Vec3( 4, 5, 6 ) ) );
+
+    EXPECT_EQ( 5, length( Vec2( 3, 4 ) ) );
+    EXPECT_EQ( 3, length( Vec3( 1, 2, 2 ) ) );
+    EXPECT_EQ( 5, length( Vec4( 4, 1, 2, 2 ) ) );
+    EXPECT_EQ( 5, distance( Vec3( 1, 1, 1 ), Vec3( 4, 5, 1 ) ) );
+}
+
+TEST( Geometric, Normalize )
+{
+    using namespace gel::math;
+
+    Vec4 v( 4, 1, 2, 2 );
+    Vec4 h = normalize<HIGHP>( v );
+    EXPECT_FLOAT_EQ( 0.8f, h.x );
+    EXPECT_FLOAT_EQ( 0.2f, h.y );
+    EXPECT_FLOAT_EQ( 0.4f, h.z );
+    EXPECT_FLOAT_EQ( 0.4f, h.w );
+
+    Vec4 m = normalize<MEDIUMP>( v );
+    Vec4 l = normalize<LOWP>( v );
+    for ( int i = 0; i < 4; ++i )
+    {
+        EXPECT_NEAR( h[i], m[i], 1e-6f );
+        EXPECT_NEAR( h[i], l[i], 1e-3f );
+    }
+    EXPECT_EQ( m, normalize( v ) );
+
+    Vec3 u = normalize<MEDIUMP>( Vec3( 0, 3, 4 ) );
+    EXPECT_NEAR( 0.6f, u.y, 1e-6f );
+    EXPECT_NEAR( 0.8f, u.z, 1e-6f );
+    EXPECT_EQ( Vec2( 0, 1 ), normalize<HIGHP>( Vec2( 0, 7 ) ) );
+    EXPECT_DOUBLE_EQ( 0.6, normalize<LOWP>( DVec3( 0, 3, 4 ) ).y );
+
+    EXPECT_NEAR( 0.5f, inversesqrt<MEDIUMP>( 4.0f ), 1e-6f );
+    EXPECT_EQ( 0.5, inversesqrt<LOWP>( 4.0 ) );
+
+    // Quaternions keep their own normalize
+    Quat q( 0, 0, 0, 2 );
+    EXPECT_EQ( Quat(), normalize( q ) );
+}
+
+TEST( Geometric, Reflect )
+{
+    using namespace gel::math;
+
+    EXPECT_EQ( Vec2( 1, 1 ), reflect( Vec2( 1, -1 ), Vec2( 0, 1 ) ) );
+    EXPECT_EQ( Vec3( 1, 1, 0 ),
+               reflect( Vec3( 1, -1, 0 ), Vec3( 0, 1, 0 ) ) );
+    EXPECT_EQ( Vec4( 1, 1, 0, 0 ),
+               reflect( Vec4( 1, -1, 0, 0 ), Vec4( 0, 1, 0, 0 ) ) );
+}
+
+TEST( Geometric, MinMaxClamp )
+{
+    using namespace gel::math;
+
+    Vec4 a( 1, 5, -2, 8 );
+    Vec4 b( 3, 4, -1, 0 );
+    EXPECT_EQ( Vec4( 1, 4, -2, 0 ), min( a, b ) );
+    EXPECT_EQ( Vec4( 3, 5, -1, 8 ), max( a, b ) );
+    EXPECT_EQ( Vec4( 1, 1, 0, 1 ), clamp( a, 0.0f, 1.0f ) );
+    EXPECT_EQ( Vec4( 1, 4, -1, 1 ),
+               clamp( a, Vec4( 0, 0, -1, 0 ), Vec4( 2, 4, 2, 1 ) ) );
+
+    EXPECT_EQ( Vec3( 1, 4, -2 ), min( Vec3( 1, 5, -2 ), Vec3( 3, 4, -1 ) ) );
+    EXPECT_EQ( Vec3( 3, 5, -1 ), max( Vec3( 1, 5, -2 ), Vec3( 3, 4, -1 ) ) );
+    EXPECT_EQ( Vec2( 0, 1 ), clamp( Vec2( -3, 3 ), 0.0f, 1.0f ) );
+    EXPECT_EQ( DVec4( 1, 4, -2, 0 ),
+               min( DVec4( 1, 5, -2, 8 ), DVec4( 3, 4, -1, 0 ) ) );
+}
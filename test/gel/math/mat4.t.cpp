@@ -0,0 +1,137 @@
+// mat4.t.cpp
+#include <gel/math/mat.h>
+#include <gel/math/vec.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+template <typename T>
+void expectNear( const gel::math::TMat4<T>& a, const gel::math::TMat4<T>& b )
+{
+    for ( gel::Size c = 0; c < 4; ++c )
+    {
+        for ( gel::Size r = 0; r < 4; ++r )
+        {
+            EXPECT_NEAR( a[c][r], b[c][r], 1e-4 ) << "[" << c << "][" << r << "]";
+        }
+    }
+}
+
+gel::math::Mat4 affine()
+{
+    using namespace gel::math;
+
+    return Mat4( Vec4( 0, 2, 0, 0 ),
+                 Vec4( -1, 0, 0, 0 ),
+                 Vec4( 0, 0, 3, 0 ),
+                 Vec4( 5, 6, 7, 1 ) );
+}
+
+} // End nspc anonymous
+
+TEST( TMat4, Construction )
+{
+    using namespace gel::math;
+
+    Mat4 m;
+    EXPECT_EQ( Vec4( 1, 0, 0, 0 ), m[0] );
+    EXPECT_EQ( Vec4( 0, 0, 0, 1 ), m[3] );
+    EXPECT_EQ( Mat4( 1.0f ), m );
+
+    Mat4 s( 2.0f );
+    EXPECT_EQ( 2.0f, s[2][2] );
+    EXPECT_EQ( 0.0f, s[2][1] );
+    EXPECT_TRUE( s != m );
+}
+
+TEST( TMat4, Multiplication )
+{
+    using namespace gel::math;
+
+    Mat4 a = affine();
+    EXPECT_EQ( a, a * Mat4() );
+    EXPECT_EQ( a, Mat4() * a );
+
+    Vec4 p = a * Vec4( 1, 1, 1, 1 );
+    EXPECT_EQ( Vec4( 4, 8, 10, 1 ), p );
+
+    Mat4 t( Vec4( 1, 0, 0, 0 ), Vec4( 0, 1, 0, 0 ), Vec4( 0, 0, 1, 0 ),
+            Vec4( 1, 2, 3, 1 ) );
+    Mat4 r = t;
+    r *= a;
+    EXPECT_EQ( t * ( a * Vec4( 1, 2, 3, 1 ) ), r * Vec4( 1, 2, 3, 1 ) );
+}
+
+TEST( TMat4, Transpose )
+{
+    using namespace gel::math;
+
+    Mat4 m( Vec4( 1, 2, 3, 4 ), Vec4( 5, 6, 7, 8 ), Vec4( 9, 10, 11, 12 ),
+            Vec4( 13, 14, 15, 16 ) );
+    Mat4 t = transpose( m );
+    EXPECT_EQ( Vec4( 1, 5, 9, 13 ), t[0] );
+    EXPECT_EQ( Vec4( 4, 8, 12, 16 ), t[3] );
+    EXPECT_EQ( m, transpose( t ) );
+
+    DMat4 d( DVec4( 1, 2, 3, 4 ), DVec4( 5, 6, 7, 8 ), DVec4( 9, 10, 11, 12 ),
+             DVec4( 13, 14, 15, 16 ) );
+    EXPECT_EQ( DVec4( 2, 6, 10, 14 ), transpose( d )[1] );
+}
+
+TEST( TMat4, Inverse )
+{
+    using namespace gel::math;
+
+    Mat4 a = affine();
+    expectNear( Mat4(), a * inverse( a ) );
+    expectNear( inverse( a ), affineInverse( a ) );
+    EXPECT_NEAR( 6.0f, determinant( a ), 1e-5f );
+
+    Mat4 p( Vec4( 2, 0, 1, 0 ), Vec4( 1, 3, 0, 1 ), Vec4( 0, 1, 4, 0 ),
+            Vec4( 1, 0, 0, 2 ) );
+    expectNear( Mat4(), inverse( p ) * p );
+
+    DMat4 d( DVec4( 2, 0, 1, 0 ), DVec4( 1, 3, 0, 1 ), DVec4( 0, 1, 4, 0 ),
+             DVec4( 1, 0, 0, 2 ) );
+    expectNear( DMat4(), d * inverse( d ) );
+    EXPECT_NEAR( determinant( p ), determinant( d ), 1e-4 );
+}
+
+TEST( TMat4, BatchTransform )
+{
+    using namespace gel::math;
+
+    Mat4 a = affine();
+    Vec3 in[9];
+    Vec3 out[9];
+    for ( int i = 0; i < 9; ++i )
+    {
+        in[i] = Vec3( i, 1, -i );
+    }
+
+    transformPoints( a, in, out, 9 );
+    for ( int i = 0; i < 9; ++i )
+    {
+        Vec4 e = a * Vec4( in[i], 1 );
+        EXPECT_EQ( Vec3( e.x, e.y, e.z ), out[i] );
+    }
+
+    transformVectors( a, in, out, 9 );
+    EXPECT_EQ( Vec3( -1, 8, -12 ), out[4] );
+
+    Vec3Stream s;
+    Vec3Stream r;
+    s.load( in, 9 );
+    transformPoints( a, s, r );
+    transformPoints( a, in, out, 9 );
+    for ( int i = 0; i < 9; ++i )
+    {
+        EXPECT_EQ( out[i], r.get( i ) );
+    }
+
+    Vec4 v[2] = { Vec4( 1, 1, 1, 1 ), Vec4( 0, 0, 0, 1 ) };
+    transform( a, v, v, 2 );
+    EXPECT_EQ( Vec4( 4, 8, 10, 1 ), v[0] );
+    EXPECT_EQ( Vec4( 5, 6, 7, 1 ), v[1] );
+}
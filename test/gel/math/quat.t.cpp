@@ -0,0 +1,111 @@
+// quat.t.cpp
+#include <math.h>
+#include <gel/math/quat.h>
+#include <gel/math/vec.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+const float HALF_PI = 1.57079632679f;
+
+void expectNear( const gel::math::Vec3& a, const gel::math::Vec3& b )
+{
+    EXPECT_NEAR( a.x, b.x, 1e-5f );
+    EXPECT_NEAR( a.y, b.y, 1e-5f );
+    EXPECT_NEAR( a.z, b.z, 1e-5f );
+}
+
+} // End nspc anonymous
+
+TEST( TQuat, Construction )
+{
+    using namespace gel::math;
+
+    Quat q;
+    EXPECT_TRUE( q.x == 0 && q.y == 0 && q.z == 0 && q.w == 1 );
+    EXPECT_EQ( 16u, alignof( Quat ) );
+
+    Quat r( 1, 2, 3, 4 );
+    EXPECT_EQ( Vec4( 1, 2, 3, 4 ), r );
+    EXPECT_EQ( Vec4( -1, -2, -3, 4 ), conjugate( r ) );
+    EXPECT_EQ( 30.0f, dot( r, r ) );
+}
+
+TEST( TQuat, Multiplication )
+{
+    using namespace gel::math;
+
+    Quat a( 1, 2, 3, 4 );
+    Quat b( -2, 1, 0.5f, 3 );
+    Quat r = a * b;
+
+    DQuat da( 1, 2, 3, 4 );
+    DQuat db( -2, 1, 0.5, 3 );
+    DQuat dr = da * db;
+    EXPECT_FLOAT_EQ( dr.x, r.x );
+    EXPECT_FLOAT_EQ( dr.y, r.y );
+    EXPECT_FLOAT_EQ( dr.z, r.z );
+    EXPECT_FLOAT_EQ( dr.w, r.w );
+
+    Quat i = normalize( a ) * inverse( normalize( a ) );
+    EXPECT_NEAR( 1.0f, i.w, 1e-6f );
+    EXPECT_NEAR( 0.0f, i.x, 1e-6f );
+
+    a *= b;
+    EXPECT_EQ( r, a );
+}
+
+TEST( TQuat, Rotation )
+{
+    using namespace gel::math;
+
+    Quat z = angleAxis( HALF_PI, Vec3( 0, 0, 1 ) );
+    expectNear( Vec3( 0, 1, 0 ), z * Vec3( 1, 0, 0 ) );
+
+    Quat x = angleAxis( HALF_PI, Vec3( 1, 0, 0 ) );
+    expectNear( Vec3( 0, 0, 1 ), x * Vec3( 0, 1, 0 ) );
+
+    // composition applies the right hand side first
+    expectNear( Vec3( 0, 0, 1 ), ( x * z ) * Vec3( 1, 0, 0 ) );
+
+    Quat qs[7];
+    Vec3 vs[7];
+    Vec3 expected[7];
+    for ( int i = 0; i < 7; ++i )
+    {
+        Vec3 axis( 1, i, 2 );
+        axis /= sqrtf( 5.0f + i * i );
+        qs[i] = angleAxis( 0.3f * i, axis );
+        vs[i] = Vec3( i, 1, -1 );
+        expected[i] = qs[i] * vs[i];
+    }
+
+    rotate( qs, vs, 7 );
+    for ( int i = 0; i < 7; ++i )
+    {
+        expectNear( expected[i], vs[i] );
+    }
+}
+
+TEST( TQuat, Interpolation )
+{
+    using namespace gel::math;
+
+    Quat a;
+    Quat b = angleAxis( HALF_PI, Vec3( 0, 1, 0 ) );
+
+    Quat h = slerp( a, b, 0.5f );
+    Quat e = angleAxis( HALF_PI * 0.5f, Vec3( 0, 1, 0 ) );
+    EXPECT_NEAR( e.y, h.y, 1e-6f );
+    EXPECT_NEAR( e.w, h.w, 1e-6f );
+    EXPECT_NEAR( 1.0f, slerp( a, b, 0.0f ).w, 1e-6f );
+
+    Quat n = nlerp( a, b, 0.5f );
+    EXPECT_NEAR( 1.0f, dot( n, n ), 1e-6f );
+    EXPECT_NEAR( e.y, n.y, 1e-6f );
+
+    // takes the shortest path when the quaternions lie in opposite hemispheres
+    Quat f = slerp( a, Quat( -static_cast<Vec4&>( b ) ), 0.5f );
+    EXPECT_NEAR( e.w, fabs( f.w ), 1e-6f );
+}
@@ -193,43 +193,16 @@ TEST( TVec2, ComparisonOperators )
     ASSERT_FALSE( u != u );
 }
 
-TEST( TRef2, Construction )
+TEST( TVec2, Swizzle )
 {
     using namespace gel::math;
 
-    TVec2<float> u( 0, 1 );
-    TVec2<float> v( 1, 2 );
+    TVec2<float> u( 1, 2 );
+    EXPECT_EQ( TVec2<float>( 2, 1 ), u.yx() );
+    EXPECT_EQ( TVec2<float>( 2, 2 ), ( u.swizzle<Y, Y>() ) );
+    EXPECT_EQ( TVec3<float>( 1, 2, 1 ), ( u.swizzle<S, T, S>() ) );
+    EXPECT_EQ( TVec4<float>( 2, 1, 2, 1 ), ( u.swizzle<Y, X, Y, X>() ) );
 
-    TRef2<float> i( u );
-    TRef2<float> j( v );
-    TRef2<float> k( i );
+    u.assign<Y, X>( TVec2<float>( 3, 4 ) );
+    EXPECT_EQ( TVec2<float>( 4, 3 ), u );
 }
-
-TEST( TRef2, Comparison )
-{
-    using namespace gel::math;
-
-    TVec2<float> u( 0, 1 );
-    TVec2<float> v( 1, 2 );
-
-    TRef2<float> i( u );
-    TRef2<float> j( v );
-
-    ASSERT_TRUE( u == i );
-    ASSERT_FALSE( u == j );
-
-    ASSERT_TRUE( i == u );
-    ASSERT_FALSE( j == u );
-
-    ASSERT_TRUE( i == i );
-    ASSERT_FALSE( i == j );
-
-    ASSERT_FALSE( u != i );
-    ASSERT_TRUE( u != j );
-
-    ASSERT_FALSE( i != u );
-    ASSERT_TRUE( j != u );
-
-    ASSERT_FALSE( i != i );
-    ASSERT_TRUE( i != j );
-}
\ No newline at end of file
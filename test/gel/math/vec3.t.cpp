@@ -193,43 +193,20 @@ TEST( TVec3, ComparisonOperators )
     ASSERT_FALSE( u != u );
 }
 
-TEST( TRef3, Construction )
+TEST( TVec3, Swizzle )
 {
     using namespace gel::math;
 
-    TVec3<float> u( 0, 1, 2 );
-    TVec3<float> v( 1, 2, 3 );
+    TVec3<float> u( 1, 2, 3 );
+    EXPECT_EQ( TVec3<float>( 1, 3, 2 ), u.xzy() );
+    EXPECT_EQ( TVec3<float>( 3, 2, 1 ), u.zyx() );
+    EXPECT_EQ( TVec2<float>( 2, 3 ), u.yz() );
+    EXPECT_EQ( TVec3<float>( 3, 1, 2 ), ( u.swizzle<B, R, G>() ) );
+    EXPECT_EQ( TVec4<float>( 1, 1, 2, 3 ), ( u.swizzle<X, X, Y, Z>() ) );
 
-    TRef3<float> i( u );
-    TRef3<float> j( v );
-    TRef3<float> k( i );
-}
-
-TEST( TRef3, Comparison )
-{
-    using namespace gel::math;
-
-    TVec3<float> u( 0, 1, 2 );
-    TVec3<float> v( 1, 2, 3 );
-
-    TRef3<float> i( u );
-    TRef3<float> j( v );
+    u.assign<Z, X>( TVec2<float>( 5, 6 ) );
+    EXPECT_EQ( TVec3<float>( 6, 2, 5 ), u );
 
-    ASSERT_TRUE( u == i );
-    ASSERT_FALSE( u == j );
-
-    ASSERT_TRUE( i == u );
-    ASSERT_FALSE( j == u );
-
-    ASSERT_TRUE( i == i );
-    ASSERT_FALSE( i == j );
-
-    ASSERT_FALSE( u != i );
-    ASSERT_TRUE( u != j );
-
-    ASSERT_FALSE( i != u );
-    ASSERT_TRUE( j != u );
-
-    ASSERT_FALSE( i != i );
-    ASSERT_TRUE( i != j );
-}
\ No newline at end of file
+    u.assign<Y, Z, X>( TVec3<float>( 7, 8, 9 ) );
+    EXPECT_EQ( TVec3<float>( 9, 7, 8 ), u );
+}
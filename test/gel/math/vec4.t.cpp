@@ -193,43 +193,60 @@ TEST( TVec4, ComparisonOperators )
     ASSERT_FALSE( u != u );
 }
 
-TEST( TRef4, Construction )
+TEST( TVec4, Swizzle )
 {
     using namespace gel::math;
 
-    TVec4<float> u( 0, 1, 2, 3 );
-    TVec4<float> v( 1, 2, 3, 4 );
+    TVec4<float> u( 1, 2, 3, 4 );
+    EXPECT_EQ( TVec4<float>( 4, 3, 2, 1 ), u.wzyx() );
+    EXPECT_EQ( TVec4<float>( 3, 3, 1, 4 ), ( u.swizzle<Z, Z, X, W>() ) );
+    EXPECT_EQ( TVec3<float>( 1, 3, 2 ), u.xzy() );
+    EXPECT_EQ( TVec3<float>( 3, 2, 1 ), u.bgr() );
+    EXPECT_EQ( TVec2<float>( 1, 3 ), u.xz() );
 
-    TRef4<float> i( u );
-    TRef4<float> j( v );
-    TRef4<float> k( i );
+    TVec4<double> d( 1, 2, 3, 4 );
+    EXPECT_EQ( TVec4<double>( 2, 4, 1, 3 ), ( d.swizzle<Y, W, X, Z>() ) );
+    EXPECT_EQ( TVec3<double>( 2, 3, 1 ), d.yzx() );
+
+    u.assign<W, Y>( TVec2<float>( 5, 6 ) );
+    EXPECT_EQ( TVec4<float>( 1, 6, 3, 5 ), u );
+
+    u.assign<Y, W, X, Z>( TVec4<float>( 7, 8, 9, 10 ) );
+    EXPECT_EQ( TVec4<float>( 9, 7, 10, 8 ), u );
+
+    d.assign<Y, W, X, Z>( TVec4<double>( 7, 8, 9, 10 ) );
+    EXPECT_EQ( TVec4<double>( 9, 7, 10, 8 ), d );
+
+    d.assign<A, R, G>( TVec3<double>( 1, 2, 3 ) );
+    EXPECT_EQ( TVec4<double>( 2, 3, 10, 1 ), d );
 }
 
-TEST( TRef4, Comparison )
+TEST( TVec4, Simd )
 {
     using namespace gel::math;
 
-    TVec4<float> u( 0, 1, 2, 3 );
-    TVec4<float> v( 1, 2, 3, 4 );
+    SVec4 vs[3];
+    ASSERT_EQ( 16u, alignof( SVec4 ) );
+    ASSERT_EQ( 0u, reinterpret_cast<gel::Size>( &vs[1] ) % 16 );
 
-    TRef4<float> i( u );
-    TRef4<float> j( v );
+    SVec4 u( 1, 2, 3, 4 );
+    SVec4 v( u );
+    v += TVec4<int>( 1, 1, 1, 1 );
+    ASSERT_EQ( SVec4( 2, 3, 4, 5 ), v );
 
-    ASSERT_TRUE( u == i );
-    ASSERT_FALSE( u == j );
+    v -= TVec4<double>( 1, 1, 1, 1 );
+    ASSERT_EQ( u, v );
 
-    ASSERT_TRUE( i == u );
-    ASSERT_FALSE( j == u );
-
-    ASSERT_TRUE( i == i );
-    ASSERT_FALSE( i == j );
-
-    ASSERT_FALSE( u != i );
-    ASSERT_TRUE( u != j );
+    v = -v;
+    ASSERT_EQ( SVec4( -1, -2, -3, -4 ), v );
+    ASSERT_TRUE( v != u );
+    ASSERT_EQ( u, -v );
 
-    ASSERT_FALSE( i != u );
-    ASSERT_TRUE( j != u );
+    v = TVec4<int>( 4, 3, 2, 1 );
+    ASSERT_EQ( SVec4( 4, 3, 2, 1 ), v );
+    ASSERT_EQ( SVec4( 5 ), u + v );
 
-    ASSERT_FALSE( i != i );
-    ASSERT_TRUE( i != j );
-}
\ No newline at end of file
+    SVec4 w( 1, 2, 3, 0 );
+    ASSERT_FALSE( w == u );
+    ASSERT_TRUE( w != u );
+}
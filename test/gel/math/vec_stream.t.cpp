@@ -0,0 +1,193 @@
+// vec_stream.t.cpp
+#include <gel/math/vec.h>
+#include <gel/memory/heap_allocator.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ * Serves a fixed number of allocations and then fails, to exercise the
+ * paths that handle exhausted memory.
+ */
+class BudgetAllocator: public gel::mem::IAllocator<float>
+{
+  public:
+    int budget;
+
+    explicit BudgetAllocator( int budget )
+        : budget( budget )
+    {
+    }
+
+    virtual float* allocate( gel::Size count )
+    {
+        if ( budget == 0 )
+        {
+            return 0;
+        }
+        --budget;
+        return gel::mem::HeapAllocator<float>::instance().allocate( count );
+    }
+
+    virtual float* reallocate( float* ptr, gel::Size count )
+    {
+        return gel::mem::HeapAllocator<float>::instance().reallocate( ptr,
+                                                                      count );
+    }
+
+    virtual void free( float* ptr )
+    {
+        gel::mem::HeapAllocator<float>::instance().free( ptr );
+    }
+};
+
+} // End nspc anonymous
+
+TEST( TVec3Stream, Construction )
+{
+    using namespace gel::math;
+
+    Vec3Stream s;
+    EXPECT_EQ( 0u, s.size() );
+
+    Vec3Stream t( 5 );
+    ASSERT_EQ( 5u, t.size() );
+    EXPECT_EQ( 0u, t.capacity() % Vec3Stream::LANES );
+    EXPECT_EQ( Vec3( 0 ), t.get( 4 ) );
+
+    t.set( 2, Vec3( 1, 2, 3 ) );
+    Vec3Stream u( t );
+    EXPECT_EQ( Vec3( 1, 2, 3 ), u.get( 2 ) );
+    EXPECT_EQ( 2.0f, u.y()[2] );
+}
+
+TEST( TVec3Stream, LoadStore )
+{
+    using namespace gel::math;
+
+    Vec3 in[37];
+    for ( int i = 0; i < 37; ++i )
+    {
+        in[i] = Vec3( i, i * 2, i * 3 );
+    }
+
+    Vec3Stream s;
+    s.load( in, 37 );
+    ASSERT_EQ( 37u, s.size() );
+    EXPECT_EQ( 36.0f, s.x()[36] );
+    EXPECT_EQ( 72.0f, s.y()[36] );
+
+    s.push( Vec3( 7, 8, 9 ) );
+    EXPECT_EQ( Vec3( 7, 8, 9 ), s.get( 37 ) );
+    EXPECT_EQ( Vec3( 5, 10, 15 ), s.get( 5 ) );
+
+    Vec3 out[38];
+    s.store( out );
+    EXPECT_EQ( in[20], out[20] );
+    EXPECT_EQ( Vec3( 7, 8, 9 ), out[37] );
+}
+
+TEST( TVec3Stream, Kernels )
+{
+    using namespace gel::math;
+
+    Vec3Stream u;
+    Vec3Stream v;
+    for ( int i = 0; i < 11; ++i )
+    {
+        u.push( Vec3( i, 0, 0 ) );
+        v.push( Vec3( 1, 2, 3 ) );
+    }
+
+    Vec3Stream r;
+    add( r, u, v );
+    ASSERT_EQ( 11u, r.size() );
+    EXPECT_EQ( Vec3( 10 + 1, 2, 3 ), r.get( 10 ) );
+
+    madd( r, v, v, u );
+    EXPECT_EQ( Vec3( 6 + 1, 4, 9 ), r.get( 6 ) );
+
+    scale( r, v, 2.0f );
+    EXPECT_EQ( Vec3( 2, 4, 6 ), r.get( 3 ) );
+
+    float d[11];
+    dot( d, u, v );
+    EXPECT_EQ( 9.0f, d[9] );
+
+    lerp( r, u, v, 0.5f );
+    EXPECT_EQ( Vec3( ( 8 + 1 ) * 0.5f, 1, 1.5f ), r.get( 8 ) );
+
+    scale( u, v, 3.0f );
+    normalize( u, u );
+    for ( int i = 0; i < 11; ++i )
+    {
+        Vec3 n = u.get( i );
+        EXPECT_NEAR( 1.0f, n.x * n.x + n.y * n.y + n.z * n.z, 1e-5f );
+        EXPECT_NEAR( 2.0f * n.x, n.y, 1e-5f );
+    }
+}
+
+TEST( TVec4Stream, Kernels )
+{
+    using namespace gel::math;
+
+    Vec4 in[6];
+    for ( int i = 0; i < 6; ++i )
+    {
+        in[i] = Vec4( i, 1, 2, 2 );
+    }
+
+    Vec4Stream u;
+    u.load( in, 6 );
+    EXPECT_EQ( Vec4( 3, 1, 2, 2 ), u.get( 3 ) );
+
+    Vec4Stream r;
+    add( r, u, u );
+    EXPECT_EQ( Vec4( 6, 2, 4, 4 ), r.get( 3 ) );
+
+    float d[6];
+    dot( d, u, u );
+    EXPECT_EQ( 9.0f + 9.0f, d[3] );
+
+    normalize( r, u );
+    EXPECT_NEAR( 0.8f, r.get( 4 ).x, 1e-6f );
+    EXPECT_NEAR( 0.4f, r.get( 4 ).w, 1e-6f );
+
+    Vec4 out[6];
+    r.store( out );
+    EXPECT_EQ( r.get( 5 ), out[5] );
+}
+
+TEST( TVec3Stream, Exhausted )
+{
+    using namespace gel::math;
+
+    // the first block fits, but no larger one does
+    BudgetAllocator allocator( 1 );
+    Vec3Stream s( allocator );
+    ASSERT_TRUE( s.resize( 3 ) );
+    s.set( 1, Vec3( 1, 2, 3 ) );
+    const gel::Size capacity = s.capacity();
+
+    EXPECT_FALSE( s.reserve( capacity + 1 ) );
+    EXPECT_FALSE( s.resize( capacity + 1 ) );
+    Vec3 in[40];
+    EXPECT_FALSE( s.load( in, 40 ) );
+    EXPECT_EQ( 3u, s.size() );
+    EXPECT_EQ( capacity, s.capacity() );
+    EXPECT_EQ( Vec3( 1, 2, 3 ), s.get( 1 ) );
+
+    for ( gel::Size i = s.size(); i < capacity; ++i )
+    {
+        EXPECT_TRUE( s.push( Vec3( 4 ) ) );
+    }
+    EXPECT_FALSE( s.push( Vec3( 5 ) ) );
+    EXPECT_EQ( capacity, s.size() );
+
+    Vec3Stream big( 40 );
+    Vec3Stream out( allocator );
+    EXPECT_FALSE( add( out, big, big ) );
+    EXPECT_FALSE( normalize( out, big ) );
+    EXPECT_EQ( 0u, out.size() );
+}
@@ -0,0 +1,148 @@
+// buddy_memory.t.cpp
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <gel/memory/buddy_memory.h>
+#include <gtest/gtest.h>
+
+TEST( BuddyMemory, AllocateRelease )
+{
+    using namespace gel::mem;
+
+    BuddyMemory memory( 100000, 1024 );
+    EXPECT_EQ( 65536u, memory.capacity() );
+    EXPECT_EQ( 1024u, memory.minBlock() );
+    EXPECT_EQ( 7u, memory.levels() );
+    EXPECT_EQ( 1u, memory.freeBlocks( 0 ) );
+    EXPECT_EQ( 65536u, memory.largestFree() );
+    EXPECT_EQ( 0.0f, memory.fragmentation() );
+    EXPECT_EQ( 0, memory.allocate( 0 ) );
+    EXPECT_EQ( 0, memory.allocate( 65537 ) );
+
+    char* a = static_cast<char*>( memory.allocate( 1 ) );
+    ASSERT_TRUE( a );
+    EXPECT_EQ( 0u, reinterpret_cast<uintptr_t>( a ) % 1024 );
+    EXPECT_EQ( 1024u, memory.blockSize( a ) );
+    EXPECT_EQ( 1024u, memory.size() );
+
+    // splitting the root left one free block at every level below it
+    for ( unsigned level = 1; level < memory.levels(); ++level )
+    {
+        EXPECT_EQ( 1u, memory.freeBlocks( level ) );
+    }
+    EXPECT_EQ( 0u, memory.freeBlocks( 0 ) );
+
+    char* b = static_cast<char*>( memory.allocate( 3000 ) );
+    ASSERT_TRUE( b );
+    EXPECT_EQ( 4096u, memory.blockSize( b ) );
+    EXPECT_EQ( a + 4096, b );
+    char* c = static_cast<char*>( memory.allocate( 1024 ) );
+    EXPECT_EQ( a + 1024, c );
+    EXPECT_EQ( 6144u, memory.size() );
+    EXPECT_EQ( 32768u, memory.largestFree() );
+    EXPECT_GT( memory.fragmentation(), 0.0f );
+
+    // releasing everything merges the buddies back into the root
+    memory.release( a );
+    memory.release( b );
+    memory.release( c );
+    EXPECT_EQ( 0u, memory.size() );
+    EXPECT_EQ( 1u, memory.freeBlocks( 0 ) );
+    EXPECT_EQ( 0.0f, memory.fragmentation() );
+    EXPECT_EQ( a, memory.allocate( 65536 ) );
+    EXPECT_EQ( 0, memory.allocate( 1 ) );
+}
+
+TEST( BuddyMemory, Reallocate )
+{
+    using namespace gel::mem;
+
+    BuddyMemory memory( 1 << 16, 1024 );
+    char* a = static_cast<char*>( memory.reallocate( 0, 1000 ) );
+    ASSERT_TRUE( a );
+    strcpy( a, "buddy" );
+
+    // the lower buddy grows in place while its buddies are free
+    EXPECT_EQ( a, memory.reallocate( a, 8000 ) );
+    EXPECT_EQ( 8192u, memory.blockSize( a ) );
+    EXPECT_EQ( 8192u, memory.size() );
+
+    // shrinking frees the upper halves
+    EXPECT_EQ( a, memory.reallocate( a, 2000 ) );
+    EXPECT_EQ( 2048u, memory.blockSize( a ) );
+    EXPECT_EQ( 2048u, memory.size() );
+    EXPECT_EQ( 1u, memory.freeBlocks( 5 ) );
+    EXPECT_EQ( 1u, memory.freeBlocks( 4 ) );
+
+    // a block whose buddy is in use moves
+    char* b = static_cast<char*>( memory.allocate( 2048 ) );
+    EXPECT_EQ( a + 2048, b );
+    char* c = static_cast<char*>( memory.reallocate( a, 4096 ) );
+    ASSERT_TRUE( c );
+    EXPECT_NE( a, c );
+    EXPECT_STREQ( "buddy", c );
+
+    // an upper buddy cannot grow in place either
+    char* d = static_cast<char*>( memory.reallocate( b, 4096 ) );
+    EXPECT_NE( b, d );
+
+    EXPECT_EQ( 0, memory.reallocate( c, 0 ) );
+    memory.release( d );
+    EXPECT_EQ( 0u, memory.size() );
+    EXPECT_EQ( 1u, memory.freeBlocks( 0 ) );
+}
+
+TEST( BuddyMemory, Stress )
+{
+    using namespace gel::mem;
+
+    BuddyMemory memory( 1 << 20, 256 );
+    std::vector<char*> blocks;
+    srand( 7 );
+    for ( int i = 0; i < 10000; ++i )
+    {
+        if ( blocks.empty() || rand() % 2 )
+        {
+            const gel::Size size = 1 + rand() % ( 1 << ( rand() % 14 ) );
+            char* p = static_cast<char*>( memory.allocate( size ) );
+            if ( p )
+            {
+                ASSERT_LE( size, memory.blockSize( p ) );
+                memset( p, 0x5A, size );
+                blocks.push_back( p );
+            }
+        }
+        else
+        {
+            const gel::Size j = rand() % blocks.size();
+            if ( rand() % 4 == 0 )
+            {
+                char* p = static_cast<char*>(
+                    memory.reallocate( blocks[j], 1 + rand() % 8192 ) );
+                if ( p )
+                {
+                    blocks[j] = p;
+                }
+                continue;
+            }
+            memory.release( blocks[j] );
+            blocks[j] = blocks.back();
+            blocks.pop_back();
+        }
+
+        gel::Size free = 0;
+        for ( unsigned level = 0; level < memory.levels(); ++level )
+        {
+            free += memory.freeBlocks( level ) * ( memory.capacity() >> level );
+        }
+        ASSERT_EQ( memory.capacity() - memory.size(), free );
+    }
+
+    for ( gel::Size j = 0; j < blocks.size(); ++j )
+    {
+        memory.release( blocks[j] );
+    }
+    EXPECT_EQ( 0u, memory.size() );
+    EXPECT_EQ( 1u, memory.freeBlocks( 0 ) );
+}
@@ -0,0 +1,199 @@
+// caching_pool_allocator.t.cpp
+#include <set>
+#include <thread>
+#include <vector>
+#include <gel/memory/caching_pool_allocator.h>
+#include <gel/memory/heap_memory.h>
+#include <gel/memory/tracking_memory.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ * Serves a fixed number of allocations and then fails, to exercise the
+ * paths that handle exhausted memory.
+ */
+class BudgetMemory: public gel::mem::IMemory
+{
+  public:
+    int budget;
+
+    explicit BudgetMemory( int budget )
+        : budget( budget )
+    {
+    }
+
+    virtual void* allocate( gel::Size size )
+    {
+        if ( budget == 0 )
+        {
+            return 0;
+        }
+        --budget;
+        return gel::mem::HeapMemory::instance().allocate( size );
+    }
+
+    virtual void* reallocate( void* pointer, gel::Size size )
+    {
+        return gel::mem::HeapMemory::instance().reallocate( pointer, size );
+    }
+
+    virtual void release( void* pointer )
+    {
+        gel::mem::HeapMemory::instance().release( pointer );
+    }
+};
+
+} // End nspc anonymous
+
+TEST( CachingPoolAllocator, SingleThread )
+{
+    using namespace gel::mem;
+
+    CachingPoolAllocator<double> pool( 4, 2, 8 );
+    EXPECT_EQ( 0, pool.allocate( 0 ) );
+
+    std::vector<double*> blocks;
+    std::set<double*> unique;
+    for ( int i = 0; i < 100; ++i )
+    {
+        double* p = pool.allocate( 1 );
+        ASSERT_TRUE( p );
+        *p = i;
+        blocks.push_back( p );
+        unique.insert( p );
+    }
+    EXPECT_EQ( 100u, unique.size() );
+    for ( int i = 0; i < 100; ++i )
+    {
+        EXPECT_EQ( i, *blocks[i] );
+        pool.free( blocks[i] );
+    }
+
+    // the most recently freed block is reused first
+    double* p = pool.allocate( 1 );
+    EXPECT_EQ( blocks.back(), p );
+    EXPECT_EQ( p, pool.reallocate( p, 1 ) );
+    EXPECT_EQ( 0, pool.reallocate( p, 0 ) );
+
+    pool.flush();
+    EXPECT_TRUE( pool.allocate( 1 ) );
+}
+
+TEST( CachingPoolAllocator, Threads )
+{
+    using namespace gel::mem;
+
+    const int threads = 8;
+    const int rounds = 20000;
+    CachingPoolAllocator<int> pool( 16, 4, 64 );
+
+    // each thread frees the blocks the previous thread allocated, which
+    // moves blocks between caches through the depot
+    std::vector<int*> handoff[threads];
+    std::vector<std::thread> workers;
+    for ( int t = 0; t < threads; ++t )
+    {
+        workers.push_back( std::thread( [&pool, &handoff, t, rounds]() {
+            std::vector<int*> live;
+            for ( int i = 0; i < rounds; ++i )
+            {
+                int* p = pool.allocate( 1 );
+                *p = t;
+                live.push_back( p );
+                if ( live.size() > 32 )
+                {
+                    EXPECT_EQ( t, *live.front() );
+                    pool.free( live.front() );
+                    live.erase( live.begin() );
+                }
+            }
+            handoff[t] = live;
+            pool.flush();
+        } ) );
+    }
+    for ( int t = 0; t < threads; ++t )
+    {
+        workers[t].join();
+    }
+
+    std::set<int*> unique;
+    for ( int t = 0; t < threads; ++t )
+    {
+        for ( gel::Size i = 0; i < handoff[t].size(); ++i )
+        {
+            EXPECT_EQ( t, *handoff[t][i] );
+            unique.insert( handoff[t][i] );
+        }
+    }
+    EXPECT_EQ( threads * 32u, unique.size() );
+
+    std::thread other( [&pool, &handoff]() {
+        for ( int t = 0; t < threads; ++t )
+        {
+            for ( gel::Size i = 0; i < handoff[t].size(); ++i )
+            {
+                pool.free( handoff[t][i] );
+            }
+        }
+        pool.flush();
+    } );
+    other.join();
+}
+
+TEST( CachingPoolAllocator, EvictedBindings )
+{
+    using namespace gel::mem;
+
+    // more allocators than a thread keeps bindings for, used in turn, must
+    // keep finding the same cache instead of leaving a new one behind
+    TrackingMemory memory;
+    {
+        const int count = 9;
+        CachingPoolAllocator<int>* pools[count];
+        for ( int i = 0; i < count; ++i )
+        {
+            pools[i] = new CachingPoolAllocator<int>( 4, 2, 8, memory );
+        }
+
+        gel::Size settled = 0;
+        for ( int round = 0; round < 1000; ++round )
+        {
+            for ( int i = 0; i < count; ++i )
+            {
+                int* p = pools[i]->allocate( 1 );
+                ASSERT_TRUE( p );
+                pools[i]->free( p );
+            }
+            if ( round == 0 )
+            {
+                settled = memory.stats().liveCount();
+            }
+        }
+        EXPECT_EQ( settled, memory.stats().liveCount() );
+
+        for ( int i = 0; i < count; ++i )
+        {
+            delete pools[i];
+        }
+    }
+    EXPECT_EQ( 0u, memory.stats().liveCount() );
+}
+
+TEST( CachingPoolAllocator, Exhausted )
+{
+    using namespace gel::mem;
+
+    // the cache itself cannot be created
+    BudgetMemory none( 0 );
+    CachingPoolAllocator<int> empty( 4, 2, 8, none );
+    EXPECT_EQ( 0, empty.allocate( 1 ) );
+    empty.flush();
+
+    // the cache and its magazines fit, but no slab does
+    BudgetMemory some( 3 );
+    CachingPoolAllocator<int> small( 4, 2, 8, some );
+    EXPECT_EQ( 0, small.allocate( 1 ) );
+    small.flush();
+}
@@ -0,0 +1,122 @@
+// concurrent_pool_allocator.t.cpp
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+#include <gel/memory/concurrent_pool_allocator.h>
+#include <gtest/gtest.h>
+
+TEST( ConcurrentPoolAllocator, SingleThread )
+{
+    using namespace gel::mem;
+
+    ConcurrentPoolAllocator<double> pool( 8 );
+    EXPECT_EQ( 0u, pool.capacity() );
+    EXPECT_EQ( 0, pool.allocate( 0 ) );
+
+    std::vector<double*> blocks;
+    std::set<double*> unique;
+    for ( int i = 0; i < 20; ++i )
+    {
+        double* p = pool.allocate( 1 );
+        ASSERT_TRUE( p );
+        EXPECT_EQ( 0u, reinterpret_cast<uintptr_t>( p ) %
+                       ConcurrentPoolAllocator<double>::ALIGNMENT );
+        *p = i;
+        blocks.push_back( p );
+        unique.insert( p );
+    }
+    EXPECT_EQ( 20u, unique.size() );
+    EXPECT_EQ( 24u, pool.capacity() );
+
+    for ( int i = 0; i < 20; ++i )
+    {
+        EXPECT_EQ( i, *blocks[i] );
+        pool.free( blocks[i] );
+    }
+
+    // the most recently freed block is reused first
+    double* p = pool.allocate( 1 );
+    EXPECT_EQ( blocks.back(), p );
+    EXPECT_EQ( p, pool.reallocate( p, 1 ) );
+    EXPECT_EQ( 0, pool.reallocate( p, 0 ) );
+    EXPECT_EQ( 24u, pool.capacity() );
+}
+
+TEST( ConcurrentPoolAllocator, CrossThreadFree )
+{
+    using namespace gel::mem;
+
+    const int producers = 4;
+    const int rounds = 20000;
+    ConcurrentPoolAllocator<int> pool( 64 );
+
+    // producers allocate and publish blocks through a shared ring that
+    // consumers drain and free, so no block is freed by its allocator
+    const int ringSize = 1024;
+    std::atomic<int*> ring[ringSize];
+    for ( int i = 0; i < ringSize; ++i )
+    {
+        ring[i].store( 0 );
+    }
+    std::atomic<int> done( 0 );
+    std::atomic<int> freed( 0 );
+
+    std::vector<std::thread> workers;
+    for ( int t = 0; t < producers; ++t )
+    {
+        workers.push_back( std::thread( [&, t]() {
+            for ( int i = 0; i < rounds; ++i )
+            {
+                int* p = pool.allocate( 1 );
+                ASSERT_TRUE( p );
+                *p = t;
+                int* expected = 0;
+                int slot = ( t * rounds + i ) % ringSize;
+                while ( !ring[slot].compare_exchange_weak( expected, p ) )
+                {
+                    expected = 0;
+                    slot = ( slot + 1 ) % ringSize;
+                }
+            }
+            done.fetch_add( 1 );
+        } ) );
+        workers.push_back( std::thread( [&]() {
+            int slot = 0;
+            while ( done.load() < producers ||
+                    freed.load() < producers * rounds )
+            {
+                int* p = ring[slot].exchange( 0 );
+                if ( p )
+                {
+                    EXPECT_TRUE( *p >= 0 && *p < producers );
+                    *p = -1;
+                    pool.free( p );
+                    freed.fetch_add( 1 );
+                }
+                slot = ( slot + 1 ) % ringSize;
+            }
+        } ) );
+    }
+    for ( gel::Size i = 0; i < workers.size(); ++i )
+    {
+        workers[i].join();
+    }
+
+    EXPECT_EQ( producers * rounds, freed.load() );
+
+    // every slot is free again, so the whole capacity is distinct
+    std::set<int*> unique;
+    std::vector<int*> blocks;
+    for ( gel::Size i = 0; i < pool.capacity(); ++i )
+    {
+        int* p = pool.allocate( 1 );
+        blocks.push_back( p );
+        unique.insert( p );
+    }
+    EXPECT_EQ( pool.capacity(), unique.size() );
+    for ( gel::Size i = 0; i < blocks.size(); ++i )
+    {
+        pool.free( blocks[i] );
+    }
+}
@@ -0,0 +1,144 @@
+// frame_arena.t.cpp
+#include <stdint.h>
+#include <string.h>
+#include <gel/memory/frame_arena.h>
+#include <gel/memory/tracking_memory.h>
+#include <gtest/gtest.h>
+
+TEST( FrameArena, Allocate )
+{
+    using namespace gel::mem;
+
+    TrackingMemory memory;
+    {
+        FrameArena arena( 256, false, memory );
+        EXPECT_EQ( 1u, memory.stats().liveCount() );
+        EXPECT_FALSE( arena.isDoubleBuffered() );
+        EXPECT_EQ( 0u, arena.size() );
+        EXPECT_EQ( 0, arena.allocate( 0 ) );
+
+        char* a = static_cast<char*>( arena.allocate( 3 ) );
+        char* b = static_cast<char*>( arena.allocate( 5 ) );
+        char* c = static_cast<char*>( arena.allocate( 1, 64 ) );
+        ASSERT_TRUE( a && b && c );
+        EXPECT_EQ( 0u, reinterpret_cast<uintptr_t>( a ) % 16 );
+        EXPECT_EQ( a + 16, b );
+        EXPECT_EQ( 0u, reinterpret_cast<uintptr_t>( c ) % 64 );
+        EXPECT_EQ( 1u, memory.stats().liveCount() );
+
+        // the blocks are reclaimed at the end of the frame
+        arena.release( a );
+        arena.postick( 16.0f );
+        EXPECT_EQ( 0u, arena.size() );
+        EXPECT_EQ( a, arena.allocate( 3 ) );
+        EXPECT_EQ( 1u, memory.stats().liveCount() );
+    }
+    EXPECT_EQ( 0u, memory.stats().liveCount() );
+}
+
+TEST( FrameArena, Overflow )
+{
+    using namespace gel::mem;
+
+    TrackingMemory memory;
+    {
+        FrameArena arena( 64, false, memory );
+        for ( int i = 0; i < 10; ++i )
+        {
+            ASSERT_TRUE( arena.allocate( 32 ) );
+        }
+        EXPECT_EQ( 320u, arena.size() );
+        EXPECT_LT( 1u, memory.stats().liveCount() );
+
+        // the overflow is merged so the next frame fits in one chunk
+        arena.postick( 16.0f );
+        EXPECT_EQ( 1u, memory.stats().liveCount() );
+        EXPECT_EQ( 320u, arena.capacity() );
+        for ( int i = 0; i < 10; ++i )
+        {
+            ASSERT_TRUE( arena.allocate( 32 ) );
+        }
+        EXPECT_EQ( 1u, memory.stats().liveCount() );
+
+        void* big = arena.allocate( 1000 );
+        EXPECT_TRUE( big );
+        EXPECT_EQ( 2u, memory.stats().liveCount() );
+    }
+    EXPECT_EQ( 0u, memory.stats().liveCount() );
+}
+
+TEST( FrameArena, Reallocate )
+{
+    using namespace gel::mem;
+
+    FrameArena arena( 128 );
+    char* a = static_cast<char*>( arena.reallocate( 0, 8 ) );
+    ASSERT_TRUE( a );
+    memcpy( a, "abcdefg", 8 );
+
+    // the newest block grows in place
+    EXPECT_EQ( a, arena.reallocate( a, 40 ) );
+    EXPECT_EQ( 40u, arena.size() );
+
+    // an older block is copied
+    char* b = static_cast<char*>( arena.allocate( 8 ) );
+    memcpy( b, "1234567", 8 );
+    char* c = static_cast<char*>( arena.reallocate( a, 200 ) );
+    ASSERT_TRUE( c );
+    EXPECT_NE( a, c );
+    EXPECT_STREQ( "abcdefg", c );
+    EXPECT_STREQ( "1234567", b );
+
+    EXPECT_EQ( 0, arena.reallocate( c, 0 ) );
+}
+
+TEST( FrameArena, DoubleBuffered )
+{
+    using namespace gel::mem;
+
+    TrackingMemory memory;
+    {
+        FrameArena arena( 64, true, memory );
+        EXPECT_TRUE( arena.isDoubleBuffered() );
+        EXPECT_EQ( 2u, memory.stats().liveCount() );
+
+        int* first = static_cast<int*>( arena.allocate( sizeof( int ) ) );
+        *first = 7;
+        arena.postick( 16.0f );
+
+        // the previous frame survives the next one
+        int* second = static_cast<int*>( arena.allocate( sizeof( int ) ) );
+        *second = 9;
+        EXPECT_NE( first, second );
+        EXPECT_EQ( 7, *first );
+        arena.postick( 16.0f );
+
+        EXPECT_EQ( 9, *second );
+        EXPECT_EQ( first, arena.allocate( sizeof( int ) ) );
+        arena.postick( 16.0f );
+        EXPECT_EQ( second, arena.allocate( sizeof( int ) ) );
+        EXPECT_EQ( 2u, memory.stats().liveCount() );
+    }
+    EXPECT_EQ( 0u, memory.stats().liveCount() );
+}
+
+TEST( FrameAllocator, Typed )
+{
+    using namespace gel::mem;
+
+    FrameArena arena( 1024 );
+    FrameAllocator<double> allocator( arena );
+    EXPECT_EQ( &arena, &allocator.arena() );
+
+    double* values = allocator.allocate( 4 );
+    ASSERT_TRUE( values );
+    for ( int i = 0; i < 4; ++i )
+    {
+        values[i] = i * 0.5;
+    }
+
+    values = allocator.reallocate( values, 8 );
+    EXPECT_EQ( 1.5, values[3] );
+    allocator.free( values );
+    EXPECT_EQ( 64u, arena.size() );
+}
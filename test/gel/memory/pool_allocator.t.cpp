@@ -0,0 +1,118 @@
+// pool_allocator.t.cpp
+#include <stdint.h>
+#include <gel/memory/heap_memory.h>
+#include <gel/memory/pool_allocator.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+struct alignas( 64 ) Wide
+{
+    float v[3];
+};
+
+class CountingMemory: public gel::mem::IMemory
+{
+  public:
+    int blocks;
+
+    CountingMemory()
+        : blocks( 0 )
+    {
+    }
+
+    virtual void* allocate( gel::Size size )
+    {
+        ++blocks;
+        return gel::mem::HeapMemory::instance().allocate( size );
+    }
+
+    virtual void* reallocate( void* pointer, gel::Size size )
+    {
+        return gel::mem::HeapMemory::instance().reallocate( pointer, size );
+    }
+
+    virtual void release( void* pointer )
+    {
+        --blocks;
+        gel::mem::HeapMemory::instance().release( pointer );
+    }
+};
+
+} // End nspc anonymous
+
+TEST( PoolAllocator, AllocateFree )
+{
+    using namespace gel::mem;
+
+    CountingMemory memory;
+    {
+        PoolAllocator<double> pool( 4, memory );
+        EXPECT_EQ( 0u, pool.capacity() );
+
+        double* p[10];
+        for ( int i = 0; i < 10; ++i )
+        {
+            p[i] = pool.allocate( 1 );
+            ASSERT_TRUE( p[i] );
+            *p[i] = i;
+        }
+        EXPECT_EQ( 10u, pool.size() );
+        EXPECT_EQ( 12u, pool.capacity() );
+        EXPECT_EQ( 3, memory.blocks );
+        for ( int i = 0; i < 10; ++i )
+        {
+            EXPECT_EQ( i, *p[i] );
+        }
+
+        // freed slots are reused last in, first out
+        pool.free( p[3] );
+        pool.free( p[7] );
+        EXPECT_EQ( 8u, pool.size() );
+        EXPECT_EQ( p[7], pool.allocate( 1 ) );
+        EXPECT_EQ( p[3], pool.allocate( 1 ) );
+        EXPECT_EQ( 3, memory.blocks );
+        pool.free( 0 );
+    }
+    EXPECT_EQ( 0, memory.blocks );
+}
+
+TEST( PoolAllocator, Policy )
+{
+    using namespace gel::mem;
+
+    PoolAllocator<int> pool;
+    EXPECT_EQ( 0, pool.allocate( 0 ) );
+
+    int* p = pool.reallocate( 0, 1 );
+    ASSERT_TRUE( p );
+    EXPECT_EQ( p, pool.reallocate( p, 1 ) );
+    EXPECT_EQ( 0, pool.reallocate( p, 0 ) );
+    EXPECT_EQ( 0u, pool.size() );
+
+    pool.reserve( 100 );
+    EXPECT_LE( 100u, pool.capacity() );
+    const gel::Size capacity = pool.capacity();
+    for ( int i = 0; i < 100; ++i )
+    {
+        pool.allocate( 1 );
+    }
+    EXPECT_EQ( capacity, pool.capacity() );
+}
+
+TEST( PoolAllocator, Alignment )
+{
+    using namespace gel::mem;
+
+    EXPECT_EQ( 64u, PoolAllocator<Wide>::ALIGNMENT );
+    EXPECT_EQ( 64u, PoolAllocator<Wide>::SLOT_SIZE );
+    EXPECT_EQ( sizeof( void* ), PoolAllocator<char>::SLOT_SIZE );
+
+    PoolAllocator<Wide> pool( 3 );
+    for ( int i = 0; i < 10; ++i )
+    {
+        Wide* w = pool.allocate( 1 );
+        EXPECT_EQ( 0u, reinterpret_cast<uintptr_t>( w ) % 64 );
+    }
+}
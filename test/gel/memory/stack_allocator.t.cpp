@@ -0,0 +1,151 @@
+// stack_allocator.t.cpp
+#include <stdint.h>
+#include <string.h>
+#include <gel/memory/stack_allocator.h>
+#include <gtest/gtest.h>
+
+TEST( StackAllocator, MarkRewind )
+{
+    using namespace gel::mem;
+
+    StackAllocator stack( 256 );
+    EXPECT_EQ( 256u, stack.capacity() );
+    EXPECT_EQ( 0u, stack.size() );
+    EXPECT_EQ( 0, stack.allocate( 0 ) );
+
+    char* a = static_cast<char*>( stack.allocate( 10 ) );
+    ASSERT_TRUE( a );
+    EXPECT_EQ( 0u, reinterpret_cast<uintptr_t>( a ) % 16 );
+    EXPECT_EQ( 10u, stack.size() );
+
+    const StackAllocator::Marker marker = stack.mark();
+    char* b = static_cast<char*>( stack.allocate( 20 ) );
+    char* c = static_cast<char*>( stack.allocate( 1, 64 ) );
+    ASSERT_TRUE( b && c );
+    EXPECT_EQ( a + 16, b );
+    EXPECT_EQ( 0u, reinterpret_cast<uintptr_t>( c ) % 64 );
+
+    stack.rewind( marker );
+    EXPECT_EQ( 10u, stack.size() );
+    EXPECT_EQ( b, stack.allocate( 20 ) );
+
+    // only the newest block is popped by a release
+    stack.release( a );
+    EXPECT_EQ( 36u, stack.size() );
+    stack.release( b );
+    EXPECT_EQ( 16u, stack.size() );
+
+    EXPECT_EQ( 0, stack.allocate( 1000 ) );
+    stack.clear();
+    EXPECT_EQ( 0u, stack.size() );
+    EXPECT_EQ( a, stack.allocate( 256 ) );
+    EXPECT_EQ( 0, stack.allocate( 1 ) );
+}
+
+TEST( StackAllocator, Reallocate )
+{
+    using namespace gel::mem;
+
+    StackAllocator stack( 256 );
+    char* a = static_cast<char*>( stack.reallocate( 0, 8 ) );
+    ASSERT_TRUE( a );
+    memcpy( a, "abcdefg", 8 );
+
+    // the newest block is resized in place
+    EXPECT_EQ( a, stack.reallocate( a, 32 ) );
+    EXPECT_EQ( 32u, stack.size() );
+
+    // an older block is copied
+    char* b = static_cast<char*>( stack.allocate( 8 ) );
+    memcpy( b, "1234567", 8 );
+    char* c = static_cast<char*>( stack.reallocate( a, 64 ) );
+    ASSERT_TRUE( c );
+    EXPECT_NE( a, c );
+    EXPECT_STREQ( "abcdefg", c );
+    EXPECT_STREQ( "1234567", b );
+
+    EXPECT_EQ( 0, stack.reallocate( c, 1000 ) );
+    EXPECT_EQ( 0, stack.reallocate( c, 0 ) );
+    EXPECT_EQ( 48u, stack.size() );
+}
+
+TEST( StackAllocator, Scope )
+{
+    using namespace gel::mem;
+
+    StackAllocator stack( 256 );
+    stack.allocate( 16 );
+    {
+        StackScope<StackAllocator> scope( stack );
+        EXPECT_EQ( 16u, scope.marker() );
+        stack.allocate( 100 );
+        {
+            StackScope<StackAllocator> inner( stack );
+            stack.allocate( 100 );
+            EXPECT_EQ( 228u, stack.size() );
+        }
+        EXPECT_EQ( 116u, stack.size() );
+    }
+    EXPECT_EQ( 16u, stack.size() );
+}
+
+TEST( DoubleEndedStackAllocator, BothEnds )
+{
+    using namespace gel::mem;
+    typedef DoubleEndedStackAllocator Stack;
+
+    Stack stack( 256 );
+    char* bottom = static_cast<char*>( stack.allocate( 10 ) );
+    char* top = static_cast<char*>( stack.allocate( 10, Stack::TOP ) );
+    ASSERT_TRUE( bottom && top );
+    EXPECT_EQ( 0u, reinterpret_cast<uintptr_t>( top ) % 16 );
+    EXPECT_EQ( bottom + 240, top );
+    EXPECT_EQ( 10u, stack.size( Stack::BOTTOM ) );
+    EXPECT_EQ( 16u, stack.size( Stack::TOP ) );
+
+    // the ends share the buffer
+    EXPECT_EQ( 0, stack.allocate( 240, Stack::TOP ) );
+    EXPECT_TRUE( stack.allocate( 200, Stack::TOP, 8 ) );
+    EXPECT_EQ( 0, stack.allocate( 40 ) );
+
+    // each end is rewound on its own
+    Stack::Marker marker = stack.mark( Stack::TOP );
+    EXPECT_EQ( Stack::TOP, marker.end );
+    stack.clear( Stack::TOP );
+    EXPECT_EQ( 0u, stack.size( Stack::TOP ) );
+    EXPECT_EQ( 10u, stack.size( Stack::BOTTOM ) );
+
+    char* last = static_cast<char*>( stack.allocate( 4, Stack::TOP, 4 ) );
+    EXPECT_EQ( bottom + 252, last );
+    stack.release( last );
+    EXPECT_EQ( 0u, stack.size( Stack::TOP ) );
+    stack.release( bottom );
+    EXPECT_EQ( 0u, stack.size( Stack::BOTTOM ) );
+}
+
+TEST( DoubleEndedStackAllocator, Scope )
+{
+    using namespace gel::mem;
+    typedef DoubleEndedStackAllocator Stack;
+
+    Stack stack( 1024 );
+    {
+        StackScope<Stack> scratch( stack, stack.mark( Stack::TOP ) );
+        char* temp = static_cast<char*>( stack.allocate( 100, Stack::TOP ) );
+        memcpy( temp, "level", 6 );
+
+        // persistent data outlives the scratch scope
+        char* kept = static_cast<char*>(
+            stack.reallocate( stack.allocate( 4 ), 32 ) );
+        memcpy( kept, temp, 6 );
+        EXPECT_EQ( 32u, stack.size( Stack::BOTTOM ) );
+        EXPECT_LT( 0u, stack.size( Stack::TOP ) );
+
+        char* moved = static_cast<char*>( stack.reallocate( temp, 200 ) );
+        ASSERT_TRUE( moved );
+        EXPECT_LT( moved, temp );
+        EXPECT_STREQ( "level", moved );
+    }
+    EXPECT_EQ( 0u, stack.size( Stack::TOP ) );
+    EXPECT_EQ( 32u, stack.size( Stack::BOTTOM ) );
+}
@@ -0,0 +1,148 @@
+// tlsf_memory.t.cpp
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <gel/memory/tlsf_memory.h>
+#include <gtest/gtest.h>
+
+TEST( TlsfMemory, AllocateRelease )
+{
+    using namespace gel::mem;
+
+    TlsfMemory memory( 1 << 16 );
+    const gel::Size capacity = memory.capacity();
+    EXPECT_LT( gel::Size( 1 << 15 ), capacity );
+    EXPECT_EQ( 0u, memory.size() );
+    EXPECT_EQ( 0, memory.allocate( 0 ) );
+
+    char* a = static_cast<char*>( memory.allocate( 1 ) );
+    char* b = static_cast<char*>( memory.allocate( 1000 ) );
+    char* c = static_cast<char*>( memory.allocate( 33 ) );
+    ASSERT_TRUE( a && b && c );
+    EXPECT_EQ( 0u, reinterpret_cast<uintptr_t>( a ) % TlsfMemory::ALIGNMENT );
+    EXPECT_EQ( 0u, reinterpret_cast<uintptr_t>( b ) % TlsfMemory::ALIGNMENT );
+    EXPECT_EQ( 16u, TlsfMemory::blockSize( a ) );
+    EXPECT_EQ( 1008u, TlsfMemory::blockSize( b ) );
+    EXPECT_EQ( 48u, TlsfMemory::blockSize( c ) );
+    EXPECT_EQ( 16u + 1008u + 48u, memory.size() );
+
+    // a freed block is reused by an allocation that fits it
+    memory.release( b );
+    EXPECT_EQ( b, memory.allocate( 500 ) );
+
+    memory.release( a );
+    memory.release( b );
+    memory.release( c );
+    EXPECT_EQ( 0u, memory.size() );
+
+    // everything merged back into one block, which only the size classes
+    // above the request are searched for
+    char* all = static_cast<char*>(
+        memory.allocate( capacity - capacity / 16 ) );
+    EXPECT_TRUE( all );
+    EXPECT_EQ( 0, memory.allocate( capacity / 8 ) );
+    memory.release( all );
+}
+
+TEST( TlsfMemory, Reallocate )
+{
+    using namespace gel::mem;
+
+    TlsfMemory memory( 1 << 16 );
+    char* a = static_cast<char*>( memory.reallocate( 0, 64 ) );
+    ASSERT_TRUE( a );
+    strcpy( a, "segregated" );
+
+    // the block grows into the free space after it and shrinks in place
+    EXPECT_EQ( a, memory.reallocate( a, 4096 ) );
+    EXPECT_EQ( 4096u, TlsfMemory::blockSize( a ) );
+    EXPECT_EQ( a, memory.reallocate( a, 100 ) );
+    EXPECT_EQ( 112u, TlsfMemory::blockSize( a ) );
+    EXPECT_EQ( 112u, memory.size() );
+
+    // a block that is followed by an allocated one moves
+    char* b = static_cast<char*>( memory.allocate( 16 ) );
+    char* c = static_cast<char*>( memory.reallocate( a, 2000 ) );
+    ASSERT_TRUE( c );
+    EXPECT_NE( a, c );
+    EXPECT_STREQ( "segregated", c );
+    EXPECT_EQ( 16u + 2000u, memory.size() );
+
+    EXPECT_EQ( 0, memory.reallocate( c, 1 << 20 ) );
+    EXPECT_EQ( 0, memory.reallocate( c, 0 ) );
+    memory.release( b );
+    EXPECT_EQ( 0u, memory.size() );
+}
+
+TEST( TlsfMemory, AddPool )
+{
+    using namespace gel::mem;
+
+    TlsfMemory memory( 4096 );
+    EXPECT_EQ( 0, memory.allocate( 8192 ) );
+
+    const gel::Size capacity = memory.capacity();
+    EXPECT_TRUE( memory.addPool( 1 << 14 ) );
+    EXPECT_LT( capacity + 8192, memory.capacity() );
+
+    void* big = memory.allocate( 8192 );
+    void* small = memory.allocate( 2048 );
+    EXPECT_TRUE( big && small );
+    memory.release( big );
+    memory.release( small );
+    EXPECT_EQ( 0u, memory.size() );
+}
+
+TEST( TlsfMemory, Stress )
+{
+    using namespace gel::mem;
+
+    TlsfMemory memory( 1 << 20 );
+    std::vector<unsigned char*> blocks;
+    std::vector<gel::Size> sizes;
+    srand( 42 );
+    for ( int i = 0; i < 20000; ++i )
+    {
+        if ( blocks.empty() || rand() % 3 != 0 )
+        {
+            const gel::Size size = 1 + rand() % ( rand() % 8 ? 256 : 16384 );
+            unsigned char* p =
+                static_cast<unsigned char*>( memory.allocate( size ) );
+            if ( !p )
+            {
+                continue;
+            }
+            memset( p, static_cast<int>( blocks.size() & 0xFF ), size );
+            blocks.push_back( p );
+            sizes.push_back( size );
+        }
+        else
+        {
+            // check the contents survived before releasing a random block
+            const gel::Size j = rand() % blocks.size();
+            const unsigned char fill = static_cast<unsigned char>( j & 0xFF );
+            ASSERT_EQ( fill, blocks[j][0] );
+            ASSERT_EQ( fill, blocks[j][sizes[j] - 1] );
+            memory.release( blocks[j] );
+
+            blocks[j] = blocks.back();
+            sizes[j] = sizes.back();
+            blocks.pop_back();
+            sizes.pop_back();
+            if ( j < blocks.size() )
+            {
+                memset( blocks[j], static_cast<int>( j & 0xFF ), sizes[j] );
+            }
+        }
+    }
+
+    for ( gel::Size j = 0; j < blocks.size(); ++j )
+    {
+        memory.release( blocks[j] );
+    }
+    EXPECT_EQ( 0u, memory.size() );
+    void* all = memory.allocate( memory.capacity() - memory.capacity() / 16 );
+    EXPECT_TRUE( all );
+    memory.release( all );
+}
@@ -0,0 +1,196 @@
+// tracking_memory.t.cpp
+#include <string.h>
+#include <gel/memory/pool_allocator.h>
+#include <gel/memory/tracking_memory.h>
+#include <gtest/gtest.h>
+
+TEST( TrackingMemory, AllocateRelease )
+{
+    using namespace gel::mem;
+
+    TrackingMemory memory;
+    const AllocationStats& stats = memory.stats();
+    EXPECT_EQ( 0u, stats.liveBytes() );
+    EXPECT_EQ( 0u, stats.liveCount() );
+
+    char* a = static_cast<char*>( memory.allocate( 100 ) );
+    char* b = static_cast<char*>( memory.allocate( 1000 ) );
+    ASSERT_TRUE( a && b );
+    EXPECT_EQ( 100u, TrackingMemory::blockSize( a ) );
+    EXPECT_EQ( 1100u, stats.liveBytes() );
+    EXPECT_EQ( 1100u, stats.peakBytes() );
+    EXPECT_EQ( 2u, stats.liveCount() );
+
+    // the histogram counts the requested sizes by power of two
+    EXPECT_EQ( 0u, AllocationStats::bucketOf( 0 ) );
+    EXPECT_EQ( 1u, AllocationStats::bucketOf( 1 ) );
+    EXPECT_EQ( 7u, AllocationStats::bucketOf( 100 ) );
+    EXPECT_EQ( 10u, AllocationStats::bucketOf( 1023 ) );
+    EXPECT_EQ( 11u, AllocationStats::bucketOf( 1024 ) );
+    EXPECT_EQ( 63u, AllocationStats::bucketOf( ~gel::Size( 0 ) ) );
+    EXPECT_EQ( 1u, stats.histogram( 7 ) );
+    EXPECT_EQ( 1u, stats.histogram( 10 ) );
+
+    // reallocating keeps the contents and replaces the recorded size
+    strcpy( a, "tracked" );
+    a = static_cast<char*>( memory.reallocate( a, 4000 ) );
+    ASSERT_TRUE( a );
+    EXPECT_STREQ( "tracked", a );
+    EXPECT_EQ( 4000u, TrackingMemory::blockSize( a ) );
+    EXPECT_EQ( 5000u, stats.liveBytes() );
+    EXPECT_EQ( 2u, stats.liveCount() );
+    EXPECT_EQ( 3u, stats.totalCount() );
+
+    memory.release( a );
+    memory.release( b );
+    memory.release( 0 );
+    EXPECT_EQ( 0u, stats.liveBytes() );
+    EXPECT_EQ( 0u, stats.liveCount() );
+    EXPECT_EQ( 5000u, stats.peakBytes() );
+
+    memory.stats().resetPeaks();
+    EXPECT_EQ( 0u, stats.peakBytes() );
+}
+
+TEST( TrackingMemory, Tags )
+{
+    using namespace gel::mem;
+
+    enum { UNTAGGED, AUDIO, TEXTURES };
+
+    TrackingMemory memory;
+    memory.stats().setTagName( AUDIO, "audio" );
+    memory.stats().setTagName( TEXTURES, "textures" );
+    const AllocationStats& stats = memory.stats();
+    EXPECT_STREQ( "audio", stats.tagName( AUDIO ) );
+    EXPECT_EQ( 0, stats.tagName( UNTAGGED ) );
+
+    void* a = memory.allocate( 10 );
+    memory.setTag( AUDIO );
+    EXPECT_EQ( unsigned( AUDIO ), memory.tag() );
+    void* b = memory.allocate( 20 );
+    void* c = memory.allocate( 30, TEXTURES );
+    EXPECT_EQ( 10u, stats.tagBytes( UNTAGGED ) );
+    EXPECT_EQ( 20u, stats.tagBytes( AUDIO ) );
+    EXPECT_EQ( 30u, stats.tagBytes( TEXTURES ) );
+    EXPECT_EQ( 1u, stats.tagCount( TEXTURES ) );
+
+    // a reallocation stays with the tag of the block
+    memory.setTag( UNTAGGED );
+    c = memory.reallocate( c, 300 );
+    EXPECT_EQ( 300u, stats.tagBytes( TEXTURES ) );
+    EXPECT_EQ( 10u, stats.tagBytes( UNTAGGED ) );
+
+    memory.release( c );
+    EXPECT_EQ( 0u, stats.tagBytes( TEXTURES ) );
+    EXPECT_EQ( 0u, stats.tagCount( TEXTURES ) );
+    EXPECT_EQ( 300u, stats.tagPeak( TEXTURES ) );
+    memory.release( a );
+    memory.release( b );
+    EXPECT_EQ( 0u, stats.liveBytes() );
+}
+
+TEST( TrackingAllocator, AllocateFree )
+{
+    using namespace gel::mem;
+
+    TrackingAllocator<int> allocator;
+    const AllocationStats& stats = allocator.stats();
+    int* a = allocator.allocate( 10 );
+    ASSERT_TRUE( a );
+    for ( int i = 0; i < 10; ++i )
+    {
+        a[i] = i;
+    }
+    EXPECT_EQ( 40u, stats.liveBytes() );
+
+    a = allocator.reallocate( a, 100 );
+    ASSERT_TRUE( a );
+    EXPECT_EQ( 9, a[9] );
+    EXPECT_EQ( 400u, stats.liveBytes() );
+
+    int* b = allocator.allocate( 5, 3 );
+    EXPECT_EQ( 20u, stats.tagBytes( 3 ) );
+    allocator.free( a );
+    allocator.free( b );
+    EXPECT_EQ( 0u, stats.liveBytes() );
+    EXPECT_EQ( 420u, stats.peakBytes() );
+}
+
+TEST( TrackingAllocator, SingleSlotPool )
+{
+    using namespace gel::mem;
+
+    // a pool only serves one instance per block, which is all it is asked
+    PoolAllocator<int> pool( 4 );
+    TrackingAllocator<int> allocator( pool );
+    int* blocks[10];
+    for ( int i = 0; i < 10; ++i )
+    {
+        blocks[i] = allocator.allocate( 1, i % 2 );
+        ASSERT_TRUE( blocks[i] );
+        *blocks[i] = i;
+    }
+    EXPECT_EQ( 40u, allocator.stats().liveBytes() );
+    EXPECT_EQ( 5u, allocator.stats().tagCount( 1 ) );
+
+    EXPECT_EQ( blocks[3], allocator.reallocate( blocks[3], 1 ) );
+    for ( int i = 0; i < 10; ++i )
+    {
+        EXPECT_EQ( i, *blocks[i] );
+        allocator.free( blocks[i] );
+    }
+    EXPECT_EQ( 0u, allocator.stats().liveBytes() );
+    EXPECT_EQ( 0u, allocator.stats().liveCount() );
+}
+
+TEST( TrackingAllocator, Untracked )
+{
+    using namespace gel::mem;
+
+    // blocks from the wrapped allocator are passed on without being counted
+    TrackingAllocator<int> allocator;
+    int* a = HeapAllocator<int>::instance().allocate( 4 );
+    ASSERT_TRUE( a );
+    a = allocator.reallocate( a, 8 );
+    ASSERT_TRUE( a );
+    EXPECT_EQ( 0u, allocator.stats().liveBytes() );
+    allocator.free( a );
+    EXPECT_EQ( 0u, allocator.stats().liveCount() );
+}
+
+TEST( TrackingTable, InsertErase )
+{
+    using gel::mem::detail::TrackingRecord;
+    using gel::mem::detail::TrackingTable;
+
+    // enough keys to grow several times, with runs that erase must shift
+    static char blocks[1000];
+    TrackingTable table;
+    for ( unsigned i = 0; i < 1000; ++i )
+    {
+        const TrackingRecord record = { i, i % 7 };
+        ASSERT_TRUE( table.insert( blocks + i, record ) );
+    }
+    const TrackingRecord duplicate = { 0, 0 };
+    EXPECT_FALSE( table.insert( blocks, duplicate ) );
+    EXPECT_EQ( 1000u, table.size() );
+
+    for ( unsigned i = 0; i < 1000; i += 2 )
+    {
+        ASSERT_TRUE( table.erase( blocks + i ) );
+    }
+    EXPECT_FALSE( table.erase( blocks ) );
+    EXPECT_EQ( 500u, table.size() );
+
+    for ( unsigned i = 0; i < 1000; ++i )
+    {
+        TrackingRecord record = { 0, 0 };
+        ASSERT_EQ( i % 2 == 1, table.get( blocks + i, record ) );
+        if ( i % 2 )
+        {
+            EXPECT_EQ( i, record.size );
+            EXPECT_EQ( i % 7, record.tag );
+        }
+    }
+}
@@ -0,0 +1,131 @@
+// virtual_memory.t.cpp
+#include <stdint.h>
+#include <string.h>
+#include <gel/memory/virtual_memory.h>
+#include <gtest/gtest.h>
+
+TEST( VirtualMemory, AllocateRelease )
+{
+    using namespace gel::mem;
+
+    VirtualMemory memory( 1 << 20 );
+    const gel::Size page = memory.pageSize();
+    ASSERT_TRUE( memory.base() );
+    EXPECT_EQ( VirtualMemory::SMALL_PAGES, memory.mode() );
+    EXPECT_EQ( VirtualMemory::systemPageSize(), page );
+    EXPECT_EQ( gel::Size( 1 << 20 ), memory.reserved() );
+    EXPECT_EQ( 0u, memory.committed() );
+    EXPECT_EQ( 0, memory.allocate( 0 ) );
+
+    char* a = static_cast<char*>( memory.allocate( 100 ) );
+    ASSERT_TRUE( a );
+    EXPECT_EQ( 0u, reinterpret_cast<uintptr_t>( a ) % VirtualMemory::HEADER );
+    memset( a, 1, 100 );
+    EXPECT_EQ( page, memory.committed() );
+
+    char* b = static_cast<char*>( memory.allocate( 2 * page ) );
+    ASSERT_TRUE( b );
+    memset( b, 2, 2 * page );
+    EXPECT_EQ( 4 * page, memory.committed() );
+
+    // a released run keeps its first page for the free list
+    memory.release( a );
+    EXPECT_EQ( 4 * page, memory.committed() );
+    char* c = static_cast<char*>( memory.allocate( 10 ) );
+    EXPECT_EQ( a, c );
+
+    // the highest run goes back to the top
+    memory.release( b );
+    EXPECT_EQ( page, memory.committed() );
+    memory.release( c );
+    EXPECT_EQ( 0u, memory.committed() );
+    EXPECT_EQ( 0, memory.allocate( 2 << 20 ) );
+}
+
+TEST( VirtualMemory, Coalesce )
+{
+    using namespace gel::mem;
+
+    VirtualMemory memory( 1 << 20 );
+    const gel::Size page = memory.pageSize();
+    char* blocks[4];
+    for ( int i = 0; i < 4; ++i )
+    {
+        blocks[i] = static_cast<char*>( memory.allocate( 1 ) );
+        ASSERT_TRUE( blocks[i] );
+    }
+    EXPECT_EQ( 4 * page, memory.committed() );
+
+    // neighbouring free runs merge in either order
+    memory.release( blocks[0] );
+    memory.release( blocks[2] );
+    memory.release( blocks[1] );
+    EXPECT_EQ( 2 * page, memory.committed() );
+
+    char* big = static_cast<char*>( memory.allocate( 2 * page ) );
+    EXPECT_EQ( blocks[0], big );
+    memset( big, 3, 2 * page );
+    EXPECT_EQ( 4 * page, memory.committed() );
+
+    // releasing the top also returns the free run below it
+    memory.release( big );
+    memory.release( blocks[3] );
+    EXPECT_EQ( 0u, memory.committed() );
+    EXPECT_EQ( blocks[0], memory.allocate( 1 ) );
+}
+
+TEST( VirtualMemory, Reallocate )
+{
+    using namespace gel::mem;
+
+    VirtualMemory memory( 1 << 20 );
+    const gel::Size page = memory.pageSize();
+    char* a = static_cast<char*>( memory.reallocate( 0, 16 ) );
+    ASSERT_TRUE( a );
+    strcpy( a, "virtual" );
+
+    // the highest block grows in place
+    EXPECT_EQ( a, memory.reallocate( a, 3 * page ) );
+    EXPECT_EQ( 4 * page, memory.committed() );
+    memset( a + page, 4, 2 * page );
+
+    // shrinking returns the tail
+    char* b = static_cast<char*>( memory.allocate( 1 ) );
+    EXPECT_EQ( a, memory.reallocate( a, page ) );
+    EXPECT_EQ( 4 * page, memory.committed() );
+
+    // a lower block that cannot grow is moved
+    char* c = static_cast<char*>( memory.reallocate( a, 8 * page ) );
+    ASSERT_TRUE( c );
+    EXPECT_NE( a, c );
+    EXPECT_STREQ( "virtual", c );
+    EXPECT_EQ( 0, memory.reallocate( c, 0 ) );
+    memory.release( b );
+    EXPECT_EQ( 0u, memory.committed() );
+}
+
+TEST( VirtualMemory, HugePages )
+{
+    using namespace gel::mem;
+
+    VirtualMemory memory( 4 << 20, VirtualMemory::TRANSPARENT_HUGE_PAGES );
+    ASSERT_TRUE( memory.base() );
+    EXPECT_EQ( VirtualMemory::HUGE_PAGE_SIZE, memory.pageSize() );
+    EXPECT_EQ( 0u, reinterpret_cast<uintptr_t>( memory.base() ) %
+                   VirtualMemory::HUGE_PAGE_SIZE );
+
+    char* a = static_cast<char*>( memory.allocate( 1 << 20 ) );
+    ASSERT_TRUE( a );
+    memset( a, 5, 1 << 20 );
+    EXPECT_EQ( VirtualMemory::HUGE_PAGE_SIZE, memory.committed() );
+    memory.release( a );
+
+    // explicit huge pages fall back when the system has none configured
+    VirtualMemory huge( 2 << 20, VirtualMemory::HUGE_PAGES );
+    ASSERT_TRUE( huge.base() );
+    EXPECT_NE( VirtualMemory::SMALL_PAGES, huge.mode() );
+    char* b = static_cast<char*>( huge.allocate( 64 ) );
+    ASSERT_TRUE( b );
+    b[0] = 1;
+    huge.release( b );
+}